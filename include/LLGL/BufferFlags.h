@@ -99,6 +99,28 @@ struct BufferFlags
         \see RenderSystem::WriteBuffer
         */
         DynamicUsage        = (1 << 2),
+
+        /**
+        \brief Hint to the renderer that the buffer will be streamed from the CPU, i.e. updated once or several times per frame.
+        \remarks This is useful for per-frame constant buffers and for vertex buffers whose content is regenerated every frame.
+        With OpenGL, RenderSystem::WriteBuffer and RenderSystem::MapBuffer with CPUAccess::WriteDiscard write the data into a persistently mapped ring buffer
+        (if GL_ARB_buffer_storage is supported) and copy it into the buffer on the GPU, so the CPU does not synchronize with the driver.
+        Other render systems treat this flag like BufferFlags::DynamicUsage.
+        \see OpenGLRendererConfiguration::streamingBufferSize
+        \see RenderSystem::WriteBuffer
+        */
+        StreamingUsage      = (1 << 3),
+
+        /**
+        \brief Specifies that the buffer can be used as source for indirect draw and dispatch arguments.
+        \remarks This flag can be used with any buffer type, but it is typically used with storage buffers,
+        so the arguments can be generated on the GPU by a compute shader.
+        \see CommandBuffer::DrawIndirect
+        \see CommandBuffer::DrawIndexedIndirect
+        \see CommandBuffer::DispatchIndirect
+        \see DrawIndirectArguments
+        */
+        IndirectArguments   = (1 << 4),
     };
 };
 
@@ -17,6 +17,7 @@
 #include "Buffer.h"
 #include "BufferArray.h"
 #include "ResourceHeap.h"
+#include "Texture.h"
 #include "PipelineLayoutFlags.h"
 
 #include "RenderTarget.h"
@@ -164,6 +165,61 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments) = 0;
 
+        /* ----- Copy ----- */
+
+        /**
+        \brief Writes the specified data into the buffer directly within the command stream.
+        \param[in] dstBuffer Specifies the destination buffer.
+        \param[in] dstOffset Specifies the offset (in bytes) of the destination range within the buffer. This must be a multiple of 4.
+        \param[in] data Raw pointer to the data which is to be written. This must not be null!
+        \param[in] dataSize Specifies the size (in bytes) of the data. This must be a multiple of 4.
+        \remarks This function is intended for small data (at most 65536 bytes) that is updated frequently, e.g. constant buffers.
+        The data is copied into the command buffer when this function is called, so the data pointer does not need to remain valid.
+        For larger data, use RenderSystem::WriteBuffer or CopyBuffer.
+        \see RenderSystem::WriteBuffer
+        */
+        virtual void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) = 0;
+
+        /**
+        \brief Copies a range of the source buffer into the destination buffer on the GPU.
+        \param[in] dstBuffer Specifies the destination buffer.
+        \param[in] dstOffset Specifies the offset (in bytes) of the destination range within the destination buffer.
+        \param[in] srcBuffer Specifies the source buffer.
+        \param[in] srcOffset Specifies the offset (in bytes) of the source range within the source buffer.
+        \param[in] size Specifies the size (in bytes) of the range to copy.
+        \remarks If the source and destination buffers are the same, the ranges must not overlap.
+        With the Vulkan backend, copy commands must not be recorded while a render target is set,
+        because the render pass has to be interrupted and the content of its attachments might get lost.
+        */
+        virtual void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) = 0;
+
+        /**
+        \brief Copies the content of the source buffer into a region of the destination texture on the GPU.
+        \param[in] dstTexture Specifies the destination texture.
+        \param[in] dstRegion Specifies the MIP-map level, offset, and extent of the destination region within the texture.
+        \param[in] srcBuffer Specifies the source buffer.
+        \param[in] srcOffset Specifies the offset (in bytes) of the texel data within the source buffer.
+        \remarks The source buffer must contain the texels tightly packed in the hardware format of the destination texture.
+        This is not supported by the Direct3D 11 backend.
+        \see SubTextureDescriptor
+        \see CopyBuffer
+        */
+        virtual void CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset) = 0;
+
+        /**
+        \brief Copies a region of the source texture into a region of the destination texture on the GPU.
+        \param[in] dstTexture Specifies the destination texture.
+        \param[in] dstRegion Specifies the MIP-map level, offset, and extent of the destination region within the destination texture.
+        The extent also specifies the size of the source region.
+        \param[in] srcTexture Specifies the source texture. This must have the same format as the destination texture.
+        \param[in] srcMipLevel Specifies the MIP-map level of the source region.
+        \param[in] srcOffset Specifies the offset of the source region within the source texture (with the same array layer convention as SubTextureDescriptor::offset).
+        \remarks Both textures must not be multi-sampled.
+        \see SubTextureDescriptor
+        \see CopyBuffer
+        */
+        virtual void CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset) = 0;
+
         /* ----- Input Assembly ------ */
 
         /**
@@ -246,6 +302,40 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) = 0;
 
+        /**
+        \brief Binds the specified resource heap to the graphics pipeline with dynamic offsets for its buffer bindings.
+        \param[in] resourceHeap Specifies the resource heap that contains all shader resources that will be bound to the shader pipeline.
+        \param[in] firstSet Specifies the set number of the first layout descriptor.
+        \param[in] numDynamicOffsets Specifies the number of dynamic offsets. This must be equal to the sum of the array sizes of all layout bindings
+        with the BindingFlags::DynamicOffset flag in the pipeline layout of the resource heap.
+        \param[in] dynamicOffsets Pointer to an array of byte offsets, one for each array element of each dynamic binding in ascending order of their binding slots.
+        Each offset must be a multiple of RenderingLimits::minConstantBufferOffsetAlignment for constant buffers
+        and of RenderingLimits::minStorageBufferOffsetAlignment for storage buffers.
+        \remarks This allows to select a different range of the same buffer for each draw call (e.g. per-object constants within a single large constant buffer)
+        without creating a new resource heap or updating any descriptors.
+        \note Only supported with: Vulkan.
+        \throws std::runtime_error If 'numDynamicOffsets' is greater than zero and the render system does not support dynamic offsets.
+        \see BindingFlags::DynamicOffset
+        \see ResourceViewDescriptor::bufferRange
+        */
+        virtual void SetGraphicsResourceHeapWithOffsets(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        );
+
+        /**
+        \brief Binds the specified resource heap to the compute pipeline with dynamic offsets for its buffer bindings.
+        \see SetGraphicsResourceHeapWithOffsets
+        */
+        virtual void SetComputeResourceHeapWithOffsets(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        );
+
         /* ----- Render Targets ----- */
 
         /**
@@ -297,6 +387,17 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetComputePipeline(ComputePipeline& computePipeline) = 0;
 
+        /**
+        \brief Queries the statistics about issued and skipped state changes of this command buffer.
+        \param[out] statistics Specifies the output parameter for the accumulated statistics.
+        \return True if the render system tracks redundant state changes, otherwise the return value is false and 'statistics' is not modified.
+        \remarks The debug layer uses this function to report the state changes via the RenderingProfiler.
+        \note Only supported with: OpenGL.
+        \see RenderingProfiler::pipelineStateChanges
+        \see RenderingProfiler::pipelineStateChangesSkipped
+        */
+        virtual bool QueryStateChangeStatistics(StateChangeStatistics& statistics) const;
+
         /* ----- Queries ----- */
 
         /**
@@ -428,6 +529,59 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance) = 0;
 
+        //! \see DrawIndirect(Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+        virtual void DrawIndirect(Buffer& buffer, std::uint64_t offset) = 0;
+
+        /**
+        \brief Draws primitives from the currently set vertex buffer with the arguments of the specified buffer.
+        \param[in] buffer Specifies the buffer which contains the draw arguments. This buffer must have been created with the BufferFlags::IndirectArguments flag.
+        \param[in] offset Specifies the offset (in bytes) of the first draw arguments within the buffer. This must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands.
+        \param[in] stride Specifies the stride (in bytes) between consecutive draw arguments. This must be a multiple of 4 and at least <code>sizeof(DrawIndirectArguments)</code>.
+        \remarks Each draw command reads its arguments in the layout of the DrawIndirectArguments structure.
+        \see DrawIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawing
+        */
+        virtual void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
+
+        /**
+        \brief Draws primitives from the currently set vertex buffer with the arguments and the number of draw commands from the specified buffers.
+        \param[in] buffer Specifies the buffer which contains the draw arguments. This buffer must have been created with the BufferFlags::IndirectArguments flag.
+        \param[in] offset Specifies the offset (in bytes) of the first draw arguments within the buffer. This must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer which contains the number of draw commands as 32-bit unsigned integer.
+        This buffer must have been created with the BufferFlags::IndirectArguments flag.
+        \param[in] countOffset Specifies the offset (in bytes) of the number of draw commands within the count buffer. This must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands. The actual number is the minimum of this value and the value in the count buffer.
+        \param[in] stride Specifies the stride (in bytes) between consecutive draw arguments.
+        \throws std::runtime_error If the render system does not support this function (see RenderingFeatures::hasIndirectCountDrawing).
+        \see DrawIndirect(Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+        \see RenderingFeatures::hasIndirectCountDrawing
+        */
+        virtual void DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) = 0;
+
+        //! \see DrawIndexedIndirect(Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+        virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) = 0;
+
+        /**
+        \brief Draws primitives from the currently set vertex- and index buffers with the arguments of the specified buffer.
+        \param[in] buffer Specifies the buffer which contains the draw arguments. This buffer must have been created with the BufferFlags::IndirectArguments flag.
+        \param[in] offset Specifies the offset (in bytes) of the first draw arguments within the buffer. This must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands.
+        \param[in] stride Specifies the stride (in bytes) between consecutive draw arguments. This must be a multiple of 4 and at least <code>sizeof(DrawIndexedIndirectArguments)</code>.
+        \remarks Each draw command reads its arguments in the layout of the DrawIndexedIndirectArguments structure.
+        \see DrawIndexedIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawing
+        */
+        virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
+
+        /**
+        \brief Draws primitives from the currently set vertex- and index buffers with the arguments and the number of draw commands from the specified buffers.
+        \see DrawIndirectCount
+        \see DrawIndexedIndirect(Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+        \see RenderingFeatures::hasIndirectCountDrawing
+        */
+        virtual void DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) = 0;
+
         /* ----- Compute ----- */
 
         /**
@@ -440,6 +594,16 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) = 0;
 
+        /**
+        \brief Dispatches a compute command with the number of thread groups from the specified buffer.
+        \param[in] buffer Specifies the buffer which contains the dispatch arguments. This buffer must have been created with the BufferFlags::IndirectArguments flag.
+        \param[in] offset Specifies the offset (in bytes) of the dispatch arguments within the buffer. This must be a multiple of 4.
+        \remarks The arguments are read in the layout of the DispatchIndirectArguments structure.
+        \see DispatchIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawing
+        */
+        virtual void DispatchIndirect(Buffer& buffer, std::uint64_t offset) = 0;
+
     protected:
 
         CommandBuffer() = default;
@@ -10,6 +10,7 @@
 
 
 #include "ColorRGBA.h"
+#include <cstdint>
 
 
 namespace LLGL
@@ -133,6 +134,77 @@ struct AttachmentClear
     ClearValue      clearValue;
 };
 
+/**
+\brief Statistics about the state changes a command buffer has issued and skipped.
+\remarks Render systems that eliminate redundant state changes (such as the OpenGL renderer) accumulate these values.
+They are accumulated per command buffer and never reset, so only the difference between two queries is meaningful.
+Commands of a deferred command buffer are only accumulated when the command buffer is submitted (see CommandQueue::Submit).
+Each value counts state groups (i.e. depth, stencil, rasterizer, blend, and logic operation states), not individual graphics API calls.
+\see CommandBuffer::QueryStateChangeStatistics
+*/
+struct StateChangeStatistics
+{
+    //! Number of state groups that have been submitted to the graphics API.
+    std::uint64_t issuedStateChanges    = 0;
+
+    //! Number of state groups that have been skipped, because they were already bound.
+    std::uint64_t skippedStateChanges   = 0;
+};
+
+/**
+\brief Layout of the arguments for a single indirect draw command.
+\remarks This structure must be written into a buffer that was created with the BufferFlags::IndirectArguments flag.
+\see CommandBuffer::DrawIndirect
+*/
+struct DrawIndirectArguments
+{
+    //! Number of vertices to generate.
+    std::uint32_t   numVertices;
+
+    //! Number of instances to generate.
+    std::uint32_t   numInstances;
+
+    //! Zero-based offset of the first vertex from the vertex buffer.
+    std::uint32_t   firstVertex;
+
+    //! Zero-based offset of the first instance.
+    std::uint32_t   firstInstance;
+};
+
+/**
+\brief Layout of the arguments for a single indirect indexed draw command.
+\remarks This structure must be written into a buffer that was created with the BufferFlags::IndirectArguments flag.
+\see CommandBuffer::DrawIndexedIndirect
+*/
+struct DrawIndexedIndirectArguments
+{
+    //! Number of indices to generate.
+    std::uint32_t   numIndices;
+
+    //! Number of instances to generate.
+    std::uint32_t   numInstances;
+
+    //! Zero-based offset of the first index from the index buffer.
+    std::uint32_t   firstIndex;
+
+    //! Base vertex offset (positive or negative) which is added to each index from the index buffer.
+    std::int32_t    vertexOffset;
+
+    //! Zero-based offset of the first instance.
+    std::uint32_t   firstInstance;
+};
+
+/**
+\brief Layout of the arguments for an indirect compute dispatch command.
+\remarks This structure must be written into a buffer that was created with the BufferFlags::IndirectArguments flag.
+\see CommandBuffer::DispatchIndirect
+*/
+struct DispatchIndirectArguments
+{
+    //! Number of thread groups in the X-, Y-, and Z-dimension.
+    std::uint32_t   numThreadGroups[3];
+};
+
 /**
 \brief Graphics API dependent state descriptor for the OpenGL renderer.
 \remarks This descriptor is used to compensate a few differences between OpenGL and the other rendering APIs.
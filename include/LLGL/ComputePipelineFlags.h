@@ -15,6 +15,7 @@ namespace LLGL
 
 class ShaderProgram;
 class PipelineLayout;
+class PipelineCache;
 
 //! Compute pipeline descriptor structure.
 struct ComputePipelineDescriptor
@@ -42,6 +43,14 @@ struct ComputePipelineDescriptor
     \note Only supported with: Vulkan, Direct3D 12
     */
     PipelineLayout* pipelineLayout  = nullptr;
+
+    /**
+    \brief Pointer to an optional pipeline cache the compute pipeline is looked up in and stored to.
+    \remarks If this is null, the render system uses its own internal pipeline cache (if supported).
+    \see RenderSystem::CreatePipelineCache
+    \note Only supported with: Vulkan
+    */
+    PipelineCache*  pipelineCache   = nullptr;
 };
 
 
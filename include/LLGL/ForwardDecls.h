@@ -22,6 +22,7 @@ class CommandQueue;
 class ComputePipeline;
 class Fence;
 class GraphicsPipeline;
+class PipelineCache;
 class PipelineLayout;
 class Query;
 class RenderContext;
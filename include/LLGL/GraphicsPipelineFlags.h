@@ -22,6 +22,7 @@ namespace LLGL
 
 class ShaderProgram;
 class PipelineLayout;
+class PipelineCache;
 class RenderTarget;
 
 
@@ -614,6 +615,14 @@ struct GraphicsPipelineDescriptor
     PipelineLayout*         pipelineLayout      = nullptr;
     #endif // /TODO
 
+    /**
+    \brief Pointer to an optional pipeline cache the graphics pipeline is looked up in and stored to.
+    \remarks If this is null, the render system uses its own internal pipeline cache (if supported).
+    \see RenderSystem::CreatePipelineCache
+    \note Only supported with: Vulkan
+    */
+    PipelineCache*          pipelineCache       = nullptr;
+
     #if 1 // TODO: maybe find a better way to determine compatible vkRenderPass object.
     /**
     \brief Pointer to an optional render target that will be used with this graphics pipeline.
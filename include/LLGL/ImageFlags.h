@@ -195,7 +195,10 @@ LLGL_EXPORT bool FindSuitableImageFormat(const Format format, ImageFormat& image
 \param[in] threadCount Specifies the number of threads to use for conversion.
 If this is less than 2, no multi-threading is used. If this is 'Constants::maxThreadCount',
 the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+The work is distributed across the shared job pool (see JobPool namespace).
 \return True if any conversion was necessary. Otherwise, no conversion was necessary and the destination buffer is not modified!
+\remarks Floating-point values outside the range [0, 1] are saturated when they are converted to a normalized integer data type.
+Common conversions are executed with vectorized kernels (SSE2, SSSE3, AVX2, or NEON) if supported by the host CPU.
 \note Compressed images and depth-stencil images cannot be converted.
 \throw std::invalid_argument If a compressed image format is specified either as source or destination.
 \throw std::invalid_argument If a depth-stencil format is specified either as source or destination.
@@ -221,6 +224,7 @@ LLGL_EXPORT bool ConvertImageBuffer(
 \param[in] threadCount Specifies the number of threads to use for conversion.
 If this is less than 2, no multi-threading is used. If this is 'Constants::maxThreadCount',
 the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+The work is distributed across the shared job pool (see JobPool namespace).
 \return Byte buffer with the converted image data or null if no conversion is necessary.
 This can be casted to the respective target data type (e.g. "unsigned char", "int", "float" etc.).
 \note Compressed images and depth-stencil images cannot be converted.
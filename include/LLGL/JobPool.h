@@ -0,0 +1,72 @@
+/*
+ * JobPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_JOB_POOL_H
+#define LLGL_JOB_POOL_H
+
+
+#include "Export.h"
+#include <functional>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+/**
+\brief Namespace with functions to configure the shared job pool.
+\remarks The job pool is used for all multi-threaded work inside of LLGL, e.g. by ConvertImageBuffer when a thread count greater than 1 is specified.
+Its worker threads are created lazily on the first use and persist as long as any render system exists.
+They are joined when the last render system is destroyed, i.e. before its module is unloaded.
+Without a render system, multi-threaded work uses temporary worker threads that are joined before the respective function returns.
+\see ConvertImageBuffer
+*/
+namespace JobPool
+{
+
+
+/**
+\brief Job scheduler function interface.
+\param[in] numJobs Specifies the number of jobs that are to be executed.
+\param[in] job Specifies the job function that must be called once for each job index in the range [0, numJobs).
+The job function can be called concurrently from any thread.
+\remarks The scheduler must not return before all jobs have been finished.
+\see SetScheduler
+*/
+using Scheduler = std::function<void(std::size_t numJobs, const std::function<void(std::size_t jobIndex)>& job)>;
+
+/**
+\brief Sets the number of worker threads of the shared job pool.
+\param[in] threadCount Specifies the number of worker threads. If this is 'Constants::maxThreadCount',
+the maximal count of threads the system supports will be used. By default Constants::maxThreadCount.
+\remarks If the job pool has already been created, it is re-created with the new size on its next use.
+This must not be called while any other thread uses the job pool.
+\see Constants::maxThreadCount
+*/
+LLGL_EXPORT void SetThreadCount(std::size_t threadCount);
+
+//! Returns the number of worker threads of the shared job pool (this is never Constants::maxThreadCount).
+LLGL_EXPORT std::size_t GetThreadCount();
+
+/**
+\brief Sets a custom job scheduler to distribute the jobs to the threads of the client application.
+\param[in] scheduler Specifies the new scheduler. If this is empty, the internal job pool is used.
+\remarks This must not be called while any other thread uses the job pool.
+*/
+LLGL_EXPORT void SetScheduler(const Scheduler& scheduler);
+
+
+} // /namespace JobPool
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -15,9 +15,12 @@
 #include "Display.h"
 #include "Input.h"
 #include "Timer.h"
+#include "JobPool.h"
 #include "ColorRGB.h"
 #include "ColorRGBA.h"
 #include "RenderSystem.h"
+#include "TimestampProfiler.h"
+#include "TraceReplayer.h"
 
 
 //DOXYGEN MAIN PAGE
@@ -88,7 +91,7 @@
  * CommandBuffer::DrawIndexed(std::uint32_t numVertices, std::uint32_t firstIndex);
  * 
  * // OpenGL Implementation:
- * void GLCommandBuffer::DrawIndexed(std::uint32_t numVertices, std::uint32_t firstIndex)
+ * void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numVertices, std::uint32_t firstIndex)
  * {
  *     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
  *     glDrawElements(
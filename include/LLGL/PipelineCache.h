@@ -0,0 +1,50 @@
+/*
+ * PipelineCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_PIPELINE_CACHE_H
+#define LLGL_PIPELINE_CACHE_H
+
+
+#include "RenderSystemChild.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Pipeline cache interface to reuse compiled pipeline states across pipeline creations and application runs.
+\remarks The cache content can be serialized with the "GetBlob" function and passed to RenderSystem::CreatePipelineCache on the next application run.
+\note Only supported with: Vulkan (for all other renderers, the cache is always empty).
+\see RenderSystem::CreatePipelineCache
+\see GraphicsPipelineDescriptor::pipelineCache
+\see ComputePipelineDescriptor::pipelineCache
+*/
+class LLGL_EXPORT PipelineCache : public RenderSystemChild
+{
+
+    public:
+
+        /**
+        \brief Returns the serialized content of this pipeline cache.
+        \remarks The blob contains a header to validate the vendor, device, and driver version when it is loaded again.
+        An empty blob is returned if the renderer does not support pipeline caches.
+        */
+        virtual std::vector<char> GetBlob() const = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -20,6 +20,29 @@ namespace LLGL
 {
 
 
+/* ----- Flags ----- */
+
+/**
+\brief Binding flags enumeration for pipeline layouts.
+\see BindingDescriptor::flags
+*/
+struct BindingFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the buffer of this binding is bound with a dynamic offset.
+        \remarks The offset is passed to CommandBuffer::SetGraphicsResourceHeapWithOffsets or CommandBuffer::SetComputeResourceHeapWithOffsets,
+        so different ranges of the same buffer can be selected without updating the resource heap.
+        This is only valid for bindings of type ResourceType::ConstantBuffer and ResourceType::StorageBuffer.
+        \note Only supported with: Vulkan.
+        \see ResourceViewDescriptor::bufferRange
+        */
+        DynamicOffset = (1 << 0),
+    };
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -32,11 +55,12 @@ struct BindingDescriptor
     BindingDescriptor(const BindingDescriptor&) = default;
 
     //! Constructors with all attributes and a default value for a uniform array.
-    inline BindingDescriptor(ResourceType type, long stageFlags, std::uint32_t slot, std::uint32_t arraySize = 1) :
+    inline BindingDescriptor(ResourceType type, long stageFlags, std::uint32_t slot, std::uint32_t arraySize = 1, long flags = 0) :
         type       { type       },
         stageFlags { stageFlags },
         slot       { slot       },
-        arraySize  { arraySize  }
+        arraySize  { arraySize  },
+        flags      { flags      }
     {
     }
 
@@ -61,6 +85,13 @@ struct BindingDescriptor
     \note For Vulkan, this number specifies the size of an array of resources (e.g. an array of uniform buffers).
     */
     std::uint32_t   arraySize   = 1;
+
+    /**
+    \brief Specifies additional binding flags. By default 0.
+    \remarks This can be a bitwise OR combination of the BindingFlags bitmasks.
+    \see BindingFlags
+    */
+    long            flags       = 0;
 };
 
 /**
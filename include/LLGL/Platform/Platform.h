@@ -32,6 +32,8 @@
 
 #if defined _M_ARM || defined __arm__
 #   define LLGL_ARCH_ARM
+#elif defined _M_ARM64 || defined __aarch64__
+#   define LLGL_ARCH_ARM64
 #elif defined _M_X64 || defined __amd64__
 #   define LLGL_ARCH_X64
 #elif defined _M_IX86 || defined _X86_ || defined __X86__ || defined __i386__
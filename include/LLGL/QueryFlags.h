@@ -48,6 +48,15 @@ enum class QueryType
     \see QueryPipelineStatistics
     */
     PipelineStatistics,
+
+    /**
+    \brief GPU timestamp (in nanoseconds) that is written when all previous commands have been completed.
+    \remarks The timestamp is written with CommandBuffer::EndQuery. CommandBuffer::BeginQuery resets the query and must be recorded outside of a render pass
+    before the query is written again, which is required by some renderers (e.g. Vulkan). Timestamps are only meaningful relative to other timestamps.
+    \note Only supported if RenderingFeatures::hasTimestampQueries is true.
+    \see TimestampProfiler
+    */
+    Timestamp,
 };
 
 
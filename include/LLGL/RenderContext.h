@@ -70,6 +70,15 @@ class LLGL_EXPORT RenderContext : public RenderSystemChild
         */
         virtual Format QueryDepthStencilFormat() const = 0;
 
+        /**
+        \brief Queries the frame pacing statistics of this render context.
+        \param[out] stats Specifies the output parameter for the statistics.
+        \return True if the renderer keeps track of frame pacing. Otherwise, the output parameter is not modified.
+        \remarks The default implementation returns false.
+        \see RenderContextDescriptor::framesInFlight
+        */
+        virtual bool QueryFramePacingStatistics(FramePacingStatistics& stats) const;
+
         /**
         \brief Returns the surface which is used to present the content on the screen.
         \remarks On desktop platforms, this can be statically casted to 'LLGL::Window&',
@@ -77,6 +86,7 @@ class LLGL_EXPORT RenderContext : public RenderSystemChild
         \code
         auto& myWindow = static_cast<LLGL::Window&>(myRenderContext->GetSurface());
         \endcode
+        \note The render context of the Null renderer has no surface if none was specified at creation time.
         */
         inline Surface& GetSurface() const
         {
@@ -149,6 +149,35 @@ struct ProfileOpenGLDescriptor
     int                     minorVersion    = -1;
 };
 
+/**
+\brief Frame pacing statistics of a render context.
+\remarks All time values are specified in milliseconds.
+\see RenderContext::QueryFramePacingStatistics
+*/
+struct FramePacingStatistics
+{
+    //! Number of frames that have been presented so far.
+    std::uint64_t   numFrames           = 0;
+
+    //! Number of frames the CPU may record ahead of the GPU.
+    std::uint32_t   framesInFlight      = 1;
+
+    //! Time the CPU was blocked during the last frame, waiting for the GPU to finish the frame that previously used the same frame slot.
+    double          lastWaitTime        = 0.0;
+
+    //! Average time the CPU was blocked per frame, waiting for the GPU.
+    double          averageWaitTime     = 0.0;
+
+    //! Maximal time the CPU was blocked within a single frame, waiting for the GPU.
+    double          maxWaitTime         = 0.0;
+
+    //! Time between the last two presented frames.
+    double          lastFrameTime       = 0.0;
+
+    //! Average time between two presented frames.
+    double          averageFrameTime    = 0.0;
+};
+
 //! Render context descriptor structure.
 struct RenderContextDescriptor
 {
@@ -166,6 +195,15 @@ struct RenderContextDescriptor
 
     //! Debuging callback function object.
     DebugCallback           debugCallback;
+
+    /**
+    \brief Number of frames the CPU may record ahead of the GPU. By default 2.
+    \remarks Each frame in flight has its own synchronization objects and command buffers,
+    so recording the next frame overlaps with the GPU executing the previous frames at the cost of additional latency.
+    This is clamped to the range [1, 3]. Currently only the Vulkan renderer makes use of this value.
+    \see RenderContext::QueryFramePacingStatistics
+    */
+    std::uint32_t           framesInFlight  = 2;
 };
 
 
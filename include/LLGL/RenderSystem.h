@@ -27,6 +27,7 @@
 #include "Shader.h"
 #include "ShaderProgram.h"
 #include "PipelineLayout.h"
+#include "PipelineCache.h"
 #include "GraphicsPipeline.h"
 #include "ComputePipeline.h"
 #include "Query.h"
@@ -35,6 +36,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <future>
 #include <cstdint>
 
 
@@ -67,6 +69,9 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
 
         /* ----- Common ----- */
 
+        //! Releases the results of all asynchronous texture read operations that have not been queried.
+        ~RenderSystem();
+
         /**
         \brief Returns the list of all available render system modules for the current platform.
         \remarks For example, on Win32 this might be { "OpenGL", "Direct3D11", "Direct3D12" }, but on MacOS it might be only { "OpenGL" }.
@@ -77,7 +82,8 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         \brief Loads a new render system from the specified module.
         \param[in] renderSystemDesc Specifies the render system descriptor structure. The 'moduleName' member of this strucutre must not be empty.
         \param[in] profiler Optional pointer to a rendering profiler. If this is used, the counters of the profiler must be reset manually.
-        This is only supported if LLGL was compiled with the "LLGL_ENABLE_DEBUG_LAYER" flag.
+        If no debugger is specified, the counters are recorded by a lightweight profiling layer that is always available.
+        Otherwise, they are recorded by the debug layer.
         \param[in] debugger Optional pointer to a rendering debugger.
         This is only supported if LLGL was compiled with the "LLGL_ENABLE_DEBUG_LAYER" flag.
         \remarks The descriptor structure can be initialized by only the module name like shown in the following example:
@@ -85,8 +91,9 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         // Load the "OpenGL" render system module
         auto renderer = LLGL::RenderSystem::Load("OpenGL");
         \endcode
-        \throws std::runtime_error If loading the render system from the specified module failed.
+        \throws std::runtime_error If loading the render system from the specified module failed, or if the capture file could not be created.
         \see RenderSystemDescriptor::moduleName
+        \see RenderSystemDescriptor::captureFilename
         */
         static std::unique_ptr<RenderSystem> Load(
             const RenderSystemDescriptor& renderSystemDesc,
@@ -260,6 +267,17 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual void UnmapBuffer(Buffer& buffer) = 0;
 
+        /**
+        \brief Queries the statistics about the staging memory that has been used to upload buffer data.
+        \param[out] statistics Specifies the output parameter for the accumulated statistics.
+        \return True if the render system uploads buffer data through a staging ring buffer,
+        otherwise the return value is false and 'statistics' is not modified.
+        \remarks The debug layer and the profiling layer use this function to report the staging statistics via the RenderingProfiler.
+        \note Only supported with: Vulkan.
+        \see RenderingProfiler::stagingRingBufferBytes
+        */
+        virtual bool QueryStagingStatistics(StagingStatistics& statistics) const;
+
         /* ----- Textures ----- */
 
         /**
@@ -320,6 +338,57 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Starts reading the image data from the specified texture asynchronously and returns a ticket to query the result.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] mipLevel Specifies the MIP-level from which to read the image data.
+        \return Non-zero ticket that must be passed to QueryTextureReadResult to retrieve the image data.
+        \remarks In contrast to ReadTexture, this function does not wait for the GPU.
+        The read operation is issued after all previously submitted commands and is completed through a fence, e.g. a few frames later.
+        The image data is read in the format that matches the hardware format of the texture,
+        i.e. the image format and data type returned by FindSuitableImageFormat for the texture format.
+        All array layers of the MIP-map level are read.
+        \remarks Renderers without support for asynchronous read operations fall back to ReadTexture,
+        in which case the result is available immediately.
+        \see QueryTextureReadResult
+        \see FindSuitableImageFormat
+        */
+        virtual std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel);
+
+        /**
+        \brief Retrieves the result of an asynchronous texture read operation.
+        \param[in] ticket Specifies the ticket that was returned by ReadTextureAsync.
+        \param[out] imageDesc Specifies the destination image descriptor to write the texture data to.
+        The image format and data type must match the hardware format of the texture (see ReadTextureAsync).
+        \param[in] wait Specifies whether to wait until the read operation has been completed. By default false.
+        \return True if the read operation has been completed and the image data has been written to 'imageDesc.data'.
+        In this case, the ticket is no longer valid. Otherwise, the read operation is still pending and the function must be called again later.
+        \remarks The image data can then be converted into the final format with ConvertImageBuffer, e.g. on a worker thread:
+        \code
+        // Start read operation once
+        auto ticket = myRenderSystem->ReadTextureAsync(*myTexture, 0);
+
+        // Poll result in subsequent frames
+        if (myRenderSystem->QueryTextureReadResult(ticket, myImageDesc))
+        {
+            std::thread myWorker(
+                [=]()
+                {
+                    auto myConvertedImage = LLGL::ConvertImageBuffer(mySrcImageDesc, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8);
+                    // ...
+                }
+            );
+            // ...
+        }
+        \endcode
+        \throws std::invalid_argument If 'ticket' is not a pending ticket of this render system.
+        \throws std::invalid_argument If 'imageDesc.dataSize' is less than the required size.
+        \throws std::runtime_error If the read operation has been completed but its data could not be retrieved. The ticket is invalid afterwards.
+        \see ReadTextureAsync
+        \see ConvertImageBuffer
+        */
+        virtual bool QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait = false);
+
         /**
         \brief Generates all MIP-maps for the specified texture.
         \param[in,out] texture Specifies the texture whose MIP-maps are to be generated.
@@ -430,6 +499,20 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         //! Releases the specified PipelineLayout object. After this call, the specified object must no longer be used.
         virtual void Release(PipelineLayout& pipelineLayout) = 0;
 
+        /* ----- Pipeline Caches ----- */
+
+        /**
+        \brief Creates a new pipeline cache object.
+        \param[in] initialBlob Optional pointer to a blob that was previously returned by PipelineCache::GetBlob. This may be null.
+        \param[in] initialBlobSize Specifies the size (in bytes) of the initial blob.
+        \remarks If the initial blob was created with a different vendor, device, or driver version, it is ignored and the cache starts empty.
+        \see PipelineCache::GetBlob
+        */
+        virtual PipelineCache* CreatePipelineCache(const void* initialBlob = nullptr, std::size_t initialBlobSize = 0) = 0;
+
+        //! Releases the specified PipelineCache object. After this call, the specified object must no longer be used.
+        virtual void Release(PipelineCache& pipelineCache) = 0;
+
         /* ----- Pipeline States ----- */
 
         /**
@@ -449,6 +532,27 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) = 0;
 
+        /**
+        \brief Creates a new graphics pipeline state object asynchronously.
+        \param[in] desc Specifies the graphics pipeline descriptor. The descriptor is copied, but all objects it refers to must stay alive until the future is ready.
+        \return Future that holds the new graphics pipeline or the exception that was thrown during its creation.
+        \remarks Like all other functions of the render system, this function must only be called from the thread that owns the render system;
+        only the compilation of the pipeline may run concurrently. The behavior depends on the renderer:
+        - Vulkan compiles the pipeline on the shared job pool.
+        - OpenGL, Direct3D, and the Null renderer create the pipeline immediately with CreateGraphicsPipeline and return a future that is already ready.
+        The returned pipeline must be released with Release(GraphicsPipeline&) as usual, even if the future has never been waited for.
+        \see CreateGraphicsPipeline
+        \see JobPool::SetThreadCount
+        */
+        virtual std::future<GraphicsPipeline*> CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc);
+
+        /**
+        \brief Creates a new compute pipeline state object asynchronously.
+        \see CreateGraphicsPipelineAsync
+        \see CreateComputePipeline
+        */
+        virtual std::future<ComputePipeline*> CreateComputePipelineAsync(const ComputePipelineDescriptor& desc);
+
         //! Releases the specified GraphicsPipeline object. After this call, the specified object must no longer be used.
         virtual void Release(GraphicsPipeline& graphicsPipeline) = 0;
 
@@ -477,7 +581,7 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
 
     protected:
 
-        RenderSystem() = default;
+        RenderSystem();
 
         //! Sets the renderer information.
         void SetRendererInfo(const RendererInfo& info);
@@ -509,6 +613,9 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         RenderingCapabilities       caps_;
         RenderSystemConfiguration   config_;
 
+        struct TextureReadResults;
+        std::unique_ptr<TextureReadResults> textureReadResults_;   // Results of the default ReadTextureAsync implementation (allocated on first use)
+
 };
 
 
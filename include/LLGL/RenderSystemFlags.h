@@ -118,9 +118,16 @@ enum class ClippingRange
 */
 enum class CPUAccess
 {
-    ReadOnly,   //!< CPU read access only.
-    WriteOnly,  //!< CPU write access only.
-    ReadWrite,  //!< CPU read and write access.
+    ReadOnly,       //!< CPU read access only.
+    WriteOnly,      //!< CPU write access only.
+    ReadWrite,      //!< CPU read and write access.
+
+    /**
+    \brief CPU write access only, where the previous content of the buffer is discarded.
+    \remarks The content of the mapped memory is undefined, so the entire buffer must be written before it is unmapped.
+    This allows the renderer to map new memory instead of synchronizing with the GPU (e.g. for buffers with BufferFlags::StreamingUsage).
+    */
+    WriteDiscard,
 };
 
 
@@ -180,6 +187,7 @@ struct RendererID
     static const int Direct3D12 = 0x00000008; //!< ID number for a Direct3D 12 renderer.
     static const int Vulkan     = 0x00000009; //!< ID number for a Vulkan renderer.
     static const int Metal      = 0x0000000a; //!< ID number for a Metal renderer.
+    static const int Null       = 0x0000000b; //!< ID number for the Null renderer (headless, no GPU required).
 
     static const int Reserved   = 0x000000ff; //!< Highest ID number for reserved future renderers. Value is 0x000000ff.
 };
@@ -233,6 +241,110 @@ struct VulkanRendererConfiguration
     Whenever a VkDeviceMemory chunk is full, the memory manager tries to reduce fragmentation anyways.
     */
     bool                    reduceDeviceMemoryFragmentation = false;
+
+    /**
+    \brief Size (in bytes) of the persistently mapped staging ring buffer. By default 4*1024*1024, i.e. 4 MB of host visible memory.
+    \remarks This ring buffer is used for transient uploads with RenderSystem::WriteBuffer, so no staging buffer must be allocated for each call.
+    Its memory ranges are recycled once the GPU has executed the respective staging commands.
+    Uploads that are larger than this ring buffer fall back to temporary staging buffers. If this is zero, the ring buffer is disabled.
+    \see RenderSystem::QueryStagingStatistics
+    */
+    std::uint64_t           stagingRingBufferSize           = 4*1024*1024;
+};
+
+/**
+\brief Statistics about the staging memory a render system has used to upload buffer data.
+\remarks These values are accumulated over the lifetime of the render system and never reset,
+so except for the high-water mark only the difference between two queries is meaningful.
+\see RenderSystem::QueryStagingStatistics
+\see VulkanRendererConfiguration::stagingRingBufferSize
+*/
+struct StagingStatistics
+{
+    //! Number of bytes that have been written into the staging ring buffer.
+    std::uint64_t ringBufferBytes         = 0;
+
+    //! Highest number of bytes (including alignment padding) that have been in use in the staging ring buffer at the same time.
+    std::uint64_t ringBufferHighWaterMark = 0;
+
+    //! Number of times an upload had to wait for the GPU, because the staging ring buffer was full and had to wrap around.
+    std::uint64_t ringBufferStalls        = 0;
+
+    //! Number of uploads that fell back to a temporary staging buffer, because the staging ring buffer was disabled or too small.
+    std::uint64_t temporaryStagingBuffers = 0;
+};
+
+/**
+\brief Callback interface to load a program binary from a user-defined cache.
+\param[in] key Specifies the hash key of the program binary. This key identifies the shader sources, vertex formats, stream-output varyings, and the driver.
+\param[out] binary Specifies the output buffer the program binary is to be written to.
+\return True if the program binary was found in the cache. Otherwise, false.
+\see OpenGLRendererConfiguration::loadProgramBinary
+*/
+using LoadProgramBinaryCallback = std::function<bool(std::uint64_t key, std::vector<char>& binary)>;
+
+/**
+\brief Callback interface to store a program binary in a user-defined cache.
+\param[in] key Specifies the hash key of the program binary.
+\param[in] binary Pointer to the program binary data.
+\param[in] binarySize Specifies the size (in bytes) of the program binary.
+\see OpenGLRendererConfiguration::storeProgramBinary
+*/
+using StoreProgramBinaryCallback = std::function<void(std::uint64_t key, const void* binary, std::size_t binarySize)>;
+
+/**
+\brief Structure for an OpenGL renderer specific configuration.
+\remarks The program binary cache requires the GL_ARB_get_program_binary extension. If a cached program binary is rejected by the driver,
+the shader program is linked from its shader sources and the cache entry is replaced.
+\see RenderSystemDescriptor::rendererConfig
+*/
+struct OpenGLRendererConfiguration
+{
+    /**
+    \brief Specifies the directory where program binaries are cached. By default empty.
+    \remarks Each program binary is stored in its own file named after its hash key.
+    If this is empty and no callbacks are specified, the program binary cache is disabled.
+    */
+    std::string                 programCacheDirectory;
+
+    /**
+    \brief Optional callback to load program binaries from a user-defined cache (e.g. in memory). By default null.
+    \remarks If this and 'storeProgramBinary' are specified, 'programCacheDirectory' is ignored.
+    */
+    LoadProgramBinaryCallback   loadProgramBinary;
+
+    //! Optional callback to store program binaries in a user-defined cache. By default null.
+    StoreProgramBinaryCallback  storeProgramBinary;
+
+    /**
+    \brief Specifies whether command buffers record their commands instead of executing them immediately. By default false.
+    \remarks Deferred command buffers encode all commands into a byte stream that is executed when the command buffer is submitted
+    with CommandQueue::Submit, which must be called on the thread of the GL context. The recording itself can then be done on any thread.
+    After the command buffer has been submitted, its commands are discarded for the next recording.
+    All objects that are referenced by the recorded commands must stay alive until the command buffer has been submitted.
+    \note Query results (i.e. CommandBuffer::QueryResult) are not recorded and must still be read on the thread of the GL context.
+    \see CommandQueue::Submit(CommandBuffer&)
+    */
+    bool                        deferredCommandBuffers = false;
+
+    /**
+    \brief Specifies the size (in bytes) of the persistently mapped ring buffer for buffers with the BufferFlags::StreamingUsage flag. By default 12 MB.
+    \remarks The ring buffer is divided into three regions, each of which is protected by a fence once it has been filled.
+    Updates that are larger than one region fall back to the regular buffer update.
+    \see BufferFlags::StreamingUsage
+    */
+    std::size_t                 streamingBufferSize    = 12 * 1024 * 1024;
+
+    /**
+    \brief Specifies the size (in bytes) of the persistently mapped ring buffer for texture uploads. By default 24 MB.
+    \remarks Image data that is passed to RenderSystem::CreateTexture and RenderSystem::WriteTexture is copied into this ring buffer,
+    which is then bound as GL_PIXEL_UNPACK_BUFFER for the texture upload. This way the driver does not have to copy the image data from client memory synchronously.
+    The ring buffer is divided into three regions; images that are larger than one region fall back to the regular texture upload.
+    If this is zero, the ring buffer for texture uploads is disabled.
+    \see RenderSystem::CreateTexture
+    \see RenderSystem::WriteTexture
+    */
+    std::size_t                 textureStreamingBufferSize = 24 * 1024 * 1024;
 };
 
 /**
@@ -297,6 +409,17 @@ struct RenderSystemDescriptor
     \see rendererConfig
     */
     std::size_t rendererConfigSize  = 0;
+
+    /**
+    \brief Optional filename of a trace file, into which all render system calls are captured. By default empty.
+    \remarks If this is not empty, the render system is wrapped into a capture layer,
+    which records all object creations, resource uploads, and command buffer commands into a binary trace file.
+    The trace is flushed at the end of each frame (i.e. with each call to RenderContext::Present)
+    and can be replayed against any render system with the TraceReplayer class or the "llgl-replay" tool.
+    Read-back operations (e.g. RenderSystem::ReadTexture) and shader uniforms (i.e. ShaderProgram::LockShaderUniform) are not captured.
+    \see TraceReplayer
+    */
+    std::string captureFilename;
 };
 
 /**
@@ -418,6 +541,32 @@ struct RenderingFeatures
     \see BlendDescriptor::logicOp
     */
     bool hasLogicOp                     = false;
+
+    /**
+    \brief Specifies whether indirect draw and dispatch commands are supported.
+    \remarks For OpenGL, GL_ARB_draw_indirect is required (and GL_ARB_multi_draw_indirect to draw multiple commands at once without emulation).
+    \see CommandBuffer::DrawIndirect
+    \see CommandBuffer::DrawIndexedIndirect
+    \see CommandBuffer::DispatchIndirect
+    */
+    bool hasIndirectDrawing             = false;
+
+    /**
+    \brief Specifies whether indirect draw commands with a draw count from a GPU buffer are supported.
+    \remarks For OpenGL, GL_ARB_indirect_parameters is required. For Vulkan, VK_KHR_draw_indirect_count is required.
+    This is not supported by Direct3D 11.
+    \see CommandBuffer::DrawIndirectCount
+    \see CommandBuffer::DrawIndexedIndirectCount
+    */
+    bool hasIndirectCountDrawing        = false;
+
+    /**
+    \brief Specifies whether timestamp queries are supported.
+    \remarks For OpenGL, GL_ARB_timer_query is required. For Vulkan, the device limit 'timestampComputeAndGraphics' is required.
+    \see QueryType::Timestamp
+    \see TimestampProfiler
+    */
+    bool hasTimestampQueries            = false;
 };
 
 /**
@@ -521,6 +670,20 @@ struct RenderingLimits
     \see BufferDescriptor::size
     */
     std::uint64_t   maxConstantBufferSize               = 0;
+
+    /**
+    \brief Specifies the minimum alignment (in bytes) for dynamic offsets and ranges within constant buffers.
+    \see CommandBuffer::SetGraphicsResourceHeapWithOffsets
+    \see ResourceViewDescriptor::bufferRange
+    */
+    std::uint64_t   minConstantBufferOffsetAlignment    = 0;
+
+    /**
+    \brief Specifies the minimum alignment (in bytes) for dynamic offsets and ranges within storage buffers.
+    \see CommandBuffer::SetGraphicsResourceHeapWithOffsets
+    \see ResourceViewDescriptor::bufferRange
+    */
+    std::uint64_t   minStorageBufferOffsetAlignment     = 0;
 };
 
 /**
@@ -13,6 +13,7 @@
 #include "RenderContextFlags.h"
 #include "GraphicsPipelineFlags.h"
 #include <cstdint>
+#include <atomic>
 
 
 namespace LLGL
@@ -22,13 +23,21 @@ namespace LLGL
 /**
 \brief Rendering profiler model class.
 \remarks This can be used to profile the renderer draw calls and buffer updates.
+If only a profiler but no debugger is passed to RenderSystem::Load, a lightweight profiling layer is used instead of the debug layer,
+which only updates the counters and performs no validation, so it can be kept enabled in release builds.
+\see RenderSystem::Load
+\see TimestampProfiler
 */
 class LLGL_EXPORT RenderingProfiler
 {
 
     public:
 
-        //! Profiling counter class.
+        /**
+        \brief Profiling counter class.
+        \remarks The counter is updated with relaxed atomic operations,
+        so command buffers can be recorded on multiple threads without locking and without ordering the counters among each other.
+        */
         class LLGL_EXPORT Counter
         {
 
@@ -36,28 +45,53 @@ class LLGL_EXPORT RenderingProfiler
 
                 using ValueType = std::uint32_t;
 
+                Counter() = default;
+
+                //! Copies the current value of the other counter.
+                Counter(const Counter& rhs) :
+                    value_ { rhs.Count() }
+                {
+                }
+
+                //! Copies the current value of the other counter.
+                Counter& operator = (const Counter& rhs)
+                {
+                    value_.store(rhs.Count(), std::memory_order_relaxed);
+                    return *this;
+                }
+
                 //! Increment internal counter by one.
                 void Inc()
                 {
-                    ++value_;
+                    value_.fetch_add(1, std::memory_order_relaxed);
                 }
 
                 //! Increment internal counter by the specified value.
                 void Inc(ValueType value)
                 {
-                    value_ += value;
+                    value_.fetch_add(value, std::memory_order_relaxed);
+                }
+
+                //! Raises internal counter to the specified value if it is currently lower.
+                void Max(ValueType value)
+                {
+                    auto current = value_.load(std::memory_order_relaxed);
+                    while (current < value && !value_.compare_exchange_weak(current, value, std::memory_order_relaxed))
+                    {
+                        /* Retry with the value that has been stored by another thread */
+                    }
                 }
 
                 //! Reset internal counter to zero.
                 void Reset()
                 {
-                    value_ = 0;
+                    value_.store(0, std::memory_order_relaxed);
                 }
 
                 //! Returns the internal counter value.
                 inline ValueType Count() const
                 {
-                    return value_;
+                    return value_.load(std::memory_order_relaxed);
                 }
 
                 //! Returns the internal counter value (same as "Count()" function).
@@ -68,7 +102,7 @@ class LLGL_EXPORT RenderingProfiler
 
             private:
 
-                ValueType value_ = 0;
+                std::atomic<ValueType> value_ { 0 };
 
         };
 
@@ -82,8 +116,19 @@ class LLGL_EXPORT RenderingProfiler
         void RecordDrawCall(const PrimitiveTopology topology, Counter::ValueType numVertices, Counter::ValueType numInstances);
 
         Counter writeBuffer;            //!< Counter for buffer writings. \see RenderSystem::WriteBuffer
+        Counter writeBufferBytes;       //!< Counter for the number of bytes written to buffers. \see RenderSystem::WriteBuffer
         Counter mapBuffer;              //!< Counter for buffer mappings. \see RenderSystem::MapBuffer
 
+        /**
+        \brief Counter for the number of bytes written into the staging ring buffer.
+        \remarks This and the following staging counters are only recorded for render systems that support RenderSystem::QueryStagingStatistics.
+        \see StagingStatistics::ringBufferBytes
+        */
+        Counter stagingRingBufferBytes;
+        Counter stagingRingBufferHighWaterMark; //!< Highest number of bytes in use in the staging ring buffer. \see StagingStatistics::ringBufferHighWaterMark
+        Counter stagingRingBufferStalls;        //!< Counter for uploads that waited for the GPU on ring wrap. \see StagingStatistics::ringBufferStalls
+        Counter temporaryStagingBuffers;        //!< Counter for uploads that fell back to temporary staging buffers. \see StagingStatistics::temporaryStagingBuffers
+
         Counter setVertexBuffer;        //!< Counter for vertex buffer bindings. \see CommandBuffer::SetVertexBuffer
         Counter setIndexBuffer;         //!< Counter for index buffer bindings. \see CommandBuffer::SetIndexBuffer
         Counter setConstantBuffer;      //!< Counter for constant buffer bindings. \see CommandBuffer::SetConstantBuffer
@@ -95,12 +140,28 @@ class LLGL_EXPORT RenderingProfiler
         Counter setSampler;             //!< Counter for sampler bindings. \see CommandBuffer::SetSampler
         Counter setRenderTarget;        //!< Counter for render target bindings. \see CommandBuffer::SetRenderTarget
 
+        /**
+        \brief Counter for state groups that have been submitted to the graphics API when a graphics pipeline was bound.
+        \remarks This is only recorded for render systems that eliminate redundant state changes.
+        \see CommandBuffer::QueryStateChangeStatistics
+        */
+        Counter pipelineStateChanges;
+
+        /**
+        \brief Counter for state groups that have been skipped when a graphics pipeline was bound, because they were already bound.
+        \see CommandBuffer::QueryStateChangeStatistics
+        */
+        Counter pipelineStateChangesSkipped;
+
         /**
         \brief Counter for draw calls.
         \see CommandBuffer.Draw
         \see CommandBuffer.DrawIndexed
         \see CommandBuffer.DrawInstanced
         \see CommandBuffer.DrawIndexedInstanced
+        \remarks Each indirect draw command counts as one draw call, and the commands with a count buffer count as a single draw call.
+        \see CommandBuffer.DrawIndirect
+        \see CommandBuffer.DrawIndexedIndirect
         */
         Counter drawCalls;
         Counter dispatchComputeCalls;   //!< Counter for dispatch compute calls. \see CommandBuffer::Dispatch
@@ -11,6 +11,7 @@
 
 #include "Export.h"
 #include <vector>
+#include <cstdint>
 
 
 namespace LLGL
@@ -50,10 +51,19 @@ struct ResourceViewDescriptor
     }
 
     //! Pointer to the hardware resoudce.
-    Resource*   resource    = nullptr;
+    Resource*       resource    = nullptr;
+
+    /**
+    \brief Specifies the size (in bytes) of the buffer range that is visible to the shader. By default 0.
+    \remarks If this is 0, the entire buffer is visible. For bindings with the BindingFlags::DynamicOffset flag,
+    this must not be 0 and is typically the size of a single element (e.g. the per-object constants), which is then selected with a dynamic offset.
+    \note Only supported with: Vulkan.
+    \see BindingFlags::DynamicOffset
+    */
+    std::uint64_t   bufferRange = 0;
 
     #if 0//TODO
-    long        flags       = 0;
+    long            flags       = 0;
     #endif
 };
 
@@ -0,0 +1,232 @@
+/*
+ * TimestampProfiler.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TIMESTAMP_PROFILER_H
+#define LLGL_TIMESTAMP_PROFILER_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class Query;
+
+/* ----- Structures ----- */
+
+/**
+\brief GPU timing record of a single profiling scope.
+\see TimestampFrameRecord::scopes
+*/
+struct TimestampScopeRecord
+{
+    //! Returns the elapsed GPU time of this scope in milliseconds.
+    inline double ElapsedTimeMs() const
+    {
+        return (static_cast<double>(elapsedTime) / 1000000.0);
+    }
+
+    //! Name of the scope as passed to TimestampProfiler::BeginScope.
+    std::string     name;
+
+    //! Nesting depth of the scope. Top-level scopes have a depth of 0.
+    std::uint32_t   depth       = 0;
+
+    //! Index of the enclosing scope within TimestampFrameRecord::scopes, or ~0u for top-level scopes.
+    std::uint32_t   parent      = ~0u;
+
+    //! GPU time (in nanoseconds) from the beginning of the frame to the beginning of this scope.
+    std::uint64_t   startTime   = 0;
+
+    //! Elapsed GPU time (in nanoseconds) between the beginning and the end of this scope.
+    std::uint64_t   elapsedTime = 0;
+};
+
+/**
+\brief GPU timing record of an entire frame.
+\see TimestampProfiler::GetLatestFrame
+*/
+struct TimestampFrameRecord
+{
+    //! Returns the elapsed GPU time of the frame in milliseconds.
+    inline double ElapsedTimeMs() const
+    {
+        return (static_cast<double>(elapsedTime) / 1000000.0);
+    }
+
+    //! Zero-based index of the frame, i.e. the number of previous TimestampProfiler::BeginFrame calls.
+    std::uint64_t                       frameIndex  = 0;
+
+    //! Elapsed GPU time (in nanoseconds) between TimestampProfiler::BeginFrame and TimestampProfiler::EndFrame.
+    std::uint64_t                       elapsedTime = 0;
+
+    //! All scopes of the frame in pre-order, i.e. each scope is followed by its nested scopes.
+    std::vector<TimestampScopeRecord>   scopes;
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief GPU profiler for nested and named timing scopes, based on timestamp queries.
+\remarks The results of a frame are resolved without stalling the CPU, i.e. they are available a few frames later (see 'numFramesInFlight').
+If the results of a frame are still not available when its queries are about to be reused, that frame is dropped.
+If the renderer does not support timestamp queries (see RenderingFeatures::hasTimestampQueries), all functions are no-ops and no frame records are generated.
+\code
+LLGL::TimestampProfiler profiler(*renderer);
+// Render loop ...
+profiler.BeginFrame(*commands);
+{
+    commands->SetRenderTarget(*context);
+    profiler.BeginScope(*commands, "Shadows");
+    {
+        // Draw shadow casters ...
+    }
+    profiler.EndScope(*commands);
+}
+profiler.EndFrame(*commands);
+commandQueue->Submit(*commands);
+if (auto frame = profiler.GetLatestFrame())
+{
+    for (const auto& scope : frame->scopes)
+        std::cout << std::string(scope.depth * 2, ' ') << scope.name << ": " << scope.ElapsedTimeMs() << " ms" << std::endl;
+}
+\endcode
+\see QueryType::Timestamp
+\see RenderingProfiler
+*/
+class LLGL_EXPORT TimestampProfiler : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Creates the timestamp profiler for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to create and release the timestamp queries.
+        The render system must outlive this profiler.
+        \param[in] numFramesInFlight Specifies the number of frames whose queries are kept alive until their results are available. By default 3.
+        \param[in] maxScopesPerFrame Specifies the maximum number of scopes per frame. Further scopes are dropped. By default 256.
+        \remarks The queries are allocated on demand and only as many as the busiest frame so far required.
+        */
+        TimestampProfiler(RenderSystem& renderSystem, std::uint32_t numFramesInFlight = 3, std::uint32_t maxScopesPerFrame = 256);
+
+        //! Releases all timestamp queries.
+        ~TimestampProfiler();
+
+        //! Returns true if the render system supports timestamp queries. Otherwise, this profiler does not generate any records.
+        inline bool IsSupported() const
+        {
+            return supported_;
+        }
+
+        /**
+        \brief Begins a new frame and resolves the results of previous frames.
+        \remarks This must be recorded before any render target is set on the command buffer,
+        because the timestamp queries of this frame are reset here, which some renderers (e.g. Vulkan) only allow outside of a render pass.
+        \throws std::runtime_error If the previous frame has not been ended.
+        */
+        void BeginFrame(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Ends the current frame.
+        \throws std::runtime_error If no frame has been begun or any scope has not been ended.
+        */
+        void EndFrame(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Begins a new scope, which can be nested inside other scopes.
+        \param[in] name Specifies the name of the scope. This must not be null.
+        \remarks If all queries of this frame are in use, the scope is dropped (see GetNumDroppedScopes).
+        The number of queries per frame grows with the number of scopes of previous frames (up to 'maxScopesPerFrame'),
+        so scopes are only dropped in the first frames after the number of scopes has increased, or if the maximum has been exceeded.
+        \throws std::runtime_error If no frame has been begun.
+        */
+        void BeginScope(CommandBuffer& commandBuffer, const char* name);
+
+        /**
+        \brief Ends the innermost scope.
+        \throws std::runtime_error If there is no scope to end.
+        */
+        void EndScope(CommandBuffer& commandBuffer);
+
+        //! Returns the most recent frame whose results are available, or null if no frame has been resolved yet.
+        const TimestampFrameRecord* GetLatestFrame() const;
+
+        //! Returns the number of frames that have been dropped, because their results were not available in time.
+        inline std::uint64_t GetNumDroppedFrames() const
+        {
+            return numDroppedFrames_;
+        }
+
+        //! Returns the number of scopes that have been dropped, because all queries of their frame were already in use.
+        inline std::uint64_t GetNumDroppedScopes() const
+        {
+            return numDroppedScopes_;
+        }
+
+    private:
+
+        struct ScopeEntry
+        {
+            std::string     name;
+            std::uint32_t   depth;
+            std::uint32_t   parent;
+        };
+
+        struct FrameSlot
+        {
+            std::vector<Query*>     queries;            // [0] frame begin, [1] frame end, followed by two queries per scope
+            std::vector<ScopeEntry> scopes;
+            std::uint64_t           frameIndex  = 0;
+            bool                    pending     = false;
+        };
+
+    private:
+
+        void ResizeQueries(FrameSlot& slot, std::size_t numQueries);
+        bool ResolveFrame(CommandBuffer& commandBuffer, FrameSlot& slot);
+        void ResolvePendingFrames(CommandBuffer& commandBuffer);
+
+    private:
+
+        RenderSystem&               renderSystem_;
+        bool                        supported_          = false;
+        std::uint32_t               maxScopesPerFrame_  = 0;
+
+        std::vector<FrameSlot>      frameSlots_;
+        FrameSlot*                  currentSlot_        = nullptr;  // Slot of the current frame (null outside of BeginFrame/EndFrame)
+        std::uint64_t               frameCounter_       = 0;
+
+        std::vector<std::uint32_t>  scopeStack_;                    // Indices of all open scopes (~0u for dropped scopes)
+        std::uint32_t               scopeCapacity_      = 0;        // Number of scopes the queries of the current frame can hold
+        std::uint32_t               numFrameScopes_     = 0;        // Number of scopes requested in the current frame (including dropped scopes)
+        std::uint32_t               scopeDemand_        = 0;        // Maximum number of scopes any frame has requested so far
+
+        TimestampFrameRecord        latestFrame_;
+        bool                        hasLatestFrame_     = false;
+        std::uint64_t               numDroppedFrames_   = 0;
+        std::uint64_t               numDroppedScopes_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,122 @@
+/*
+ * TraceReplayer.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TRACE_REPLAYER_H
+#define LLGL_TRACE_REPLAYER_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CaptureReader;
+class Timer;
+
+/* ----- Structures ----- */
+
+/**
+\brief Statistics of a single replayed frame.
+\see TraceReplayer::ReplayFrame
+*/
+struct TraceFrameStatistics
+{
+    //! Returns the elapsed CPU time of the frame in milliseconds.
+    inline double CPUTimeMs() const
+    {
+        return (static_cast<double>(cpuTime) / 1000000.0);
+    }
+
+    //! Zero-based index of the frame within the trace.
+    std::uint64_t   frameIndex  = 0;
+
+    //! Number of records that have been replayed for this frame, including object creations and resource uploads.
+    std::uint32_t   numRecords  = 0;
+
+    //! Number of command buffer commands that have been replayed for this frame.
+    std::uint32_t   numCommands = 0;
+
+    //! Elapsed CPU time (in nanoseconds) to replay all records of this frame, including the final RenderContext::Present call. This does not include any file I/O.
+    std::uint64_t   cpuTime     = 0;
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Replays a trace file, which has been captured with RenderSystemDescriptor::captureFilename, against a render system.
+\remarks The trace can be replayed against any render system, which allows to benchmark the CPU overhead of different renderers
+or different versions of LLGL with exactly the same command stream and without the application logic.
+Render contexts of the trace are created without a custom surface, i.e. the render system creates its own windows.
+All objects that are still alive at the end of the trace are released when the replayer is destroyed.
+\code
+auto renderer = LLGL::RenderSystem::Load("OpenGL");
+LLGL::TraceReplayer replayer(*renderer, "frames.llgltrace");
+LLGL::TraceFrameStatistics stats;
+while (replayer.ReplayFrame(&stats))
+    std::cout << "frame " << stats.frameIndex << ": " << stats.CPUTimeMs() << " ms" << std::endl;
+\endcode
+\see RenderSystemDescriptor::captureFilename
+*/
+class LLGL_EXPORT TraceReplayer : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Loads the specified trace file into memory for replay.
+        \param[in] renderSystem Specifies the render system the trace is replayed against. The render system must outlive this replayer.
+        \param[in] filename Specifies the filename of the trace.
+        \throws std::runtime_error If the file could not be opened or is not a trace of a compatible format version.
+        */
+        TraceReplayer(RenderSystem& renderSystem, const std::string& filename);
+
+        //! Waits until all submitted commands are completed and releases all objects that have been created during replay.
+        ~TraceReplayer();
+
+        /**
+        \brief Replays all records up to and including the next end of a frame (i.e. a RenderContext::Present call).
+        \param[out] statistics Optional pointer to the statistics of the replayed frame.
+        \return True if any records have been replayed, or false if the end of the trace had already been reached.
+        \remarks The last frame of a trace may not end with a RenderContext::Present call, e.g. if it only contains the release of all objects.
+        \throws std::runtime_error If the trace is malformed, e.g. if a record refers to an unknown object.
+        */
+        bool ReplayFrame(TraceFrameStatistics* statistics = nullptr);
+
+        //! Returns the number of frames that have been replayed so far.
+        inline std::uint64_t GetNumFrames() const
+        {
+            return frameCounter_;
+        }
+
+    private:
+
+        RenderSystem&                   renderSystem_;
+        std::unique_ptr<CaptureReader>  reader_;
+        std::unique_ptr<Timer>          timer_;
+        std::vector<char>               scratch_;           // Scratch buffer for the data blocks of a record
+        std::uint64_t                   frameCounter_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
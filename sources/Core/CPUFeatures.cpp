@@ -0,0 +1,130 @@
+/*
+ * CPUFeatures.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CPUFeatures.h"
+
+#if defined LLGL_ARCH_X86 || defined LLGL_ARCH_X64
+#   if defined _MSC_VER
+#       include <intrin.h>
+#       include <immintrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+
+namespace LLGL
+{
+
+
+struct CPUFeatureSet
+{
+    bool sse2   = false;
+    bool ssse3  = false;
+    bool sse41  = false;
+    bool avx2   = false;
+    bool f16c   = false;
+    bool neon   = false;
+};
+
+#if defined LLGL_ARCH_X86 || defined LLGL_ARCH_X64
+
+// Executes the CPUID instruction for the specified function and sub-function IDs.
+static void QueryCPUID(int (&info)[4], int functionID, int subFunctionID = 0)
+{
+    #if defined _MSC_VER
+    __cpuidex(info, functionID, subFunctionID);
+    #else
+    unsigned int regs[4] = { 0, 0, 0, 0 };
+    __cpuid_count(functionID, subFunctionID, regs[0], regs[1], regs[2], regs[3]);
+    for (int i = 0; i < 4; ++i)
+        info[i] = static_cast<int>(regs[i]);
+    #endif
+}
+
+// Returns the lower 32 bits of the extended control register XCR0.
+static unsigned int QueryXCR0()
+{
+    #if defined _MSC_VER
+    return static_cast<unsigned int>(_xgetbv(0));
+    #else
+    unsigned int eax = 0, edx = 0;
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+    #endif
+}
+
+static CPUFeatureSet QueryCPUFeatureSet()
+{
+    CPUFeatureSet features;
+
+    int info[4] = { 0 };
+    QueryCPUID(info, 0);
+    const int maxFunctionID = info[0];
+
+    if (maxFunctionID >= 1)
+    {
+        QueryCPUID(info, 1);
+        features.sse2   = ((info[3] & (1 << 26)) != 0);
+        features.ssse3  = ((info[2] & (1 <<  9)) != 0);
+        features.sse41  = ((info[2] & (1 << 19)) != 0);
+
+        /* AVX registers must also be enabled by the OS (OSXSAVE and XCR0) */
+        const bool osxsave  = ((info[2] & (1 << 27)) != 0);
+        const bool avx      = ((info[2] & (1 << 28)) != 0);
+        const bool osAVX    = (osxsave && avx && (QueryXCR0() & 0x6) == 0x6);
+
+        features.f16c = (osAVX && (info[2] & (1 << 29)) != 0);
+
+        if (osAVX && maxFunctionID >= 7)
+        {
+            QueryCPUID(info, 7, 0);
+            features.avx2 = ((info[1] & (1 << 5)) != 0);
+        }
+    }
+
+    return features;
+}
+
+#else
+
+static CPUFeatureSet QueryCPUFeatureSet()
+{
+    CPUFeatureSet features;
+
+    #if defined LLGL_ARCH_ARM64 || defined __ARM_NEON
+    features.neon = true;
+    #endif
+
+    return features;
+}
+
+#endif
+
+LLGL_EXPORT bool IsCPUFeatureSupported(const CPUFeature feature)
+{
+    /* Query CPU features only once */
+    static const CPUFeatureSet features = QueryCPUFeatureSet();
+
+    switch (feature)
+    {
+        case CPUFeature::SSE2:  return features.sse2;
+        case CPUFeature::SSSE3: return features.ssse3;
+        case CPUFeature::SSE41: return features.sse41;
+        case CPUFeature::AVX2:  return features.avx2;
+        case CPUFeature::F16C:  return features.f16c;
+        case CPUFeature::NEON:  return features.neon;
+    }
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
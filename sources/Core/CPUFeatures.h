@@ -0,0 +1,50 @@
+/*
+ * CPUFeatures.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPU_FEATURES_H
+#define LLGL_CPU_FEATURES_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Platform/Platform.h>
+
+
+// Macro to compile a single function for an instruction set extension that is not enabled for the entire translation unit
+#if defined __GNUC__ || defined __clang__
+#   define LLGL_TARGET_FEATURE(FEATURES) __attribute__((target(FEATURES)))
+#else
+#   define LLGL_TARGET_FEATURE(FEATURES)
+#endif
+
+
+namespace LLGL
+{
+
+
+// CPU instruction set extensions that are queried at runtime.
+enum class CPUFeature
+{
+    SSE2,   // x86 Streaming SIMD Extensions 2.
+    SSSE3,  // x86 Supplemental Streaming SIMD Extensions 3 (byte shuffles).
+    SSE41,  // x86 Streaming SIMD Extensions 4.1.
+    AVX2,   // x86 Advanced Vector Extensions 2.
+    F16C,   // x86 half-precision floating-point conversion.
+    NEON,   // ARM Advanced SIMD (always available on AArch64).
+};
+
+// Returns true if the specified instruction set extension is supported by the host CPU.
+LLGL_EXPORT bool IsCPUFeatureSupported(const CPUFeature feature);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
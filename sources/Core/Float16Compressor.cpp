@@ -1,11 +1,21 @@
 /*
  * Float16Compressor.cpp
- * 
+ *
  * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
  * See "LICENSE.txt" for license information.
  */
 
 #include "Float16Compressor.h"
+#include "CPUFeatures.h"
+#include <cstring>
+
+#if defined LLGL_ARCH_X86 || defined LLGL_ARCH_X64
+#   define LLGL_FLOAT16_F16C
+#   include <immintrin.h>
+#elif defined LLGL_ARCH_ARM64
+#   define LLGL_FLOAT16_NEON
+#   include <arm_neon.h>
+#endif
 
 
 namespace LLGL
@@ -13,94 +23,265 @@ namespace LLGL
 
 
 /*
-This class has been adopted from a public-domain code sample.
-see http://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion
+Table-driven conversion between 32-bit and 16-bit floats, based on
+"Fast Half Float Conversions" by Jeroen van der Zijp (2008).
+The compression is extended by round-to-nearest-even and NaN quieting,
+so the results are bit-exact to the hardware conversions (F16C and ARMv8 FCVT).
 */
 class Float16Compressor
 {
 
     public:
 
-        static std::uint16_t Compress(float value)
+        Float16Compressor()
+        {
+            BuildCompressTables();
+            BuildDecompressTables();
+        }
+
+        std::uint16_t Compress(float value) const
         {
-            Bits v, s;
-            v.f = value;
-            std::uint32_t sign = v.si & signN;
-            v.si ^= sign;
-            sign >>= shiftSign; // logical shift
-            s.si = mulN;
-            s.si = static_cast<std::int32_t>(s.f * v.f); // correct subnormals
-            v.si ^= (s.si ^ v.si) & -(minN > v.si);
-            v.si ^= (infN ^ v.si) & -((infN > v.si) & (v.si > maxN));
-            v.si ^= (nanN ^ v.si) & -((nanN > v.si) & (v.si > infN));
-            v.ui >>= shift; // logical shift
-            v.si ^= ((v.si - maxD) ^ v.si) & -(v.si > maxC);
-            v.si ^= ((v.si - minD) ^ v.si) & -(v.si > subC);
-            return (v.ui | sign);
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            /* Look up sign and exponent, and add the implicit leading bit for subnormal results */
+            const std::uint32_t idx         = (bits >> 23);
+            const std::uint32_t mantissa    = (bits & 0x007fffffu);
+            const std::uint32_t m           = (mantissa | implicitTable_[idx]);
+            const std::uint32_t shift       = shiftTable_[idx];
+
+            std::uint32_t h = baseTable_[idx] + (m >> shift);
+
+            /* Round to nearest even; a carry into the exponent yields the next power of two or infinity */
+            const std::uint32_t roundBit    = (m >> (shift - 1u)) & 1u;
+            const std::uint32_t stickyBits  = (m & ((1u << (shift - 1u)) - 1u));
+            h += roundBit & (static_cast<std::uint32_t>(stickyBits != 0) | (h & 1u)) & roundTable_[idx];
+
+            /* Quiet NaNs (only set for exponent 255 with non-zero mantissa) */
+            h |= nanTable_[idx] & (0u - static_cast<std::uint32_t>(mantissa != 0));
+
+            return static_cast<std::uint16_t>(h);
         }
 
-        static float Decompress(std::uint16_t value)
+        float Decompress(std::uint16_t value) const
         {
-            Bits v;
-            v.ui = value;
-            int32_t sign = v.si & signC;
-            v.si ^= sign;
-            sign <<= shiftSign;
-            v.si ^= ((v.si + minD) ^ v.si) & -(v.si > subC);
-            v.si ^= ((v.si + maxD) ^ v.si) & -(v.si > maxC);
-            Bits s;
-            s.si = mulC;
-            s.f *= v.si;
-            int32_t mask = -(norC > v.si);
-            v.si <<= shift;
-            v.si ^= (s.si ^ v.si) & mask;
-            v.si |= sign;
-            return v.f;
+            const std::uint32_t idx     = (value >> 10);
+            const std::uint32_t bits    = mantissaTable_[offsetTable_[idx] + (value & 0x03ffu)] + exponentTable_[idx];
+            float result;
+            std::memcpy(&result, &bits, sizeof(result));
+            return result;
         }
 
     private:
 
-        union Bits
+        void BuildCompressTables()
+        {
+            for (std::uint32_t i = 0; i < 256; ++i)
+            {
+                const std::int32_t e = static_cast<std::int32_t>(i) - 127;
+
+                std::uint16_t base      = 0;
+                std::uint8_t  shift     = 24;
+                std::uint32_t implicit  = 0;
+                std::uint8_t  round     = 1;
+                std::uint16_t nan       = 0;
+
+                if (e < -25)
+                {
+                    /* Very small numbers map to zero */
+                }
+                else if (e < -14)
+                {
+                    /* Small numbers map to subnormals (shift includes the implicit leading bit) */
+                    shift       = static_cast<std::uint8_t>(-e - 1);
+                    implicit    = 0x00800000u;
+                }
+                else if (e <= 15)
+                {
+                    /* Normal numbers just lose precision */
+                    base        = static_cast<std::uint16_t>((e + 15) << 10);
+                    shift       = 13;
+                }
+                else if (e < 128)
+                {
+                    /* Large numbers map to infinity */
+                    base        = 0x7c00;
+                    round       = 0;
+                }
+                else
+                {
+                    /* Infinity and NaN's stay infinity and NaN's (payload is truncated) */
+                    base        = 0x7c00;
+                    shift       = 13;
+                    round       = 0;
+                    nan         = 0x0200;
+                }
+
+                baseTable_[i        ] = base;
+                baseTable_[i | 0x100] = static_cast<std::uint16_t>(base | 0x8000);
+                shiftTable_[i        ] = shiftTable_[i | 0x100] = shift;
+                implicitTable_[i     ] = implicitTable_[i | 0x100] = implicit;
+                roundTable_[i        ] = roundTable_[i | 0x100] = round;
+                nanTable_[i          ] = nanTable_[i | 0x100] = nan;
+            }
+        }
+
+        void BuildDecompressTables()
         {
-            float           f;
-            std::int32_t    si;
-            std::uint32_t   ui;
-        };
+            /* Zero and subnormals (renormalized into 32-bit normals) */
+            mantissaTable_[0] = 0;
+            for (std::uint32_t i = 1; i < 1024; ++i)
+            {
+                std::uint32_t m = (i << 13);
+                std::uint32_t e = 0;
+                while ((m & 0x00800000u) == 0)
+                {
+                    e -= 0x00800000u;
+                    m <<= 1;
+                }
+                m &= ~0x00800000u;
+                e += 0x38800000u;
+                mantissaTable_[i] = (m | e);
+            }
 
-        static const std::int32_t shift     = 13;
-        static const std::int32_t shiftSign = 16;
+            /* Normals, and NaN's with the quiet bit set */
+            for (std::uint32_t i = 0; i < 1024; ++i)
+            {
+                mantissaTable_[1024 + i] = (i << 13);
+                mantissaTable_[2048 + i] = (i << 13) | (i != 0 ? 0x00400000u : 0u);
+            }
 
-        static const std::int32_t infN      = 0x7f800000; // flt32 infinity
-        static const std::int32_t maxN      = 0x477fe000; // max flt16 normal as a flt32
-        static const std::int32_t minN      = 0x38800000; // min flt16 normal as a flt32
-        static const std::int32_t signN     = 0x80000000; // flt32 sign bit
+            for (std::uint32_t i = 0; i < 32; ++i)
+            {
+                std::uint32_t exponent;
+                if (i == 0)
+                    exponent = 0;
+                else if (i < 31)
+                    exponent = ((i + 112) << 23);
+                else
+                    exponent = 0x7f800000u;
 
-        static const std::int32_t infC      = (infN >> shift);
-        static const std::int32_t nanN      = ((infC + 1) << shift); // minimum flt16 nan as a flt32
-        static const std::int32_t maxC      = (maxN >> shift);
-        static const std::int32_t minC      = (minN >> shift);
-        static const std::int32_t signC     = (signN >> shiftSign); // flt16 sign bit
+                exponentTable_[i     ] = exponent;
+                exponentTable_[i + 32] = exponent | 0x80000000u;
 
-        static const std::int32_t mulN      = 0x52000000; // (1 << 23) / minN
-        static const std::int32_t mulC      = 0x33800000; // minN / (1 << (23 - shift))
+                const std::uint16_t offset = (i == 0 ? 0 : (i < 31 ? 1024 : 2048));
+                offsetTable_[i     ] = offset;
+                offsetTable_[i + 32] = offset;
+            }
+        }
+
+    private:
 
-        static const std::int32_t subC      = 0x003ff; // max flt32 subnormal down shifted
-        static const std::int32_t norC      = 0x00400; // min flt32 normal down shifted
+        std::uint16_t baseTable_[512];
+        std::uint8_t  shiftTable_[512];
+        std::uint32_t implicitTable_[512];
+        std::uint8_t  roundTable_[512];
+        std::uint16_t nanTable_[512];
 
-        static const std::int32_t maxD      = (infC - maxC - 1);
-        static const std::int32_t minD      = (minC - subC - 1);
+        std::uint32_t mantissaTable_[3072];
+        std::uint32_t exponentTable_[64];
+        std::uint16_t offsetTable_[64];
 
 };
 
+static const Float16Compressor g_float16Compressor;
+
+
+/* ----- Vectorized kernels ----- */
+
+#ifdef LLGL_FLOAT16_F16C
+
+LLGL_TARGET_FEATURE("f16c,avx")
+static std::size_t CompressFloat16Array_F16C(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 v = _mm256_loadu_ps(src + i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
+}
+
+LLGL_TARGET_FEATURE("f16c,avx")
+static std::size_t DecompressFloat16Array_F16C(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(v));
+    }
+    return i;
+}
+
+#endif // /LLGL_FLOAT16_F16C
+
+#ifdef LLGL_FLOAT16_NEON
+
+static std::size_t CompressFloat16Array_NEON(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+    return i;
+}
+
+static std::size_t DecompressFloat16Array_NEON(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    return i;
+}
+
+#endif // /LLGL_FLOAT16_NEON
+
+
+/* ----- Functions ----- */
 
 LLGL_EXPORT std::uint16_t CompressFloat16(float value)
 {
-    return Float16Compressor::Compress(value);
+    return g_float16Compressor.Compress(value);
 }
 
 LLGL_EXPORT float DecompressFloat16(std::uint16_t value)
 {
-    return Float16Compressor::Decompress(value);
+    return g_float16Compressor.Decompress(value);
+}
+
+LLGL_EXPORT void CompressFloat16Array(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    std::size_t i = 0;
+
+    #if defined LLGL_FLOAT16_F16C
+    static const bool hasF16C = IsCPUFeatureSupported(CPUFeature::F16C);
+    if (hasF16C)
+        i = CompressFloat16Array_F16C(src, dst, count);
+    #elif defined LLGL_FLOAT16_NEON
+    i = CompressFloat16Array_NEON(src, dst, count);
+    #endif
+
+    /* Convert remaining elements with the table-driven conversion */
+    for (; i < count; ++i)
+        dst[i] = g_float16Compressor.Compress(src[i]);
+}
+
+LLGL_EXPORT void DecompressFloat16Array(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+
+    #if defined LLGL_FLOAT16_F16C
+    static const bool hasF16C = IsCPUFeatureSupported(CPUFeature::F16C);
+    if (hasF16C)
+        i = DecompressFloat16Array_F16C(src, dst, count);
+    #elif defined LLGL_FLOAT16_NEON
+    i = DecompressFloat16Array_NEON(src, dst, count);
+    #endif
+
+    /* Convert remaining elements with the table-driven conversion */
+    for (; i < count; ++i)
+        dst[i] = g_float16Compressor.Decompress(src[i]);
 }
 
 
@@ -10,6 +10,7 @@
 
 
 #include "../Renderer/CheckedCast.h"
+#include "../Renderer/HWObjectPool.h"
 #include <LLGL/Export.h>
 #include <algorithm>
 #include <type_traits>
@@ -133,6 +134,13 @@ void RemoveFromUniqueSet(std::set<std::unique_ptr<T>>& cont, const TBase* entry)
     }
 }
 
+// Removes the specified entry from the hardware object pool in O(1) and destroys it.
+template <typename T, typename TBase>
+void RemoveFromUniqueSet(HWObjectPool<T>& cont, const TBase* entry)
+{
+    cont.Remove(static_cast<const T*>(entry));
+}
+
 template <typename BaseType, typename SubType>
 SubType* TakeOwnership(std::set<std::unique_ptr<BaseType>>& objectSet, std::unique_ptr<SubType>&& object)
 {
@@ -157,6 +165,14 @@ SubType* TakeOwnership(std::list<std::unique_ptr<BaseType>>& objectSet, std::uni
     return ref;
 }
 
+template <typename BaseType, typename SubType>
+SubType* TakeOwnership(HWObjectPool<BaseType>& objectPool, std::unique_ptr<SubType>&& object)
+{
+    auto ref = object.get();
+    objectPool.Insert(std::forward<std::unique_ptr<SubType>>(object));
+    return ref;
+}
+
 // Returns the specified integral value as hexadecimal string.
 template <typename T>
 std::string ToHex(T value)
@@ -0,0 +1,581 @@
+/*
+ * ImageConversionSIMD.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ImageConversionSIMD.h"
+#include "CPUFeatures.h"
+#include <limits>
+#include <cstdint>
+#include <cstring>
+
+#if defined LLGL_ARCH_X86 || defined LLGL_ARCH_X64
+#   define LLGL_SIMD_X86
+#   include <emmintrin.h>
+#   include <tmmintrin.h>
+#   include <smmintrin.h>
+#   include <immintrin.h>
+#elif defined LLGL_ARCH_ARM64
+#   define LLGL_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- Scalar functions ----- */
+
+/*
+These scalar functions are used for the remaining pixels that do not fill an entire vector register.
+They are equivalent to the double round-trip of the generic conversion: Since the integer inputs are exactly representable,
+a single-precision division yields the same correctly rounded result as a double-precision division followed by rounding to float.
+The opposite direction must be computed in double-precision to get the same truncation as the generic conversion.
+*/
+
+template <typename T>
+static float UNormToFloat32(T src)
+{
+    return static_cast<float>(src) / static_cast<float>(std::numeric_limits<T>::max());
+}
+
+template <typename T>
+static T Float32ToUNorm(float src)
+{
+    /* Saturate input to [0, 1] (NaN is mapped to 0) */
+    src = (src > 0.0f ? (src < 1.0f ? src : 1.0f) : 0.0f);
+    return static_cast<T>(static_cast<double>(src) * static_cast<double>(std::numeric_limits<T>::max()));
+}
+
+// Swizzles the pixels in the range [idxBegin, idxEnd) with the default alpha value for all negative entries in 'dstMap'.
+template <typename T, std::size_t SrcSize, std::size_t DstSize>
+static void ShufflePixels(const T* src, T* dst, std::size_t idxBegin, std::size_t idxEnd, const int (&dstMap)[DstSize], T alpha)
+{
+    for (auto i = idxBegin; i < idxEnd; ++i, src += SrcSize, dst += DstSize)
+    {
+        for (std::size_t j = 0; j < DstSize; ++j)
+            dst[j] = (dstMap[j] >= 0 ? src[dstMap[j]] : alpha);
+    }
+}
+
+
+#ifdef LLGL_SIMD_X86
+
+/* ----- SSE2/SSSE3 kernels ----- */
+
+LLGL_TARGET_FEATURE("sse2")
+static void ConvertUInt8ToFloat32_SSE2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const std::uint8_t*>(srcBuffer);
+    auto dst = static_cast<float*>(dstBuffer);
+
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128  scale = _mm_set1_ps(255.0f);
+
+    auto i = idxBegin;
+
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        __m128i v   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i lo  = _mm_unpacklo_epi8(v, zero);
+        __m128i hi  = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_ps(dst + i     , _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dst + i +  4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dst + i +  8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+        _mm_storeu_ps(dst + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = UNormToFloat32(src[i]);
+}
+
+LLGL_TARGET_FEATURE("sse2")
+static void ConvertUInt16ToFloat32_SSE2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const std::uint16_t*>(srcBuffer);
+    auto dst = static_cast<float*>(dstBuffer);
+
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128  scale = _mm_set1_ps(65535.0f);
+
+    auto i = idxBegin;
+
+    for (; i + 8 <= idxEnd; i += 8)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_ps(dst + i    , _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale));
+        _mm_storeu_ps(dst + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale));
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = UNormToFloat32(src[i]);
+}
+
+// Saturates four floats to [0, 1] and returns them multiplied by 'scale' (in double-precision) as truncated 32-bit integers.
+LLGL_TARGET_FEATURE("sse2")
+static __m128i SaturateAndScale_SSE2(__m128 v, __m128d scale)
+{
+    /* MAXPS returns the second operand if either operand is NaN, so NaN is mapped to 0 */
+    v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    __m128i lo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtps_pd(v), scale));
+    __m128i hi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)), scale));
+    return _mm_unpacklo_epi64(lo, hi);
+}
+
+LLGL_TARGET_FEATURE("sse2")
+static void ConvertFloat32ToUInt8_SSE2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const float*>(srcBuffer);
+    auto dst = static_cast<std::uint8_t*>(dstBuffer);
+
+    const __m128d scale = _mm_set1_pd(255.0);
+
+    auto i = idxBegin;
+
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        __m128i a = SaturateAndScale_SSE2(_mm_loadu_ps(src + i     ), scale);
+        __m128i b = SaturateAndScale_SSE2(_mm_loadu_ps(src + i +  4), scale);
+        __m128i c = SaturateAndScale_SSE2(_mm_loadu_ps(src + i +  8), scale);
+        __m128i d = SaturateAndScale_SSE2(_mm_loadu_ps(src + i + 12), scale);
+        __m128i v = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = Float32ToUNorm<std::uint8_t>(src[i]);
+}
+
+LLGL_TARGET_FEATURE("sse2")
+static void ConvertFloat32ToUInt16_SSE2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const float*>(srcBuffer);
+    auto dst = static_cast<std::uint16_t*>(dstBuffer);
+
+    const __m128d scale     = _mm_set1_pd(65535.0);
+    const __m128i bias32    = _mm_set1_epi32(32768);
+    const __m128i bias16    = _mm_set1_epi16(static_cast<short>(0x8000));
+
+    auto i = idxBegin;
+
+    for (; i + 8 <= idxEnd; i += 8)
+    {
+        /* SSE2 only provides signed saturation from 32 to 16 bits, so the values are biased into the signed range */
+        __m128i a = _mm_sub_epi32(SaturateAndScale_SSE2(_mm_loadu_ps(src + i    ), scale), bias32);
+        __m128i b = _mm_sub_epi32(SaturateAndScale_SSE2(_mm_loadu_ps(src + i + 4), scale), bias32);
+        __m128i v = _mm_xor_si128(_mm_packs_epi32(a, b), bias16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = Float32ToUNorm<std::uint16_t>(src[i]);
+}
+
+// Swizzles four 32-bit float components per pixel, e.g. RGBA to BGRA.
+template <int D0, int D1, int D2, int D3>
+LLGL_TARGET_FEATURE("sse2")
+static void ShuffleFloat32x4_SSE2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const float*>(srcBuffer) + idxBegin * 4;
+    auto dst = static_cast<float*>(dstBuffer) + idxBegin * 4;
+
+    for (auto i = idxBegin; i < idxEnd; ++i, src += 4, dst += 4)
+    {
+        __m128 v = _mm_loadu_ps(src);
+        _mm_storeu_ps(dst, _mm_shuffle_ps(v, v, _MM_SHUFFLE(D3, D2, D1, D0)));
+    }
+}
+
+// Builds the byte shuffle mask and alpha mask for 'numPixels' pixels with 'SrcSize' and 'DstSize' 8-bit components.
+template <std::size_t SrcSize, std::size_t DstSize>
+static void BuildShuffleMasks(std::uint8_t* shuffleMask, std::uint8_t* alphaMask, std::size_t maskSize, std::size_t numPixels, const int (&dstMap)[DstSize])
+{
+    for (std::size_t i = 0; i < maskSize; ++i)
+    {
+        /* Each 128-bit lane is shuffled separately */
+        auto laneIdx    = i % 16;
+        auto pixel      = laneIdx / DstSize;
+        auto component  = laneIdx % DstSize;
+
+        if (pixel < numPixels && dstMap[component] >= 0)
+        {
+            shuffleMask[i]  = static_cast<std::uint8_t>(pixel * SrcSize + dstMap[component]);
+            alphaMask[i]    = 0x00;
+        }
+        else
+        {
+            shuffleMask[i]  = 0x80;
+            alphaMask[i]    = (pixel < numPixels ? 0xFF : 0x00);
+        }
+    }
+}
+
+// Swizzles 8-bit components with byte shuffles (4 pixels per step) including insertion or removal of the alpha channel.
+template <std::size_t SrcSize, int... DstMap>
+LLGL_TARGET_FEATURE("ssse3")
+static void ShuffleUInt8_SSSE3(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    static const int            dstMap[]    = { DstMap... };
+    static const std::size_t    dstSize     = sizeof...(DstMap);
+
+    auto src = static_cast<const std::uint8_t*>(srcBuffer) + idxBegin * SrcSize;
+    auto dst = static_cast<std::uint8_t*>(dstBuffer) + idxBegin * dstSize;
+
+    alignas(16) std::uint8_t shuffleMask[16];
+    alignas(16) std::uint8_t alphaMask[16];
+    BuildShuffleMasks<SrcSize, dstSize>(shuffleMask, alphaMask, 16, 4, dstMap);
+
+    const __m128i shuffle   = _mm_load_si128(reinterpret_cast<const __m128i*>(shuffleMask));
+    const __m128i alpha     = _mm_load_si128(reinterpret_cast<const __m128i*>(alphaMask));
+
+    auto i = idxBegin;
+
+    /* Process 4 pixels per step, as long as an entire 16 byte vector can be read from the source */
+    for (; i + 4 <= idxEnd && (idxEnd - i) * SrcSize >= 16; i += 4, src += 4 * SrcSize, dst += 4 * dstSize)
+    {
+        __m128i v = _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), shuffle), alpha);
+
+        if (dstSize == 4)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+        else
+        {
+            /* Store only 12 bytes for 4 pixels with 3 components */
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), v);
+            auto hi = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+            std::memcpy(dst + 8, &hi, 4);
+        }
+    }
+
+    ShufflePixels<std::uint8_t, SrcSize, dstSize>(src, dst, i, idxEnd, dstMap, 0xFF);
+}
+
+
+/* ----- AVX2 kernels ----- */
+
+LLGL_TARGET_FEATURE("avx2")
+static void ConvertUInt8ToFloat32_AVX2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const std::uint8_t*>(srcBuffer);
+    auto dst = static_cast<float*>(dstBuffer);
+
+    const __m256 scale = _mm256_set1_ps(255.0f);
+
+    auto i = idxBegin;
+
+    for (; i + 8 <= idxEnd; i += 8)
+    {
+        __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_div_ps(_mm256_cvtepi32_ps(v), scale));
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = UNormToFloat32(src[i]);
+}
+
+LLGL_TARGET_FEATURE("avx2")
+static void ConvertUInt16ToFloat32_AVX2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const std::uint16_t*>(srcBuffer);
+    auto dst = static_cast<float*>(dstBuffer);
+
+    const __m256 scale = _mm256_set1_ps(65535.0f);
+
+    auto i = idxBegin;
+
+    for (; i + 8 <= idxEnd; i += 8)
+    {
+        __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_div_ps(_mm256_cvtepi32_ps(v), scale));
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = UNormToFloat32(src[i]);
+}
+
+// Saturates eight floats to [0, 1] and returns them multiplied by 'scale' (in double-precision) as truncated 32-bit integers.
+LLGL_TARGET_FEATURE("avx2")
+static void SaturateAndScale_AVX2(__m256 v, __m256d scale, __m128i& lo, __m128i& hi)
+{
+    v   = _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+    lo  = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v)), scale));
+    hi  = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)), scale));
+}
+
+LLGL_TARGET_FEATURE("avx2")
+static void ConvertFloat32ToUInt8_AVX2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const float*>(srcBuffer);
+    auto dst = static_cast<std::uint8_t*>(dstBuffer);
+
+    const __m256d scale = _mm256_set1_pd(255.0);
+
+    auto i = idxBegin;
+
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        __m128i a, b, c, d;
+        SaturateAndScale_AVX2(_mm256_loadu_ps(src + i    ), scale, a, b);
+        SaturateAndScale_AVX2(_mm256_loadu_ps(src + i + 8), scale, c, d);
+        __m128i v = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = Float32ToUNorm<std::uint8_t>(src[i]);
+}
+
+LLGL_TARGET_FEATURE("avx2")
+static void ConvertFloat32ToUInt16_AVX2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const float*>(srcBuffer);
+    auto dst = static_cast<std::uint16_t*>(dstBuffer);
+
+    const __m256d scale = _mm256_set1_pd(65535.0);
+
+    auto i = idxBegin;
+
+    for (; i + 8 <= idxEnd; i += 8)
+    {
+        __m128i a, b;
+        SaturateAndScale_AVX2(_mm256_loadu_ps(src + i), scale, a, b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi32(a, b));
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = Float32ToUNorm<std::uint16_t>(src[i]);
+}
+
+// Swizzles four 8-bit components per pixel with byte shuffles (8 pixels per step).
+template <int... DstMap>
+LLGL_TARGET_FEATURE("avx2")
+static void ShuffleUInt8x4_AVX2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    static const int dstMap[] = { DstMap... };
+
+    auto src = static_cast<const std::uint8_t*>(srcBuffer) + idxBegin * 4;
+    auto dst = static_cast<std::uint8_t*>(dstBuffer) + idxBegin * 4;
+
+    alignas(32) std::uint8_t shuffleMask[32];
+    alignas(32) std::uint8_t alphaMask[32];
+    BuildShuffleMasks<4, 4>(shuffleMask, alphaMask, 32, 4, dstMap);
+
+    const __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(shuffleMask));
+
+    auto i = idxBegin;
+
+    for (; i + 8 <= idxEnd; i += 8, src += 32, dst += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_shuffle_epi8(v, shuffle));
+    }
+
+    ShufflePixels<std::uint8_t, 4, 4>(src, dst, i, idxEnd, dstMap, 0xFF);
+}
+
+#endif // /LLGL_SIMD_X86
+
+
+#ifdef LLGL_SIMD_NEON
+
+/* ----- NEON kernels ----- */
+
+// Wrapper for interleaved loads and stores of 8-bit pixels with 3 or 4 components.
+template <std::size_t Size>
+struct NEONPixelsUInt8;
+
+template <>
+struct NEONPixelsUInt8<3>
+{
+    using Type = uint8x16x3_t;
+    static Type Load(const std::uint8_t* src) { return vld3q_u8(src); }
+    static void Store(std::uint8_t* dst, const Type& v) { vst3q_u8(dst, v); }
+};
+
+template <>
+struct NEONPixelsUInt8<4>
+{
+    using Type = uint8x16x4_t;
+    static Type Load(const std::uint8_t* src) { return vld4q_u8(src); }
+    static void Store(std::uint8_t* dst, const Type& v) { vst4q_u8(dst, v); }
+};
+
+// Swizzles 8-bit components with de-interleaving loads (16 pixels per step) including insertion or removal of the alpha channel.
+template <std::size_t SrcSize, int... DstMap>
+static void ShuffleUInt8_NEON(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    static const int            dstMap[]    = { DstMap... };
+    static const std::size_t    dstSize     = sizeof...(DstMap);
+
+    auto src = static_cast<const std::uint8_t*>(srcBuffer) + idxBegin * SrcSize;
+    auto dst = static_cast<std::uint8_t*>(dstBuffer) + idxBegin * dstSize;
+
+    const uint8x16_t alpha = vdupq_n_u8(0xFF);
+
+    auto i = idxBegin;
+
+    for (; i + 16 <= idxEnd; i += 16, src += 16 * SrcSize, dst += 16 * dstSize)
+    {
+        auto in = NEONPixelsUInt8<SrcSize>::Load(src);
+        typename NEONPixelsUInt8<dstSize>::Type out;
+
+        for (std::size_t j = 0; j < dstSize; ++j)
+            out.val[j] = (dstMap[j] >= 0 ? in.val[dstMap[j]] : alpha);
+
+        NEONPixelsUInt8<dstSize>::Store(dst, out);
+    }
+
+    ShufflePixels<std::uint8_t, SrcSize, dstSize>(src, dst, i, idxEnd, dstMap, 0xFF);
+}
+
+static void ConvertUInt8ToFloat32_NEON(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const std::uint8_t*>(srcBuffer);
+    auto dst = static_cast<float*>(dstBuffer);
+
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+
+    auto i = idxBegin;
+
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        uint8x16_t v    = vld1q_u8(src + i);
+        uint16x8_t lo   = vmovl_u8(vget_low_u8(v));
+        uint16x8_t hi   = vmovl_high_u8(v);
+        vst1q_f32(dst + i     , vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), scale));
+        vst1q_f32(dst + i +  4, vdivq_f32(vcvtq_f32_u32(vmovl_high_u16(lo)), scale));
+        vst1q_f32(dst + i +  8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), scale));
+        vst1q_f32(dst + i + 12, vdivq_f32(vcvtq_f32_u32(vmovl_high_u16(hi)), scale));
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = UNormToFloat32(src[i]);
+}
+
+static void ConvertUInt16ToFloat32_NEON(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = static_cast<const std::uint16_t*>(srcBuffer);
+    auto dst = static_cast<float*>(dstBuffer);
+
+    const float32x4_t scale = vdupq_n_f32(65535.0f);
+
+    auto i = idxBegin;
+
+    for (; i + 8 <= idxEnd; i += 8)
+    {
+        uint16x8_t v = vld1q_u16(src + i);
+        vst1q_f32(dst + i    , vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), scale));
+        vst1q_f32(dst + i + 4, vdivq_f32(vcvtq_f32_u32(vmovl_high_u16(v)), scale));
+    }
+
+    for (; i < idxEnd; ++i)
+        dst[i] = UNormToFloat32(src[i]);
+}
+
+#endif // /LLGL_SIMD_NEON
+
+
+/* ----- Kernel table ----- */
+
+struct SIMDKernelEntry
+{
+    CPUFeature              feature;
+    ImageFormat             srcFormat;
+    DataType                srcDataType;
+    ImageFormat             dstFormat;
+    DataType                dstDataType;
+    ImageConversionKernel   kernel;
+};
+
+#define LLGL_SIMD_KERNEL_TYPE(FEATURE, SRC_TYPE, DST_TYPE, FUNC) \
+    { CPUFeature::FEATURE, ImageFormat::R, DataType::SRC_TYPE, ImageFormat::R, DataType::DST_TYPE, FUNC }
+
+#define LLGL_SIMD_KERNEL_FORMAT(FEATURE, SRC_FMT, DST_FMT, TYPE, FUNC) \
+    { CPUFeature::FEATURE, ImageFormat::SRC_FMT, DataType::TYPE, ImageFormat::DST_FMT, DataType::TYPE, FUNC }
+
+#define LLGL_SIMD_KERNEL_FORMATS_UINT8(FEATURE, FUNC)                                   \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, RGB,  RGBA, UInt8, (FUNC<3, 0, 1, 2, -1>) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, RGB,  BGRA, UInt8, (FUNC<3, 2, 1, 0, -1>) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, BGR,  RGBA, UInt8, (FUNC<3, 2, 1, 0, -1>) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, BGR,  BGRA, UInt8, (FUNC<3, 0, 1, 2, -1>) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, RGB,  BGR,  UInt8, (FUNC<3, 2, 1, 0    >) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, BGR,  RGB,  UInt8, (FUNC<3, 2, 1, 0    >) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, RGBA, RGB,  UInt8, (FUNC<4, 0, 1, 2    >) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, RGBA, BGR,  UInt8, (FUNC<4, 2, 1, 0    >) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, BGRA, RGB,  UInt8, (FUNC<4, 2, 1, 0    >) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, BGRA, BGR,  UInt8, (FUNC<4, 0, 1, 2    >) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, RGBA, BGRA, UInt8, (FUNC<4, 2, 1, 0, 3 >) ),      \
+    LLGL_SIMD_KERNEL_FORMAT( FEATURE, BGRA, RGBA, UInt8, (FUNC<4, 2, 1, 0, 3 >) )
+
+// Kernels are sorted by preference, i.e. the first supported entry is selected.
+static const SIMDKernelEntry g_simdKernels[] =
+{
+    #ifdef LLGL_SIMD_X86
+
+    /* AVX2 kernels */
+    LLGL_SIMD_KERNEL_TYPE( AVX2, UInt8,   Float32, ConvertUInt8ToFloat32_AVX2  ),
+    LLGL_SIMD_KERNEL_TYPE( AVX2, UInt16,  Float32, ConvertUInt16ToFloat32_AVX2 ),
+    LLGL_SIMD_KERNEL_TYPE( AVX2, Float32, UInt8,   ConvertFloat32ToUInt8_AVX2  ),
+    LLGL_SIMD_KERNEL_TYPE( AVX2, Float32, UInt16,  ConvertFloat32ToUInt16_AVX2 ),
+    LLGL_SIMD_KERNEL_FORMAT( AVX2, RGBA, BGRA, UInt8, (ShuffleUInt8x4_AVX2<2, 1, 0, 3>) ),
+    LLGL_SIMD_KERNEL_FORMAT( AVX2, BGRA, RGBA, UInt8, (ShuffleUInt8x4_AVX2<2, 1, 0, 3>) ),
+
+    /* SSSE3 kernels */
+    LLGL_SIMD_KERNEL_FORMATS_UINT8( SSSE3, ShuffleUInt8_SSSE3 ),
+
+    /* SSE2 kernels */
+    LLGL_SIMD_KERNEL_TYPE( SSE2, UInt8,   Float32, ConvertUInt8ToFloat32_SSE2  ),
+    LLGL_SIMD_KERNEL_TYPE( SSE2, UInt16,  Float32, ConvertUInt16ToFloat32_SSE2 ),
+    LLGL_SIMD_KERNEL_TYPE( SSE2, Float32, UInt8,   ConvertFloat32ToUInt8_SSE2  ),
+    LLGL_SIMD_KERNEL_TYPE( SSE2, Float32, UInt16,  ConvertFloat32ToUInt16_SSE2 ),
+    LLGL_SIMD_KERNEL_FORMAT( SSE2, RGBA, BGRA, Float32, (ShuffleFloat32x4_SSE2<2, 1, 0, 3>) ),
+    LLGL_SIMD_KERNEL_FORMAT( SSE2, BGRA, RGBA, Float32, (ShuffleFloat32x4_SSE2<2, 1, 0, 3>) ),
+
+    #endif // /LLGL_SIMD_X86
+
+    #ifdef LLGL_SIMD_NEON
+
+    /* NEON kernels */
+    LLGL_SIMD_KERNEL_TYPE( NEON, UInt8,  Float32, ConvertUInt8ToFloat32_NEON  ),
+    LLGL_SIMD_KERNEL_TYPE( NEON, UInt16, Float32, ConvertUInt16ToFloat32_NEON ),
+    LLGL_SIMD_KERNEL_FORMATS_UINT8( NEON, ShuffleUInt8_NEON ),
+
+    #endif // /LLGL_SIMD_NEON
+
+    /* Terminating entry to avoid an empty array */
+    { CPUFeature::SSE2, ImageFormat::R, DataType::UInt8, ImageFormat::R, DataType::UInt8, nullptr }
+};
+
+#undef LLGL_SIMD_KERNEL_TYPE
+#undef LLGL_SIMD_KERNEL_FORMAT
+#undef LLGL_SIMD_KERNEL_FORMATS_UINT8
+
+ImageConversionKernel FindImageConversionKernelSIMD(
+    ImageFormat srcFormat,
+    DataType    srcDataType,
+    ImageFormat dstFormat,
+    DataType    dstDataType)
+{
+    for (const auto& entry : g_simdKernels)
+    {
+        if (entry.kernel      != nullptr     &&
+            entry.srcFormat   == srcFormat   &&
+            entry.srcDataType == srcDataType &&
+            entry.dstFormat   == dstFormat   &&
+            entry.dstDataType == dstDataType &&
+            IsCPUFeatureSupported(entry.feature))
+        {
+            return entry.kernel;
+        }
+    }
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,44 @@
+/*
+ * ImageConversionSIMD.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_IMAGE_CONVERSION_SIMD_H
+#define LLGL_IMAGE_CONVERSION_SIMD_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Function signature for specialized conversion kernels that process the pixels in the range [idxBegin, idxEnd).
+using ImageConversionKernel = void (*)(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd);
+
+/*
+Returns the best vectorized kernel for the specified conversion that is supported by the host CPU,
+or null if there is no vectorized kernel for this conversion. Data type conversions (with equal image formats)
+are looked up with ImageFormat::R for both formats, because they are independent of the image format.
+The results of all vectorized kernels are bit-exact to the generic conversion.
+*/
+ImageConversionKernel FindImageConversionKernelSIMD(
+    ImageFormat srcFormat,
+    DataType    srcDataType,
+    ImageFormat dstFormat,
+    DataType    dstDataType
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
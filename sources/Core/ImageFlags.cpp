@@ -14,6 +14,8 @@
 #include <cstring>
 #include "../Core/Assertion.h"
 #include "Float16Compressor.h"
+#include "ImageConversionSIMD.h"
+#include "ThreadPool.h"
 
 
 namespace LLGL
@@ -92,12 +94,13 @@ double ReadNormalizedVariant(const T& src)
     return (static_cast<double>(src) - min) / (max - min);
 }
 
-// Writes the specified value from the range [0, 1] to the destination variant.
+// Writes the specified value from the range [0, 1] to the destination variant. Values outside this range are saturated (NaN is mapped to 0).
 template <typename T>
 void WriteNormalizedVariant(T& dst, double value)
 {
     auto min = static_cast<double>(std::numeric_limits<T>::min());
     auto max = static_cast<double>(std::numeric_limits<T>::max());
+    value = (value > 0.0 ? (value < 1.0 ? value : 1.0) : 0.0);
     dst = static_cast<T>(value * (max - min) + min);
 }
 
@@ -161,11 +164,232 @@ static void WriteNormalizedTypedVariant(DataType dstDataType, VariantBuffer& dst
     }
 }
 
+static void SetVariantMinMax(DataType dataType, Variant& var, bool setMin)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:
+            var.int8 = (setMin ? std::numeric_limits<std::int8_t>::min() : std::numeric_limits<std::int8_t>::max());
+            break;
+        case DataType::UInt8:
+            var.uint8 = (setMin ? std::numeric_limits<std::uint8_t>::min() : std::numeric_limits<std::uint8_t>::max());
+            break;
+        case DataType::Int16:
+            var.int16 = (setMin ? std::numeric_limits<std::int16_t>::min() : std::numeric_limits<std::int16_t>::max());
+            break;
+        case DataType::UInt16:
+            var.uint16 = (setMin ? std::numeric_limits<std::uint16_t>::min() : std::numeric_limits<std::uint16_t>::max());
+            break;
+        case DataType::Int32:
+            var.int32 = (setMin ? std::numeric_limits<std::int32_t>::min() : std::numeric_limits<std::int32_t>::max());
+            break;
+        case DataType::UInt32:
+            var.uint32 = (setMin ? std::numeric_limits<std::uint32_t>::min() : std::numeric_limits<std::uint32_t>::max());
+            break;
+        case DataType::Float16:
+            var.uint16 = CompressFloat16(setMin ? 0.0f : 1.0f);
+            break;
+        case DataType::Float32:
+            var.real32 = (setMin ? 0.0f : 1.0f);
+            break;
+        case DataType::Float64:
+            var.real64 = (setMin ? 0.0 : 1.0);
+            break;
+    }
+}
+
 static ByteBuffer AllocByteArray(std::size_t size)
 {
     return ByteBuffer { new char[size] };
 }
 
+/* ----- Specialized conversion kernels ----- */
+
+/*
+The specialized kernels avoid the per-component switch and double round-trip of the generic conversion workers
+for the most common combinations of image formats and data types. Each kernel is chosen once per conversion call
+and must produce exactly the same results as the generic path.
+*/
+
+// Returns the source component unmodified.
+template <typename T>
+T CopyComponent(T src)
+{
+    return src;
+}
+
+// Converts the specified normalized integer into a 32-bit float (equivalent to the generic double round-trip).
+template <typename TSrc>
+float NormalizedToFloat32(TSrc src)
+{
+    return static_cast<float>(ReadNormalizedVariant(src));
+}
+
+// Converts the specified 32-bit float into a normalized integer (equivalent to the generic double round-trip).
+template <typename TDst>
+TDst Float32ToNormalized(float src)
+{
+    TDst dst;
+    WriteNormalizedVariant(dst, static_cast<double>(src));
+    return dst;
+}
+
+// Converts the specified normalized integer into a 16-bit float.
+template <typename TSrc>
+std::uint16_t NormalizedToFloat16(TSrc src)
+{
+    return CompressFloat16(static_cast<float>(ReadNormalizedVariant(src)));
+}
+
+// Converts the specified 16-bit float into a normalized integer.
+template <typename TDst>
+TDst Float16ToNormalized(std::uint16_t src)
+{
+    TDst dst;
+    WriteNormalizedVariant(dst, static_cast<double>(DecompressFloat16(src)));
+    return dst;
+}
+
+// Returns the default alpha component for the specified data type, i.e. the maximum of the normalized range.
+template <typename T>
+T GetDefaultAlpha(DataType dataType)
+{
+    Variant var;
+    SetVariantMinMax(dataType, var, false);
+    T alpha;
+    std::memcpy(&alpha, &var, sizeof(T));
+    return alpha;
+}
+
+/*
+Generic template for all specialized kernels: Each destination component 'i' is read from the source component 'DstMap[i]'
+and converted by 'Convert', or is set to the default alpha value of 'DstDataType' if 'DstMap[i]' is negative.
+*/
+template <typename TSrc, typename TDst, TDst (*Convert)(TSrc), DataType DstDataType, std::size_t SrcSize, int... DstMap>
+void ConvertImageKernel(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    static const int            dstMap[]    = { DstMap... };
+    static const std::size_t    dstSize     = sizeof...(DstMap);
+
+    const TDst alpha = GetDefaultAlpha<TDst>(DstDataType);
+
+    auto src = reinterpret_cast<const TSrc*>(srcBuffer) + idxBegin * SrcSize;
+    auto dst = reinterpret_cast<TDst*>(dstBuffer) + idxBegin * dstSize;
+
+    for (auto i = idxBegin; i < idxEnd; ++i, src += SrcSize, dst += dstSize)
+    {
+        for (std::size_t j = 0; j < dstSize; ++j)
+            dst[j] = (dstMap[j] >= 0 ? Convert(src[dstMap[j]]) : alpha);
+    }
+}
+
+// Converts 32-bit floats into 16-bit floats with the bulk conversion (uses F16C or NEON if available).
+static void CompressFloat16Kernel(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    CompressFloat16Array(
+        reinterpret_cast<const float*>(srcBuffer) + idxBegin,
+        reinterpret_cast<std::uint16_t*>(dstBuffer) + idxBegin,
+        idxEnd - idxBegin
+    );
+}
+
+// Converts 16-bit floats into 32-bit floats with the bulk conversion (uses F16C or NEON if available).
+static void DecompressFloat16Kernel(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    DecompressFloat16Array(
+        reinterpret_cast<const std::uint16_t*>(srcBuffer) + idxBegin,
+        reinterpret_cast<float*>(dstBuffer) + idxBegin,
+        idxEnd - idxBegin
+    );
+}
+
+struct ImageConversionKernelEntry
+{
+    ImageFormat             srcFormat;
+    DataType                srcDataType;
+    ImageFormat             dstFormat;
+    DataType                dstDataType;
+    ImageConversionKernel   kernel;
+};
+
+#define LLGL_KERNEL_TYPE(SRC_TYPE, DST_TYPE, TSRC, TDST, FUNC) \
+    { ImageFormat::R, DataType::SRC_TYPE, ImageFormat::R, DataType::DST_TYPE, ConvertImageKernel<TSRC, TDST, FUNC, DataType::DST_TYPE, 1, 0> }
+
+#define LLGL_KERNEL_FORMAT(SRC_FMT, DST_FMT, TYPE, T, SRC_SIZE, ...) \
+    { ImageFormat::SRC_FMT, DataType::TYPE, ImageFormat::DST_FMT, DataType::TYPE, ConvertImageKernel<T, T, CopyComponent<T>, DataType::TYPE, SRC_SIZE, __VA_ARGS__> }
+
+#define LLGL_KERNEL_FORMATS(TYPE, T)                                    \
+    LLGL_KERNEL_FORMAT( RGB,  RGBA, TYPE, T, 3, 0, 1, 2, -1 ),          \
+    LLGL_KERNEL_FORMAT( RGB,  BGRA, TYPE, T, 3, 2, 1, 0, -1 ),          \
+    LLGL_KERNEL_FORMAT( BGR,  RGBA, TYPE, T, 3, 2, 1, 0, -1 ),          \
+    LLGL_KERNEL_FORMAT( BGR,  BGRA, TYPE, T, 3, 0, 1, 2, -1 ),          \
+    LLGL_KERNEL_FORMAT( RGB,  BGR,  TYPE, T, 3, 2, 1, 0     ),          \
+    LLGL_KERNEL_FORMAT( BGR,  RGB,  TYPE, T, 3, 2, 1, 0     ),          \
+    LLGL_KERNEL_FORMAT( RGBA, RGB,  TYPE, T, 4, 0, 1, 2     ),          \
+    LLGL_KERNEL_FORMAT( RGBA, BGR,  TYPE, T, 4, 2, 1, 0     ),          \
+    LLGL_KERNEL_FORMAT( BGRA, RGB,  TYPE, T, 4, 2, 1, 0     ),          \
+    LLGL_KERNEL_FORMAT( BGRA, BGR,  TYPE, T, 4, 0, 1, 2     ),          \
+    LLGL_KERNEL_FORMAT( RGBA, BGRA, TYPE, T, 4, 2, 1, 0, 3  ),          \
+    LLGL_KERNEL_FORMAT( BGRA, RGBA, TYPE, T, 4, 2, 1, 0, 3  )
+
+#define LLGL_KERNEL_FUSED(SRC_FMT, SRC_TYPE, DST_FMT, DST_TYPE, TSRC, TDST, FUNC, SRC_SIZE, ...) \
+    { ImageFormat::SRC_FMT, DataType::SRC_TYPE, ImageFormat::DST_FMT, DataType::DST_TYPE, ConvertImageKernel<TSRC, TDST, FUNC, DataType::DST_TYPE, SRC_SIZE, __VA_ARGS__> }
+
+static const ImageConversionKernelEntry g_imageConversionKernels[] =
+{
+    /* Data type conversions (applied per component, independent of the image format) */
+    LLGL_KERNEL_TYPE( UInt8,   Float32, std::uint8_t,  float,         NormalizedToFloat32<std::uint8_t>   ),
+    LLGL_KERNEL_TYPE( UInt16,  Float32, std::uint16_t, float,         NormalizedToFloat32<std::uint16_t>  ),
+    LLGL_KERNEL_TYPE( Float32, UInt8,   float,         std::uint8_t,  Float32ToNormalized<std::uint8_t>   ),
+    LLGL_KERNEL_TYPE( Float32, UInt16,  float,         std::uint16_t, Float32ToNormalized<std::uint16_t>  ),
+    LLGL_KERNEL_TYPE( UInt8,   Float16, std::uint8_t,  std::uint16_t, NormalizedToFloat16<std::uint8_t>   ),
+    LLGL_KERNEL_TYPE( Float16, UInt8,   std::uint16_t, std::uint8_t,  Float16ToNormalized<std::uint8_t>   ),
+    { ImageFormat::R, DataType::Float32, ImageFormat::R, DataType::Float16, CompressFloat16Kernel   },
+    { ImageFormat::R, DataType::Float16, ImageFormat::R, DataType::Float32, DecompressFloat16Kernel },
+
+    /* Image format conversions (swizzling, alpha insertion and removal) */
+    LLGL_KERNEL_FORMATS( UInt8,   std::uint8_t  ),
+    LLGL_KERNEL_FORMATS( UInt16,  std::uint16_t ),
+    LLGL_KERNEL_FORMATS( Float16, std::uint16_t ),
+    LLGL_KERNEL_FORMATS( Float32, float         ),
+
+    /* Fused image format and data type conversions (avoids the intermediate buffer) */
+    LLGL_KERNEL_FUSED( RGB,  UInt8,   RGBA, Float32, std::uint8_t,  float,         NormalizedToFloat32<std::uint8_t>, 3, 0, 1, 2, -1 ),
+    LLGL_KERNEL_FUSED( BGR,  UInt8,   RGBA, Float32, std::uint8_t,  float,         NormalizedToFloat32<std::uint8_t>, 3, 2, 1, 0, -1 ),
+    LLGL_KERNEL_FUSED( BGRA, UInt8,   RGBA, Float32, std::uint8_t,  float,         NormalizedToFloat32<std::uint8_t>, 4, 2, 1, 0, 3  ),
+    LLGL_KERNEL_FUSED( RGB,  UInt8,   RGBA, Float16, std::uint8_t,  std::uint16_t, NormalizedToFloat16<std::uint8_t>, 3, 0, 1, 2, -1 ),
+    LLGL_KERNEL_FUSED( RGB,  Float32, RGBA, Float16, float,         std::uint16_t, CompressFloat16,                   3, 0, 1, 2, -1 ),
+    LLGL_KERNEL_FUSED( RGBA, Float32, BGRA, UInt8,   float,         std::uint8_t,  Float32ToNormalized<std::uint8_t>, 4, 2, 1, 0, 3  ),
+    LLGL_KERNEL_FUSED( RGBA, Float16, RGB,  Float32, std::uint16_t, float,         DecompressFloat16,                 4, 0, 1, 2     ),
+};
+
+#undef LLGL_KERNEL_TYPE
+#undef LLGL_KERNEL_FORMAT
+#undef LLGL_KERNEL_FORMATS
+#undef LLGL_KERNEL_FUSED
+
+// Returns the specialized kernel for the specified conversion, or null if the generic conversion must be used.
+static ImageConversionKernel FindImageConversionKernel(
+    ImageFormat srcFormat, DataType srcDataType, ImageFormat dstFormat, DataType dstDataType)
+{
+    /* Prefer vectorized kernels that are supported by the host CPU */
+    if (auto kernel = FindImageConversionKernelSIMD(srcFormat, srcDataType, dstFormat, dstDataType))
+        return kernel;
+
+    for (const auto& entry : g_imageConversionKernels)
+    {
+        if (entry.srcFormat   == srcFormat   &&
+            entry.srcDataType == srcDataType &&
+            entry.dstFormat   == dstFormat   &&
+            entry.dstDataType == dstDataType)
+        {
+            return entry.kernel;
+        }
+    }
+    return nullptr;
+}
+
+
 // Worker thread procedure for the "ConvertImageBufferDataType" function
 static void ConvertImageBufferDataTypeWorker(
     DataType srcDataType, const VariantConstBuffer& srcBuffer,
@@ -184,9 +408,6 @@ static void ConvertImageBufferDataTypeWorker(
     }
 }
 
-// Minimal number of entries each worker thread shall process
-static const std::size_t g_threadMinWorkSize = 64;
-
 static void ConvertImageBufferDataType(
     DataType    srcDataType,
     const void* srcBuffer,
@@ -203,79 +424,34 @@ static void ConvertImageBufferDataType(
     if (dstBufferSize != requiredDstBufferSize)
         throw std::invalid_argument("cannot convert image data type with destination buffer size mismatch");
 
-    /* Get variant buffer for source and destination images */
-    VariantConstBuffer src { srcBuffer };
-    VariantBuffer dst { dstBuffer };
-
-    threadCount = std::min(threadCount, imageSize / g_threadMinWorkSize);
-
-    if (threadCount > 1)
+    if (auto kernel = FindImageConversionKernel(ImageFormat::R, srcDataType, ImageFormat::R, dstDataType))
     {
-        /* Create worker threads */
-        std::vector<std::thread> workers(threadCount);
-
-        auto workSize       = imageSize / threadCount;
-        auto workSizeRemain = imageSize % threadCount;
-
-        std::size_t offset = 0;
-
-        for (std::size_t i = 0; i < threadCount; ++i)
-        {
-            workers[i] = std::thread(
-                ConvertImageBufferDataTypeWorker,
-                srcDataType, std::ref(src),
-                dstDataType, std::ref(dst),
-                offset, offset + workSize
-            );
-            offset += workSize;
-        }
-
-        /* Execute conversion of remaining work on main thread */
-        if (workSizeRemain > 0)
-            ConvertImageBufferDataTypeWorker(srcDataType, src, dstDataType, dst, offset, offset + workSizeRemain);
-
-        /* Join worker threads */
-        for (auto& w : workers)
-            w.join();
+        /* Execute specialized kernel (each component is treated as a single-channel pixel) */
+        DoConcurrentWork(
+            imageSize,
+            threadCount,
+            DataTypeSize(dstDataType),
+            [kernel, srcBuffer, dstBuffer](std::size_t idxBegin, std::size_t idxEnd)
+            {
+                kernel(srcBuffer, dstBuffer, idxBegin, idxEnd);
+            }
+        );
     }
     else
     {
-        /* Execute conversion only on main thread */
-        ConvertImageBufferDataTypeWorker(srcDataType, src, dstDataType, dst, 0, imageSize);
-    }
-}
-
-static void SetVariantMinMax(DataType dataType, Variant& var, bool setMin)
-{
-    switch (dataType)
-    {
-        case DataType::Int8:
-            var.int8 = (setMin ? std::numeric_limits<std::int8_t>::min() : std::numeric_limits<std::int8_t>::max());
-            break;
-        case DataType::UInt8:
-            var.uint8 = (setMin ? std::numeric_limits<std::uint8_t>::min() : std::numeric_limits<std::uint8_t>::max());
-            break;
-        case DataType::Int16:
-            var.int16 = (setMin ? std::numeric_limits<std::int16_t>::min() : std::numeric_limits<std::int16_t>::max());
-            break;
-        case DataType::UInt16:
-            var.uint16 = (setMin ? std::numeric_limits<std::uint16_t>::min() : std::numeric_limits<std::uint16_t>::max());
-            break;
-        case DataType::Int32:
-            var.int32 = (setMin ? std::numeric_limits<std::int32_t>::min() : std::numeric_limits<std::int32_t>::max());
-            break;
-        case DataType::UInt32:
-            var.uint32 = (setMin ? std::numeric_limits<std::uint32_t>::min() : std::numeric_limits<std::uint32_t>::max());
-            break;
-        case DataType::Float16:
-            var.uint16 = CompressFloat16(setMin ? 0.0f : 1.0f);
-            break;
-        case DataType::Float32:
-            var.real32 = (setMin ? 0.0f : 1.0f);
-            break;
-        case DataType::Float64:
-            var.real64 = (setMin ? 0.0 : 1.0);
-            break;
+        /* Get variant buffer for source and destination images */
+        VariantConstBuffer src { srcBuffer };
+        VariantBuffer dst { dstBuffer };
+
+        DoConcurrentWork(
+            imageSize,
+            threadCount,
+            DataTypeSize(dstDataType),
+            [srcDataType, &src, dstDataType, &dst](std::size_t idxBegin, std::size_t idxEnd)
+            {
+                ConvertImageBufferDataTypeWorker(srcDataType, src, dstDataType, dst, idxBegin, idxEnd);
+            }
+        );
     }
 }
 
@@ -459,54 +635,40 @@ static void ConvertImageBufferFormat(
     /* Allocate destination buffer */
     imageSize /= dataTypeSize;
 
-    /* Get variant buffer for source and destination images */
-    VariantConstBuffer src { srcImageDesc.data };
-    VariantBuffer dst { dstImageDesc.data };
-
-    threadCount = std::min(threadCount, imageSize / g_threadMinWorkSize);
-
-    if (threadCount > 1)
+    if (auto kernel = FindImageConversionKernel(srcImageDesc.format, srcImageDesc.dataType, dstImageDesc.format, srcImageDesc.dataType))
     {
-        /* Create worker threads */
-        std::vector<std::thread> workers(threadCount);
-
-        auto workSize       = imageSize / threadCount;
-        auto workSizeRemain = imageSize % threadCount;
-
-        std::size_t offset = 0;
-
-        for (std::size_t i = 0; i < threadCount; ++i)
-        {
-            workers[i] = std::thread(
-                ConvertImageBufferFormatWorker,
-                srcImageDesc.format, srcImageDesc.dataType, std::ref(src),
-                dstImageDesc.format, std::ref(dst),
-                offset, offset + workSize
-            );
-            offset += workSize;
-        }
-
-        /* Execute conversion of remaining work on main thread */
-        if (workSizeRemain > 0)
-        {
-            ConvertImageBufferFormatWorker(
-                srcImageDesc.format, srcImageDesc.dataType, src,
-                dstImageDesc.format, dst,
-                offset, offset + workSizeRemain
-            );
-        }
-
-        /* Join worker threads */
-        for (auto& w : workers)
-            w.join();
+        /* Execute specialized kernel */
+        auto srcBuffer = srcImageDesc.data;
+        auto dstBuffer = dstImageDesc.data;
+
+        DoConcurrentWork(
+            imageSize,
+            threadCount,
+            dstFormatSize * dataTypeSize,
+            [kernel, srcBuffer, dstBuffer](std::size_t idxBegin, std::size_t idxEnd)
+            {
+                kernel(srcBuffer, dstBuffer, idxBegin, idxEnd);
+            }
+        );
     }
     else
     {
-        /* Execute conversion only on main thread */
-        ConvertImageBufferFormatWorker(
-            srcImageDesc.format, srcImageDesc.dataType, src,
-            dstImageDesc.format, dst,
-            0, imageSize
+        /* Get variant buffer for source and destination images */
+        VariantConstBuffer src { srcImageDesc.data };
+        VariantBuffer dst { dstImageDesc.data };
+
+        auto srcFormat      = srcImageDesc.format;
+        auto srcDataType    = srcImageDesc.dataType;
+        auto dstFormat      = dstImageDesc.format;
+
+        DoConcurrentWork(
+            imageSize,
+            threadCount,
+            dstFormatSize * dataTypeSize,
+            [srcFormat, srcDataType, &src, dstFormat, &dst](std::size_t idxBegin, std::size_t idxEnd)
+            {
+                ConvertImageBufferFormatWorker(srcFormat, srcDataType, src, dstFormat, dst, idxBegin, idxEnd);
+            }
         );
     }
 }
@@ -663,6 +825,40 @@ static void ValidateImageConversionParams(
         throw std::invalid_argument("source image data size is not a multiple of the source data type size");
 }
 
+// Converts the image with a specialized kernel that handles both image format and data type at once.
+static bool ConvertImageBufferFused(
+    const SrcImageDescriptor&   srcImageDesc,
+    const DstImageDescriptor&   dstImageDesc,
+    std::size_t                 threadCount)
+{
+    auto kernel = FindImageConversionKernel(srcImageDesc.format, srcImageDesc.dataType, dstImageDesc.format, dstImageDesc.dataType);
+    if (!kernel)
+        return false;
+
+    /* Validate destination buffer size */
+    auto imageSize              = srcImageDesc.dataSize / (DataTypeSize(srcImageDesc.dataType) * ImageFormatSize(srcImageDesc.format));
+    auto requiredDstBufferSize  = imageSize * DataTypeSize(dstImageDesc.dataType) * ImageFormatSize(dstImageDesc.format);
+
+    if (dstImageDesc.dataSize != requiredDstBufferSize)
+        throw std::invalid_argument("cannot convert image format with destination buffer size mismatch");
+
+    /* Execute specialized kernel */
+    auto srcBuffer = srcImageDesc.data;
+    auto dstBuffer = dstImageDesc.data;
+
+    DoConcurrentWork(
+        imageSize,
+        threadCount,
+        DataTypeSize(dstImageDesc.dataType) * ImageFormatSize(dstImageDesc.format),
+        [kernel, srcBuffer, dstBuffer](std::size_t idxBegin, std::size_t idxEnd)
+        {
+            kernel(srcBuffer, dstBuffer, idxBegin, idxEnd);
+        }
+    );
+
+    return true;
+}
+
 LLGL_EXPORT bool ConvertImageBuffer(
     const SrcImageDescriptor&   srcImageDesc,
     const DstImageDescriptor&   dstImageDesc,
@@ -677,6 +873,10 @@ LLGL_EXPORT bool ConvertImageBuffer(
 
     if (srcImageDesc.dataType != dstImageDesc.dataType && srcImageDesc.format != dstImageDesc.format)
     {
+        /* Try to convert image format and data type in a single pass */
+        if (ConvertImageBufferFused(srcImageDesc, dstImageDesc, threadCount))
+            return true;
+
         /* Convert image data type with intermediate buffer */
         auto intermediateBufferSize = srcImageDesc.dataSize / DataTypeSize(srcImageDesc.dataType) * DataTypeSize(dstImageDesc.dataType);
         auto intermediateBuffer     = AllocByteArray(intermediateBufferSize);
@@ -730,75 +930,25 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     /* Validate input parameters */
     ValidateImageConversionParams(srcImageDesc, dstFormat, dstDataType);
 
-    if (threadCount == Constants::maxThreadCount)
-        threadCount = std::thread::hardware_concurrency();
+    if (srcImageDesc.dataType == dstDataType && srcImageDesc.format == dstFormat)
+        return nullptr;
 
-    /* Initialize destination image descriptor */
+    /* Allocate destination buffer and convert image into it */
     auto srcNumPixels = srcImageDesc.dataSize / (DataTypeSize(srcImageDesc.dataType) * ImageFormatSize(srcImageDesc.format));
+    auto dstDataSize  = srcNumPixels * DataTypeSize(dstDataType) * ImageFormatSize(dstFormat);
+    auto dstImage     = AllocByteArray(dstDataSize);
 
-    DstImageDescriptor dstImageDesc
+    const DstImageDescriptor dstImageDesc
     {
         dstFormat,
         dstDataType,
-        nullptr,
-        srcNumPixels * DataTypeSize(dstDataType) * ImageFormatSize(dstFormat)
+        dstImage.get(),
+        dstDataSize
     };
 
-    if (srcImageDesc.dataType != dstDataType && srcImageDesc.format != dstFormat)
-    {
-        auto dstImage = AllocByteArray(dstImageDesc.dataSize);
-        {
-            /* Convert image data type with intermediate buffer */
-            auto intermediateBufferSize = srcImageDesc.dataSize / DataTypeSize(srcImageDesc.dataType) * DataTypeSize(dstDataType);
-            auto intermediateBuffer     = AllocByteArray(intermediateBufferSize);
-
-            ConvertImageBufferDataType(
-                srcImageDesc.dataType, srcImageDesc.data, srcImageDesc.dataSize,
-                dstDataType, intermediateBuffer.get(), intermediateBufferSize,
-                threadCount
-            );
-
-            /* Set new source buffer and source data type */
-            const SrcImageDescriptor intermediateImageDesc
-            {
-                srcImageDesc.format,
-                dstDataType,
-                intermediateBuffer.get(),
-                intermediateBufferSize
-            };
-
-            /* Convert image format */
-            dstImageDesc.data = dstImage.get();
-            ConvertImageBufferFormat(intermediateImageDesc, dstImageDesc, threadCount);
-        }
-        return dstImage;
-    }
-    else if (srcImageDesc.dataType != dstDataType)
-    {
-        /* Convert image data type */
-        auto dstImage = AllocByteArray(dstImageDesc.dataSize);
-        {
-            dstImageDesc.data = dstImage.get();
-            ConvertImageBufferDataType(
-                srcImageDesc.dataType, srcImageDesc.data, srcImageDesc.dataSize,
-                dstDataType, dstImageDesc.data, dstImageDesc.dataSize,
-                threadCount
-            );
-        }
-        return dstImage;
-    }
-    else if (srcImageDesc.format != dstFormat)
-    {
-        /* Convert image format */
-        auto dstImage = AllocByteArray(dstImageDesc.dataSize);
-        {
-            dstImageDesc.data = dstImage.get();
-            ConvertImageBufferFormat(srcImageDesc, dstImageDesc, threadCount);
-        }
-        return dstImage;
-    }
+    ConvertImageBuffer(srcImageDesc, dstImageDesc, threadCount);
 
-    return nullptr;
+    return dstImage;
 }
 
 LLGL_EXPORT ByteBuffer GenerateImageBuffer(
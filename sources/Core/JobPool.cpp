@@ -0,0 +1,188 @@
+/*
+ * JobPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/JobPool.h>
+#include <LLGL/Constants.h>
+#include "ThreadPool.h"
+#include <algorithm>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal members ----- */
+
+// Minimal number of entries each job shall process
+static const std::size_t g_minChunkSize     = 64;
+
+// Number of chunks per thread, so threads that finish early can take over work from slower threads
+static const std::size_t g_chunksPerThread  = 4;
+
+// Cache line size (in bytes) to which the chunk boundaries are aligned
+static const std::size_t g_cacheLineSize    = 64;
+
+static std::size_t                  g_threadCount   = Constants::maxThreadCount;
+static JobPool::Scheduler           g_scheduler;
+static std::shared_ptr<ThreadPool>  g_threadPool;
+static std::size_t                  g_threadPoolRefCount    = 0;
+static std::mutex                   g_threadPoolMutex;
+
+static std::size_t GetEffectiveThreadCount()
+{
+    if (g_threadCount == Constants::maxThreadCount)
+    {
+        /* Use all hardware threads (the calling thread participates in the work as well) */
+        auto hardwareThreads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+        return (hardwareThreads > 1 ? hardwareThreads - 1 : 1);
+    }
+    return g_threadCount;
+}
+
+// Returns the shared thread pool and creates it on first use, or null if no render system keeps the shared thread pool alive.
+static std::shared_ptr<ThreadPool> GetSharedThreadPool()
+{
+    std::lock_guard<std::mutex> lock { g_threadPoolMutex };
+    if (g_threadPoolRefCount == 0)
+        return nullptr;
+    if (!g_threadPool)
+        g_threadPool = std::make_shared<ThreadPool>(GetEffectiveThreadCount());
+    return g_threadPool;
+}
+
+static std::size_t GreatestCommonDivisor(std::size_t a, std::size_t b)
+{
+    while (b != 0)
+    {
+        auto t = b;
+        b = a % b;
+        a = t;
+    }
+    return a;
+}
+
+// Returns the number of items whose size is a multiple of the cache line size.
+static std::size_t GetCacheLineGranularity(std::size_t itemSize)
+{
+    if (itemSize == 0)
+        return 1;
+    return g_cacheLineSize / GreatestCommonDivisor(g_cacheLineSize, itemSize);
+}
+
+
+/* ----- Internal functions ----- */
+
+void DoConcurrentWork(
+    std::size_t                                             workSize,
+    std::size_t                                             threadCount,
+    std::size_t                                             itemSize,
+    const std::function<void(std::size_t, std::size_t)>&    task)
+{
+    threadCount = std::min(threadCount, workSize / g_minChunkSize);
+
+    if (threadCount < 2)
+    {
+        /* Execute work only on calling thread */
+        task(0, workSize);
+        return;
+    }
+
+    /* Split work into chunks whose boundaries are aligned to cache lines in the destination buffer */
+    const auto granularity  = GetCacheLineGranularity(itemSize);
+    const auto numChunks    = threadCount * g_chunksPerThread;
+
+    auto chunkSize = std::max((workSize + numChunks - 1) / numChunks, g_minChunkSize);
+    chunkSize = (chunkSize + granularity - 1) / granularity * granularity;
+
+    const auto numJobs = (workSize + chunkSize - 1) / chunkSize;
+
+    auto job = [&](std::size_t jobIndex)
+    {
+        auto idxBegin   = jobIndex * chunkSize;
+        auto idxEnd     = std::min(idxBegin + chunkSize, workSize);
+        task(idxBegin, idxEnd);
+    };
+
+    if (g_scheduler)
+        g_scheduler(numJobs, job);
+    else if (auto threadPool = GetSharedThreadPool())
+        threadPool->Execute(numJobs, threadCount - 1, job);
+    else
+    {
+        /* Use temporary worker threads that are joined before this function returns */
+        ThreadPool tempThreadPool { threadCount - 1 };
+        tempThreadPool.Execute(numJobs, threadCount - 1, job);
+    }
+}
+
+LLGL_EXPORT void DoAsyncWork(const std::function<void()>& task)
+{
+    if (auto threadPool = GetSharedThreadPool())
+        threadPool->Submit(task);
+    else
+        task();
+}
+
+void AcquireSharedThreadPool()
+{
+    std::lock_guard<std::mutex> lock { g_threadPoolMutex };
+    ++g_threadPoolRefCount;
+}
+
+void ReleaseSharedThreadPool()
+{
+    std::shared_ptr<ThreadPool> threadPool;
+    {
+        std::lock_guard<std::mutex> lock { g_threadPoolMutex };
+        if (g_threadPoolRefCount > 0 && --g_threadPoolRefCount == 0)
+            threadPool = std::move(g_threadPool);
+    }
+    /* Join worker threads (if this was the last reference) outside of the lock, since pending tasks might still use the job pool */
+}
+
+
+/* ----- Public functions ----- */
+
+namespace JobPool
+{
+
+
+LLGL_EXPORT void SetThreadCount(std::size_t threadCount)
+{
+    std::shared_ptr<ThreadPool> threadPool;
+    {
+        std::lock_guard<std::mutex> lock { g_threadPoolMutex };
+        if (g_threadCount != threadCount)
+        {
+            /* Release current thread pool, so it will be re-created with the new size on next use */
+            g_threadCount = threadCount;
+            threadPool = std::move(g_threadPool);
+        }
+    }
+}
+
+LLGL_EXPORT std::size_t GetThreadCount()
+{
+    std::lock_guard<std::mutex> lock { g_threadPoolMutex };
+    return GetEffectiveThreadCount();
+}
+
+LLGL_EXPORT void SetScheduler(const Scheduler& scheduler)
+{
+    g_scheduler = scheduler;
+}
+
+
+} // /namespace JobPool
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
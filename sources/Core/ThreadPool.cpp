@@ -0,0 +1,162 @@
+/*
+ * ThreadPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Shared state of a single batch of jobs that is processed by the worker threads and the calling thread.
+struct JobBatch
+{
+    JobBatch(std::size_t numJobs, const ThreadPool::JobFunc& job) :
+        numJobs { numJobs },
+        job     { &job    }
+    {
+    }
+
+    // Claims and executes jobs until no more jobs are left.
+    void Run()
+    {
+        for (;;)
+        {
+            auto jobIndex = next.fetch_add(1);
+            if (jobIndex >= numJobs)
+                break;
+
+            (*job)(jobIndex);
+
+            if (done.fetch_add(1) + 1 == numJobs)
+            {
+                std::lock_guard<std::mutex> lock { mutex };
+                var.notify_all();
+            }
+        }
+    }
+
+    // Blocks the calling thread until all jobs have been finished.
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock { mutex };
+        var.wait(lock, [this]{ return (done.load() == numJobs); });
+    }
+
+    const std::size_t           numJobs;
+
+    // The job function is only accessed while jobs are left, i.e. before ThreadPool::Execute returns.
+    const ThreadPool::JobFunc*  job;
+
+    std::atomic<std::size_t>    next { 0 };
+    std::atomic<std::size_t>    done { 0 };
+    std::mutex                  mutex;
+    std::condition_variable     var;
+};
+
+
+/* ----- ThreadPool class ----- */
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    workers_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        workers_.emplace_back(&ThreadPool::WorkerThreadProc, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    /* Signal all worker threads to quit after the remaining tasks */
+    {
+        std::lock_guard<std::mutex> lock { mutex_ };
+        quit_ = true;
+    }
+    var_.notify_all();
+
+    for (auto& w : workers_)
+        w.join();
+}
+
+void ThreadPool::Execute(std::size_t numJobs, std::size_t maxWorkers, const JobFunc& job)
+{
+    if (numJobs == 0)
+        return;
+
+    auto batch = std::make_shared<JobBatch>(numJobs, job);
+
+    /* Wake up worker threads (the calling thread takes one of the jobs itself) */
+    auto numTasks = std::min(std::min(maxWorkers, workers_.size()), numJobs - 1);
+
+    if (numTasks > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock { mutex_ };
+            for (std::size_t i = 0; i < numTasks; ++i)
+                tasks_.push_back([batch]() { batch->Run(); });
+        }
+        var_.notify_all();
+    }
+
+    /* Participate in the work and wait for the remaining jobs */
+    batch->Run();
+    batch->Wait();
+}
+
+void ThreadPool::Submit(const std::function<void()>& task)
+{
+    if (workers_.empty())
+    {
+        /* Execute task on calling thread */
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock { mutex_ };
+        tasks_.push_back(task);
+    }
+    var_.notify_one();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void ThreadPool::WorkerThreadProc()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+
+        /* Wait for next task */
+        {
+            std::unique_lock<std::mutex> lock { mutex_ };
+            var_.wait(lock, [this]{ return (quit_ || !tasks_.empty()); });
+
+            if (tasks_.empty())
+                return;
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        task();
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
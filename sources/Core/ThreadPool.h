@@ -0,0 +1,113 @@
+/*
+ * ThreadPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_THREAD_POOL_H
+#define LLGL_THREAD_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <deque>
+
+
+namespace LLGL
+{
+
+
+//! Pool of persistent worker threads that execute batches of indexed jobs.
+class ThreadPool
+{
+
+    public:
+
+        using JobFunc = std::function<void(std::size_t jobIndex)>;
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator = (const ThreadPool&) = delete;
+
+        //! Creates the specified number of worker threads.
+        ThreadPool(std::size_t threadCount);
+
+        //! Joins all worker threads.
+        ~ThreadPool();
+
+        /**
+        \brief Executes the job function for each index in [0, numJobs) on at most 'maxWorkers' worker threads and the calling thread.
+        \remarks The calling thread participates in the work, so this function can also be called from within a job without deadlocks.
+        Returns after all jobs have been finished.
+        */
+        void Execute(std::size_t numJobs, std::size_t maxWorkers, const JobFunc& job);
+
+        /**
+        \brief Enqueues the specified task to be executed on one of the worker threads and returns immediately.
+        \remarks If there are no worker threads, the task is executed on the calling thread.
+        */
+        void Submit(const std::function<void()>& task);
+
+        //! Returns the number of worker threads.
+        inline std::size_t GetThreadCount() const
+        {
+            return workers_.size();
+        }
+
+    private:
+
+        void WorkerThreadProc();
+
+    private:
+
+        std::vector<std::thread>            workers_;
+        std::deque<std::function<void()>>   tasks_;
+        std::mutex                          mutex_;
+        std::condition_variable             var_;
+        bool                                quit_       = false;
+
+};
+
+/**
+\brief Distributes the range [0, workSize) in chunks across the shared job pool and calls 'task(idxBegin, idxEnd)' for each chunk.
+\param[in] workSize Specifies the number of work items (e.g. pixels or components).
+\param[in] threadCount Specifies the maximal number of threads that work concurrently. If this is less than 2, the task is executed on the calling thread only.
+\param[in] itemSize Specifies the size (in bytes) of each work item in the destination buffer.
+All chunk boundaries except the end of the range are aligned to a cache line (relative to the start of the destination buffer), which avoids false sharing between threads.
+\param[in] task Specifies the task function.
+\see JobPool::SetScheduler
+*/
+void DoConcurrentWork(
+    std::size_t                                             workSize,
+    std::size_t                                             threadCount,
+    std::size_t                                             itemSize,
+    const std::function<void(std::size_t, std::size_t)>&    task
+);
+
+/**
+\brief Executes the specified task asynchronously on the shared job pool.
+\remarks Pending tasks are finished before the shared job pool is re-created or destroyed.
+If no render system keeps the shared job pool alive, the task is executed on the calling thread.
+\see JobPool::SetThreadCount
+*/
+LLGL_EXPORT void DoAsyncWork(const std::function<void()>& task);
+
+//! Adds a reference to the shared job pool. This is called by each render system, so the worker threads persist while any render system exists.
+void AcquireSharedThreadPool();
+
+//! Removes a reference from the shared job pool. The worker threads are joined when the last reference has been removed.
+void ReleaseSharedThreadPool();
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,29 @@
+/*
+ * BasicPipelineCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "BasicPipelineCache.h"
+
+
+namespace LLGL
+{
+
+
+BasicPipelineCache::BasicPipelineCache(const void* /*initialBlob*/, std::size_t /*initialBlobSize*/)
+{
+}
+
+std::vector<char> BasicPipelineCache::GetBlob() const
+{
+    return {};
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
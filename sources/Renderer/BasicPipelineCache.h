@@ -0,0 +1,40 @@
+/*
+ * BasicPipelineCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_BASIC_PIPELINE_CACHE_H
+#define LLGL_BASIC_PIPELINE_CACHE_H
+
+
+#include <LLGL/PipelineCache.h>
+
+
+namespace LLGL
+{
+
+
+// This class is used for renderers without native pipeline cache support and always returns an empty blob.
+class LLGL_EXPORT BasicPipelineCache : public PipelineCache
+{
+
+    public:
+
+        BasicPipelineCache() = default;
+        BasicPipelineCache(const void* initialBlob, std::size_t initialBlobSize);
+
+        std::vector<char> GetBlob() const override;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
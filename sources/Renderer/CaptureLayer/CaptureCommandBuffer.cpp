@@ -0,0 +1,423 @@
+/*
+ * CaptureCommandBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureCommandBuffer.h"
+#include "CaptureRenderContext.h"
+#include "../CheckedCast.h"
+#include <LLGL/Buffer.h>
+#include <LLGL/BufferArray.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Sampler.h>
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/RenderTarget.h>
+#include <LLGL/GraphicsPipeline.h>
+#include <LLGL/ComputePipeline.h>
+#include <LLGL/Query.h>
+
+
+namespace LLGL
+{
+
+
+CaptureCommandBuffer::CaptureCommandBuffer(CommandBuffer& instance, CommandBufferExt* instanceExt, CaptureWriter& writer) :
+    instance    { instance    },
+    instanceExt { instanceExt },
+    writer_     { writer      }
+{
+}
+
+/* ----- Configuration ----- */
+
+void CaptureCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
+{
+    instance.SetGraphicsAPIDependentState(stateDesc, stateDescSize);
+    WriteCommand(CaptureOpcode::SetGraphicsAPIDependentState, CaptureData(stateDesc, stateDescSize));
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void CaptureCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    instance.SetViewport(viewport);
+    WriteCommand(CaptureOpcode::SetViewport, viewport);
+}
+
+void CaptureCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    instance.SetViewports(numViewports, viewports);
+    WriteCommand(CaptureOpcode::SetViewports, std::vector<Viewport>(viewports, viewports + numViewports));
+}
+
+void CaptureCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    instance.SetScissor(scissor);
+    WriteCommand(CaptureOpcode::SetScissor, scissor);
+}
+
+void CaptureCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    instance.SetScissors(numScissors, scissors);
+    WriteCommand(CaptureOpcode::SetScissors, std::vector<Scissor>(scissors, scissors + numScissors));
+}
+
+/* ----- Clear ----- */
+
+void CaptureCommandBuffer::SetClearColor(const ColorRGBAf& color)
+{
+    instance.SetClearColor(color);
+    WriteCommand(CaptureOpcode::SetClearColor, color);
+}
+
+void CaptureCommandBuffer::SetClearDepth(float depth)
+{
+    instance.SetClearDepth(depth);
+    WriteCommand(CaptureOpcode::SetClearDepth, depth);
+}
+
+void CaptureCommandBuffer::SetClearStencil(std::uint32_t stencil)
+{
+    instance.SetClearStencil(stencil);
+    WriteCommand(CaptureOpcode::SetClearStencil, stencil);
+}
+
+void CaptureCommandBuffer::Clear(long flags)
+{
+    instance.Clear(flags);
+    WriteCommand(CaptureOpcode::Clear, static_cast<std::int64_t>(flags));
+}
+
+void CaptureCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    instance.ClearAttachments(numAttachments, attachments);
+    WriteCommand(CaptureOpcode::ClearAttachments, std::vector<AttachmentClear>(attachments, attachments + numAttachments));
+}
+
+/* ----- Copy ----- */
+
+void CaptureCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    instance.UpdateBuffer(dstBuffer, dstOffset, data, dataSize);
+    WriteCommand(CaptureOpcode::UpdateBuffer, CaptureRef(dstBuffer), dstOffset, CaptureData(data, dataSize));
+}
+
+void CaptureCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    instance.CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
+    WriteCommand(CaptureOpcode::CopyBuffer, CaptureRef(dstBuffer), dstOffset, CaptureRef(srcBuffer), srcOffset, size);
+}
+
+void CaptureCommandBuffer::CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset)
+{
+    instance.CopyBufferToTexture(dstTexture, dstRegion, srcBuffer, srcOffset);
+    WriteCommand(CaptureOpcode::CopyBufferToTexture, CaptureRef(dstTexture), dstRegion, CaptureRef(srcBuffer), srcOffset);
+}
+
+void CaptureCommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    instance.CopyTexture(dstTexture, dstRegion, srcTexture, srcMipLevel, srcOffset);
+    WriteCommand(CaptureOpcode::CopyTexture, CaptureRef(dstTexture), dstRegion, CaptureRef(srcTexture), srcMipLevel, srcOffset);
+}
+
+/* ----- Input Assembly ------ */
+
+void CaptureCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    instance.SetVertexBuffer(buffer);
+    WriteCommand(CaptureOpcode::SetVertexBuffer, CaptureRef(buffer));
+}
+
+void CaptureCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    instance.SetVertexBufferArray(bufferArray);
+    WriteCommand(CaptureOpcode::SetVertexBufferArray, CaptureRef(bufferArray));
+}
+
+void CaptureCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    instance.SetIndexBuffer(buffer);
+    WriteCommand(CaptureOpcode::SetIndexBuffer, CaptureRef(buffer));
+}
+
+/* ----- Constant Buffers ------ */
+
+void CaptureCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags)
+{
+    instanceExt->SetConstantBuffer(buffer, slot, stageFlags);
+    WriteCommand(CaptureOpcode::SetConstantBuffer, CaptureRef(buffer), slot, static_cast<std::int64_t>(stageFlags));
+}
+
+/* ----- Storage Buffers ------ */
+
+void CaptureCommandBuffer::SetStorageBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags)
+{
+    instanceExt->SetStorageBuffer(buffer, slot, stageFlags);
+    WriteCommand(CaptureOpcode::SetStorageBuffer, CaptureRef(buffer), slot, static_cast<std::int64_t>(stageFlags));
+}
+
+/* ----- Stream Output Buffers ------ */
+
+void CaptureCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+{
+    instance.SetStreamOutputBuffer(buffer);
+    WriteCommand(CaptureOpcode::SetStreamOutputBuffer, CaptureRef(buffer));
+}
+
+void CaptureCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+{
+    instance.SetStreamOutputBufferArray(bufferArray);
+    WriteCommand(CaptureOpcode::SetStreamOutputBufferArray, CaptureRef(bufferArray));
+}
+
+void CaptureCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
+{
+    instance.BeginStreamOutput(primitiveType);
+    WriteCommand(CaptureOpcode::BeginStreamOutput, primitiveType);
+}
+
+void CaptureCommandBuffer::EndStreamOutput()
+{
+    instance.EndStreamOutput();
+    WriteCommand(CaptureOpcode::EndStreamOutput);
+}
+
+/* ----- Textures ----- */
+
+void CaptureCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long stageFlags)
+{
+    instanceExt->SetTexture(texture, slot, stageFlags);
+    WriteCommand(CaptureOpcode::SetTexture, CaptureRef(texture), slot, static_cast<std::int64_t>(stageFlags));
+}
+
+/* ----- Sampler States ----- */
+
+void CaptureCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long stageFlags)
+{
+    instanceExt->SetSampler(sampler, slot, stageFlags);
+    WriteCommand(CaptureOpcode::SetSampler, CaptureRef(sampler), slot, static_cast<std::int64_t>(stageFlags));
+}
+
+/* ----- Resource View Heaps ----- */
+
+void CaptureCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    instance.SetGraphicsResourceHeap(resourceHeap, firstSet);
+    WriteCommand(CaptureOpcode::SetGraphicsResourceHeap, CaptureRef(resourceHeap), firstSet, std::vector<std::uint32_t>());
+}
+
+void CaptureCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    instance.SetComputeResourceHeap(resourceHeap, firstSet);
+    WriteCommand(CaptureOpcode::SetComputeResourceHeap, CaptureRef(resourceHeap), firstSet, std::vector<std::uint32_t>());
+}
+
+void CaptureCommandBuffer::SetGraphicsResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    instance.SetGraphicsResourceHeapWithOffsets(resourceHeap, firstSet, numDynamicOffsets, dynamicOffsets);
+    WriteCommand(
+        CaptureOpcode::SetGraphicsResourceHeap,
+        CaptureRef(resourceHeap),
+        firstSet,
+        std::vector<std::uint32_t>(dynamicOffsets, dynamicOffsets + numDynamicOffsets)
+    );
+}
+
+void CaptureCommandBuffer::SetComputeResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    instance.SetComputeResourceHeapWithOffsets(resourceHeap, firstSet, numDynamicOffsets, dynamicOffsets);
+    WriteCommand(
+        CaptureOpcode::SetComputeResourceHeap,
+        CaptureRef(resourceHeap),
+        firstSet,
+        std::vector<std::uint32_t>(dynamicOffsets, dynamicOffsets + numDynamicOffsets)
+    );
+}
+
+/* ----- Render Targets ----- */
+
+void CaptureCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+{
+    instance.SetRenderTarget(renderTarget);
+    WriteCommand(CaptureOpcode::SetRenderTarget, CaptureRef(renderTarget));
+}
+
+void CaptureCommandBuffer::SetRenderTarget(RenderContext& renderContext)
+{
+    auto& renderContextCapture = LLGL_CAST(CaptureRenderContext&, renderContext);
+    instance.SetRenderTarget(renderContextCapture.instance);
+    WriteCommand(CaptureOpcode::SetRenderTargetContext, CaptureRef(renderContext));
+}
+
+/* ----- Pipeline States ----- */
+
+void CaptureCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    instance.SetGraphicsPipeline(graphicsPipeline);
+    WriteCommand(CaptureOpcode::SetGraphicsPipeline, CaptureRef(graphicsPipeline));
+}
+
+void CaptureCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+{
+    instance.SetComputePipeline(computePipeline);
+    WriteCommand(CaptureOpcode::SetComputePipeline, CaptureRef(computePipeline));
+}
+
+bool CaptureCommandBuffer::QueryStateChangeStatistics(StateChangeStatistics& statistics) const
+{
+    return instance.QueryStateChangeStatistics(statistics);
+}
+
+/* ----- Queries ----- */
+
+void CaptureCommandBuffer::BeginQuery(Query& query)
+{
+    instance.BeginQuery(query);
+    WriteCommand(CaptureOpcode::BeginQuery, CaptureRef(query));
+}
+
+void CaptureCommandBuffer::EndQuery(Query& query)
+{
+    instance.EndQuery(query);
+    WriteCommand(CaptureOpcode::EndQuery, CaptureRef(query));
+}
+
+bool CaptureCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
+{
+    /* Query results are not captured, since they do not affect the commands of the trace */
+    return instance.QueryResult(query, result);
+}
+
+bool CaptureCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result)
+{
+    return instance.QueryPipelineStatisticsResult(query, result);
+}
+
+void CaptureCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
+{
+    instance.BeginRenderCondition(query, mode);
+    WriteCommand(CaptureOpcode::BeginRenderCondition, CaptureRef(query), mode);
+}
+
+void CaptureCommandBuffer::EndRenderCondition()
+{
+    instance.EndRenderCondition();
+    WriteCommand(CaptureOpcode::EndRenderCondition);
+}
+
+/* ----- Drawing ----- */
+
+void CaptureCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    instance.Draw(numVertices, firstVertex);
+    WriteCommand(CaptureOpcode::Draw, numVertices, firstVertex);
+}
+
+void CaptureCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    instance.DrawIndexed(numIndices, firstIndex);
+    WriteCommand(CaptureOpcode::DrawIndexed, numIndices, firstIndex);
+}
+
+void CaptureCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    instance.DrawIndexed(numIndices, firstIndex, vertexOffset);
+    WriteCommand(CaptureOpcode::DrawIndexedOffset, numIndices, firstIndex, vertexOffset);
+}
+
+void CaptureCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    instance.DrawInstanced(numVertices, firstVertex, numInstances);
+    WriteCommand(CaptureOpcode::DrawInstanced, numVertices, firstVertex, numInstances);
+}
+
+void CaptureCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    instance.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+    WriteCommand(CaptureOpcode::DrawInstancedOffset, numVertices, firstVertex, numInstances, firstInstance);
+}
+
+void CaptureCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+    WriteCommand(CaptureOpcode::DrawIndexedInstanced, numIndices, numInstances, firstIndex);
+}
+
+void CaptureCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+    WriteCommand(CaptureOpcode::DrawIndexedInstancedOffset, numIndices, numInstances, firstIndex, vertexOffset);
+}
+
+void CaptureCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+    WriteCommand(CaptureOpcode::DrawIndexedInstancedOffsetFirst, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+}
+
+void CaptureCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    instance.DrawIndirect(buffer, offset);
+    WriteCommand(CaptureOpcode::DrawIndirect, CaptureRef(buffer), offset);
+}
+
+void CaptureCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    instance.DrawIndirect(buffer, offset, numCommands, stride);
+    WriteCommand(CaptureOpcode::DrawIndirectMulti, CaptureRef(buffer), offset, numCommands, stride);
+}
+
+void CaptureCommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    instance.DrawIndirectCount(buffer, offset, countBuffer, countOffset, maxNumCommands, stride);
+    WriteCommand(CaptureOpcode::DrawIndirectCount, CaptureRef(buffer), offset, CaptureRef(countBuffer), countOffset, maxNumCommands, stride);
+}
+
+void CaptureCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    instance.DrawIndexedIndirect(buffer, offset);
+    WriteCommand(CaptureOpcode::DrawIndexedIndirect, CaptureRef(buffer), offset);
+}
+
+void CaptureCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    instance.DrawIndexedIndirect(buffer, offset, numCommands, stride);
+    WriteCommand(CaptureOpcode::DrawIndexedIndirectMulti, CaptureRef(buffer), offset, numCommands, stride);
+}
+
+void CaptureCommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    instance.DrawIndexedIndirectCount(buffer, offset, countBuffer, countOffset, maxNumCommands, stride);
+    WriteCommand(CaptureOpcode::DrawIndexedIndirectCount, CaptureRef(buffer), offset, CaptureRef(countBuffer), countOffset, maxNumCommands, stride);
+}
+
+/* ----- Compute ----- */
+
+void CaptureCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
+{
+    instance.Dispatch(groupSizeX, groupSizeY, groupSizeZ);
+    WriteCommand(CaptureOpcode::Dispatch, groupSizeX, groupSizeY, groupSizeZ);
+}
+
+void CaptureCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    instance.DispatchIndirect(buffer, offset);
+    WriteCommand(CaptureOpcode::DispatchIndirect, CaptureRef(buffer), offset);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
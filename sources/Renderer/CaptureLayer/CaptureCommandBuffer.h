@@ -0,0 +1,188 @@
+/*
+ * CaptureCommandBuffer.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_COMMAND_BUFFER_H
+#define LLGL_CAPTURE_COMMAND_BUFFER_H
+
+
+#include <LLGL/CommandBufferExt.h>
+#include "CaptureStream.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Command buffer of the capture layer.
+All commands are passed on unmodified and written into the trace, preceded by the capture ID of this command buffer.
+Only render contexts are unwrapped, all other objects are referenced by their capture IDs.
+*/
+class CaptureCommandBuffer : public CommandBufferExt
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        CaptureCommandBuffer(CommandBuffer& instance, CommandBufferExt* instanceExt, CaptureWriter& writer);
+
+        /* ----- Configuration ----- */
+
+        void SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize) override;
+
+        /* ----- Viewport and Scissor ----- */
+
+        void SetViewport(const Viewport& viewport) override;
+        void SetViewports(std::uint32_t numViewports, const Viewport* viewports) override;
+
+        void SetScissor(const Scissor& scissor) override;
+        void SetScissors(std::uint32_t numScissors, const Scissor* scissors) override;
+
+        /* ----- Clear ----- */
+
+        void SetClearColor(const ColorRGBAf& color) override;
+        void SetClearDepth(float depth) override;
+        void SetClearStencil(std::uint32_t stencil) override;
+
+        void Clear(long flags) override;
+        void ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments) override;
+
+        /* ----- Copy ----- */
+
+        void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
+        void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset) override;
+        void CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset) override;
+
+        /* ----- Input Assembly ------ */
+
+        void SetVertexBuffer(Buffer& buffer) override;
+        void SetVertexBufferArray(BufferArray& bufferArray) override;
+
+        void SetIndexBuffer(Buffer& buffer) override;
+
+        /* ----- Constant Buffers ------ */
+
+        void SetConstantBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags = StageFlags::AllStages) override;
+
+        /* ----- Storage Buffers ------ */
+
+        void SetStorageBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags = StageFlags::AllStages) override;
+
+        /* ----- Stream Output Buffers ------ */
+
+        void SetStreamOutputBuffer(Buffer& buffer) override;
+        void SetStreamOutputBufferArray(BufferArray& bufferArray) override;
+
+        void BeginStreamOutput(const PrimitiveType primitiveType) override;
+        void EndStreamOutput() override;
+
+        /* ----- Textures ----- */
+
+        void SetTexture(Texture& texture, std::uint32_t slot, long stageFlags = StageFlags::AllStages) override;
+
+        /* ----- Sampler States ----- */
+
+        void SetSampler(Sampler& sampler, std::uint32_t slot, long stageFlags = StageFlags::AllStages) override;
+
+        /* ----- Resource View Heaps ----- */
+
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+
+        void SetGraphicsResourceHeapWithOffsets(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        ) override;
+
+        void SetComputeResourceHeapWithOffsets(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        ) override;
+
+        /* ----- Render Targets ----- */
+
+        void SetRenderTarget(RenderTarget& renderTarget) override;
+        void SetRenderTarget(RenderContext& renderContext) override;
+
+        /* ----- Pipeline States ----- */
+
+        void SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline) override;
+        void SetComputePipeline(ComputePipeline& computePipeline) override;
+
+        bool QueryStateChangeStatistics(StateChangeStatistics& statistics) const override;
+
+        /* ----- Queries ----- */
+
+        void BeginQuery(Query& query) override;
+        void EndQuery(Query& query) override;
+
+        bool QueryResult(Query& query, std::uint64_t& result) override;
+        bool QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result) override;
+
+        void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void EndRenderCondition() override;
+
+        /* ----- Drawing ----- */
+
+        void Draw(std::uint32_t numVertices, std::uint32_t firstVertex) override;
+
+        void DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex) override;
+        void DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset) override;
+
+        void DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances) override;
+        void DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance) override;
+
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex) override;
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset) override;
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance) override;
+
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        /* ----- Compute ----- */
+
+        void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, std::uint64_t offset) override;
+
+        /* ----- Capture members ----- */
+
+        CommandBuffer&      instance;
+        CommandBufferExt*   instanceExt = nullptr;
+
+    private:
+
+        template <typename... Args>
+        void WriteCommand(const CaptureOpcode opcode, const Args&... args)
+        {
+            writer_.WriteRecord(opcode, CaptureRef(this), args...);
+        }
+
+        CaptureWriter& writer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
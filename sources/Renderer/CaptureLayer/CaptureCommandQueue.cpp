@@ -0,0 +1,60 @@
+/*
+ * CaptureCommandQueue.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureCommandQueue.h"
+#include "CaptureCommandBuffer.h"
+#include "../CheckedCast.h"
+#include <LLGL/Fence.h>
+
+
+namespace LLGL
+{
+
+
+CaptureCommandQueue::CaptureCommandQueue(CommandQueue& instance, CaptureWriter& writer) :
+    instance { instance },
+    writer_  { writer   }
+{
+}
+
+/* ----- Command queues ----- */
+
+void CaptureCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferCapture = LLGL_CAST(CaptureCommandBuffer&, commandBuffer);
+    instance.Submit(commandBufferCapture.instance);
+    writer_.WriteRecord(CaptureOpcode::SubmitCommandBuffer, CaptureRef(commandBuffer));
+}
+
+/* ----- Fences ----- */
+
+void CaptureCommandQueue::Submit(Fence& fence)
+{
+    instance.Submit(fence);
+    writer_.WriteRecord(CaptureOpcode::SubmitFence, CaptureRef(fence));
+}
+
+bool CaptureCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    /* Timeout is not captured, since the replay always waits for the fence to be signaled */
+    auto result = instance.WaitFence(fence, timeout);
+    writer_.WriteRecord(CaptureOpcode::WaitFence, CaptureRef(fence));
+    return result;
+}
+
+void CaptureCommandQueue::WaitIdle()
+{
+    instance.WaitIdle();
+    writer_.WriteRecord(CaptureOpcode::WaitIdle);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
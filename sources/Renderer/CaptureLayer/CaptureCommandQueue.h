@@ -0,0 +1,54 @@
+/*
+ * CaptureCommandQueue.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_COMMAND_QUEUE_H
+#define LLGL_CAPTURE_COMMAND_QUEUE_H
+
+
+#include <LLGL/CommandQueue.h>
+#include "CaptureStream.h"
+
+
+namespace LLGL
+{
+
+
+class CaptureCommandQueue : public CommandQueue
+{
+
+    public:
+
+        CaptureCommandQueue(CommandQueue& instance, CaptureWriter& writer);
+
+        /* ----- Command queues ----- */
+
+        void Submit(CommandBuffer& commandBuffer) override;
+
+        /* ----- Fences ----- */
+
+        void Submit(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+        void WaitIdle() override;
+
+        CommandQueue& instance;
+
+    private:
+
+        CaptureWriter& writer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
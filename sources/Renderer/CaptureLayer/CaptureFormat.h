@@ -0,0 +1,158 @@
+/*
+ * CaptureFormat.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_FORMAT_H
+#define LLGL_CAPTURE_FORMAT_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Binary trace format of the capture layer:
+The file starts with the magic number and the format version, followed by a flat sequence of records.
+Each record starts with its opcode and is followed by its arguments in native byte order (there are no record sizes).
+Render system objects are referenced by capture IDs, which are assigned in order of creation (starting at 1, where 0 denotes null).
+Commands of command buffers are stored in the global order they were recorded in, each preceded by the ID of its command buffer.
+*/
+
+static const char           g_captureMagic[8]   = { 'L', 'L', 'G', 'L', 'T', 'R', 'C', '\0' };
+static const std::uint32_t  g_captureVersion    = 1;
+
+enum class CaptureOpcode : std::uint8_t
+{
+    /* ----- Render system ----- */
+    SetConfiguration = 1,
+
+    CreateRenderContext,
+    ReleaseRenderContext,
+    SetVideoMode,
+    SetVsync,
+    Present,                            // Frame boundary
+
+    CreateCommandBuffer,
+    CreateCommandBufferExt,
+    ReleaseCommandBuffer,
+
+    CreateBuffer,
+    CreateBufferArray,
+    ReleaseBuffer,
+    ReleaseBufferArray,
+    WriteBuffer,                        // Also used for the content of write-mapped buffers
+
+    CreateTexture,
+    ReleaseTexture,
+    WriteTexture,
+    GenerateMips,
+    GenerateMipsRange,
+
+    CreateSampler,
+    ReleaseSampler,
+
+    CreateResourceHeap,
+    ReleaseResourceHeap,
+
+    CreateRenderTarget,
+    ReleaseRenderTarget,
+
+    CreateShader,
+    CreateShaderProgram,
+    ReleaseShader,
+    ReleaseShaderProgram,
+    BindConstantBuffer,
+    BindStorageBuffer,
+
+    CreatePipelineLayout,
+    ReleasePipelineLayout,
+
+    CreatePipelineCache,
+    ReleasePipelineCache,
+
+    CreateGraphicsPipeline,
+    CreateComputePipeline,
+    ReleaseGraphicsPipeline,
+    ReleaseComputePipeline,
+
+    CreateQuery,
+    ReleaseQuery,
+
+    CreateFence,
+    ReleaseFence,
+
+    /* ----- Command queue ----- */
+    SubmitCommandBuffer,
+    SubmitFence,
+    WaitFence,
+    WaitIdle,
+
+    /* ----- Command buffer ----- */
+    SetGraphicsAPIDependentState,
+    SetViewport,
+    SetViewports,
+    SetScissor,
+    SetScissors,
+    SetClearColor,
+    SetClearDepth,
+    SetClearStencil,
+    Clear,
+    ClearAttachments,
+    UpdateBuffer,
+    CopyBuffer,
+    CopyBufferToTexture,
+    CopyTexture,
+    SetVertexBuffer,
+    SetVertexBufferArray,
+    SetIndexBuffer,
+    SetConstantBuffer,
+    SetStorageBuffer,
+    SetStreamOutputBuffer,
+    SetStreamOutputBufferArray,
+    BeginStreamOutput,
+    EndStreamOutput,
+    SetTexture,
+    SetSampler,
+    SetGraphicsResourceHeap,
+    SetComputeResourceHeap,
+    SetRenderTarget,
+    SetRenderTargetContext,
+    SetGraphicsPipeline,
+    SetComputePipeline,
+    BeginQuery,
+    EndQuery,
+    BeginRenderCondition,
+    EndRenderCondition,
+    Draw,
+    DrawIndexed,
+    DrawIndexedOffset,
+    DrawInstanced,
+    DrawInstancedOffset,
+    DrawIndexedInstanced,
+    DrawIndexedInstancedOffset,
+    DrawIndexedInstancedOffsetFirst,
+    DrawIndirect,
+    DrawIndirectMulti,
+    DrawIndirectCount,
+    DrawIndexedIndirect,
+    DrawIndexedIndirectMulti,
+    DrawIndexedIndirectCount,
+    Dispatch,
+    DispatchIndirect,
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,72 @@
+/*
+ * CaptureRenderContext.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureRenderContext.h"
+
+
+namespace LLGL
+{
+
+
+CaptureRenderContext::CaptureRenderContext(RenderContext& instance, CaptureWriter& writer) :
+    instance { instance },
+    writer_  { writer   }
+{
+    ShareSurfaceAndConfig(instance);
+}
+
+void CaptureRenderContext::Present()
+{
+    instance.Present();
+
+    /* Write end of frame and flush trace, so all complete frames are preserved if the application terminates unexpectedly */
+    writer_.WriteRecord(CaptureOpcode::Present, CaptureRef(this));
+    writer_.Flush();
+}
+
+Format CaptureRenderContext::QueryColorFormat() const
+{
+    return instance.QueryColorFormat();
+}
+
+Format CaptureRenderContext::QueryDepthStencilFormat() const
+{
+    return instance.QueryDepthStencilFormat();
+}
+
+bool CaptureRenderContext::QueryFramePacingStatistics(FramePacingStatistics& stats) const
+{
+    return instance.QueryFramePacingStatistics(stats);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool CaptureRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
+{
+    auto result = instance.SetVideoMode(videoModeDesc);
+    ShareSurfaceAndConfig(instance);
+    writer_.WriteRecord(CaptureOpcode::SetVideoMode, CaptureRef(this), videoModeDesc);
+    return result;
+}
+
+bool CaptureRenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
+{
+    auto result = instance.SetVsync(vsyncDesc);
+    ShareSurfaceAndConfig(instance);
+    writer_.WriteRecord(CaptureOpcode::SetVsync, CaptureRef(this), vsyncDesc);
+    return result;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,58 @@
+/*
+ * CaptureRenderContext.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_RENDER_CONTEXT_H
+#define LLGL_CAPTURE_RENDER_CONTEXT_H
+
+
+#include <LLGL/RenderContext.h>
+#include "CaptureStream.h"
+
+
+namespace LLGL
+{
+
+
+// Render context of the capture layer, which marks the frame boundaries of the trace.
+class CaptureRenderContext : public RenderContext
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        CaptureRenderContext(RenderContext& instance, CaptureWriter& writer);
+
+        void Present() override;
+
+        Format QueryColorFormat() const override;
+        Format QueryDepthStencilFormat() const override;
+
+        bool QueryFramePacingStatistics(FramePacingStatistics& stats) const override;
+
+        /* ----- Capture members ----- */
+
+        RenderContext& instance;
+
+    private:
+
+        bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
+        bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
+
+        CaptureWriter& writer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,490 @@
+/*
+ * CaptureRenderSystem.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureRenderSystem.h"
+#include "../../Core/Helper.h"
+#include "../CheckedCast.h"
+#include <LLGL/Buffer.h>
+#include <LLGL/BufferArray.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Sampler.h>
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/RenderTarget.h>
+#include <LLGL/Shader.h>
+#include <LLGL/PipelineLayout.h>
+#include <LLGL/PipelineCache.h>
+#include <LLGL/GraphicsPipeline.h>
+#include <LLGL/ComputePipeline.h>
+#include <LLGL/Query.h>
+#include <LLGL/Fence.h>
+
+
+namespace LLGL
+{
+
+
+CaptureRenderSystem::CaptureRenderSystem(const std::shared_ptr<RenderSystem>& instance, const std::string& filename) :
+    instance_ { instance },
+    writer_   { filename }
+{
+    /* Some render systems already provide their capabilities before a render context is created */
+    SetRendererInfo(instance_->GetRendererInfo());
+    SetRenderingCaps(instance_->GetRenderingCaps());
+}
+
+void CaptureRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
+{
+    RenderSystem::SetConfiguration(config);
+    instance_->SetConfiguration(config);
+    writer_.WriteRecord(CaptureOpcode::SetConfiguration, config);
+}
+
+/* ----- Render Context ----- */
+
+RenderContext* CaptureRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
+{
+    auto renderContextInstance = instance_->CreateRenderContext(desc, surface);
+
+    SetRendererInfo(instance_->GetRendererInfo());
+    SetRenderingCaps(instance_->GetRenderingCaps());
+
+    auto renderContext = TakeOwnership(renderContexts_, MakeUnique<CaptureRenderContext>(*renderContextInstance, writer_));
+    writer_.WriteCreateRecord(CaptureOpcode::CreateRenderContext, renderContext, desc);
+    return renderContext;
+}
+
+void CaptureRenderSystem::Release(RenderContext& renderContext)
+{
+    auto& renderContextCapture = LLGL_CAST(CaptureRenderContext&, renderContext);
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseRenderContext, &renderContext);
+    instance_->Release(renderContextCapture.instance);
+    RemoveFromUniqueSet(renderContexts_, &renderContext);
+}
+
+/* ----- Command queues ----- */
+
+CommandQueue* CaptureRenderSystem::GetCommandQueue()
+{
+    /* Wrap command queue of the instance, so that capture command buffers can be unwrapped on submission */
+    if (!commandQueue_)
+    {
+        if (auto commandQueueInstance = instance_->GetCommandQueue())
+            commandQueue_ = MakeUnique<CaptureCommandQueue>(*commandQueueInstance, writer_);
+    }
+    return commandQueue_.get();
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* CaptureRenderSystem::CreateCommandBuffer()
+{
+    auto commandBuffer = TakeOwnership(commandBuffers_, MakeUnique<CaptureCommandBuffer>(*instance_->CreateCommandBuffer(), nullptr, writer_));
+    writer_.WriteCreateRecord(CaptureOpcode::CreateCommandBuffer, commandBuffer);
+    return commandBuffer;
+}
+
+CommandBufferExt* CaptureRenderSystem::CreateCommandBufferExt()
+{
+    if (auto instance = instance_->CreateCommandBufferExt())
+    {
+        auto commandBuffer = TakeOwnership(commandBuffers_, MakeUnique<CaptureCommandBuffer>(*instance, instance, writer_));
+        writer_.WriteCreateRecord(CaptureOpcode::CreateCommandBufferExt, commandBuffer);
+        return commandBuffer;
+    }
+    return nullptr;
+}
+
+void CaptureRenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferCapture = LLGL_CAST(CaptureCommandBuffer&, commandBuffer);
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseCommandBuffer, &commandBuffer);
+    instance_->Release(commandBufferCapture.instance);
+    RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* CaptureRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
+{
+    auto buffer = instance_->CreateBuffer(desc, initialData);
+
+    buffers_[buffer].size = desc.size;
+
+    writer_.WriteCreateRecord(
+        CaptureOpcode::CreateBuffer,
+        buffer,
+        desc,
+        CaptureData(initialData, (initialData != nullptr ? static_cast<std::size_t>(desc.size) : 0))
+    );
+
+    return buffer;
+}
+
+BufferArray* CaptureRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    auto buffers = instance_->CreateBufferArray(numBuffers, bufferArray);
+
+    std::vector<CaptureObjectRef> bufferRefs;
+    bufferRefs.reserve(numBuffers);
+    for (std::uint32_t i = 0; i < numBuffers; ++i)
+        bufferRefs.push_back(CaptureRef(bufferArray[i]));
+
+    writer_.WriteCreateRecord(CaptureOpcode::CreateBufferArray, buffers, bufferRefs);
+
+    return buffers;
+}
+
+void CaptureRenderSystem::Release(Buffer& buffer)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseBuffer, &buffer);
+    buffers_.erase(&buffer);
+    instance_->Release(buffer);
+}
+
+void CaptureRenderSystem::Release(BufferArray& bufferArray)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseBufferArray, &bufferArray);
+    instance_->Release(bufferArray);
+}
+
+void CaptureRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t dataSize, std::size_t offset)
+{
+    instance_->WriteBuffer(buffer, data, dataSize, offset);
+    writer_.WriteRecord(CaptureOpcode::WriteBuffer, CaptureRef(buffer), static_cast<std::uint64_t>(offset), CaptureData(data, dataSize));
+}
+
+void* CaptureRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
+{
+    auto result = instance_->MapBuffer(buffer, access);
+
+    /* Remember mapped memory and its current content, so the written range can be recorded when the buffer is unmapped */
+    if (access != CPUAccess::ReadOnly && result != nullptr)
+    {
+        auto& entry = buffers_[&buffer];
+        auto bytes = static_cast<const char*>(result);
+        entry.mappedData = result;
+        entry.snapshot.assign(bytes, bytes + static_cast<std::size_t>(entry.size));
+    }
+
+    return result;
+}
+
+void CaptureRenderSystem::UnmapBuffer(Buffer& buffer)
+{
+    /*
+    The trace cannot observe individual writes to mapped memory,
+    so record the range between the first and last byte that differs from the content at mapping time
+    */
+    auto it = buffers_.find(&buffer);
+    if (it != buffers_.end() && it->second.mappedData != nullptr)
+    {
+        auto& entry = it->second;
+        auto data   = static_cast<const char*>(entry.mappedData);
+        auto size   = entry.snapshot.size();
+
+        std::size_t first = 0, last = size;
+        while (first < size && data[first] == entry.snapshot[first])
+            ++first;
+        while (last > first && data[last - 1] == entry.snapshot[last - 1])
+            --last;
+
+        if (first < last)
+        {
+            writer_.WriteRecord(
+                CaptureOpcode::WriteBuffer,
+                CaptureRef(buffer),
+                static_cast<std::uint64_t>(first),
+                CaptureData(data + first, last - first)
+            );
+        }
+
+        entry.mappedData = nullptr;
+    }
+
+    instance_->UnmapBuffer(buffer);
+}
+
+bool CaptureRenderSystem::QueryStagingStatistics(StagingStatistics& statistics) const
+{
+    return instance_->QueryStagingStatistics(statistics);
+}
+
+/* ----- Textures ----- */
+
+Texture* CaptureRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+{
+    auto texture = instance_->CreateTexture(textureDesc, imageDesc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreateTexture, texture, textureDesc, (imageDesc != nullptr ? *imageDesc : SrcImageDescriptor{}));
+    return texture;
+}
+
+void CaptureRenderSystem::Release(Texture& texture)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseTexture, &texture);
+    instance_->Release(texture);
+}
+
+void CaptureRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc)
+{
+    instance_->WriteTexture(texture, subTextureDesc, imageDesc);
+    writer_.WriteRecord(CaptureOpcode::WriteTexture, CaptureRef(texture), subTextureDesc, imageDesc);
+}
+
+void CaptureRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    /* Read-back operations are not captured, since they do not affect the commands of the trace */
+    instance_->ReadTexture(texture, mipLevel, imageDesc);
+}
+
+std::uint64_t CaptureRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    return instance_->ReadTextureAsync(texture, mipLevel);
+}
+
+bool CaptureRenderSystem::QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait)
+{
+    return instance_->QueryTextureReadResult(ticket, imageDesc, wait);
+}
+
+void CaptureRenderSystem::GenerateMips(Texture& texture)
+{
+    instance_->GenerateMips(texture);
+    writer_.WriteRecord(CaptureOpcode::GenerateMips, CaptureRef(texture));
+}
+
+void CaptureRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers)
+{
+    instance_->GenerateMips(texture, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
+    writer_.WriteRecord(CaptureOpcode::GenerateMipsRange, CaptureRef(texture), baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* CaptureRenderSystem::CreateSampler(const SamplerDescriptor& desc)
+{
+    auto sampler = instance_->CreateSampler(desc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreateSampler, sampler, desc);
+    return sampler;
+}
+
+void CaptureRenderSystem::Release(Sampler& sampler)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseSampler, &sampler);
+    instance_->Release(sampler);
+}
+
+/* ----- Resource Views ----- */
+
+ResourceHeap* CaptureRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    auto resourceHeap = instance_->CreateResourceHeap(desc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreateResourceHeap, resourceHeap, desc);
+    return resourceHeap;
+}
+
+void CaptureRenderSystem::Release(ResourceHeap& resourceViewHeap)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseResourceHeap, &resourceViewHeap);
+    instance_->Release(resourceViewHeap);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* CaptureRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
+{
+    auto renderTarget = instance_->CreateRenderTarget(desc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreateRenderTarget, renderTarget, desc);
+    return renderTarget;
+}
+
+void CaptureRenderSystem::Release(RenderTarget& renderTarget)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseRenderTarget, &renderTarget);
+    instance_->Release(renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* CaptureRenderSystem::CreateShader(const ShaderDescriptor& desc)
+{
+    auto shader = instance_->CreateShader(desc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreateShader, shader, desc);
+    return shader;
+}
+
+ShaderProgram* CaptureRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    auto shaderProgram = TakeOwnership(shaderPrograms_, MakeUnique<CaptureShaderProgram>(*instance_->CreateShaderProgram(desc), writer_));
+    writer_.WriteCreateRecord(CaptureOpcode::CreateShaderProgram, shaderProgram, desc);
+    return shaderProgram;
+}
+
+void CaptureRenderSystem::Release(Shader& shader)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseShader, &shader);
+    instance_->Release(shader);
+}
+
+void CaptureRenderSystem::Release(ShaderProgram& shaderProgram)
+{
+    auto& shaderProgramCapture = LLGL_CAST(CaptureShaderProgram&, shaderProgram);
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseShaderProgram, &shaderProgram);
+    instance_->Release(shaderProgramCapture.instance);
+    RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
+}
+
+/* ----- Pipeline Layouts ----- */
+
+PipelineLayout* CaptureRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
+{
+    auto pipelineLayout = instance_->CreatePipelineLayout(desc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreatePipelineLayout, pipelineLayout, desc);
+    return pipelineLayout;
+}
+
+void CaptureRenderSystem::Release(PipelineLayout& pipelineLayout)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleasePipelineLayout, &pipelineLayout);
+    instance_->Release(pipelineLayout);
+}
+
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* CaptureRenderSystem::CreatePipelineCache(const void* initialBlob, std::size_t initialBlobSize)
+{
+    auto pipelineCache = instance_->CreatePipelineCache(initialBlob, initialBlobSize);
+    writer_.WriteCreateRecord(
+        CaptureOpcode::CreatePipelineCache,
+        pipelineCache,
+        CaptureData(initialBlob, (initialBlob != nullptr ? initialBlobSize : 0))
+    );
+    return pipelineCache;
+}
+
+void CaptureRenderSystem::Release(PipelineCache& pipelineCache)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleasePipelineCache, &pipelineCache);
+    instance_->Release(pipelineCache);
+}
+
+/* ----- Pipeline States ----- */
+
+GraphicsPipeline* CaptureRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    /* Unwrap shader program, but record the original descriptor that refers to the capture object */
+    auto instanceDesc = desc;
+    if (desc.shaderProgram)
+        instanceDesc.shaderProgram = &(LLGL_CAST(CaptureShaderProgram*, desc.shaderProgram)->instance);
+
+    auto graphicsPipeline = instance_->CreateGraphicsPipeline(instanceDesc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreateGraphicsPipeline, graphicsPipeline, desc);
+    return graphicsPipeline;
+}
+
+ComputePipeline* CaptureRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+{
+    auto instanceDesc = desc;
+    if (desc.shaderProgram)
+        instanceDesc.shaderProgram = &(LLGL_CAST(CaptureShaderProgram*, desc.shaderProgram)->instance);
+
+    auto computePipeline = instance_->CreateComputePipeline(instanceDesc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreateComputePipeline, computePipeline, desc);
+    return computePipeline;
+}
+
+/*
+Start the creation with the wrapped render system right away, so it keeps running asynchronously,
+and write the creation record with a deferred continuation once the client waits for the future.
+The record is therefore placed in the trace where the pipeline becomes available to the client.
+*/
+
+std::future<GraphicsPipeline*> CaptureRenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    auto instanceDesc = desc;
+    if (desc.shaderProgram)
+        instanceDesc.shaderProgram = &(LLGL_CAST(CaptureShaderProgram*, desc.shaderProgram)->instance);
+
+    return std::async(
+        std::launch::deferred,
+        [this](std::future<GraphicsPipeline*> instanceFuture, const GraphicsPipelineDescriptor& captureDesc) -> GraphicsPipeline*
+        {
+            auto graphicsPipeline = instanceFuture.get();
+            writer_.WriteCreateRecord(CaptureOpcode::CreateGraphicsPipeline, graphicsPipeline, captureDesc);
+            return graphicsPipeline;
+        },
+        instance_->CreateGraphicsPipelineAsync(instanceDesc),
+        desc
+    );
+}
+
+std::future<ComputePipeline*> CaptureRenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    auto instanceDesc = desc;
+    if (desc.shaderProgram)
+        instanceDesc.shaderProgram = &(LLGL_CAST(CaptureShaderProgram*, desc.shaderProgram)->instance);
+
+    return std::async(
+        std::launch::deferred,
+        [this](std::future<ComputePipeline*> instanceFuture, const ComputePipelineDescriptor& captureDesc) -> ComputePipeline*
+        {
+            auto computePipeline = instanceFuture.get();
+            writer_.WriteCreateRecord(CaptureOpcode::CreateComputePipeline, computePipeline, captureDesc);
+            return computePipeline;
+        },
+        instance_->CreateComputePipelineAsync(instanceDesc),
+        desc
+    );
+}
+
+void CaptureRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseGraphicsPipeline, &graphicsPipeline);
+    instance_->Release(graphicsPipeline);
+}
+
+void CaptureRenderSystem::Release(ComputePipeline& computePipeline)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseComputePipeline, &computePipeline);
+    instance_->Release(computePipeline);
+}
+
+/* ----- Queries ----- */
+
+Query* CaptureRenderSystem::CreateQuery(const QueryDescriptor& desc)
+{
+    auto query = instance_->CreateQuery(desc);
+    writer_.WriteCreateRecord(CaptureOpcode::CreateQuery, query, desc);
+    return query;
+}
+
+void CaptureRenderSystem::Release(Query& query)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseQuery, &query);
+    instance_->Release(query);
+}
+
+/* ----- Fences ----- */
+
+Fence* CaptureRenderSystem::CreateFence()
+{
+    auto fence = instance_->CreateFence();
+    writer_.WriteCreateRecord(CaptureOpcode::CreateFence, fence);
+    return fence;
+}
+
+void CaptureRenderSystem::Release(Fence& fence)
+{
+    writer_.WriteReleaseRecord(CaptureOpcode::ReleaseFence, &fence);
+    instance_->Release(fence);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
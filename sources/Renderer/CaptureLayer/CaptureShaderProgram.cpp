@@ -0,0 +1,63 @@
+/*
+ * CaptureShaderProgram.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureShaderProgram.h"
+
+
+namespace LLGL
+{
+
+
+CaptureShaderProgram::CaptureShaderProgram(ShaderProgram& instance, CaptureWriter& writer) :
+    instance { instance },
+    writer_  { writer   }
+{
+}
+
+bool CaptureShaderProgram::HasErrors() const
+{
+    return instance.HasErrors();
+}
+
+std::string CaptureShaderProgram::QueryInfoLog()
+{
+    return instance.QueryInfoLog();
+}
+
+ShaderReflectionDescriptor CaptureShaderProgram::QueryReflectionDesc() const
+{
+    return instance.QueryReflectionDesc();
+}
+
+void CaptureShaderProgram::BindConstantBuffer(const std::string& name, std::uint32_t bindingIndex)
+{
+    instance.BindConstantBuffer(name, bindingIndex);
+    writer_.WriteRecord(CaptureOpcode::BindConstantBuffer, CaptureRef(this), name, bindingIndex);
+}
+
+void CaptureShaderProgram::BindStorageBuffer(const std::string& name, std::uint32_t bindingIndex)
+{
+    instance.BindStorageBuffer(name, bindingIndex);
+    writer_.WriteRecord(CaptureOpcode::BindStorageBuffer, CaptureRef(this), name, bindingIndex);
+}
+
+ShaderUniform* CaptureShaderProgram::LockShaderUniform()
+{
+    return instance.LockShaderUniform();
+}
+
+void CaptureShaderProgram::UnlockShaderUniform()
+{
+    instance.UnlockShaderUniform();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
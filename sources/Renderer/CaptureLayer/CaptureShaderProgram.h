@@ -0,0 +1,59 @@
+/*
+ * CaptureShaderProgram.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_SHADER_PROGRAM_H
+#define LLGL_CAPTURE_SHADER_PROGRAM_H
+
+
+#include <LLGL/ShaderProgram.h>
+#include "CaptureStream.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Shader program of the capture layer, which captures the buffer binding points.
+Uniforms that are set with the ShaderUniform interface are not captured.
+*/
+class CaptureShaderProgram : public ShaderProgram
+{
+
+    public:
+
+        CaptureShaderProgram(ShaderProgram& instance, CaptureWriter& writer);
+
+        bool HasErrors() const override;
+
+        std::string QueryInfoLog() override;
+
+        ShaderReflectionDescriptor QueryReflectionDesc() const override;
+
+        void BindConstantBuffer(const std::string& name, std::uint32_t bindingIndex) override;
+        void BindStorageBuffer(const std::string& name, std::uint32_t bindingIndex) override;
+
+        ShaderUniform* LockShaderUniform() override;
+        void UnlockShaderUniform() override;
+
+        ShaderProgram& instance;
+
+    private:
+
+        CaptureWriter& writer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
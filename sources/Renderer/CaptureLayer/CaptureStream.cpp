@@ -0,0 +1,905 @@
+/*
+ * CaptureStream.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CaptureStream.h"
+#include "../../Core/Helper.h"
+#include <LLGL/Resource.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Shader.h>
+#include <LLGL/ShaderProgram.h>
+#include <LLGL/PipelineLayout.h>
+#include <LLGL/PipelineCache.h>
+#include <LLGL/RenderTarget.h>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/*
+ * CaptureWriter class
+ */
+
+CaptureWriter::CaptureWriter(const std::string& filename) :
+    file_ { filename, (std::ios_base::out | std::ios_base::binary | std::ios_base::trunc) }
+{
+    if (!file_.good())
+        throw std::runtime_error("failed to create capture file: \"" + filename + "\"");
+
+    file_.write(g_captureMagic, sizeof(g_captureMagic));
+    Write(g_captureVersion);
+}
+
+void CaptureWriter::WriteReleaseRecord(const CaptureOpcode opcode, const RenderSystemChild* object)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    Write(opcode);
+    Write(CaptureRef(object));
+    objectIDs_.Remove(object);
+}
+
+void CaptureWriter::Flush()
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    file_.flush();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t CaptureWriter::RegisterObject(const RenderSystemChild* object)
+{
+    auto id = nextID_++;
+    objectIDs_.Insert(object, id);
+    return id;
+}
+
+void CaptureWriter::Write(const CaptureObjectRef& ref)
+{
+    /* Write ID 0 for null and for objects that are unknown to the capture layer */
+    auto id = (ref.object != nullptr ? objectIDs_.Find(ref.object) : 0u);
+    Write(id != HWObjectIndexTable::invalidIndex ? id : 0u);
+}
+
+void CaptureWriter::Write(const CaptureDataRef& ref)
+{
+    Write(static_cast<std::uint64_t>(ref.size));
+    if (ref.size > 0)
+        file_.write(reinterpret_cast<const char*>(ref.data), static_cast<std::streamsize>(ref.size));
+}
+
+void CaptureWriter::Write(const std::string& s)
+{
+    Write(CaptureData(s.data(), s.size()));
+}
+
+void CaptureWriter::Write(const Extent2D& extent)
+{
+    Write(extent.width);
+    Write(extent.height);
+}
+
+void CaptureWriter::Write(const Extent3D& extent)
+{
+    Write(extent.width);
+    Write(extent.height);
+    Write(extent.depth);
+}
+
+void CaptureWriter::Write(const Offset3D& offset)
+{
+    Write(offset.x);
+    Write(offset.y);
+    Write(offset.z);
+}
+
+void CaptureWriter::Write(const ColorRGBAf& color)
+{
+    Write(color.r);
+    Write(color.g);
+    Write(color.b);
+    Write(color.a);
+}
+
+void CaptureWriter::Write(const ColorRGBAb& color)
+{
+    Write(color.r);
+    Write(color.g);
+    Write(color.b);
+    Write(color.a);
+}
+
+void CaptureWriter::Write(const Viewport& viewport)
+{
+    Write(viewport.x);
+    Write(viewport.y);
+    Write(viewport.width);
+    Write(viewport.height);
+    Write(viewport.minDepth);
+    Write(viewport.maxDepth);
+}
+
+void CaptureWriter::Write(const Scissor& scissor)
+{
+    Write(scissor.x);
+    Write(scissor.y);
+    Write(scissor.width);
+    Write(scissor.height);
+}
+
+void CaptureWriter::Write(const ClearValue& clearValue)
+{
+    Write(clearValue.color);
+    Write(clearValue.depth);
+    Write(clearValue.stencil);
+}
+
+void CaptureWriter::Write(const AttachmentClear& attachment)
+{
+    Write(static_cast<std::int64_t>(attachment.flags));
+    Write(attachment.colorAttachment);
+    Write(attachment.clearValue);
+}
+
+void CaptureWriter::Write(const MultiSamplingDescriptor& desc)
+{
+    Write(desc.enabled);
+    Write(desc.samples);
+}
+
+void CaptureWriter::Write(const VsyncDescriptor& desc)
+{
+    Write(desc.enabled);
+    Write(desc.refreshRate);
+    Write(desc.interval);
+}
+
+void CaptureWriter::Write(const VideoModeDescriptor& desc)
+{
+    Write(desc.resolution);
+    Write(desc.colorBits);
+    Write(desc.depthBits);
+    Write(desc.stencilBits);
+    Write(desc.fullscreen);
+    Write(desc.swapChainSize);
+}
+
+void CaptureWriter::Write(const RenderContextDescriptor& desc)
+{
+    /* Debug callback cannot be captured */
+    Write(desc.vsync);
+    Write(desc.multiSampling);
+    Write(desc.videoMode);
+    Write(desc.profileOpenGL.contextProfile);
+    Write(desc.profileOpenGL.majorVersion);
+    Write(desc.profileOpenGL.minorVersion);
+    Write(desc.framesInFlight);
+}
+
+void CaptureWriter::Write(const RenderSystemConfiguration& config)
+{
+    Write(config.imageInitialization.enabled);
+    Write(config.imageInitialization.clearValue);
+    Write(static_cast<std::uint64_t>(config.threadCount));
+}
+
+void CaptureWriter::Write(const VertexAttribute& attrib)
+{
+    Write(attrib.name);
+    Write(attrib.format);
+    Write(attrib.instanceDivisor);
+    Write(attrib.offset);
+    Write(attrib.semanticIndex);
+}
+
+void CaptureWriter::Write(const VertexFormat& format)
+{
+    Write(format.attributes);
+    Write(format.stride);
+    Write(format.inputSlot);
+}
+
+void CaptureWriter::Write(const BufferDescriptor& desc)
+{
+    Write(desc.type);
+    Write(desc.size);
+    Write(static_cast<std::int64_t>(desc.flags));
+    Write(desc.vertexBuffer.format);
+    Write(desc.indexBuffer.format.GetDataType());
+    Write(desc.storageBuffer.storageType);
+    Write(desc.storageBuffer.format);
+    Write(desc.storageBuffer.stride);
+}
+
+void CaptureWriter::Write(const TextureDescriptor& desc)
+{
+    Write(desc.type);
+    Write(desc.format);
+    Write(static_cast<std::int64_t>(desc.flags));
+    Write(desc.extent);
+    Write(desc.arrayLayers);
+    Write(desc.mipLevels);
+    Write(desc.samples);
+}
+
+void CaptureWriter::Write(const SubTextureDescriptor& desc)
+{
+    Write(desc.mipLevel);
+    Write(desc.offset);
+    Write(desc.extent);
+}
+
+void CaptureWriter::Write(const SrcImageDescriptor& desc)
+{
+    Write(desc.format);
+    Write(desc.dataType);
+    Write(CaptureData(desc.data, (desc.data != nullptr ? desc.dataSize : 0)));
+}
+
+void CaptureWriter::Write(const SamplerDescriptor& desc)
+{
+    Write(desc.addressModeU);
+    Write(desc.addressModeV);
+    Write(desc.addressModeW);
+    Write(desc.minFilter);
+    Write(desc.magFilter);
+    Write(desc.mipMapFilter);
+    Write(desc.mipMapping);
+    Write(desc.mipMapLODBias);
+    Write(desc.minLOD);
+    Write(desc.maxLOD);
+    Write(desc.maxAnisotropy);
+    Write(desc.compareEnabled);
+    Write(desc.compareOp);
+    Write(desc.borderColor);
+}
+
+void CaptureWriter::Write(const ResourceHeapDescriptor& desc)
+{
+    Write(CaptureRef(desc.pipelineLayout));
+    Write(static_cast<std::uint32_t>(desc.resourceViews.size()));
+    for (const auto& resourceView : desc.resourceViews)
+    {
+        Write(CaptureRef(resourceView.resource));
+        Write(resourceView.bufferRange);
+    }
+}
+
+void CaptureWriter::Write(const RenderTargetDescriptor& desc)
+{
+    Write(desc.resolution);
+    Write(desc.multiSampling);
+    Write(desc.customMultiSampling);
+    Write(static_cast<std::uint32_t>(desc.attachments.size()));
+    for (const auto& attachment : desc.attachments)
+    {
+        Write(attachment.type);
+        Write(CaptureRef(attachment.texture));
+        Write(attachment.mipLevel);
+        Write(attachment.arrayLayer);
+    }
+}
+
+void CaptureWriter::Write(const ShaderDescriptor& desc)
+{
+    Write(desc.type);
+
+    /* Embed shader files into the trace, so the trace does not depend on the working directory */
+    switch (desc.sourceType)
+    {
+        case ShaderSourceType::CodeString:
+        {
+            Write(ShaderSourceType::CodeString);
+            auto sourceSize = (desc.sourceSize > 0 ? desc.sourceSize : std::strlen(desc.source));
+            Write(CaptureData(desc.source, sourceSize));
+        }
+        break;
+
+        case ShaderSourceType::CodeFile:
+        {
+            Write(ShaderSourceType::CodeString);
+            Write(ReadFileString(desc.source));
+        }
+        break;
+
+        case ShaderSourceType::BinaryBuffer:
+        {
+            Write(ShaderSourceType::BinaryBuffer);
+            Write(CaptureData(desc.source, desc.sourceSize));
+        }
+        break;
+
+        case ShaderSourceType::BinaryFile:
+        {
+            Write(ShaderSourceType::BinaryBuffer);
+            auto buffer = ReadFileBuffer(desc.source);
+            Write(CaptureData(buffer.data(), buffer.size()));
+        }
+        break;
+    }
+
+    Write(desc.entryPoint != nullptr);
+    if (desc.entryPoint != nullptr)
+        Write(std::string(desc.entryPoint));
+
+    Write(desc.profile != nullptr);
+    if (desc.profile != nullptr)
+        Write(std::string(desc.profile));
+
+    Write(static_cast<std::int64_t>(desc.flags));
+
+    Write(static_cast<std::uint32_t>(desc.streamOutput.format.attributes.size()));
+    for (const auto& attrib : desc.streamOutput.format.attributes)
+    {
+        Write(attrib.name);
+        Write(attrib.stream);
+        Write(attrib.startComponent);
+        Write(attrib.components);
+        Write(attrib.semanticIndex);
+        Write(attrib.outputSlot);
+    }
+}
+
+void CaptureWriter::Write(const ShaderProgramDescriptor& desc)
+{
+    Write(desc.vertexFormats);
+    Write(CaptureRef(desc.vertexShader));
+    Write(CaptureRef(desc.tessControlShader));
+    Write(CaptureRef(desc.tessEvaluationShader));
+    Write(CaptureRef(desc.geometryShader));
+    Write(CaptureRef(desc.fragmentShader));
+    Write(CaptureRef(desc.computeShader));
+}
+
+void CaptureWriter::Write(const PipelineLayoutDescriptor& desc)
+{
+    Write(static_cast<std::uint32_t>(desc.bindings.size()));
+    for (const auto& binding : desc.bindings)
+    {
+        Write(binding.type);
+        Write(static_cast<std::int64_t>(binding.stageFlags));
+        Write(binding.slot);
+        Write(binding.arraySize);
+        Write(static_cast<std::int64_t>(binding.flags));
+    }
+}
+
+void CaptureWriter::Write(const StencilFaceDescriptor& desc)
+{
+    Write(desc.stencilFailOp);
+    Write(desc.depthFailOp);
+    Write(desc.depthPassOp);
+    Write(desc.compareOp);
+    Write(desc.readMask);
+    Write(desc.writeMask);
+    Write(desc.reference);
+}
+
+void CaptureWriter::Write(const GraphicsPipelineDescriptor& desc)
+{
+    Write(CaptureRef(desc.shaderProgram));
+    Write(CaptureRef(desc.pipelineLayout));
+    Write(CaptureRef(desc.pipelineCache));
+    Write(CaptureRef(desc.renderTarget));
+    Write(desc.primitiveTopology);
+    Write(desc.viewports);
+    Write(desc.scissors);
+
+    /* Write depth state */
+    Write(desc.depth.testEnabled);
+    Write(desc.depth.writeEnabled);
+    Write(desc.depth.compareOp);
+
+    /* Write stencil state */
+    Write(desc.stencil.testEnabled);
+    Write(desc.stencil.front);
+    Write(desc.stencil.back);
+
+    /* Write rasterizer state */
+    Write(desc.rasterizer.polygonMode);
+    Write(desc.rasterizer.cullMode);
+    Write(desc.rasterizer.depthBias.constantFactor);
+    Write(desc.rasterizer.depthBias.slopeFactor);
+    Write(desc.rasterizer.depthBias.clamp);
+    Write(desc.rasterizer.multiSampling);
+    Write(desc.rasterizer.frontCCW);
+    Write(desc.rasterizer.depthClampEnabled);
+    Write(desc.rasterizer.scissorTestEnabled);
+    Write(desc.rasterizer.antiAliasedLineEnabled);
+    Write(desc.rasterizer.conservativeRasterization);
+    Write(desc.rasterizer.lineWidth);
+
+    /* Write blend state */
+    Write(desc.blend.blendEnabled);
+    Write(desc.blend.blendFactor);
+    Write(desc.blend.alphaToCoverageEnabled);
+    Write(desc.blend.logicOp);
+    Write(static_cast<std::uint32_t>(desc.blend.targets.size()));
+    for (const auto& target : desc.blend.targets)
+    {
+        Write(target.srcColor);
+        Write(target.dstColor);
+        Write(target.colorArithmetic);
+        Write(target.srcAlpha);
+        Write(target.dstAlpha);
+        Write(target.alphaArithmetic);
+        Write(target.colorMask);
+    }
+}
+
+void CaptureWriter::Write(const ComputePipelineDescriptor& desc)
+{
+    Write(CaptureRef(desc.shaderProgram));
+    Write(CaptureRef(desc.pipelineLayout));
+    Write(CaptureRef(desc.pipelineCache));
+}
+
+void CaptureWriter::Write(const QueryDescriptor& desc)
+{
+    Write(desc.type);
+    Write(desc.renderCondition);
+}
+
+
+/*
+ * CaptureReader class
+ */
+
+CaptureReader::CaptureReader(const std::string& filename)
+{
+    /* Load entire trace into memory */
+    std::ifstream file { filename, (std::ios_base::in | std::ios_base::binary | std::ios_base::ate) };
+    if (!file.good())
+        throw std::runtime_error("failed to open capture file: \"" + filename + "\"");
+
+    data_.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(data_.data(), static_cast<std::streamsize>(data_.size()));
+    if (static_cast<std::size_t>(file.gcount()) != data_.size())
+        throw std::runtime_error("failed to read capture file: \"" + filename + "\"");
+
+    /* Verify file header */
+    if (data_.size() < sizeof(g_captureMagic) || std::memcmp(data_.data(), g_captureMagic, sizeof(g_captureMagic)) != 0)
+        throw std::runtime_error("invalid capture file: \"" + filename + "\"");
+
+    readPos_ = sizeof(g_captureMagic);
+
+    auto version = Read<std::uint32_t>();
+    if (version != g_captureVersion)
+        throw std::runtime_error("unsupported capture file version " + std::to_string(version) + " (expected " + std::to_string(g_captureVersion) + ")");
+
+    /* Reserve ID 0 for null references */
+    objects_.resize(1);
+}
+
+bool CaptureReader::ReadOpcode(CaptureOpcode& opcode)
+{
+    if (readPos_ >= data_.size())
+        return false;
+    opcode = static_cast<CaptureOpcode>(static_cast<std::uint8_t>(data_[readPos_++]));
+    return true;
+}
+
+void CaptureReader::Read(std::vector<char>& data)
+{
+    auto size = Read<std::uint64_t>();
+    data.resize(static_cast<std::size_t>(size));
+    if (size > 0)
+        ReadBytes(data.data(), data.size());
+}
+
+void CaptureReader::Read(std::string& s)
+{
+    auto size = Read<std::uint64_t>();
+    s.resize(static_cast<std::size_t>(size));
+    if (size > 0)
+        ReadBytes(&s[0], s.size());
+}
+
+void CaptureReader::Read(Extent2D& extent)
+{
+    Read(extent.width);
+    Read(extent.height);
+}
+
+void CaptureReader::Read(Extent3D& extent)
+{
+    Read(extent.width);
+    Read(extent.height);
+    Read(extent.depth);
+}
+
+void CaptureReader::Read(Offset3D& offset)
+{
+    Read(offset.x);
+    Read(offset.y);
+    Read(offset.z);
+}
+
+void CaptureReader::Read(ColorRGBAf& color)
+{
+    Read(color.r);
+    Read(color.g);
+    Read(color.b);
+    Read(color.a);
+}
+
+void CaptureReader::Read(ColorRGBAb& color)
+{
+    Read(color.r);
+    Read(color.g);
+    Read(color.b);
+    Read(color.a);
+}
+
+void CaptureReader::Read(Viewport& viewport)
+{
+    Read(viewport.x);
+    Read(viewport.y);
+    Read(viewport.width);
+    Read(viewport.height);
+    Read(viewport.minDepth);
+    Read(viewport.maxDepth);
+}
+
+void CaptureReader::Read(Scissor& scissor)
+{
+    Read(scissor.x);
+    Read(scissor.y);
+    Read(scissor.width);
+    Read(scissor.height);
+}
+
+void CaptureReader::Read(ClearValue& clearValue)
+{
+    Read(clearValue.color);
+    Read(clearValue.depth);
+    Read(clearValue.stencil);
+}
+
+void CaptureReader::Read(AttachmentClear& attachment)
+{
+    attachment.flags = static_cast<long>(Read<std::int64_t>());
+    Read(attachment.colorAttachment);
+    Read(attachment.clearValue);
+}
+
+void CaptureReader::Read(MultiSamplingDescriptor& desc)
+{
+    Read(desc.enabled);
+    Read(desc.samples);
+}
+
+void CaptureReader::Read(VsyncDescriptor& desc)
+{
+    Read(desc.enabled);
+    Read(desc.refreshRate);
+    Read(desc.interval);
+}
+
+void CaptureReader::Read(VideoModeDescriptor& desc)
+{
+    Read(desc.resolution);
+    Read(desc.colorBits);
+    Read(desc.depthBits);
+    Read(desc.stencilBits);
+    Read(desc.fullscreen);
+    Read(desc.swapChainSize);
+}
+
+void CaptureReader::Read(RenderContextDescriptor& desc)
+{
+    Read(desc.vsync);
+    Read(desc.multiSampling);
+    Read(desc.videoMode);
+    Read(desc.profileOpenGL.contextProfile);
+    Read(desc.profileOpenGL.majorVersion);
+    Read(desc.profileOpenGL.minorVersion);
+    Read(desc.framesInFlight);
+}
+
+void CaptureReader::Read(RenderSystemConfiguration& config)
+{
+    Read(config.imageInitialization.enabled);
+    Read(config.imageInitialization.clearValue);
+    config.threadCount = static_cast<std::size_t>(Read<std::uint64_t>());
+}
+
+void CaptureReader::Read(VertexAttribute& attrib)
+{
+    Read(attrib.name);
+    Read(attrib.format);
+    Read(attrib.instanceDivisor);
+    Read(attrib.offset);
+    Read(attrib.semanticIndex);
+}
+
+void CaptureReader::Read(VertexFormat& format)
+{
+    Read(format.attributes);
+    Read(format.stride);
+    Read(format.inputSlot);
+}
+
+void CaptureReader::Read(BufferDescriptor& desc)
+{
+    Read(desc.type);
+    Read(desc.size);
+    desc.flags = static_cast<long>(Read<std::int64_t>());
+    Read(desc.vertexBuffer.format);
+    desc.indexBuffer.format = IndexFormat(Read<DataType>());
+    Read(desc.storageBuffer.storageType);
+    Read(desc.storageBuffer.format);
+    Read(desc.storageBuffer.stride);
+}
+
+void CaptureReader::Read(TextureDescriptor& desc)
+{
+    Read(desc.type);
+    Read(desc.format);
+    desc.flags = static_cast<long>(Read<std::int64_t>());
+    Read(desc.extent);
+    Read(desc.arrayLayers);
+    Read(desc.mipLevels);
+    Read(desc.samples);
+}
+
+void CaptureReader::Read(SubTextureDescriptor& desc)
+{
+    Read(desc.mipLevel);
+    Read(desc.offset);
+    Read(desc.extent);
+}
+
+void CaptureReader::Read(SrcImageDescriptor& desc, std::vector<char>& storage)
+{
+    Read(desc.format);
+    Read(desc.dataType);
+    Read(storage);
+    desc.data       = (storage.empty() ? nullptr : storage.data());
+    desc.dataSize   = storage.size();
+}
+
+void CaptureReader::Read(SamplerDescriptor& desc)
+{
+    Read(desc.addressModeU);
+    Read(desc.addressModeV);
+    Read(desc.addressModeW);
+    Read(desc.minFilter);
+    Read(desc.magFilter);
+    Read(desc.mipMapFilter);
+    Read(desc.mipMapping);
+    Read(desc.mipMapLODBias);
+    Read(desc.minLOD);
+    Read(desc.maxLOD);
+    Read(desc.maxAnisotropy);
+    Read(desc.compareEnabled);
+    Read(desc.compareOp);
+    Read(desc.borderColor);
+}
+
+void CaptureReader::Read(ResourceHeapDescriptor& desc)
+{
+    desc.pipelineLayout = ReadObject<PipelineLayout>();
+    desc.resourceViews.resize(Read<std::uint32_t>());
+    for (auto& resourceView : desc.resourceViews)
+    {
+        resourceView.resource = ReadObject<Resource>();
+        Read(resourceView.bufferRange);
+    }
+}
+
+void CaptureReader::Read(RenderTargetDescriptor& desc)
+{
+    Read(desc.resolution);
+    Read(desc.multiSampling);
+    Read(desc.customMultiSampling);
+    desc.attachments.resize(Read<std::uint32_t>());
+    for (auto& attachment : desc.attachments)
+    {
+        Read(attachment.type);
+        attachment.texture = ReadObject<Texture>();
+        Read(attachment.mipLevel);
+        Read(attachment.arrayLayer);
+    }
+}
+
+void CaptureReader::Read(ShaderDescriptor& desc, CaptureShaderStorage& storage)
+{
+    Read(desc.type);
+    Read(desc.sourceType);
+    Read(storage.source);
+
+    /* Code strings in the trace are not null terminated */
+    desc.sourceSize = storage.source.size();
+    if (desc.sourceType == ShaderSourceType::CodeString)
+        storage.source.push_back('\0');
+    desc.source = storage.source.data();
+
+    if (Read<bool>())
+    {
+        Read(storage.entryPoint);
+        desc.entryPoint = storage.entryPoint.c_str();
+    }
+    else
+        desc.entryPoint = nullptr;
+
+    if (Read<bool>())
+    {
+        Read(storage.profile);
+        desc.profile = storage.profile.c_str();
+    }
+    else
+        desc.profile = nullptr;
+
+    desc.flags = static_cast<long>(Read<std::int64_t>());
+
+    desc.streamOutput.format.attributes.resize(Read<std::uint32_t>());
+    for (auto& attrib : desc.streamOutput.format.attributes)
+    {
+        Read(attrib.name);
+        Read(attrib.stream);
+        Read(attrib.startComponent);
+        Read(attrib.components);
+        Read(attrib.semanticIndex);
+        Read(attrib.outputSlot);
+    }
+}
+
+void CaptureReader::Read(ShaderProgramDescriptor& desc)
+{
+    Read(desc.vertexFormats);
+    desc.vertexShader           = ReadObject<Shader>();
+    desc.tessControlShader      = ReadObject<Shader>();
+    desc.tessEvaluationShader   = ReadObject<Shader>();
+    desc.geometryShader         = ReadObject<Shader>();
+    desc.fragmentShader         = ReadObject<Shader>();
+    desc.computeShader          = ReadObject<Shader>();
+}
+
+void CaptureReader::Read(PipelineLayoutDescriptor& desc)
+{
+    desc.bindings.resize(Read<std::uint32_t>());
+    for (auto& binding : desc.bindings)
+    {
+        Read(binding.type);
+        binding.stageFlags = static_cast<long>(Read<std::int64_t>());
+        Read(binding.slot);
+        Read(binding.arraySize);
+        binding.flags = static_cast<long>(Read<std::int64_t>());
+    }
+}
+
+void CaptureReader::Read(StencilFaceDescriptor& desc)
+{
+    Read(desc.stencilFailOp);
+    Read(desc.depthFailOp);
+    Read(desc.depthPassOp);
+    Read(desc.compareOp);
+    Read(desc.readMask);
+    Read(desc.writeMask);
+    Read(desc.reference);
+}
+
+void CaptureReader::Read(GraphicsPipelineDescriptor& desc)
+{
+    desc.shaderProgram  = ReadObject<ShaderProgram>();
+    desc.pipelineLayout = ReadObject<PipelineLayout>();
+    desc.pipelineCache  = ReadObject<PipelineCache>();
+    desc.renderTarget   = ReadObject<RenderTarget>();
+    Read(desc.primitiveTopology);
+    Read(desc.viewports);
+    Read(desc.scissors);
+
+    /* Read depth state */
+    Read(desc.depth.testEnabled);
+    Read(desc.depth.writeEnabled);
+    Read(desc.depth.compareOp);
+
+    /* Read stencil state */
+    Read(desc.stencil.testEnabled);
+    Read(desc.stencil.front);
+    Read(desc.stencil.back);
+
+    /* Read rasterizer state */
+    Read(desc.rasterizer.polygonMode);
+    Read(desc.rasterizer.cullMode);
+    Read(desc.rasterizer.depthBias.constantFactor);
+    Read(desc.rasterizer.depthBias.slopeFactor);
+    Read(desc.rasterizer.depthBias.clamp);
+    Read(desc.rasterizer.multiSampling);
+    Read(desc.rasterizer.frontCCW);
+    Read(desc.rasterizer.depthClampEnabled);
+    Read(desc.rasterizer.scissorTestEnabled);
+    Read(desc.rasterizer.antiAliasedLineEnabled);
+    Read(desc.rasterizer.conservativeRasterization);
+    Read(desc.rasterizer.lineWidth);
+
+    /* Read blend state */
+    Read(desc.blend.blendEnabled);
+    Read(desc.blend.blendFactor);
+    Read(desc.blend.alphaToCoverageEnabled);
+    Read(desc.blend.logicOp);
+    desc.blend.targets.resize(Read<std::uint32_t>());
+    for (auto& target : desc.blend.targets)
+    {
+        Read(target.srcColor);
+        Read(target.dstColor);
+        Read(target.colorArithmetic);
+        Read(target.srcAlpha);
+        Read(target.dstAlpha);
+        Read(target.alphaArithmetic);
+        Read(target.colorMask);
+    }
+}
+
+void CaptureReader::Read(ComputePipelineDescriptor& desc)
+{
+    desc.shaderProgram  = ReadObject<ShaderProgram>();
+    desc.pipelineLayout = ReadObject<PipelineLayout>();
+    desc.pipelineCache  = ReadObject<PipelineCache>();
+}
+
+void CaptureReader::Read(QueryDescriptor& desc)
+{
+    Read(desc.type);
+    Read(desc.renderCondition);
+}
+
+void CaptureReader::RegisterObject(std::uint32_t id, RenderSystemChild* object, const CaptureOpcode createOpcode)
+{
+    if (id == 0 || id < objects_.size())
+        throw std::runtime_error("invalid object ID in trace record: " + std::to_string(id));
+
+    /* IDs are assigned in order of creation, so the table only grows at the end */
+    objects_.resize(id + 1);
+    objects_[id].object         = object;
+    objects_[id].createOpcode   = createOpcode;
+}
+
+CaptureReader::ObjectEntry CaptureReader::UnregisterObject()
+{
+    auto id = Read<std::uint32_t>();
+    if (id == 0 || id >= objects_.size() || objects_[id].object == nullptr)
+        throw std::runtime_error("invalid object ID in trace record: " + std::to_string(id));
+
+    auto entry = objects_[id];
+    objects_[id] = ObjectEntry{};
+
+    return entry;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void CaptureReader::ReadBytes(void* data, std::size_t size)
+{
+    if (size > data_.size() - readPos_)
+        throw std::runtime_error("unexpected end of capture file");
+    std::memcpy(data, data_.data() + readPos_, size);
+    readPos_ += size;
+}
+
+RenderSystemChild* CaptureReader::ReadObjectEntry()
+{
+    auto id = Read<std::uint32_t>();
+    if (id >= objects_.size() || (id != 0 && objects_[id].object == nullptr))
+        throw std::runtime_error("invalid object ID in trace record: " + std::to_string(id));
+    return objects_[id].object;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
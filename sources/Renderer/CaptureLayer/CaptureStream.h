@@ -0,0 +1,324 @@
+/*
+ * CaptureStream.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_STREAM_H
+#define LLGL_CAPTURE_STREAM_H
+
+
+#include "CaptureFormat.h"
+#include "../HWObjectPool.h"
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/RenderContextFlags.h>
+#include <LLGL/BufferFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/SamplerFlags.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/ShaderProgramFlags.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include <LLGL/ResourceHeapFlags.h>
+#include <LLGL/RenderTargetFlags.h>
+#include <LLGL/GraphicsPipelineFlags.h>
+#include <LLGL/ComputePipelineFlags.h>
+#include <LLGL/QueryFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/RenderSystemChild.h>
+#include <LLGL/ColorRGBA.h>
+#include <LLGL/Types.h>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace LLGL
+{
+
+
+// Reference to a render system object, which is written as its capture ID.
+struct CaptureObjectRef
+{
+    const RenderSystemChild* object;
+};
+
+// Reference to a block of raw data, which is written with its size.
+struct CaptureDataRef
+{
+    const void*     data;
+    std::size_t     size;
+};
+
+inline CaptureObjectRef CaptureRef(const RenderSystemChild* object)
+{
+    return CaptureObjectRef{ object };
+}
+
+inline CaptureObjectRef CaptureRef(const RenderSystemChild& object)
+{
+    return CaptureObjectRef{ &object };
+}
+
+inline CaptureDataRef CaptureData(const void* data, std::size_t size)
+{
+    return CaptureDataRef{ data, size };
+}
+
+/*
+Thread-safe writer of the binary trace format (see CaptureFormat.h).
+Each record is written under a lock, so commands of different threads are never interleaved within a record.
+*/
+class CaptureWriter
+{
+
+    public:
+
+        // Creates the trace file and writes the file header. Throws std::runtime_error if the file could not be created.
+        CaptureWriter(const std::string& filename);
+
+        // Writes a record with the specified opcode and arguments.
+        template <typename... Args>
+        void WriteRecord(const CaptureOpcode opcode, const Args&... args)
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+            Write(opcode);
+            WriteArgs(args...);
+        }
+
+        // Assigns a new capture ID to the specified object and writes a record with that ID as first argument.
+        template <typename... Args>
+        void WriteCreateRecord(const CaptureOpcode opcode, const RenderSystemChild* object, const Args&... args)
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+            Write(opcode);
+            Write(RegisterObject(object));
+            WriteArgs(args...);
+        }
+
+        // Writes a release record for the specified object and removes its capture ID.
+        void WriteReleaseRecord(const CaptureOpcode opcode, const RenderSystemChild* object);
+
+        // Writes all buffered records to the file.
+        void Flush();
+
+    private:
+
+        void WriteArgs()
+        {
+            /* Recursion end */
+        }
+
+        template <typename T, typename... Args>
+        void WriteArgs(const T& first, const Args&... rest)
+        {
+            Write(first);
+            WriteArgs(rest...);
+        }
+
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "capture writer requires explicit overload for structured types");
+            file_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void Write(const CaptureObjectRef& ref);
+        void Write(const CaptureDataRef& ref);
+        void Write(const std::string& s);
+
+        void Write(const Extent2D& extent);
+        void Write(const Extent3D& extent);
+        void Write(const Offset3D& offset);
+        void Write(const ColorRGBAf& color);
+        void Write(const ColorRGBAb& color);
+        void Write(const Viewport& viewport);
+        void Write(const Scissor& scissor);
+        void Write(const ClearValue& clearValue);
+        void Write(const AttachmentClear& attachment);
+        void Write(const MultiSamplingDescriptor& desc);
+        void Write(const VsyncDescriptor& desc);
+        void Write(const VideoModeDescriptor& desc);
+        void Write(const RenderContextDescriptor& desc);
+        void Write(const RenderSystemConfiguration& config);
+        void Write(const VertexAttribute& attrib);
+        void Write(const VertexFormat& format);
+        void Write(const BufferDescriptor& desc);
+        void Write(const TextureDescriptor& desc);
+        void Write(const SubTextureDescriptor& desc);
+        void Write(const SrcImageDescriptor& desc);
+        void Write(const SamplerDescriptor& desc);
+        void Write(const ResourceHeapDescriptor& desc);
+        void Write(const RenderTargetDescriptor& desc);
+        void Write(const ShaderDescriptor& desc);
+        void Write(const ShaderProgramDescriptor& desc);
+        void Write(const PipelineLayoutDescriptor& desc);
+        void Write(const StencilFaceDescriptor& desc);
+        void Write(const GraphicsPipelineDescriptor& desc);
+        void Write(const ComputePipelineDescriptor& desc);
+        void Write(const QueryDescriptor& desc);
+
+        template <typename T>
+        void Write(const std::vector<T>& container)
+        {
+            Write(static_cast<std::uint32_t>(container.size()));
+            for (const auto& entry : container)
+                Write(entry);
+        }
+
+        std::uint32_t RegisterObject(const RenderSystemChild* object);
+
+    private:
+
+        std::mutex          mutex_;
+        std::ofstream       file_;
+        HWObjectIndexTable  objectIDs_;     // Maps object addresses to capture IDs
+        std::uint32_t       nextID_     = 1;
+
+};
+
+// Storage for the strings and source code a shader descriptor of a trace refers to.
+struct CaptureShaderStorage
+{
+    std::vector<char>   source;
+    std::string         entryPoint;
+    std::string         profile;
+};
+
+/*
+Reader of the binary trace format (see CaptureFormat.h).
+The entire trace is loaded into memory on construction, so replaying records does not include any file I/O.
+All objects that are created during replay are registered with their capture IDs, so records can refer to them.
+*/
+class CaptureReader
+{
+
+    public:
+
+        struct ObjectEntry
+        {
+            RenderSystemChild*  object          = nullptr;
+            CaptureOpcode       createOpcode    = CaptureOpcode::SetConfiguration;
+        };
+
+    public:
+
+        // Loads the trace file into memory and verifies the file header. Throws std::runtime_error if the file is not a valid trace.
+        CaptureReader(const std::string& filename);
+
+        // Reads the opcode of the next record. Returns false if the end of the trace has been reached.
+        bool ReadOpcode(CaptureOpcode& opcode);
+
+        template <typename T>
+        void Read(T& value)
+        {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "capture reader requires explicit overload for structured types");
+            ReadBytes(&value, sizeof(T));
+        }
+
+        template <typename T>
+        T Read()
+        {
+            T value;
+            Read(value);
+            return value;
+        }
+
+        // Reads a block of raw data.
+        void Read(std::vector<char>& data);
+        void Read(std::string& s);
+
+        void Read(Extent2D& extent);
+        void Read(Extent3D& extent);
+        void Read(Offset3D& offset);
+        void Read(ColorRGBAf& color);
+        void Read(ColorRGBAb& color);
+        void Read(Viewport& viewport);
+        void Read(Scissor& scissor);
+        void Read(ClearValue& clearValue);
+        void Read(AttachmentClear& attachment);
+        void Read(MultiSamplingDescriptor& desc);
+        void Read(VsyncDescriptor& desc);
+        void Read(VideoModeDescriptor& desc);
+        void Read(RenderContextDescriptor& desc);
+        void Read(RenderSystemConfiguration& config);
+        void Read(VertexAttribute& attrib);
+        void Read(VertexFormat& format);
+        void Read(BufferDescriptor& desc);
+        void Read(TextureDescriptor& desc);
+        void Read(SubTextureDescriptor& desc);
+        void Read(SrcImageDescriptor& desc, std::vector<char>& storage);
+        void Read(SamplerDescriptor& desc);
+        void Read(ResourceHeapDescriptor& desc);
+        void Read(RenderTargetDescriptor& desc);
+        void Read(ShaderDescriptor& desc, CaptureShaderStorage& storage);
+        void Read(ShaderProgramDescriptor& desc);
+        void Read(PipelineLayoutDescriptor& desc);
+        void Read(StencilFaceDescriptor& desc);
+        void Read(GraphicsPipelineDescriptor& desc);
+        void Read(ComputePipelineDescriptor& desc);
+        void Read(QueryDescriptor& desc);
+
+        template <typename T>
+        void Read(std::vector<T>& container)
+        {
+            container.resize(Read<std::uint32_t>());
+            for (auto& entry : container)
+                Read(entry);
+        }
+
+        // Reads a capture ID and returns its object, or null if the ID is 0. Throws std::runtime_error if the ID is unknown.
+        template <typename T>
+        T* ReadObject()
+        {
+            return static_cast<T*>(ReadObjectEntry());
+        }
+
+        // Reads a capture ID and returns its object. Throws std::runtime_error if the ID is 0 or unknown.
+        template <typename T>
+        T& ReadObjectRef()
+        {
+            if (auto object = ReadObject<T>())
+                return *object;
+            throw std::runtime_error("null object reference in trace record");
+        }
+
+        // Registers the object of a creation record with the specified capture ID.
+        void RegisterObject(std::uint32_t id, RenderSystemChild* object, const CaptureOpcode createOpcode);
+
+        // Reads a capture ID, unregisters its object, and returns it.
+        ObjectEntry UnregisterObject();
+
+        // Returns all registered objects, indexed by their capture IDs.
+        inline const std::vector<ObjectEntry>& GetObjects() const
+        {
+            return objects_;
+        }
+
+    private:
+
+        void ReadBytes(void* data, std::size_t size);
+
+        RenderSystemChild* ReadObjectEntry();
+
+    private:
+
+        std::vector<char>           data_;          // Entire content of the trace file
+        std::size_t                 readPos_    = 0;
+        std::vector<ObjectEntry>    objects_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,52 @@
+/*
+ * CommandBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/CommandBuffer.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+static void AssertNoDynamicOffsets(std::uint32_t numDynamicOffsets)
+{
+    if (numDynamicOffsets > 0)
+        throw std::runtime_error("dynamic offsets for resource heaps are not supported by this render system");
+}
+
+void CommandBuffer::SetGraphicsResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    /*dynamicOffsets*/)
+{
+    AssertNoDynamicOffsets(numDynamicOffsets);
+    SetGraphicsResourceHeap(resourceHeap, firstSet);
+}
+
+void CommandBuffer::SetComputeResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    /*dynamicOffsets*/)
+{
+    AssertNoDynamicOffsets(numDynamicOffsets);
+    SetComputeResourceHeap(resourceHeap, firstSet);
+}
+
+bool CommandBuffer::QueryStateChangeStatistics(StateChangeStatistics& /*statistics*/) const
+{
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
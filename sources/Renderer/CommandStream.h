@@ -0,0 +1,54 @@
+/*
+ * CommandStream.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_COMMAND_STREAM_H
+#define LLGL_COMMAND_STREAM_H
+
+
+#include "../Core/Helper.h"
+#include <cstdint>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Helper functions to decode the command streams of deferred command buffers (e.g. GLDeferredCommandBuffer and NullCommandBuffer).
+*/
+
+// Reads the command structure at the current stream position (the stream has no alignment for command structures).
+template <typename T>
+inline T ReadCmd(const std::uint8_t*& pc)
+{
+    T cmd;
+    ::memcpy(&cmd, pc, sizeof(T));
+    pc += sizeof(T);
+    return cmd;
+}
+
+// Reads the number of array elements and returns a pointer to the aligned array at the current stream position.
+template <typename T>
+inline const T* ReadCmdArray(const std::uint8_t* begin, const std::uint8_t*& pc, std::uint32_t& count)
+{
+    count = ReadCmd<std::uint32_t>(pc);
+    pc = begin + GetAlignedSize(static_cast<std::size_t>(pc - begin), alignof(T));
+    auto data = reinterpret_cast<const T*>(pc);
+    pc += sizeof(T) * count;
+    return data;
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -9,7 +9,7 @@
 #define LLGL_CONTAINER_TYPES_H
 
 
-#include <set>
+#include "HWObjectPool.h"
 #include <memory>
 
 
@@ -21,7 +21,7 @@ template <typename T>
 using HWObjectInstance = std::unique_ptr<T>;
 
 template <typename T>
-using HWObjectContainer = std::set<HWObjectInstance<T>>;
+using HWObjectContainer = HWObjectPool<T>;
 
 
 } // /namespace LLGL
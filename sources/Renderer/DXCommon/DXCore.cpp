@@ -263,6 +263,9 @@ void DXGetRenderingCaps(RenderingCapabilities& caps, D3D_FEATURE_LEVEL featureLe
     caps.features.hasViewportArrays                 = true;
     caps.features.hasStreamOutputs                  = (featureLevel >= D3D_FEATURE_LEVEL_10_0);
     caps.features.hasLogicOp                        = (featureLevel >= D3D_FEATURE_LEVEL_11_1);
+    caps.features.hasIndirectDrawing                = (featureLevel >= D3D_FEATURE_LEVEL_11_0);
+    caps.features.hasIndirectCountDrawing           = false;
+    caps.features.hasTimestampQueries               = true;
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = 1.0f;
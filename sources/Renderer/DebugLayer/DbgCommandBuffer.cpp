@@ -17,6 +17,7 @@
 #include "DbgRenderTarget.h"
 #include "DbgShaderProgram.h"
 #include "DbgQuery.h"
+#include "DbgResourceHeap.h"
 
 
 namespace LLGL
@@ -139,6 +140,91 @@ void DbgCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Atta
     instance.ClearAttachments(numAttachments, attachments);
 }
 
+/* ----- Copy ----- */
+
+void DbgCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+
+        if (!data)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "illegal null pointer argument for 'data' parameter");
+
+        if (dstOffset % 4 != 0 || dataSize % 4 != 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "offset and size for buffer update must be multiples of 4 (offset " + std::to_string(dstOffset) +
+                " and size " + std::to_string(dataSize) + " specified)"
+            );
+        }
+
+        ValidateBufferRange(dstBufferDbg, dstOffset, dataSize);
+    }
+
+    instance.UpdateBuffer(dstBufferDbg.instance, dstOffset, data, dataSize);
+}
+
+void DbgCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
+    auto& srcBufferDbg = LLGL_CAST(DbgBuffer&, srcBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+
+        if (size == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no bytes will be copied between buffers");
+
+        ValidateBufferRange(dstBufferDbg, dstOffset, size);
+        ValidateBufferRange(srcBufferDbg, srcOffset, size);
+
+        if (&dstBufferDbg == &srcBufferDbg && dstOffset < srcOffset + size && srcOffset < dstOffset + size)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "source and destination ranges of buffer copy must not overlap");
+    }
+
+    instance.CopyBuffer(dstBufferDbg.instance, dstOffset, srcBufferDbg.instance, srcOffset, size);
+}
+
+void DbgCommandBuffer::CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcBufferDbg  = LLGL_CAST(DbgBuffer&, srcBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateTextureRegion(dstTextureDbg, dstRegion.mipLevel, dstRegion.offset, dstRegion.extent);
+
+        const auto numTexels = dstRegion.extent.width * dstRegion.extent.height * dstRegion.extent.depth;
+        ValidateBufferRange(srcBufferDbg, srcOffset, TextureBufferSize(dstTextureDbg.desc.format, numTexels));
+    }
+
+    instance.CopyBufferToTexture(dstTextureDbg.instance, dstRegion, srcBufferDbg.instance, srcOffset);
+}
+
+void DbgCommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateTextureRegion(dstTextureDbg, dstRegion.mipLevel, dstRegion.offset, dstRegion.extent);
+        ValidateTextureRegion(srcTextureDbg, srcMipLevel, srcOffset, dstRegion.extent);
+
+        if (dstTextureDbg.desc.format != srcTextureDbg.desc.format)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "source and destination textures of texture copy must have the same format");
+    }
+
+    instance.CopyTexture(dstTextureDbg.instance, dstRegion, srcTextureDbg.instance, srcMipLevel, srcOffset);
+}
+
 /* ----- Buffers ------ */
 
 void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
@@ -352,13 +438,63 @@ void DbgCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long sta
 //TODO: record bindings
 void DbgCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
-    instance.SetGraphicsResourceHeap(resourceHeap, firstSet);
+    auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateDynamicOffsets(resourceHeapDbg, 0, nullptr);
+    }
+
+    instance.SetGraphicsResourceHeap(resourceHeapDbg.instance, firstSet);
 }
 
 //TODO: record bindings
 void DbgCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
-    instance.SetComputeResourceHeap(resourceHeap, firstSet);
+    auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateDynamicOffsets(resourceHeapDbg, 0, nullptr);
+    }
+
+    instance.SetComputeResourceHeap(resourceHeapDbg.instance, firstSet);
+}
+
+void DbgCommandBuffer::SetGraphicsResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateDynamicOffsets(resourceHeapDbg, numDynamicOffsets, dynamicOffsets);
+    }
+
+    instance.SetGraphicsResourceHeapWithOffsets(resourceHeapDbg.instance, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
+void DbgCommandBuffer::SetComputeResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateDynamicOffsets(resourceHeapDbg, numDynamicOffsets, dynamicOffsets);
+    }
+
+    instance.SetComputeResourceHeapWithOffsets(resourceHeapDbg.instance, firstSet, numDynamicOffsets, dynamicOffsets);
 }
 
 /* ----- Render Targets ----- */
@@ -418,6 +554,8 @@ void DbgCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
     instance.SetGraphicsPipeline(graphicsPipelineDbg.instance);
     
     LLGL_DBG_PROFILER_DO(setGraphicsPipeline.Inc());
+
+    RecordStateChangeStatistics();
 }
 
 void DbgCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
@@ -430,6 +568,11 @@ void DbgCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
     LLGL_DBG_PROFILER_DO(setComputePipeline.Inc());
 }
 
+bool DbgCommandBuffer::QueryStateChangeStatistics(StateChangeStatistics& statistics) const
+{
+    return instance.QueryStateChangeStatistics(statistics);
+}
+
 /* ----- Queries ----- */
 
 void DbgCommandBuffer::BeginQuery(Query& query)
@@ -439,7 +582,8 @@ void DbgCommandBuffer::BeginQuery(Query& query)
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
-        if (queryDbg.state == DbgQuery::State::Busy)
+        /* Timestamp queries are only reset with BeginQuery, so they can be reset again before they are written */
+        if (queryDbg.state == DbgQuery::State::Busy && query.GetType() != QueryType::Timestamp)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "query is already busy");
         queryDbg.state = DbgQuery::State::Busy;
     }
@@ -614,6 +758,127 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
     LLGL_DBG_PROFILER_DO(RecordDrawCall(topology_, numIndices, numInstances));
 }
 
+void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectDrawingSupported();
+        AssertGraphicsPipelineBound();
+        AssertVertexBufferBound();
+        ValidateVertexLayout();
+        ValidateIndirectArguments(bufferDbg, offset, 1, sizeof(DrawIndirectArguments), sizeof(DrawIndirectArguments));
+    }
+
+    instance.DrawIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc());
+}
+
+void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectDrawingSupported();
+        AssertGraphicsPipelineBound();
+        AssertVertexBufferBound();
+        ValidateVertexLayout();
+        ValidateIndirectArguments(bufferDbg, offset, numCommands, stride, sizeof(DrawIndirectArguments));
+    }
+
+    instance.DrawIndirect(bufferDbg.instance, offset, numCommands, stride);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc(numCommands));
+}
+
+void DbgCommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto& bufferDbg         = LLGL_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg    = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectCountDrawingSupported();
+        AssertGraphicsPipelineBound();
+        AssertVertexBufferBound();
+        ValidateVertexLayout();
+        ValidateIndirectArguments(bufferDbg, offset, maxNumCommands, stride, sizeof(DrawIndirectArguments));
+        ValidateIndirectCountBuffer(countBufferDbg, countOffset);
+    }
+
+    instance.DrawIndirectCount(bufferDbg.instance, offset, countBufferDbg.instance, countOffset, maxNumCommands, stride);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc());
+}
+
+void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectDrawingSupported();
+        AssertGraphicsPipelineBound();
+        AssertVertexBufferBound();
+        AssertIndexBufferBound();
+        ValidateVertexLayout();
+        ValidateIndirectArguments(bufferDbg, offset, 1, sizeof(DrawIndexedIndirectArguments), sizeof(DrawIndexedIndirectArguments));
+    }
+
+    instance.DrawIndexedIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc());
+}
+
+void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectDrawingSupported();
+        AssertGraphicsPipelineBound();
+        AssertVertexBufferBound();
+        AssertIndexBufferBound();
+        ValidateVertexLayout();
+        ValidateIndirectArguments(bufferDbg, offset, numCommands, stride, sizeof(DrawIndexedIndirectArguments));
+    }
+
+    instance.DrawIndexedIndirect(bufferDbg.instance, offset, numCommands, stride);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc(numCommands));
+}
+
+void DbgCommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto& bufferDbg         = LLGL_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg    = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectCountDrawingSupported();
+        AssertGraphicsPipelineBound();
+        AssertVertexBufferBound();
+        AssertIndexBufferBound();
+        ValidateVertexLayout();
+        ValidateIndirectArguments(bufferDbg, offset, maxNumCommands, stride, sizeof(DrawIndexedIndirectArguments));
+        ValidateIndirectCountBuffer(countBufferDbg, countOffset);
+    }
+
+    instance.DrawIndexedIndirectCount(bufferDbg.instance, offset, countBufferDbg.instance, countOffset, maxNumCommands, stride);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc());
+}
+
 /* ----- Compute ----- */
 
 void DbgCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
@@ -636,6 +901,35 @@ void DbgCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSiz
     LLGL_DBG_PROFILER_DO(dispatchComputeCalls.Inc());
 }
 
+void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectDrawingSupported();
+        AssertComputePipelineBound();
+        ValidateIndirectArguments(bufferDbg, offset, 1, sizeof(DispatchIndirectArguments), sizeof(DispatchIndirectArguments));
+    }
+
+    instance.DispatchIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(dispatchComputeCalls.Inc());
+}
+
+/* ----- Debugging members ----- */
+
+void DbgCommandBuffer::RecordStateChangeStatistics()
+{
+    StateChangeStatistics stats;
+    if (profiler_ != nullptr && instance.QueryStateChangeStatistics(stats))
+    {
+        profiler_->pipelineStateChanges.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.issuedStateChanges - stateChangeStats_.issuedStateChanges));
+        profiler_->pipelineStateChangesSkipped.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.skippedStateChanges - stateChangeStats_.skippedStateChanges));
+        stateChangeStats_ = stats;
+    }
+}
 
 /*
  * ======= Private: =======
@@ -895,6 +1189,122 @@ void DbgCommandBuffer::ValidateBufferType(const BufferType bufferType, const Buf
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid buffer type");
 }
 
+void DbgCommandBuffer::ValidateDynamicOffsets(const DbgResourceHeap& resourceHeapDbg, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
+{
+    const auto& types = resourceHeapDbg.dynamicOffsetTypes;
+
+    if (numDynamicOffsets != types.size())
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "mismatch between number of dynamic offsets (" + std::to_string(numDynamicOffsets) +
+            ") and bindings with dynamic offsets in resource heap (" + std::to_string(types.size()) + ")"
+        );
+    }
+    else if (numDynamicOffsets > 0 && !dynamicOffsets)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "dynamic offset array must not be a null pointer");
+    else
+    {
+        for (std::uint32_t i = 0; i < numDynamicOffsets; ++i)
+        {
+            /* Storage buffers have their own offset alignment */
+            const bool isStorage = (types[i] == ResourceType::StorageBuffer);
+            const auto alignment = (isStorage ? limits_.minStorageBufferOffsetAlignment : limits_.minConstantBufferOffsetAlignment);
+
+            if (alignment > 0 && dynamicOffsets[i] % alignment != 0)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "dynamic offset " + std::to_string(dynamicOffsets[i]) + " is not a multiple of the minimal " +
+                    (isStorage ? "storage" : "constant") + " buffer alignment (" + std::to_string(alignment) + ")"
+                );
+            }
+        }
+    }
+}
+
+void DbgCommandBuffer::ValidateBufferRange(const DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size)
+{
+    if (offset + size > bufferDbg.desc.size)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "buffer range out of bounds (" + std::to_string(offset + size) +
+            " bytes required but buffer size is " + std::to_string(bufferDbg.desc.size) + ")"
+        );
+    }
+}
+
+void DbgCommandBuffer::ValidateTextureRegion(const DbgTexture& textureDbg, std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent)
+{
+    if (mipLevel >= textureDbg.mipLevels)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "MIP level out of bounds (" + std::to_string(mipLevel) +
+            " specified but limit is " + std::to_string(textureDbg.mipLevels - 1) + ")"
+        );
+        return;
+    }
+
+    if (offset.x < 0 || offset.y < 0 || offset.z < 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "negative offset for texture region");
+
+    /* Compare region against MIP extent (which also includes the number of array layers) */
+    const auto mipExtent = textureDbg.QueryMipExtent(mipLevel);
+    if (static_cast<std::uint32_t>(offset.x) + extent.width  > mipExtent.width  ||
+        static_cast<std::uint32_t>(offset.y) + extent.height > mipExtent.height ||
+        static_cast<std::uint32_t>(offset.z) + extent.depth  > mipExtent.depth)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "texture region out of bounds");
+    }
+}
+
+void DbgCommandBuffer::ValidateIndirectArguments(
+    const DbgBuffer& bufferDbg, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride, std::uint32_t argumentsSize)
+{
+    if ((bufferDbg.desc.flags & BufferFlags::IndirectArguments) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer for indirect arguments was not created with the BufferFlags::IndirectArguments flag");
+
+    if (offset % 4 != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "offset for indirect arguments is not a multiple of 4 (" + std::to_string(offset) + " specified)");
+
+    if (numCommands == 0)
+        LLGL_DBG_WARN(WarningType::PointlessOperation, "no indirect commands will be generated");
+    else
+    {
+        if (numCommands > 1 && (stride % 4 != 0 || stride < argumentsSize))
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "stride for indirect arguments must be a multiple of 4 and at least " + std::to_string(argumentsSize) +
+                " (" + std::to_string(stride) + " specified)"
+            );
+        }
+
+        const auto requiredSize = offset + static_cast<std::uint64_t>(numCommands - 1) * stride + argumentsSize;
+        if (requiredSize > bufferDbg.desc.size)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "indirect arguments out of bounds (" + std::to_string(requiredSize) +
+                " bytes required but buffer size is " + std::to_string(bufferDbg.desc.size) + ")"
+            );
+        }
+    }
+}
+
+void DbgCommandBuffer::ValidateIndirectCountBuffer(const DbgBuffer& bufferDbg, std::uint64_t offset)
+{
+    if ((bufferDbg.desc.flags & BufferFlags::IndirectArguments) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer for indirect command count was not created with the BufferFlags::IndirectArguments flag");
+
+    if (offset % 4 != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "offset for indirect command count is not a multiple of 4 (" + std::to_string(offset) + " specified)");
+    else if (offset + sizeof(std::uint32_t) > bufferDbg.desc.size)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "offset for indirect command count out of bounds (" + std::to_string(offset) + " specified)");
+}
+
 void DbgCommandBuffer::AssertGraphicsPipelineBound()
 {
     if (!bindings_.graphicsPipeline)
@@ -950,6 +1360,18 @@ void DbgCommandBuffer::AssertOffsetInstancingSupported()
         LLGL_DBG_ERROR_NOT_SUPPORTED("offset-instancing");
 }
 
+void DbgCommandBuffer::AssertIndirectDrawingSupported()
+{
+    if (!features_.hasIndirectDrawing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
+}
+
+void DbgCommandBuffer::AssertIndirectCountDrawingSupported()
+{
+    if (!features_.hasIndirectCountDrawing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing with count buffer");
+}
+
 void DbgCommandBuffer::WarnImproperVertices(const std::string& topologyName, std::uint32_t unusedVertices)
 {
     LLGL_DBG_WARN(
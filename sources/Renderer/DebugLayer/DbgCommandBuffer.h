@@ -22,8 +22,10 @@ namespace LLGL
 
 
 class DbgBuffer;
+class DbgTexture;
 class DbgRenderContext;
 class DbgRenderTarget;
+class DbgResourceHeap;
 
 class DbgCommandBuffer : public CommandBufferExt
 {
@@ -61,6 +63,13 @@ class DbgCommandBuffer : public CommandBufferExt
         void Clear(long flags) override;
         void ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments) override;
 
+        /* ----- Copy ----- */
+
+        void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
+        void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset) override;
+        void CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset) override;
+
         /* ----- Input Assembly ------ */
 
         void SetVertexBuffer(Buffer& buffer) override;
@@ -97,6 +106,20 @@ class DbgCommandBuffer : public CommandBufferExt
         void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
         void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
 
+        void SetGraphicsResourceHeapWithOffsets(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        ) override;
+
+        void SetComputeResourceHeapWithOffsets(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        ) override;
+
         /* ----- Render Targets ----- */
 
         void SetRenderTarget(RenderTarget& renderTarget) override;
@@ -107,6 +130,8 @@ class DbgCommandBuffer : public CommandBufferExt
         void SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline) override;
         void SetComputePipeline(ComputePipeline& computePipeline) override;
 
+        bool QueryStateChangeStatistics(StateChangeStatistics& statistics) const override;
+
         /* ----- Queries ----- */
 
         void BeginQuery(Query& query) override;
@@ -132,12 +157,24 @@ class DbgCommandBuffer : public CommandBufferExt
         void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset) override;
         void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance) override;
 
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, std::uint64_t offset) override;
 
         /* ----- Debugging members ----- */
 
+        // Records the state changes the wrapped command buffer has issued and skipped since the last call.
+        void RecordStateChangeStatistics();
+
         CommandBuffer&      instance;
         CommandBufferExt*   instanceExt = nullptr;
 
@@ -163,6 +200,11 @@ class DbgCommandBuffer : public CommandBufferExt
 
         void ValidateStageFlags(long stageFlags, long validFlags);
         void ValidateBufferType(const BufferType bufferType, const BufferType compareType);
+        void ValidateDynamicOffsets(const DbgResourceHeap& resourceHeapDbg, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets);
+        void ValidateBufferRange(const DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size);
+        void ValidateTextureRegion(const DbgTexture& textureDbg, std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent);
+        void ValidateIndirectArguments(const DbgBuffer& bufferDbg, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride, std::uint32_t argumentsSize);
+        void ValidateIndirectCountBuffer(const DbgBuffer& bufferDbg, std::uint64_t offset);
 
         void AssertGraphicsPipelineBound();
         void AssertComputePipelineBound();
@@ -171,6 +213,8 @@ class DbgCommandBuffer : public CommandBufferExt
 
         void AssertInstancingSupported();
         void AssertOffsetInstancingSupported();
+        void AssertIndirectDrawingSupported();
+        void AssertIndirectCountDrawingSupported();
 
         void WarnImproperVertices(const std::string& topologyName, std::uint32_t unusedVertices);
 
@@ -187,6 +231,8 @@ class DbgCommandBuffer : public CommandBufferExt
 
         PrimitiveTopology               topology_               = PrimitiveTopology::TriangleList;
 
+        StateChangeStatistics           stateChangeStats_;      // Last queried state change statistics of the wrapped command buffer
+
         struct Bindings
         {
             DbgRenderContext*       renderContext           = nullptr;
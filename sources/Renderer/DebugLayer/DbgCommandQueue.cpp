@@ -0,0 +1,55 @@
+/*
+ * DbgCommandQueue.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "DbgCommandQueue.h"
+#include "DbgCommandBuffer.h"
+#include "../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+DbgCommandQueue::DbgCommandQueue(CommandQueue& instance) :
+    instance { instance }
+{
+}
+
+/* ----- Command queues ----- */
+
+void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferDbg = LLGL_CAST(DbgCommandBuffer&, commandBuffer);
+    instance.Submit(commandBufferDbg.instance);
+
+    /* Deferred command buffers issue their state changes when they are submitted */
+    commandBufferDbg.RecordStateChangeStatistics();
+}
+
+/* ----- Fences ----- */
+
+void DbgCommandQueue::Submit(Fence& fence)
+{
+    instance.Submit(fence);
+}
+
+bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    return instance.WaitFence(fence, timeout);
+}
+
+void DbgCommandQueue::WaitIdle()
+{
+    instance.WaitIdle();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
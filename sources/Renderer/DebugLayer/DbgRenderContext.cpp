@@ -33,6 +33,11 @@ Format DbgRenderContext::QueryDepthStencilFormat() const
     return instance.QueryDepthStencilFormat();
 }
 
+bool DbgRenderContext::QueryFramePacingStatistics(FramePacingStatistics& stats) const
+{
+    return instance.QueryFramePacingStatistics(stats);
+}
+
 
 /*
  * ======= Private: =======
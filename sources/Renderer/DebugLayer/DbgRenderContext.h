@@ -32,6 +32,8 @@ class DbgRenderContext : public RenderContext
         Format QueryColorFormat() const override;
         Format QueryDepthStencilFormat() const override;
 
+        bool QueryFramePacingStatistics(FramePacingStatistics& stats) const override;
+
         /* ----- Debugging members ----- */
 
         RenderContext& instance;
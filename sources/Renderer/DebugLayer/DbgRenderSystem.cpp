@@ -9,6 +9,7 @@
 #include "DbgCore.h"
 #include "../../Core/Helper.h"
 #include "../CheckedCast.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -66,7 +67,13 @@ void DbgRenderSystem::Release(RenderContext& renderContext)
 
 CommandQueue* DbgRenderSystem::GetCommandQueue()
 {
-    return instance_->GetCommandQueue();
+    /* Wrap command queue of the instance, so that debug command buffers can be unwrapped on submission */
+    if (!commandQueue_)
+    {
+        if (auto commandQueueInstance = instance_->GetCommandQueue())
+            commandQueue_ = MakeUnique<DbgCommandQueue>(*commandQueueInstance);
+    }
+    return commandQueue_.get();
 }
 
 /* ----- Command buffers ----- */
@@ -179,6 +186,10 @@ void DbgRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t
     instance_->WriteBuffer(bufferDbg.instance, data, dataSize, offset);
 
     LLGL_DBG_PROFILER_DO(writeBuffer.Inc());
+    LLGL_DBG_PROFILER_DO(writeBufferBytes.Inc(static_cast<RenderingProfiler::Counter::ValueType>(dataSize)));
+
+    if (profiler_)
+        RecordStagingStatistics();
 }
 
 void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
@@ -216,6 +227,11 @@ void DbgRenderSystem::UnmapBuffer(Buffer& buffer)
     bufferDbg.mapped = false;
 }
 
+bool DbgRenderSystem::QueryStagingStatistics(StagingStatistics& statistics) const
+{
+    return instance_->QueryStagingStatistics(statistics);
+}
+
 /* ----- Textures ----- */
 
 Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
@@ -274,6 +290,40 @@ void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel
     instance_->ReadTexture(textureDbg.instance, mipLevel, imageDesc);
 }
 
+std::uint64_t DbgRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateMipLevelLimit(mipLevel, textureDbg.mipLevels);
+    }
+
+    const auto ticket = instance_->ReadTextureAsync(textureDbg.instance, mipLevel);
+
+    if (debugger_)
+        pendingTextureReads_[ticket] = textureDbg.desc.format;
+
+    return ticket;
+}
+
+bool DbgRenderSystem::QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateTextureReadResult(ticket, imageDesc);
+    }
+
+    const auto result = instance_->QueryTextureReadResult(ticket, imageDesc, wait);
+
+    if (result)
+        pendingTextureReads_.erase(ticket);
+
+    return result;
+}
+
 void DbgRenderSystem::GenerateMips(Texture& texture)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
@@ -321,10 +371,47 @@ void DbgRenderSystem::Release(Sampler& sampler)
 
 /* ----- Resource Views ----- */
 
+static std::vector<ResourceType> GetDynamicOffsetTypes(const PipelineLayoutDescriptor& desc)
+{
+    /* Gather all bindings with dynamic offsets in ascending order of their binding slots */
+    std::vector<const BindingDescriptor*> bindings;
+
+    for (const auto& binding : desc.bindings)
+    {
+        if ((binding.flags & BindingFlags::DynamicOffset) != 0)
+            bindings.push_back(&binding);
+    }
+
+    std::sort(
+        bindings.begin(), bindings.end(),
+        [](const BindingDescriptor* lhs, const BindingDescriptor* rhs)
+        {
+            return (lhs->slot < rhs->slot);
+        }
+    );
+
+    std::vector<ResourceType> types;
+    types.reserve(bindings.size());
+
+    for (auto binding : bindings)
+        types.push_back(binding->type);
+
+    return types;
+}
+
 ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
 {
+    std::vector<ResourceType> dynamicOffsetTypes;
+
     auto instanceDesc = desc;
     {
+        if (auto pipelineLayout = desc.pipelineLayout)
+        {
+            auto pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout*, pipelineLayout);
+            instanceDesc.pipelineLayout = &(pipelineLayoutDbg->instance);
+            dynamicOffsetTypes = GetDynamicOffsetTypes(pipelineLayoutDbg->desc);
+        }
+
         for (auto& resourceView : instanceDesc.resourceViews)
         {
             if (auto resource = resourceView.resource)
@@ -353,12 +440,15 @@ ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
                 LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer passed to ResourceViewDescriptor");
         }
     }
-    return instance_->CreateResourceHeap(instanceDesc);
+    return TakeOwnership(
+        resourceHeaps_,
+        MakeUnique<DbgResourceHeap>(*instance_->CreateResourceHeap(instanceDesc), std::move(dynamicOffsetTypes))
+    );
 }
 
 void DbgRenderSystem::Release(ResourceHeap& resourceViewHeap)
 {
-    return instance_->Release(resourceViewHeap);
+    ReleaseDbg(resourceHeaps_, resourceViewHeap);
 }
 
 /* ----- Render Targets ----- */
@@ -394,6 +484,16 @@ Shader* DbgRenderSystem::CreateShader(const ShaderDescriptor& desc)
     return TakeOwnership(shaders_, MakeUnique<DbgShader>(*instance_->CreateShader(desc), desc.type, debugger_));
 }
 
+static PipelineLayout* GetInstancePipelineLayout(PipelineLayout* pipelineLayout)
+{
+    if (pipelineLayout)
+    {
+        auto pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout*, pipelineLayout);
+        return &(pipelineLayoutDbg->instance);
+    }
+    return nullptr;
+}
+
 static Shader* GetInstanceShader(Shader* shader)
 {
     if (shader)
@@ -433,12 +533,30 @@ void DbgRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* DbgRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return instance_->CreatePipelineLayout(desc);
+    return TakeOwnership(pipelineLayouts_, MakeUnique<DbgPipelineLayout>(*instance_->CreatePipelineLayout(desc), desc));
 }
 
 void DbgRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    instance_->Release(pipelineLayout);
+    ReleaseDbg(pipelineLayouts_, pipelineLayout);
+}
+
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* DbgRenderSystem::CreatePipelineCache(const void* initialBlob, std::size_t initialBlobSize)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (initialBlob == nullptr && initialBlobSize > 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "illegal null pointer argument for 'initialBlob' parameter with non-zero size");
+    }
+    return instance_->CreatePipelineCache(initialBlob, initialBlobSize);
+}
+
+void DbgRenderSystem::Release(PipelineCache& pipelineCache)
+{
+    instance_->Release(pipelineCache);
 }
 
 /* ----- Pipeline States ----- */
@@ -455,7 +573,8 @@ GraphicsPipeline* DbgRenderSystem::CreateGraphicsPipeline(const GraphicsPipeline
         auto instanceDesc = desc;
         {
             auto shaderProgramDbg = LLGL_CAST(DbgShaderProgram*, desc.shaderProgram);
-            instanceDesc.shaderProgram = &(shaderProgramDbg->instance);
+            instanceDesc.shaderProgram  = &(shaderProgramDbg->instance);
+            instanceDesc.pipelineLayout = GetInstancePipelineLayout(desc.pipelineLayout);
 
             if (desc.renderTarget)
             {
@@ -478,7 +597,8 @@ ComputePipeline* DbgRenderSystem::CreateComputePipeline(const ComputePipelineDes
         auto instanceDesc = desc;
         {
             auto shaderProgramDbg = LLGL_CAST(DbgShaderProgram*, desc.shaderProgram);
-            instanceDesc.shaderProgram = &(shaderProgramDbg->instance);
+            instanceDesc.shaderProgram  = &(shaderProgramDbg->instance);
+            instanceDesc.pipelineLayout = GetInstancePipelineLayout(desc.pipelineLayout);
         }
         return instance_->CreateComputePipeline(instanceDesc);
     }
@@ -503,6 +623,11 @@ void DbgRenderSystem::Release(ComputePipeline& computePipeline)
 
 Query* DbgRenderSystem::CreateQuery(const QueryDescriptor& desc)
 {
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateQueryDesc(desc);
+    }
     return TakeOwnership(queries_, MakeUnique<DbgQuery>(*instance_->CreateQuery(desc), desc));
 }
 
@@ -612,7 +737,7 @@ void DbgRenderSystem::ValidateBufferCPUAccess(DbgBuffer& bufferDbg, const CPUAcc
         if ((bufferDbg.desc.flags & BufferFlags::MapReadAccess) == 0)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot map buffer with CPU read access (buffer was not created with 'LLGL::BufferFlags::MapReadAccess' flag)");
     }
-    if (access == CPUAccess::WriteOnly || access == CPUAccess::ReadWrite)
+    if (access == CPUAccess::WriteOnly || access == CPUAccess::ReadWrite || access == CPUAccess::WriteDiscard)
     {
         if ((bufferDbg.desc.flags & BufferFlags::MapWriteAccess) == 0)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot map buffer with CPU write access (buffer was not created with 'LLGL::BufferFlags::MapWriteAccess' flag)");
@@ -907,6 +1032,29 @@ void DbgRenderSystem::ValidateTextureArrayRangeWithEnd(std::uint32_t baseArrayLa
     }
 }
 
+void DbgRenderSystem::ValidateTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc)
+{
+    auto it = pendingTextureReads_.find(ticket);
+    if (it == pendingTextureReads_.end())
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid ticket for asynchronous texture read: " + std::to_string(ticket));
+        return;
+    }
+
+    if (!imageDesc.data)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "illegal null pointer argument for 'imageDesc.data' parameter");
+
+    /* Image data is read in the hardware format of the texture */
+    ImageFormat imageFormat = ImageFormat::RGBA;
+    DataType    dataType    = DataType::UInt8;
+
+    if (FindSuitableImageFormat(it->second, imageFormat, dataType))
+    {
+        if (imageDesc.format != imageFormat || imageDesc.dataType != dataType)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "image format and data type of asynchronous texture read must match the hardware format of the texture");
+    }
+}
+
 void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescriptor& desc)
 {
     if (desc.rasterizer.conservativeRasterization && !features_.hasConservativeRasterization)
@@ -934,6 +1082,17 @@ void DbgRenderSystem::ValidatePrimitiveTopology(const PrimitiveTopology primitiv
     }
 }
 
+void DbgRenderSystem::ValidateQueryDesc(const QueryDescriptor& desc)
+{
+    if (desc.type == QueryType::Timestamp)
+    {
+        if (!features_.hasTimestampQueries)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("timestamp queries");
+        if (desc.renderCondition)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "timestamp queries cannot be used as render condition");
+    }
+}
+
 void DbgRenderSystem::Assert3DTextures()
 {
     if (!features_.has3DTextures)
@@ -964,8 +1123,21 @@ void DbgRenderSystem::AssertMultiSampleTextures()
         LLGL_DBG_ERROR_NOT_SUPPORTED("multi-sample textures");
 }
 
+void DbgRenderSystem::RecordStagingStatistics()
+{
+    StagingStatistics stats;
+    if (instance_->QueryStagingStatistics(stats))
+    {
+        profiler_->stagingRingBufferBytes.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.ringBufferBytes - stagingStats_.ringBufferBytes));
+        profiler_->stagingRingBufferHighWaterMark.Max(static_cast<RenderingProfiler::Counter::ValueType>(stats.ringBufferHighWaterMark));
+        profiler_->stagingRingBufferStalls.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.ringBufferStalls - stagingStats_.ringBufferStalls));
+        profiler_->temporaryStagingBuffers.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.temporaryStagingBuffers - stagingStats_.temporaryStagingBuffers));
+        stagingStats_ = stats;
+    }
+}
+
 template <typename T, typename TBase>
-void DbgRenderSystem::ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry)
+void DbgRenderSystem::ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry)
 {
     auto& entryDbg = LLGL_CAST(T&, entry);
     instance_->Release(entryDbg.instance);
@@ -11,6 +11,7 @@
 
 #include <LLGL/RenderSystem.h>
 #include "DbgRenderContext.h"
+#include "DbgCommandQueue.h"
 #include "DbgCommandBuffer.h"
 
 #include "DbgBuffer.h"
@@ -21,8 +22,11 @@
 #include "DbgShader.h"
 #include "DbgShaderProgram.h"
 #include "DbgQuery.h"
+#include "DbgPipelineLayout.h"
+#include "DbgResourceHeap.h"
 
 #include "../ContainerTypes.h"
+#include <map>
 
 
 namespace LLGL
@@ -71,6 +75,8 @@ class DbgRenderSystem : public RenderSystem
         void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        bool QueryStagingStatistics(StagingStatistics& statistics) const override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
@@ -80,6 +86,9 @@ class DbgRenderSystem : public RenderSystem
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        bool QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait = false) override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
 
@@ -116,6 +125,12 @@ class DbgRenderSystem : public RenderSystem
 
         void Release(PipelineLayout& pipelineLayout) override;
 
+        /* ----- Pipeline Caches ----- */
+
+        PipelineCache* CreatePipelineCache(const void* initialBlob = nullptr, std::size_t initialBlobSize = 0) override;
+
+        void Release(PipelineCache& pipelineCache) override;
+
         /* ----- Pipeline States ----- */
 
         GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
@@ -160,18 +175,23 @@ class DbgRenderSystem : public RenderSystem
         void ValidateTextureMipRange(const DbgTexture& textureDbg, std::uint32_t baseMipLevel, std::uint32_t numMipLevels);
         void ValidateTextureArrayRange(const DbgTexture& textureDbg, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers);
         void ValidateTextureArrayRangeWithEnd(std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers, std::uint32_t arrayLayerLimit);
+        void ValidateTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc);
 
         void ValidateGraphicsPipelineDesc(const GraphicsPipelineDescriptor& desc);
         void ValidatePrimitiveTopology(const PrimitiveTopology primitiveTopology);
 
+        void ValidateQueryDesc(const QueryDescriptor& desc);
+
         void Assert3DTextures();
         void AssertCubeTextures();
         void AssertArrayTextures();
         void AssertCubeArrayTextures();
         void AssertMultiSampleTextures();
 
+        void RecordStagingStatistics();
+
         template <typename T, typename TBase>
-        void ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry);
+        void ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry);
 
         /* ----- Common objects ----- */
 
@@ -187,6 +207,7 @@ class DbgRenderSystem : public RenderSystem
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<DbgRenderContext>     renderContexts_;
+        HWObjectInstance<DbgCommandQueue>       commandQueue_;
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
@@ -198,6 +219,11 @@ class DbgRenderSystem : public RenderSystem
         //HWObjectContainer<DbgComputePipeline>   computePipelines_;
         //HWObjectContainer<DbgSampler>           samplers_;
         HWObjectContainer<DbgQuery>             queries_;
+        HWObjectContainer<DbgPipelineLayout>    pipelineLayouts_;
+        HWObjectContainer<DbgResourceHeap>      resourceHeaps_;
+
+        std::map<std::uint64_t, Format>         pendingTextureReads_;   // Texture format of each pending asynchronous read operation
+        StagingStatistics                       stagingStats_;          // Last queried staging statistics of the wrapped render system
 
 };
 
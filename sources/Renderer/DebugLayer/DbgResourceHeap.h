@@ -0,0 +1,47 @@
+/*
+ * DbgResourceHeap.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_DBG_RESOURCE_HEAP_H
+#define LLGL_DBG_RESOURCE_HEAP_H
+
+
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/ResourceFlags.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class DbgResourceHeap : public ResourceHeap
+{
+
+    public:
+
+        DbgResourceHeap(ResourceHeap& instance, std::vector<ResourceType>&& dynamicOffsetTypes) :
+            instance           { instance                      },
+            dynamicOffsetTypes { std::move(dynamicOffsetTypes) }
+        {
+        }
+
+        ResourceHeap&                   instance;
+
+        // Resource types of all bindings with the BindingFlags::DynamicOffset flag, in ascending order of their binding slots.
+        const std::vector<ResourceType> dynamicOffsetTypes;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -39,7 +39,7 @@ void D3D11Buffer::UpdateSubresource(ID3D11DeviceContext* context, const void* da
 
 static bool HasReadAccess(const CPUAccess access)
 {
-    return (access != CPUAccess::WriteOnly);
+    return (access == CPUAccess::ReadOnly || access == CPUAccess::ReadWrite);
 }
 
 static bool HasWriteAccess(const CPUAccess access)
@@ -47,6 +47,19 @@ static bool HasWriteAccess(const CPUAccess access)
     return (access != CPUAccess::ReadOnly);
 }
 
+// Returns the map type for the specified buffer, since staging buffers cannot be mapped with D3D11_MAP_WRITE_DISCARD.
+static D3D11_MAP GetMapForBuffer(ID3D11Buffer* buffer, const CPUAccess access)
+{
+    if (access == CPUAccess::WriteDiscard)
+    {
+        D3D11_BUFFER_DESC desc;
+        buffer->GetDesc(&desc);
+        if (desc.Usage == D3D11_USAGE_STAGING)
+            return D3D11_MAP_WRITE;
+    }
+    return D3D11Types::Map(access);
+}
+
 void* D3D11Buffer::Map(ID3D11DeviceContext* context, const CPUAccess access)
 {
     HRESULT hr = 0;
@@ -59,12 +72,12 @@ void* D3D11Buffer::Map(ID3D11DeviceContext* context, const CPUAccess access)
             context->CopyResource(cpuAccessBuffer_.Get(), GetNative());
 
         /* Map CPU-access buffer */
-        hr = context->Map(cpuAccessBuffer_.Get(), 0, D3D11Types::Map(access), 0, &mapppedSubresource);
+        hr = context->Map(cpuAccessBuffer_.Get(), 0, GetMapForBuffer(cpuAccessBuffer_.Get(), access), 0, &mapppedSubresource);
     }
     else
     {
         /* Map buffer */
-        hr = context->Map(GetNative(), 0, D3D11Types::Map(access), 0, &mapppedSubresource);
+        hr = context->Map(GetNative(), 0, GetMapForBuffer(GetNative(), access), 0, &mapppedSubresource);
     }
 
     return (SUCCEEDED(hr) ? mapppedSubresource.pData : nullptr);
@@ -116,14 +129,19 @@ void D3D11Buffer::CreateResource(ID3D11Device* device, const D3D11_BUFFER_DESC&
         subresourceData.pSysMem = initialData;
     }
 
+    /* Allow buffer to be used as source for indirect arguments */
+    auto bufferDesc = desc;
+    if ((bufferFlags & BufferFlags::IndirectArguments) != 0)
+        bufferDesc.MiscFlags |= D3D11_RESOURCE_MISC_DRAWINDIRECT_ARGS;
+
     /* Create new D3D11 hardware buffer */
-    auto hr = device->CreateBuffer(&desc, (initialData != nullptr ? &subresourceData : nullptr), buffer_.ReleaseAndGetAddressOf());
+    auto hr = device->CreateBuffer(&bufferDesc, (initialData != nullptr ? &subresourceData : nullptr), buffer_.ReleaseAndGetAddressOf());
     DXThrowIfFailed(hr, "failed to create D3D11 buffer");
 
     /* Create CPU access buffer (if required) */
     auto cpuAccessFlags = GetCPUAccessFlags(bufferFlags);
     if (cpuAccessFlags != 0)
-        CreateCPUAccessBuffer(device, desc, cpuAccessFlags);
+        CreateCPUAccessBuffer(device, bufferDesc, cpuAccessFlags);
 }
 
 static D3D11_USAGE GetUsageForCPUAccessFlags(UINT cpuAccessFlags)
@@ -26,7 +26,7 @@ D3D11ConstantBuffer::D3D11ConstantBuffer(ID3D11Device* device, const BufferDescr
         D3D11_BIND_CONSTANT_BUFFER
     };
 
-    if ((desc.flags & BufferFlags::DynamicUsage) != 0)
+    if ((desc.flags & (BufferFlags::DynamicUsage | BufferFlags::StreamingUsage)) != 0)
     {
         bufferDesc.Usage            = D3D11_USAGE_DYNAMIC;
         bufferDesc.CPUAccessFlags   = D3D11_CPU_ACCESS_WRITE;
@@ -12,6 +12,7 @@
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
 #include <algorithm>
+#include <stdexcept>
 
 #include "RenderState/D3D11StateManager.h"
 #include "RenderState/D3D11GraphicsPipelineBase.h"
@@ -161,6 +162,111 @@ void D3D11CommandBuffer::ClearAttachments(std::uint32_t numAttachments, const At
     }
 }
 
+/* ----- Copy ----- */
+
+void D3D11CommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+    dstBufferD3D.UpdateSubresource(context_.Get(), data, static_cast<UINT>(dataSize), static_cast<UINT>(dstOffset));
+}
+
+void D3D11CommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+    auto& srcBufferD3D = LLGL_CAST(D3D11Buffer&, srcBuffer);
+
+    D3D11_BOX srcBox;
+    {
+        srcBox.left     = static_cast<UINT>(srcOffset);
+        srcBox.top      = 0;
+        srcBox.front    = 0;
+        srcBox.right    = static_cast<UINT>(srcOffset + size);
+        srcBox.bottom   = 1;
+        srcBox.back     = 1;
+    }
+    context_->CopySubresourceRegion(
+        dstBufferD3D.GetNative(),
+        0,
+        static_cast<UINT>(dstOffset),
+        0,
+        0,
+        srcBufferD3D.GetNative(),
+        0,
+        &srcBox
+    );
+}
+
+void D3D11CommandBuffer::CopyBufferToTexture(Texture& /*dstTexture*/, const SubTextureDescriptor& /*dstRegion*/, Buffer& /*srcBuffer*/, std::uint64_t /*srcOffset*/)
+{
+    throw std::runtime_error("copying buffers to textures not supported by Direct3D 11 renderer");
+}
+
+/*
+Converts the texture region into the range of array layers and the offset and extent within each layer.
+Array layers are specified by the Y component for 1D-array textures and by the Z component for all other array textures.
+*/
+static void ConvertD3D11TextureRegion(
+    const TextureType   type,
+    const Offset3D&     offset,
+    const Extent3D&     extent,
+    UINT&               outFirstLayer,
+    UINT&               outNumLayers,
+    D3D11_BOX&          outBox)
+{
+    switch (type)
+    {
+        case TextureType::Texture1DArray:
+            outFirstLayer   = static_cast<UINT>(offset.y);
+            outNumLayers    = extent.height;
+            outBox          = { static_cast<UINT>(offset.x), 0, 0, static_cast<UINT>(offset.x) + extent.width, 1, 1 };
+            break;
+
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DMSArray:
+            outFirstLayer   = static_cast<UINT>(offset.z);
+            outNumLayers    = extent.depth;
+            outBox          = { static_cast<UINT>(offset.x), static_cast<UINT>(offset.y), 0,
+                                static_cast<UINT>(offset.x) + extent.width, static_cast<UINT>(offset.y) + extent.height, 1 };
+            break;
+
+        default:
+            outFirstLayer   = 0;
+            outNumLayers    = 1;
+            outBox          = { static_cast<UINT>(offset.x), static_cast<UINT>(offset.y), static_cast<UINT>(offset.z),
+                                static_cast<UINT>(offset.x) + extent.width, static_cast<UINT>(offset.y) + extent.height, static_cast<UINT>(offset.z) + extent.depth };
+            break;
+    }
+}
+
+void D3D11CommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    auto& dstTextureD3D = LLGL_CAST(D3D11Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D11Texture&, srcTexture);
+
+    UINT        dstFirstLayer = 0, srcFirstLayer = 0, numLayers = 0;
+    D3D11_BOX   dstBox, srcBox;
+
+    ConvertD3D11TextureRegion(dstTextureD3D.GetType(), dstRegion.offset, dstRegion.extent, dstFirstLayer, numLayers, dstBox);
+    ConvertD3D11TextureRegion(srcTextureD3D.GetType(), srcOffset, dstRegion.extent, srcFirstLayer, numLayers, srcBox);
+
+    /* Copy each array layer separately, since a subresource only refers to a single array layer */
+    for (UINT layer = 0; layer < numLayers; ++layer)
+    {
+        context_->CopySubresourceRegion(
+            dstTextureD3D.GetNative().resource.Get(),
+            D3D11CalcSubresource(dstRegion.mipLevel, dstFirstLayer + layer, dstTextureD3D.GetNumMipLevels()),
+            dstBox.left,
+            dstBox.top,
+            dstBox.front,
+            srcTextureD3D.GetNative().resource.Get(),
+            D3D11CalcSubresource(srcMipLevel, srcFirstLayer + layer, srcTextureD3D.GetNumMipLevels()),
+            &srcBox
+        );
+    }
+}
+
 /* ----- Input Assembly ------ */
 
 void D3D11CommandBuffer::SetVertexBuffer(Buffer& buffer)
@@ -361,6 +467,10 @@ void D3D11CommandBuffer::BeginQuery(Query& query)
         context_->Begin(queryD3D.GetQueryObject());
         context_->End(queryD3D.GetTimeStampQueryBegin());
     }
+    else if (queryD3D.GetQueryObjectType() == D3D11_QUERY_TIMESTAMP)
+    {
+        /* Timestamp queries are only written at the end (no reset required for D3D11) */
+    }
     else
     {
         /* Begin standard query */
@@ -378,6 +488,13 @@ void D3D11CommandBuffer::EndQuery(Query& query)
         context_->End(queryD3D.GetTimeStampQueryEnd());
         context_->End(queryD3D.GetQueryObject());
     }
+    else if (queryD3D.GetQueryObjectType() == D3D11_QUERY_TIMESTAMP)
+    {
+        /* Insert timestamp query within its own disjoint query to determine the timestamp frequency */
+        context_->Begin(queryD3D.GetDisjointQuery());
+        context_->End(queryD3D.GetQueryObject());
+        context_->End(queryD3D.GetDisjointQuery());
+    }
     else
     {
         /* End standard query */
@@ -435,6 +552,28 @@ bool D3D11CommandBuffer::QueryResult(Query& query, std::uint64_t& result)
         }
         break;
 
+        /* Query result from special case query type: Timestamp */
+        case D3D11_QUERY_TIMESTAMP:
+        {
+            UINT64 time = 0;
+            if (context_->GetData(queryD3D.GetQueryObject(), &time, sizeof(time), 0) == S_OK)
+            {
+                D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
+                if (context_->GetData(queryD3D.GetDisjointQuery(), &disjointData, sizeof(disjointData), 0) == S_OK)
+                {
+                    /* Normalize timestamp to nanoseconds (a disjoint timestamp is invalid and yields zero) */
+                    static const double nanoseconds = 1000000000.0;
+
+                    if (disjointData.Disjoint == FALSE)
+                        result = static_cast<std::uint64_t>(static_cast<double>(time) * (nanoseconds / static_cast<double>(disjointData.Frequency)) + 0.5);
+                    else
+                        result = 0;
+                    return true;
+                }
+            }
+        }
+        break;
+
         /* Query result from data of type: BOOL */
         case D3D11_QUERY_OCCLUSION_PREDICATE:
         case D3D11_QUERY_SO_OVERFLOW_PREDICATE:
@@ -549,6 +688,44 @@ void D3D11CommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uin
     context_->DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
+void D3D11CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DrawInstancedIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
+}
+
+void D3D11CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    /* Emulate multi-draw-indirect with a sequence of single indirect draw commands */
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    for (; numCommands-- > 0; offset += stride)
+        context_->DrawInstancedIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
+}
+
+void D3D11CommandBuffer::DrawIndirectCount(Buffer& /*buffer*/, std::uint64_t /*offset*/, Buffer& /*countBuffer*/, std::uint64_t /*countOffset*/, std::uint32_t /*maxNumCommands*/, std::uint32_t /*stride*/)
+{
+    throw std::runtime_error("indirect draw commands with count buffer not supported by Direct3D 11 renderer");
+}
+
+void D3D11CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DrawIndexedInstancedIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
+}
+
+void D3D11CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    /* Emulate multi-draw-indirect with a sequence of single indirect draw commands */
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    for (; numCommands-- > 0; offset += stride)
+        context_->DrawIndexedInstancedIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
+}
+
+void D3D11CommandBuffer::DrawIndexedIndirectCount(Buffer& /*buffer*/, std::uint64_t /*offset*/, Buffer& /*countBuffer*/, std::uint64_t /*countOffset*/, std::uint32_t /*maxNumCommands*/, std::uint32_t /*stride*/)
+{
+    throw std::runtime_error("indirect draw commands with count buffer not supported by Direct3D 11 renderer");
+}
+
 /* ----- Compute ----- */
 
 void D3D11CommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
@@ -556,6 +733,12 @@ void D3D11CommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupS
     context_->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
 }
 
+void D3D11CommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DispatchIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
+}
+
 
 /*
  * ======= Private: =======
@@ -26,6 +26,7 @@
 #include "RenderState/D3D11Fence.h"
 #include "RenderState/D3D11ResourceHeap.h"
 #include "RenderState/D3D11PipelineLayout.h"
+#include "RenderState/D3D11PipelineCache.h"
 
 #include "Shader/D3D11Shader.h"
 #include "Shader/D3D11ShaderProgram.h"
@@ -129,6 +130,12 @@ class D3D11RenderSystem final : public RenderSystem
 
         void Release(PipelineLayout& pipelineLayout) override;
 
+        /* ----- Pipeline Caches ----- */
+
+        PipelineCache* CreatePipelineCache(const void* initialBlob = nullptr, std::size_t initialBlobSize = 0) override;
+
+        void Release(PipelineCache& pipelineCache) override;
+
         /* ----- Pipeline States ----- */
 
         GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
@@ -257,6 +264,7 @@ class D3D11RenderSystem final : public RenderSystem
         HWObjectContainer<D3D11Shader>                  shaders_;
         HWObjectContainer<D3D11ShaderProgram>           shaderPrograms_;
         HWObjectContainer<D3D11PipelineLayout>          pipelineLayouts_;
+        HWObjectContainer<D3D11PipelineCache>           pipelineCaches_;
         HWObjectContainer<D3D11GraphicsPipelineBase>    graphicsPipelines_;
         HWObjectContainer<D3D11ComputePipeline>         computePipelines_;
         HWObjectContainer<D3D11ResourceHeap>            resourceHeaps_;
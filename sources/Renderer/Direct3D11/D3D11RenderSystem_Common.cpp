@@ -222,6 +222,18 @@ void D3D11RenderSystem::Release(PipelineLayout& pipelineLayout)
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* D3D11RenderSystem::CreatePipelineCache(const void* initialBlob, std::size_t initialBlobSize)
+{
+    return TakeOwnership(pipelineCaches_, MakeUnique<D3D11PipelineCache>(initialBlob, initialBlobSize));
+}
+
+void D3D11RenderSystem::Release(PipelineCache& pipelineCache)
+{
+    RemoveFromUniqueSet(pipelineCaches_, &pipelineCache);
+}
+
 /* ----- Pipeline States ----- */
 
 GraphicsPipeline* D3D11RenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
@@ -443,6 +455,8 @@ void D3D11RenderSystem::QueryRenderingCaps()
         caps.limits.maxViewportSize[1]              = D3D11_VIEWPORT_BOUNDS_MAX;
         caps.limits.maxBufferSize                   = std::numeric_limits<UINT>::max();
         caps.limits.maxConstantBufferSize           = D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 16;
+        caps.limits.minConstantBufferOffsetAlignment = 256;
+        caps.limits.minStorageBufferOffsetAlignment  = 16;
     }
     SetRenderingCaps(caps);
 }
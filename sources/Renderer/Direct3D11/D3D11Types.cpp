@@ -233,6 +233,7 @@ D3D11_QUERY Map(const QueryDescriptor& queryDesc)
             case QueryType::StreamOutOverflow:                  break;
             case QueryType::StreamOutPrimitivesWritten:         return D3D11_QUERY_SO_STATISTICS;
             case QueryType::PipelineStatistics:                 return D3D11_QUERY_PIPELINE_STATISTICS;
+            case QueryType::Timestamp:                          return D3D11_QUERY_TIMESTAMP;
         }
     }
     DXTypes::MapFailed("QueryType", "D3D11_QUERY");
@@ -242,11 +243,10 @@ D3D11_MAP Map(const CPUAccess cpuAccess)
 {
     switch (cpuAccess)
     {
-        case CPUAccess::ReadOnly:   return D3D11_MAP_READ;
-        case CPUAccess::WriteOnly:  return D3D11_MAP_WRITE;
-        case CPUAccess::ReadWrite:  return D3D11_MAP_READ_WRITE;
-                                  /*return D3D11_MAP_WRITE_DISCARD;
-                                    return D3D11_MAP_WRITE_NO_OVERWRITE;*/
+        case CPUAccess::ReadOnly:       return D3D11_MAP_READ;
+        case CPUAccess::WriteOnly:      return D3D11_MAP_WRITE;
+        case CPUAccess::ReadWrite:      return D3D11_MAP_READ_WRITE;
+        case CPUAccess::WriteDiscard:   return D3D11_MAP_WRITE_DISCARD;
     }
     DXTypes::MapFailed("CPUAccess", "D3D11_MAP");
 }
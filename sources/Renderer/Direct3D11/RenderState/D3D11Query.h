@@ -64,6 +64,11 @@ class D3D11Query final : public Query
             return timeStampQueryEnd_.Get();
         }
 
+        inline ID3D11Query* GetDisjointQuery() const
+        {
+            return disjointQuery_.Get();
+        }
+
     private:
 
         D3D11_QUERY         queryObjectType_ = D3D11_QUERY_EVENT;
@@ -74,6 +79,9 @@ class D3D11Query final : public Query
         ComPtr<ID3D11Query> timeStampQueryBegin_;
         ComPtr<ID3D11Query> timeStampQueryEnd_;
 
+        // Disjoint query for the special query type: Timestamp (to determine the timestamp frequency)
+        ComPtr<ID3D11Query> disjointQuery_;
+
 };
 
 
@@ -58,6 +58,7 @@ void D3D12Buffer::UpdateStaticSubresource(
     UpdateSubresources<1>(commandList, resource_.Get(), uploadBuffer.Get(), 0, 0, 1, &subresourceData);
 
     commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(resource_.Get(), D3D12_RESOURCE_STATE_COPY_DEST, stateAfter));
+    usageState_ = stateAfter;
 }
 
 void D3D12Buffer::UpdateDynamicSubresource(const void* data, UINT64 bufferSize, UINT64 offset)
@@ -80,6 +81,7 @@ void D3D12Buffer::UpdateDynamicSubresource(const void* data, UINT64 bufferSize,
 void D3D12Buffer::CreateResource(ID3D12Device* device, UINT64 bufferSize, D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_STATES resourceState)
 {
     bufferSize_ = bufferSize;
+    usageState_ = resourceState;
 
     /* Create generic buffer resource */
     CD3DX12_HEAP_PROPERTIES heapProperties(heapType);
@@ -47,6 +47,12 @@ class D3D12Buffer : public Buffer
             return bufferSize_;
         }
 
+        //! Returns the resource state the buffer is in between commands (e.g. D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER).
+        inline D3D12_RESOURCE_STATES GetUsageState() const
+        {
+            return usageState_;
+        }
+
     protected:
 
         D3D12Buffer(const BufferType type);
@@ -58,6 +64,7 @@ class D3D12Buffer : public Buffer
 
         ComPtr<ID3D12Resource>  resource_;
         UINT64                  bufferSize_ = 0;
+        D3D12_RESOURCE_STATES   usageState_ = D3D12_RESOURCE_STATE_COMMON;
 
 };
 
@@ -12,6 +12,8 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include <algorithm>
+#include <stdexcept>
+#include <vector>
 #include "D3DX12/d3dx12.h"
 
 #include "Buffer/D3D12VertexBuffer.h"
@@ -175,6 +177,172 @@ void D3D12CommandBuffer::ClearAttachments(std::uint32_t numAttachments, const At
     //commandList_->ClearRenderTargetView(rtvDescHandle_, clearState_.color.Ptr(), 0, nullptr);
 }
 
+/* ----- Copy ----- */
+
+void D3D12CommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+
+    /* Inline buffer writes require the command list interface of Windows 10 Fall Creators Update */
+    ComPtr<ID3D12GraphicsCommandList2> commandList2;
+    if (FAILED(commandList_.As(&commandList2)))
+        throw std::runtime_error("inline buffer updates not supported by Direct3D 12 renderer (requires ID3D12GraphicsCommandList2)");
+
+    /* Write each 32-bit value of the data with its own parameter */
+    const auto numValues    = static_cast<UINT>(dataSize / 4);
+    const auto values       = reinterpret_cast<const UINT*>(data);
+    const auto gpuAddress   = dstBufferD3D.GetNative()->GetGPUVirtualAddress() + dstOffset;
+
+    std::vector<D3D12_WRITEBUFFERIMMEDIATE_PARAMETER> params(numValues);
+    for (UINT i = 0; i < numValues; ++i)
+    {
+        params[i].Dest  = gpuAddress + i * 4;
+        params[i].Value = values[i];
+    }
+
+    TransitionResource(dstBufferD3D.GetNative(), dstBufferD3D.GetUsageState(), D3D12_RESOURCE_STATE_COPY_DEST);
+    {
+        commandList2->WriteBufferImmediate(numValues, params.data(), nullptr);
+    }
+    TransitionResource(dstBufferD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_DEST, dstBufferD3D.GetUsageState());
+}
+
+void D3D12CommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+    auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, srcBuffer);
+
+    TransitionResource(dstBufferD3D.GetNative(), dstBufferD3D.GetUsageState(), D3D12_RESOURCE_STATE_COPY_DEST);
+    TransitionResource(srcBufferD3D.GetNative(), srcBufferD3D.GetUsageState(), D3D12_RESOURCE_STATE_COPY_SOURCE);
+    {
+        commandList_->CopyBufferRegion(dstBufferD3D.GetNative(), dstOffset, srcBufferD3D.GetNative(), srcOffset, size);
+    }
+    TransitionResource(srcBufferD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_SOURCE, srcBufferD3D.GetUsageState());
+    TransitionResource(dstBufferD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_DEST, dstBufferD3D.GetUsageState());
+}
+
+/*
+Converts the texture region into the range of array layers and the offset and extent within each layer.
+Array layers are specified by the Y component for 1D-array textures and by the Z component for all other array textures.
+*/
+static void ConvertD3D12TextureRegion(
+    const TextureType   type,
+    const Offset3D&     offset,
+    const Extent3D&     extent,
+    UINT&               outFirstLayer,
+    UINT&               outNumLayers,
+    D3D12_BOX&          outBox)
+{
+    switch (type)
+    {
+        case TextureType::Texture1DArray:
+            outFirstLayer   = static_cast<UINT>(offset.y);
+            outNumLayers    = extent.height;
+            outBox          = { static_cast<UINT>(offset.x), 0, 0, static_cast<UINT>(offset.x) + extent.width, 1, 1 };
+            break;
+
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DMSArray:
+            outFirstLayer   = static_cast<UINT>(offset.z);
+            outNumLayers    = extent.depth;
+            outBox          = { static_cast<UINT>(offset.x), static_cast<UINT>(offset.y), 0,
+                                static_cast<UINT>(offset.x) + extent.width, static_cast<UINT>(offset.y) + extent.height, 1 };
+            break;
+
+        default:
+            outFirstLayer   = 0;
+            outNumLayers    = 1;
+            outBox          = { static_cast<UINT>(offset.x), static_cast<UINT>(offset.y), static_cast<UINT>(offset.z),
+                                static_cast<UINT>(offset.x) + extent.width, static_cast<UINT>(offset.y) + extent.height, static_cast<UINT>(offset.z) + extent.depth };
+            break;
+    }
+}
+
+void D3D12CommandBuffer::CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset)
+{
+    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
+    auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, srcBuffer);
+
+    UINT        firstLayer = 0, numLayers = 0;
+    D3D12_BOX   dstBox;
+    ConvertD3D12TextureRegion(dstTextureD3D.GetType(), dstRegion.offset, dstRegion.extent, firstLayer, numLayers, dstBox);
+
+    /* Determine footprint of the tightly packed texels of each array layer within the source buffer */
+    D3D12_TEXTURE_COPY_LOCATION srcLocation;
+    {
+        srcLocation.pResource                           = srcBufferD3D.GetNative();
+        srcLocation.Type                                = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+        srcLocation.PlacedFootprint.Offset              = srcOffset;
+        srcLocation.PlacedFootprint.Footprint.Format    = dstTextureD3D.GetFormat();
+        srcLocation.PlacedFootprint.Footprint.Width     = dstBox.right - dstBox.left;
+        srcLocation.PlacedFootprint.Footprint.Height    = dstBox.bottom - dstBox.top;
+        srcLocation.PlacedFootprint.Footprint.Depth     = dstBox.back - dstBox.front;
+        srcLocation.PlacedFootprint.Footprint.RowPitch  = TextureBufferSize(D3D12Types::Unmap(dstTextureD3D.GetFormat()), srcLocation.PlacedFootprint.Footprint.Width);
+    }
+    const auto layerSize = static_cast<UINT64>(srcLocation.PlacedFootprint.Footprint.RowPitch) * srcLocation.PlacedFootprint.Footprint.Height * srcLocation.PlacedFootprint.Footprint.Depth;
+
+    D3D12_TEXTURE_COPY_LOCATION dstLocation;
+    {
+        dstLocation.pResource   = dstTextureD3D.GetNative();
+        dstLocation.Type        = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    }
+
+    TransitionResource(dstTextureD3D.GetNative(), dstTextureD3D.GetUsageState(), D3D12_RESOURCE_STATE_COPY_DEST);
+    TransitionResource(srcBufferD3D.GetNative(), srcBufferD3D.GetUsageState(), D3D12_RESOURCE_STATE_COPY_SOURCE);
+
+    for (UINT layer = 0; layer < numLayers; ++layer)
+    {
+        dstLocation.SubresourceIndex = D3D12CalcSubresource(
+            dstRegion.mipLevel, firstLayer + layer, 0, dstTextureD3D.GetNumMipLevels(), dstTextureD3D.GetNumArrayLayers()
+        );
+        commandList_->CopyTextureRegion(&dstLocation, dstBox.left, dstBox.top, dstBox.front, &srcLocation, nullptr);
+        srcLocation.PlacedFootprint.Offset += layerSize;
+    }
+
+    TransitionResource(srcBufferD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_SOURCE, srcBufferD3D.GetUsageState());
+    TransitionResource(dstTextureD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_DEST, dstTextureD3D.GetUsageState());
+}
+
+void D3D12CommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D12Texture&, srcTexture);
+
+    UINT        dstFirstLayer = 0, srcFirstLayer = 0, numLayers = 0;
+    D3D12_BOX   dstBox, srcBox;
+
+    ConvertD3D12TextureRegion(dstTextureD3D.GetType(), dstRegion.offset, dstRegion.extent, dstFirstLayer, numLayers, dstBox);
+    ConvertD3D12TextureRegion(srcTextureD3D.GetType(), srcOffset, dstRegion.extent, srcFirstLayer, numLayers, srcBox);
+
+    D3D12_TEXTURE_COPY_LOCATION dstLocation, srcLocation;
+    {
+        dstLocation.pResource   = dstTextureD3D.GetNative();
+        dstLocation.Type        = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        srcLocation.pResource   = srcTextureD3D.GetNative();
+        srcLocation.Type        = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    }
+
+    TransitionResource(dstTextureD3D.GetNative(), dstTextureD3D.GetUsageState(), D3D12_RESOURCE_STATE_COPY_DEST);
+    TransitionResource(srcTextureD3D.GetNative(), srcTextureD3D.GetUsageState(), D3D12_RESOURCE_STATE_COPY_SOURCE);
+
+    /* Copy each array layer separately, since a subresource only refers to a single array layer */
+    for (UINT layer = 0; layer < numLayers; ++layer)
+    {
+        dstLocation.SubresourceIndex = D3D12CalcSubresource(
+            dstRegion.mipLevel, dstFirstLayer + layer, 0, dstTextureD3D.GetNumMipLevels(), dstTextureD3D.GetNumArrayLayers()
+        );
+        srcLocation.SubresourceIndex = D3D12CalcSubresource(
+            srcMipLevel, srcFirstLayer + layer, 0, srcTextureD3D.GetNumMipLevels(), srcTextureD3D.GetNumArrayLayers()
+        );
+        commandList_->CopyTextureRegion(&dstLocation, dstBox.left, dstBox.top, dstBox.front, &srcLocation, &srcBox);
+    }
+
+    TransitionResource(srcTextureD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_SOURCE, srcTextureD3D.GetUsageState());
+    TransitionResource(dstTextureD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_DEST, dstTextureD3D.GetUsageState());
+}
+
 /* ----- Buffers ------ */
 
 void D3D12CommandBuffer::SetVertexBuffer(Buffer& buffer)
@@ -371,6 +539,36 @@ void D3D12CommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uin
     commandList_->DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
+void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, sizeof(D3D12_DRAW_ARGUMENTS), 1, buffer, offset);
+}
+
+void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, stride, numCommands, buffer, offset);
+}
+
+void D3D12CommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, stride, maxNumCommands, buffer, offset, &countBuffer, countOffset);
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, sizeof(D3D12_DRAW_INDEXED_ARGUMENTS), 1, buffer, offset);
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride, numCommands, buffer, offset);
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride, maxNumCommands, buffer, offset, &countBuffer, countOffset);
+}
+
 /* ----- Compute ----- */
 
 void D3D12CommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
@@ -378,6 +576,11 @@ void D3D12CommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupS
     commandList_->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
 }
 
+void D3D12CommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH, sizeof(D3D12_DISPATCH_ARGUMENTS), 1, buffer, offset);
+}
+
 /* ----- Extended functions ----- */
 
 void D3D12CommandBuffer::ResetCommandList(ID3D12CommandAllocator* commandAlloc, ID3D12PipelineState* pipelineState)
@@ -392,11 +595,23 @@ void D3D12CommandBuffer::ResetCommandList(ID3D12CommandAllocator* commandAlloc,
  * ======= Private: =======
  */
 
+void D3D12CommandBuffer::TransitionResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES stateBefore, D3D12_RESOURCE_STATES stateAfter)
+{
+    /* Skip transition if one state includes the other (e.g. GENERIC_READ of upload buffers includes COPY_SOURCE) */
+    const auto commonStates = (stateBefore & stateAfter);
+    if (commonStates != stateBefore && commonStates != stateAfter)
+    {
+        auto resourceBarrier = CD3DX12_RESOURCE_BARRIER::Transition(resource, stateBefore, stateAfter);
+        commandList_->ResourceBarrier(1, &resourceBarrier);
+    }
+}
+
 void D3D12CommandBuffer::CreateDevices(D3D12RenderSystem& renderSystem)
 {
     /* Create command allocator and graphics command list */
     commandAlloc_   = renderSystem.CreateDXCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
     commandList_    = renderSystem.CreateDXCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, commandAlloc_.Get());
+    device_         = renderSystem.GetDevice();
 }
 
 void D3D12CommandBuffer::SetBackBufferRTV(D3D12RenderContext& renderContextD3D)
@@ -451,6 +666,59 @@ void D3D12CommandBuffer::SetScissorRectsWithFramebufferExtent(UINT numScissorRec
 }
 
 
+ID3D12CommandSignature* D3D12CommandBuffer::GetCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE type, UINT stride)
+{
+    auto& signature = commandSignatures_[std::make_pair(type, stride)];
+
+    if (!signature)
+    {
+        /* Create command signature with a single argument, since neither root constants nor vertex buffer views are changed */
+        D3D12_INDIRECT_ARGUMENT_DESC argumentDesc;
+        {
+            argumentDesc.Type               = type;
+        }
+        D3D12_COMMAND_SIGNATURE_DESC signatureDesc;
+        {
+            signatureDesc.ByteStride        = stride;
+            signatureDesc.NumArgumentDescs  = 1;
+            signatureDesc.pArgumentDescs    = &argumentDesc;
+            signatureDesc.NodeMask          = 0;
+        }
+        auto hr = device_->CreateCommandSignature(&signatureDesc, nullptr, IID_PPV_ARGS(signature.ReleaseAndGetAddressOf()));
+        DXThrowIfFailed(hr, "failed to create D3D12 command signature for indirect commands");
+    }
+
+    return signature.Get();
+}
+
+void D3D12CommandBuffer::ExecuteIndirect(
+    D3D12_INDIRECT_ARGUMENT_TYPE    type,
+    UINT                            stride,
+    UINT                            maxNumCommands,
+    Buffer&                         buffer,
+    std::uint64_t                   offset,
+    Buffer*                         countBuffer,
+    std::uint64_t                   countOffset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+
+    ID3D12Resource* countResource = nullptr;
+    if (countBuffer)
+    {
+        auto countBufferD3D = LLGL_CAST(D3D12Buffer*, countBuffer);
+        countResource = countBufferD3D->GetNative();
+    }
+
+    commandList_->ExecuteIndirect(
+        GetCommandSignature(type, stride),
+        maxNumCommands,
+        bufferD3D.GetNative(),
+        offset,
+        countResource,
+        countOffset
+    );
+}
+
 } // /namespace LLGL
 
 
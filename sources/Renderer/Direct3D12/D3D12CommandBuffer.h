@@ -11,6 +11,8 @@
 
 #include <LLGL/CommandBuffer.h>
 #include <cstddef>
+#include <map>
+#include <utility>
 #include "../DXCommon/ComPtr.h"
 #include "../DXCommon/DXCore.h"
 
@@ -55,6 +57,13 @@ class D3D12CommandBuffer final : public CommandBuffer
         void Clear(long flags) override;
         void ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments) override;
 
+        /* ----- Copy ----- */
+
+        void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
+        void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset) override;
+        void CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset) override;
+
         /* ----- Input Assembly ------ */
 
         void SetVertexBuffer(Buffer& buffer) override;
@@ -110,9 +119,18 @@ class D3D12CommandBuffer final : public CommandBuffer
         void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset) override;
         void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance) override;
 
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, std::uint64_t offset) override;
 
         /* ----- Extended functions ----- */
 
@@ -134,9 +152,30 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         void SetScissorRectsWithFramebufferExtent(UINT numScissorRects);
 
+        // Records a transition barrier for the resource, unless one of the states already includes the other.
+        void TransitionResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES stateBefore, D3D12_RESOURCE_STATES stateAfter);
+
+        // Returns the command signature for indirect commands of the specified argument type and stride (created on demand).
+        ID3D12CommandSignature* GetCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE type, UINT stride);
+
+        // Executes indirect commands with the command signature of the specified argument type and stride.
+        void ExecuteIndirect(
+            D3D12_INDIRECT_ARGUMENT_TYPE    type,
+            UINT                            stride,
+            UINT                            maxNumCommands,
+            Buffer&                         buffer,
+            std::uint64_t                   offset,
+            Buffer*                         countBuffer = nullptr,
+            std::uint64_t                   countOffset = 0
+        );
+
         ComPtr<ID3D12CommandAllocator>      commandAlloc_;
         ComPtr<ID3D12GraphicsCommandList>   commandList_;
 
+        ID3D12Device*                       device_                 = nullptr;
+
+        std::map<std::pair<D3D12_INDIRECT_ARGUMENT_TYPE, UINT>, ComPtr<ID3D12CommandSignature>> commandSignatures_;
+
         D3D12_CPU_DESCRIPTOR_HANDLE         rtvDescHandle_          = {};
         D3D12_CPU_DESCRIPTOR_HANDLE         dsvDescHandle_          = {};
 
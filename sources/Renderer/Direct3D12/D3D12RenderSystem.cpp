@@ -374,6 +374,18 @@ void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* D3D12RenderSystem::CreatePipelineCache(const void* initialBlob, std::size_t initialBlobSize)
+{
+    return TakeOwnership(pipelineCaches_, MakeUnique<D3D12PipelineCache>(initialBlob, initialBlobSize));
+}
+
+void D3D12RenderSystem::Release(PipelineCache& pipelineCache)
+{
+    RemoveFromUniqueSet(pipelineCaches_, &pipelineCache);
+}
+
 /* ----- Pipeline States ----- */
 
 GraphicsPipeline* D3D12RenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
@@ -672,12 +684,16 @@ void D3D12RenderSystem::QueryRenderingCaps()
 
         /* Set extended attributes */
         caps.features.hasConservativeRasterization  = (GetFeatureLevel() >= D3D_FEATURE_LEVEL_12_0);
+        caps.features.hasIndirectCountDrawing       = true;
+        caps.features.hasTimestampQueries           = false; // Queries are not implemented for D3D12 yet
 
         caps.limits.maxNumViewports                 = D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
         caps.limits.maxViewportSize[0]              = D3D12_VIEWPORT_BOUNDS_MAX;
         caps.limits.maxViewportSize[1]              = D3D12_VIEWPORT_BOUNDS_MAX;
         caps.limits.maxBufferSize                   = std::numeric_limits<UINT64>::max();
         caps.limits.maxConstantBufferSize           = D3D12_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 16;
+        caps.limits.minConstantBufferOffsetAlignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT;
+        caps.limits.minStorageBufferOffsetAlignment  = D3D12_RAW_UAV_SRV_BYTE_ALIGNMENT;
     }
     SetRenderingCaps(caps);
 }
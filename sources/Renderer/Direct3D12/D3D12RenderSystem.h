@@ -23,6 +23,7 @@
 #include "RenderState/D3D12Fence.h"
 #include "RenderState/D3D12GraphicsPipeline.h"
 #include "RenderState/D3D12PipelineLayout.h"
+#include "RenderState/D3D12PipelineCache.h"
 #include "RenderState/D3D12ResourceHeap.h"
 
 #include "Shader/D3D12Shader.h"
@@ -123,6 +124,12 @@ class D3D12RenderSystem final : public RenderSystem
 
         void Release(PipelineLayout& pipelineLayout) override;
 
+        /* ----- Pipeline Caches ----- */
+
+        PipelineCache* CreatePipelineCache(const void* initialBlob = nullptr, std::size_t initialBlobSize = 0) override;
+
+        void Release(PipelineCache& pipelineCache) override;
+
         /* ----- Pipeline States ----- */
 
         GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
@@ -231,6 +238,7 @@ class D3D12RenderSystem final : public RenderSystem
         HWObjectContainer<D3D12Shader>              shaders_;
         HWObjectContainer<D3D12ShaderProgram>       shaderPrograms_;
         HWObjectContainer<D3D12PipelineLayout>      pipelineLayouts_;
+        HWObjectContainer<D3D12PipelineCache>       pipelineCaches_;
         HWObjectContainer<D3D12GraphicsPipeline>    graphicsPipelines_;
         HWObjectContainer<D3D12Sampler>             samplers_;
         HWObjectContainer<D3D12ResourceHeap>        resourceHeaps_;
@@ -0,0 +1,29 @@
+/*
+ * D3D12PipelineCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D12_PIPELINE_CACHE_H
+#define LLGL_D3D12_PIPELINE_CACHE_H
+
+
+#include "../../BasicPipelineCache.h"
+
+
+namespace LLGL
+{
+
+
+using D3D12PipelineCache = BasicPipelineCache;
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
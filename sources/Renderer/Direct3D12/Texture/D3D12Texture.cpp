@@ -232,6 +232,7 @@ void D3D12Texture::UpdateSubresource(
     );
 
     commandList->ResourceBarrier(1, &resourceBarrier);
+    usageState_ = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
 }
 
 void D3D12Texture::CreateResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle)
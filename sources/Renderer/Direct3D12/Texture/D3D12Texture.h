@@ -66,6 +66,12 @@ class D3D12Texture final : public Texture
             return numArrayLayers_;
         }
 
+        // Returns the resource state the texture is in between commands (e.g. D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE).
+        inline D3D12_RESOURCE_STATES GetUsageState() const
+        {
+            return usageState_;
+        }
+
     private:
 
         void CreateResource(ID3D12Device* device, const D3D12_RESOURCE_DESC& desc);
@@ -75,6 +81,7 @@ class D3D12Texture final : public Texture
         DXGI_FORMAT             format_         = DXGI_FORMAT_UNKNOWN;
         UINT                    numMipLevels_   = 0;
         UINT                    numArrayLayers_ = 0;
+        D3D12_RESOURCE_STATES   usageState_     = D3D12_RESOURCE_STATE_COPY_DEST;
 
 };
 
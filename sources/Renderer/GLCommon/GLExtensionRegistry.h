@@ -64,11 +64,18 @@ enum class GLExt
     ARB_texture_storage,
     ARB_texture_storage_multisample,
     ARB_buffer_storage,
+    ARB_copy_buffer,
+    ARB_copy_image,
+    ARB_map_buffer_range,
+    ARB_draw_indirect,
+    ARB_multi_draw_indirect,
+    ARB_indirect_parameters,
     ARB_direct_state_access,
     ARB_polygon_offset_clamp,
     ARB_texture_view,
     ARB_shader_image_load_store,
     ARB_framebuffer_no_attachments,
+    KHR_parallel_shader_compile,
 
     /* Extensions without procedures */
     ARB_texture_cube_map,
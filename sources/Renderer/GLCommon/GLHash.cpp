@@ -0,0 +1,36 @@
+/*
+ * GLHash.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLHash.h"
+
+
+namespace LLGL
+{
+
+
+std::uint64_t GLHashBytes(const void* data, std::size_t size, std::uint64_t hash)
+{
+    auto bytes = reinterpret_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+std::uint64_t GLHashString(const std::string& str, std::uint64_t hash)
+{
+    return GLHashBytes(str.c_str(), str.size() + 1, hash);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
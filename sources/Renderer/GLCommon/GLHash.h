@@ -0,0 +1,38 @@
+/*
+ * GLHash.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_HASH_H
+#define LLGL_GL_HASH_H
+
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Initial value for the 64-bit FNV-1a hash function.
+static const std::uint64_t g_glHashOffsetBasis = 0xcbf29ce484222325ull;
+
+// Accumulates the specified data into the 64-bit FNV-1a hash.
+std::uint64_t GLHashBytes(const void* data, std::size_t size, std::uint64_t hash = g_glHashOffsetBasis);
+
+// Accumulates the specified string (including its terminator) into the 64-bit FNV-1a hash.
+std::uint64_t GLHashString(const std::string& str, std::uint64_t hash = g_glHashOffsetBasis);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -329,6 +329,49 @@ void GLTexSubImageCubeArray(const SubTextureDescriptor& desc, const SrcImageDesc
 
 #endif
 
+void GLTexSubImage(const TextureType type, const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc)
+{
+    switch (type)
+    {
+        #ifdef LLGL_OPENGL
+        case TextureType::Texture1D:
+            GLTexSubImage1D(desc, imageDesc);
+            break;
+        #endif
+
+        case TextureType::Texture2D:
+            GLTexSubImage2D(desc, imageDesc);
+            break;
+
+        case TextureType::Texture3D:
+            GLTexSubImage3D(desc, imageDesc);
+            break;
+
+        case TextureType::TextureCube:
+            GLTexSubImageCube(desc, imageDesc);
+            break;
+
+        #ifdef LLGL_OPENGL
+        case TextureType::Texture1DArray:
+            GLTexSubImage1DArray(desc, imageDesc);
+            break;
+        #endif
+
+        case TextureType::Texture2DArray:
+            GLTexSubImage2DArray(desc, imageDesc);
+            break;
+
+        #ifdef LLGL_OPENGL
+        case TextureType::TextureCubeArray:
+            GLTexSubImageCubeArray(desc, imageDesc);
+            break;
+        #endif
+
+        default:
+            break;
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -36,6 +36,9 @@ void GLTexSubImage2DArray(const SubTextureDescriptor& desc, const SrcImageDescri
 
 #endif
 
+// Writes the sub-image into the currently bound texture of the specified type.
+void GLTexSubImage(const TextureType type, const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc);
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,378 @@
+/*
+ * HWObjectPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_HW_OBJECT_POOL_H
+#define LLGL_HW_OBJECT_POOL_H
+
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+
+namespace LLGL
+{
+
+
+// Generation-checked handle to an object of a hardware object pool.
+struct HWObjectHandle
+{
+    std::uint32_t index;
+    std::uint32_t generation;
+};
+
+/*
+Open addressing hash table (with linear probing) that maps object addresses to slot indices of a hardware object pool.
+Entries are removed with backward shift deletion, so the table never contains tombstones and lookups stay short.
+*/
+class HWObjectIndexTable
+{
+
+    public:
+
+        static const std::uint32_t invalidIndex = ~0u;
+
+        // Inserts the specified object address with its slot index. The address must not be inserted yet.
+        void Insert(const void* key, std::uint32_t index)
+        {
+            if ((size_ + 1) * 4 > entries_.size() * 3)
+                Rehash(entries_.empty() ? 64 : entries_.size() * 2);
+            InsertEntry(key, index);
+            ++size_;
+        }
+
+        // Returns the slot index of the specified object address, or 'invalidIndex' if the address is not in the table.
+        std::uint32_t Find(const void* key) const
+        {
+            if (!entries_.empty())
+            {
+                for (auto pos = Hash(key); entries_[pos].key != nullptr; pos = Next(pos))
+                {
+                    if (entries_[pos].key == key)
+                        return entries_[pos].index;
+                }
+            }
+            return invalidIndex;
+        }
+
+        // Removes the specified object address and returns its slot index, or 'invalidIndex' if the address is not in the table.
+        std::uint32_t Remove(const void* key)
+        {
+            if (entries_.empty())
+                return invalidIndex;
+
+            /* Find entry of the specified key */
+            auto pos = Hash(key);
+            while (entries_[pos].key != key)
+            {
+                if (entries_[pos].key == nullptr)
+                    return invalidIndex;
+                pos = Next(pos);
+            }
+
+            auto index = entries_[pos].index;
+
+            /* Shift following entries of the same cluster back into the gap, if they are not at their ideal position */
+            for (auto next = Next(pos); entries_[next].key != nullptr; next = Next(next))
+            {
+                auto ideal = Hash(entries_[next].key);
+                if (((next - ideal) & Mask()) >= ((next - pos) & Mask()))
+                {
+                    entries_[pos] = entries_[next];
+                    pos = next;
+                }
+            }
+
+            entries_[pos] = Entry{};
+            --size_;
+
+            return index;
+        }
+
+        void Clear()
+        {
+            entries_.clear();
+            size_ = 0;
+        }
+
+    private:
+
+        struct Entry
+        {
+            const void*     key     = nullptr;
+            std::uint32_t   index   = invalidIndex;
+        };
+
+    private:
+
+        std::size_t Mask() const
+        {
+            return (entries_.size() - 1);
+        }
+
+        std::size_t Next(std::size_t pos) const
+        {
+            return ((pos + 1) & Mask());
+        }
+
+        std::size_t Hash(const void* key) const
+        {
+            /* Fibonacci hashing of the address; the lower bits are always zero due to the alignment of the objects */
+            auto h = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(key)) * 0x9E3779B97F4A7C15ull;
+            return (static_cast<std::size_t>(h >> 32) & Mask());
+        }
+
+        void InsertEntry(const void* key, std::uint32_t index)
+        {
+            auto pos = Hash(key);
+            while (entries_[pos].key != nullptr)
+                pos = Next(pos);
+            entries_[pos].key   = key;
+            entries_[pos].index = index;
+        }
+
+        void Rehash(std::size_t capacity)
+        {
+            std::vector<Entry> prevEntries(capacity);
+            prevEntries.swap(entries_);
+            for (const auto& entry : prevEntries)
+            {
+                if (entry.key != nullptr)
+                    InsertEntry(entry.key, entry.index);
+            }
+        }
+
+    private:
+
+        std::vector<Entry>  entries_;   // Capacity is always a power of two
+        std::size_t         size_       = 0;
+
+};
+
+/*
+Pool of hardware objects of the same base type with generation-checked slots.
+Slots are stored contiguously and released slots are recycled via an intrusive free list,
+so that inserting and removing an object are O(1) operations (removal uses the index table to find the slot of an object).
+The generation of a slot is incremented each time its object is removed, so stale handles are detected.
+Objects are still allocated individually, because the backends insert sub classes of different sizes (e.g. GLBuffer and GLBufferWithVAO).
+The iteration and container interface mirrors std::set<std::unique_ptr<T>>, which was used before.
+*/
+template <typename T>
+class HWObjectPool
+{
+
+        struct Slot
+        {
+            std::unique_ptr<T>  object;
+            std::uint32_t       generation  = 0;
+            std::uint32_t       nextFree    = HWObjectIndexTable::invalidIndex;
+        };
+
+    public:
+
+        // Forward iterator over all occupied slots that dereferences to 'const std::unique_ptr<T>&'.
+        class const_iterator
+        {
+
+            public:
+
+                using iterator_category = std::forward_iterator_tag;
+                using value_type        = std::unique_ptr<T>;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = const std::unique_ptr<T>*;
+                using reference         = const std::unique_ptr<T>&;
+
+                const_iterator(const Slot* slot, const Slot* end) :
+                    slot_ { slot },
+                    end_  { end  }
+                {
+                    SkipFreeSlots();
+                }
+
+                reference operator * () const
+                {
+                    return slot_->object;
+                }
+
+                pointer operator -> () const
+                {
+                    return &(slot_->object);
+                }
+
+                const_iterator& operator ++ ()
+                {
+                    ++slot_;
+                    SkipFreeSlots();
+                    return *this;
+                }
+
+                const_iterator operator ++ (int)
+                {
+                    auto prev = *this;
+                    ++(*this);
+                    return prev;
+                }
+
+                bool operator == (const const_iterator& rhs) const
+                {
+                    return (slot_ == rhs.slot_);
+                }
+
+                bool operator != (const const_iterator& rhs) const
+                {
+                    return (slot_ != rhs.slot_);
+                }
+
+            private:
+
+                void SkipFreeSlots()
+                {
+                    while (slot_ != end_ && !slot_->object)
+                        ++slot_;
+                }
+
+                const Slot* slot_ = nullptr;
+                const Slot* end_  = nullptr;
+
+        };
+
+        using iterator = const_iterator;
+
+    public:
+
+        HWObjectPool() = default;
+
+        HWObjectPool(const HWObjectPool&) = delete;
+        HWObjectPool& operator = (const HWObjectPool&) = delete;
+
+        ~HWObjectPool()
+        {
+            clear();
+        }
+
+        // Takes the ownership of the specified object and returns its handle.
+        HWObjectHandle Insert(std::unique_ptr<T>&& object)
+        {
+            /* Reuse the most recently released slot, or append a new slot */
+            std::uint32_t index;
+            if (freeList_ != HWObjectIndexTable::invalidIndex)
+            {
+                index       = freeList_;
+                freeList_   = slots_[index].nextFree;
+            }
+            else
+            {
+                index = static_cast<std::uint32_t>(slots_.size());
+                slots_.emplace_back();
+            }
+
+            auto& slot = slots_[index];
+            indices_.Insert(object.get(), index);
+            slot.object = std::move(object);
+            ++size_;
+
+            return HWObjectHandle{ index, slot.generation };
+        }
+
+        // Destroys the specified object and returns true on success. Otherwise, the object is not owned by this pool.
+        bool Remove(const T* object)
+        {
+            if (!object)
+                return false;
+
+            auto index = indices_.Remove(object);
+            if (index == HWObjectIndexTable::invalidIndex)
+                return false;
+
+            auto& slot = slots_[index];
+            {
+                slot.generation++;
+                slot.nextFree = freeList_;
+            }
+            freeList_ = index;
+            --size_;
+
+            /* Destroy object last, in case its destructor accesses this pool */
+            std::unique_ptr<T> releasedObject = std::move(slot.object);
+
+            return true;
+        }
+
+        // Returns true if the specified object is owned by this pool.
+        bool Contains(const T* object) const
+        {
+            return (object != nullptr && indices_.Find(object) != HWObjectIndexTable::invalidIndex);
+        }
+
+        // Returns the handle of the specified object, or an invalid handle if the object is not owned by this pool.
+        HWObjectHandle GetHandle(const T* object) const
+        {
+            auto index = (object != nullptr ? indices_.Find(object) : HWObjectIndexTable::invalidIndex);
+            if (index != HWObjectIndexTable::invalidIndex)
+                return HWObjectHandle{ index, slots_[index].generation };
+            return HWObjectHandle{ HWObjectIndexTable::invalidIndex, 0 };
+        }
+
+        // Returns the object of the specified handle, or null if the handle is invalid or its object has already been removed.
+        T* Get(const HWObjectHandle& handle) const
+        {
+            if (handle.index < slots_.size() && slots_[handle.index].generation == handle.generation)
+                return slots_[handle.index].object.get();
+            return nullptr;
+        }
+
+        // Destroys all objects in reverse order of their slots.
+        void clear()
+        {
+            for (auto it = slots_.rbegin(); it != slots_.rend(); ++it)
+                it->object.reset();
+            slots_.clear();
+            indices_.Clear();
+            freeList_   = HWObjectIndexTable::invalidIndex;
+            size_       = 0;
+        }
+
+        bool empty() const
+        {
+            return (size_ == 0);
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator{ slots_.data(), slots_.data() + slots_.size() };
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator{ slots_.data() + slots_.size(), slots_.data() + slots_.size() };
+        }
+
+    private:
+
+        std::vector<Slot>   slots_;
+        HWObjectIndexTable  indices_;                                       // Maps object addresses to slot indices
+        std::uint32_t       freeList_   = HWObjectIndexTable::invalidIndex; // Index of the first free slot
+        std::size_t         size_       = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
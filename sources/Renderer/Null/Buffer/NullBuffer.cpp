@@ -0,0 +1,68 @@
+/*
+ * NullBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullBuffer.h"
+#include <stdexcept>
+#include <string>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+NullBuffer::NullBuffer(const BufferDescriptor& desc, const void* initialData) :
+    Buffer { desc.type                               },
+    data_  ( static_cast<std::size_t>(desc.size), 0 )
+{
+    if (initialData)
+        ::memcpy(data_.data(), initialData, data_.size());
+}
+
+void NullBuffer::Write(std::uint64_t offset, const void* data, std::uint64_t dataSize)
+{
+    ValidateRange(offset, dataSize);
+    ::memcpy(data_.data() + offset, data, static_cast<std::size_t>(dataSize));
+}
+
+void NullBuffer::Read(std::uint64_t offset, void* data, std::uint64_t dataSize) const
+{
+    ValidateRange(offset, dataSize);
+    ::memcpy(data, data_.data() + offset, static_cast<std::size_t>(dataSize));
+}
+
+void NullBuffer::CopyFrom(std::uint64_t dstOffset, const NullBuffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    ValidateRange(dstOffset, size);
+    srcBuffer.ValidateRange(srcOffset, size);
+
+    /* Source and destination may be the same buffer with overlapping ranges */
+    ::memmove(data_.data() + dstOffset, srcBuffer.data_.data() + srcOffset, static_cast<std::size_t>(size));
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullBuffer::ValidateRange(std::uint64_t offset, std::uint64_t size) const
+{
+    if (offset + size > GetSize())
+    {
+        throw std::out_of_range(
+            "buffer range [" + std::to_string(offset) + ", " + std::to_string(offset + size) +
+            ") exceeds buffer size of " + std::to_string(GetSize()) + " bytes"
+        );
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
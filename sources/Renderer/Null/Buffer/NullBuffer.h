@@ -0,0 +1,67 @@
+/*
+ * NullBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_BUFFER_H
+#define LLGL_NULL_BUFFER_H
+
+
+#include <LLGL/Buffer.h>
+#include <LLGL/BufferFlags.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Buffer that is backed by host memory.
+class NullBuffer final : public Buffer
+{
+
+    public:
+
+        NullBuffer(const BufferDescriptor& desc, const void* initialData = nullptr);
+
+        // Writes the specified data into this buffer at the specified offset (in bytes).
+        void Write(std::uint64_t offset, const void* data, std::uint64_t dataSize);
+
+        // Reads data from this buffer at the specified offset (in bytes).
+        void Read(std::uint64_t offset, void* data, std::uint64_t dataSize) const;
+
+        // Copies the specified range from the source buffer into this buffer.
+        void CopyFrom(std::uint64_t dstOffset, const NullBuffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
+
+        // Returns a pointer to the host memory of this buffer.
+        inline char* GetData()
+        {
+            return data_.data();
+        }
+
+        // Returns the size (in bytes) of this buffer.
+        inline std::uint64_t GetSize() const
+        {
+            return static_cast<std::uint64_t>(data_.size());
+        }
+
+    private:
+
+        void ValidateRange(std::uint64_t offset, std::uint64_t size) const;
+
+        std::vector<char> data_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
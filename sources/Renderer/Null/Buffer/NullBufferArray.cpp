@@ -0,0 +1,26 @@
+/*
+ * NullBufferArray.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullBufferArray.h"
+
+
+namespace LLGL
+{
+
+
+NullBufferArray::NullBufferArray(const BufferType type, std::uint32_t numBuffers, Buffer* const * bufferArray) :
+    BufferArray { type                                  },
+    buffers_    { bufferArray, bufferArray + numBuffers }
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,50 @@
+/*
+ * NullBufferArray.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_BUFFER_ARRAY_H
+#define LLGL_NULL_BUFFER_ARRAY_H
+
+
+#include <LLGL/BufferArray.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class Buffer;
+
+class NullBufferArray final : public BufferArray
+{
+
+    public:
+
+        NullBufferArray(const BufferType type, std::uint32_t numBuffers, Buffer* const * bufferArray);
+
+        // Returns the array of buffers.
+        inline const std::vector<Buffer*>& GetBuffers() const
+        {
+            return buffers_;
+        }
+
+    private:
+
+        std::vector<Buffer*> buffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,402 @@
+/*
+ * NullCommandBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullCommandBuffer.h"
+#include "NullCommandExecutor.h"
+#include "RenderState/NullQuery.h"
+#include "../CheckedCast.h"
+#include <LLGL/GraphicsPipelineFlags.h>
+#include <LLGL/QueryFlags.h>
+#include <LLGL/ColorRGBA.h>
+#include <limits>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+NullCommandBuffer::NullCommandBuffer(std::size_t initialBufferSize)
+{
+    buffer_.reserve(initialBufferSize);
+}
+
+/* ----- Configuration ----- */
+
+void NullCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
+{
+    if (stateDesc != nullptr && stateDescSize > 0)
+    {
+        WriteHeader(NullOpcode::SetGraphicsAPIDependentState, stateDescSize);
+        WriteBytes(stateDesc, stateDescSize);
+    }
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void NullCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    WriteCmd(NullOpcode::SetViewport, viewport);
+}
+
+void NullCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    WriteCmdArray(NullOpcode::SetViewports, numViewports, viewports);
+}
+
+void NullCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    WriteCmd(NullOpcode::SetScissor, scissor);
+}
+
+void NullCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    WriteCmdArray(NullOpcode::SetScissors, numScissors, scissors);
+}
+
+/* ----- Clear ----- */
+
+void NullCommandBuffer::SetClearColor(const ColorRGBAf& color)
+{
+    WriteCmd(NullOpcode::SetClearColor, color);
+}
+
+void NullCommandBuffer::SetClearDepth(float depth)
+{
+    WriteCmd(NullOpcode::SetClearDepth, depth);
+}
+
+void NullCommandBuffer::SetClearStencil(std::uint32_t stencil)
+{
+    WriteCmd(NullOpcode::SetClearStencil, stencil);
+}
+
+void NullCommandBuffer::Clear(long flags)
+{
+    WriteCmd(NullOpcode::Clear, flags);
+}
+
+void NullCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    WriteCmdArray(NullOpcode::ClearAttachments, numAttachments, attachments);
+}
+
+/* ----- Copy ----- */
+
+void NullCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    /* Store data inline after the command structure */
+    const NullCmdUpdateBuffer cmd{ &dstBuffer, dstOffset, dataSize };
+    WriteHeader(NullOpcode::UpdateBuffer, sizeof(cmd) + dataSize);
+    WriteBytes(&cmd, sizeof(cmd));
+    WriteBytes(data, dataSize);
+}
+
+void NullCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    WriteCmd(NullOpcode::CopyBuffer, NullCmdCopyBuffer{ &dstBuffer, dstOffset, &srcBuffer, srcOffset, size });
+}
+
+void NullCommandBuffer::CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset)
+{
+    WriteCmd(NullOpcode::CopyBufferToTexture, NullCmdCopyBufferToTexture{ &dstTexture, dstRegion, &srcBuffer, srcOffset });
+}
+
+void NullCommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    WriteCmd(NullOpcode::CopyTexture, NullCmdCopyTexture{ &dstTexture, dstRegion, &srcTexture, srcMipLevel, srcOffset });
+}
+
+/* ----- Input Assembly ------ */
+
+void NullCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    WriteCmd(NullOpcode::SetVertexBuffer, &buffer);
+}
+
+void NullCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    WriteCmd(NullOpcode::SetVertexBufferArray, &bufferArray);
+}
+
+void NullCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    WriteCmd(NullOpcode::SetIndexBuffer, &buffer);
+}
+
+/* ----- Constant Buffers ------ */
+
+void NullCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags)
+{
+    WriteCmd(NullOpcode::SetConstantBuffer, NullCmdSetResource{ &buffer, slot, stageFlags });
+}
+
+/* ----- Storage Buffers ------ */
+
+void NullCommandBuffer::SetStorageBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags)
+{
+    WriteCmd(NullOpcode::SetStorageBuffer, NullCmdSetResource{ &buffer, slot, stageFlags });
+}
+
+/* ----- Stream Output Buffers ------ */
+
+void NullCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+{
+    WriteCmd(NullOpcode::SetStreamOutputBuffer, &buffer);
+}
+
+void NullCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+{
+    WriteCmd(NullOpcode::SetStreamOutputBufferArray, &bufferArray);
+}
+
+void NullCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
+{
+    WriteCmd(NullOpcode::BeginStreamOutput, primitiveType);
+}
+
+void NullCommandBuffer::EndStreamOutput()
+{
+    WriteOpcode(NullOpcode::EndStreamOutput);
+}
+
+/* ----- Textures ----- */
+
+void NullCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long stageFlags)
+{
+    WriteCmd(NullOpcode::SetTexture, NullCmdSetResource{ &texture, slot, stageFlags });
+}
+
+/* ----- Sampler States ----- */
+
+void NullCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long stageFlags)
+{
+    WriteCmd(NullOpcode::SetSampler, NullCmdSetSampler{ &sampler, slot, stageFlags });
+}
+
+/* ----- Resource Heaps ----- */
+
+void NullCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    WriteCmd(NullOpcode::SetGraphicsResourceHeap, NullCmdSetResourceHeap{ &resourceHeap, firstSet });
+}
+
+void NullCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    WriteCmd(NullOpcode::SetComputeResourceHeap, NullCmdSetResourceHeap{ &resourceHeap, firstSet });
+}
+
+/* ----- Render Targets ----- */
+
+void NullCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+{
+    WriteCmd(NullOpcode::SetRenderTarget, &renderTarget);
+}
+
+void NullCommandBuffer::SetRenderTarget(RenderContext& renderContext)
+{
+    WriteCmd(NullOpcode::SetRenderTargetContext, &renderContext);
+}
+
+/* ----- Pipeline States ----- */
+
+void NullCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    WriteCmd(NullOpcode::SetGraphicsPipeline, &graphicsPipeline);
+}
+
+void NullCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+{
+    WriteCmd(NullOpcode::SetComputePipeline, &computePipeline);
+}
+
+/* ----- Queries ----- */
+
+void NullCommandBuffer::BeginQuery(Query& query)
+{
+    WriteCmd(NullOpcode::BeginQuery, &query);
+}
+
+void NullCommandBuffer::EndQuery(Query& query)
+{
+    WriteCmd(NullOpcode::EndQuery, &query);
+}
+
+bool NullCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
+{
+    auto& queryNull = LLGL_CAST(NullQuery&, query);
+    return queryNull.QueryResult(result);
+}
+
+bool NullCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result)
+{
+    /* No pipeline statistics are generated, so all counters keep their invalid default value */
+    std::uint64_t dummyResult = 0;
+    auto& queryNull = LLGL_CAST(NullQuery&, query);
+    if (queryNull.QueryResult(dummyResult))
+    {
+        result = QueryPipelineStatistics{};
+        return true;
+    }
+    return false;
+}
+
+void NullCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
+{
+    WriteCmd(NullOpcode::BeginRenderCondition, NullCmdBeginRenderCondition{ &query, mode });
+}
+
+void NullCommandBuffer::EndRenderCondition()
+{
+    WriteOpcode(NullOpcode::EndRenderCondition);
+}
+
+/* ----- Drawing ----- */
+
+void NullCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    WriteCmd(NullOpcode::Draw, NullCmdDraw{ numVertices, firstVertex, 1, 0 });
+}
+
+void NullCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    WriteCmd(NullOpcode::DrawIndexed, NullCmdDrawIndexed{ numIndices, 1, firstIndex, 0, 0 });
+}
+
+void NullCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    WriteCmd(NullOpcode::DrawIndexed, NullCmdDrawIndexed{ numIndices, 1, firstIndex, vertexOffset, 0 });
+}
+
+void NullCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    WriteCmd(NullOpcode::Draw, NullCmdDraw{ numVertices, firstVertex, numInstances, 0 });
+}
+
+void NullCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    WriteCmd(NullOpcode::Draw, NullCmdDraw{ numVertices, firstVertex, numInstances, firstInstance });
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    WriteCmd(NullOpcode::DrawIndexed, NullCmdDrawIndexed{ numIndices, numInstances, firstIndex, 0, 0 });
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    WriteCmd(NullOpcode::DrawIndexed, NullCmdDrawIndexed{ numIndices, numInstances, firstIndex, vertexOffset, 0 });
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    WriteCmd(NullOpcode::DrawIndexed, NullCmdDrawIndexed{ numIndices, numInstances, firstIndex, vertexOffset, firstInstance });
+}
+
+void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    WriteCmd(NullOpcode::DrawIndirect, NullCmdDrawIndirect{ &buffer, offset, nullptr, 0, 1, 0 });
+}
+
+void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    WriteCmd(NullOpcode::DrawIndirect, NullCmdDrawIndirect{ &buffer, offset, nullptr, 0, numCommands, stride });
+}
+
+void NullCommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    WriteCmd(NullOpcode::DrawIndirect, NullCmdDrawIndirect{ &buffer, offset, &countBuffer, countOffset, maxNumCommands, stride });
+}
+
+void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    WriteCmd(NullOpcode::DrawIndexedIndirect, NullCmdDrawIndirect{ &buffer, offset, nullptr, 0, 1, 0 });
+}
+
+void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    WriteCmd(NullOpcode::DrawIndexedIndirect, NullCmdDrawIndirect{ &buffer, offset, nullptr, 0, numCommands, stride });
+}
+
+void NullCommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    WriteCmd(NullOpcode::DrawIndexedIndirect, NullCmdDrawIndirect{ &buffer, offset, &countBuffer, countOffset, maxNumCommands, stride });
+}
+
+/* ----- Compute ----- */
+
+void NullCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
+{
+    WriteCmd(NullOpcode::Dispatch, NullCmdDispatch{ groupSizeX, groupSizeY, groupSizeZ });
+}
+
+void NullCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    WriteCmd(NullOpcode::DispatchIndirect, NullCmdDrawIndirect{ &buffer, offset, nullptr, 0, 1, 0 });
+}
+
+/* ----- Internal ----- */
+
+void NullCommandBuffer::Execute()
+{
+    ExecuteNullCommandStream(buffer_);
+    executed_ = true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullCommandBuffer::WriteHeader(const NullOpcode opcode, std::size_t payloadSize)
+{
+    if (payloadSize > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("command payload exceeds limit of Null command buffer");
+
+    /* Start a new recording if the previous one has already been executed */
+    if (executed_)
+    {
+        buffer_.clear();
+        executed_ = false;
+    }
+
+    const auto size = static_cast<std::uint32_t>(payloadSize);
+    buffer_.push_back(static_cast<std::uint8_t>(opcode));
+    WriteBytes(&size, sizeof(size));
+}
+
+void NullCommandBuffer::WriteBytes(const void* data, std::size_t size)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+    buffer_.insert(buffer_.end(), bytes, bytes + size);
+}
+
+void NullCommandBuffer::WriteOpcode(const NullOpcode opcode)
+{
+    WriteHeader(opcode, 0);
+}
+
+template <typename T>
+void NullCommandBuffer::WriteCmd(const NullOpcode opcode, const T& cmd)
+{
+    WriteHeader(opcode, sizeof(T));
+    WriteBytes(&cmd, sizeof(T));
+}
+
+template <typename T>
+void NullCommandBuffer::WriteCmdArray(const NullOpcode opcode, std::uint32_t count, const T* data)
+{
+    WriteHeader(opcode, sizeof(T) * count);
+    WriteBytes(data, sizeof(T) * count);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,109 @@
+/*
+ * NullCommandExecutor.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullCommandExecutor.h"
+#include "NullCommandOpcode.h"
+#include "Buffer/NullBuffer.h"
+#include "Texture/NullTexture.h"
+#include "RenderState/NullQuery.h"
+#include "../CheckedCast.h"
+#include "../CommandStream.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+static void ExecuteCopyBufferToTexture(const NullCmdCopyBufferToTexture& cmd)
+{
+    auto& dstTextureNull    = LLGL_CAST(NullTexture&, *cmd.dstTexture);
+    auto& srcBufferNull     = LLGL_CAST(NullBuffer&, *cmd.srcBuffer);
+
+    /* Source buffer must contain the tightly packed region in the memory layout of the texture format */
+    const auto dataSize = static_cast<std::uint64_t>(dstTextureNull.GetRegionSize(cmd.dstRegion.extent));
+    if (cmd.srcOffset + dataSize > srcBufferNull.GetSize())
+        throw std::out_of_range("source buffer range exceeds buffer size in CopyBufferToTexture command");
+
+    dstTextureNull.Write(cmd.dstRegion, srcBufferNull.GetData() + cmd.srcOffset, static_cast<std::size_t>(dataSize));
+}
+
+void ExecuteNullCommandStream(const std::vector<std::uint8_t>& stream)
+{
+    const auto begin    = stream.data();
+    const auto end      = begin + stream.size();
+
+    for (auto pc = begin; pc < end;)
+    {
+        /* Decode command header */
+        const auto opcode   = static_cast<NullOpcode>(*pc++);
+        const auto size     = ReadCmd<std::uint32_t>(pc);
+        const auto next     = pc + size;
+
+        switch (opcode)
+        {
+            case NullOpcode::UpdateBuffer:
+            {
+                auto cmd = ReadCmd<NullCmdUpdateBuffer>(pc);
+                auto& bufferNull = LLGL_CAST(NullBuffer&, *cmd.buffer);
+                bufferNull.Write(cmd.offset, pc, cmd.size);
+            }
+            break;
+
+            case NullOpcode::CopyBuffer:
+            {
+                auto cmd = ReadCmd<NullCmdCopyBuffer>(pc);
+                auto& dstBufferNull = LLGL_CAST(NullBuffer&, *cmd.dstBuffer);
+                auto& srcBufferNull = LLGL_CAST(NullBuffer&, *cmd.srcBuffer);
+                dstBufferNull.CopyFrom(cmd.dstOffset, srcBufferNull, cmd.srcOffset, cmd.size);
+            }
+            break;
+
+            case NullOpcode::CopyBufferToTexture:
+            {
+                ExecuteCopyBufferToTexture(ReadCmd<NullCmdCopyBufferToTexture>(pc));
+            }
+            break;
+
+            case NullOpcode::CopyTexture:
+            {
+                auto cmd = ReadCmd<NullCmdCopyTexture>(pc);
+                auto& dstTextureNull = LLGL_CAST(NullTexture&, *cmd.dstTexture);
+                auto& srcTextureNull = LLGL_CAST(NullTexture&, *cmd.srcTexture);
+                dstTextureNull.CopyFrom(cmd.dstRegion, srcTextureNull, cmd.srcMipLevel, cmd.srcOffset);
+            }
+            break;
+
+            case NullOpcode::BeginQuery:
+            {
+                auto& queryNull = LLGL_CAST(NullQuery&, *ReadCmd<Query*>(pc));
+                queryNull.Begin();
+            }
+            break;
+
+            case NullOpcode::EndQuery:
+            {
+                auto& queryNull = LLGL_CAST(NullQuery&, *ReadCmd<Query*>(pc));
+                queryNull.End();
+            }
+            break;
+
+            default:
+            break;
+        }
+
+        /* Skip remaining payload of the command */
+        pc = next;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,31 @@
+/*
+ * NullCommandExecutor.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_COMMAND_EXECUTOR_H
+#define LLGL_NULL_COMMAND_EXECUTOR_H
+
+
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Decodes the specified command stream of a Null command buffer and executes all commands that modify host memory or query results.
+void ExecuteNullCommandStream(const std::vector<std::uint8_t>& stream);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,179 @@
+/*
+ * NullCommandOpcode.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_COMMAND_OPCODE_H
+#define LLGL_NULL_COMMAND_OPCODE_H
+
+
+#include <LLGL/TextureFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class Buffer;
+class Texture;
+class Resource;
+class Sampler;
+class ResourceHeap;
+class Query;
+
+/*
+Opcodes of the command stream that is recorded by the Null command buffer.
+Each command is encoded as its opcode, followed by the size (in bytes) of its payload as std::uint32_t, and the payload itself without padding.
+Only the commands that modify host memory or query results are executed; all other commands are skipped by their payload size.
+*/
+enum class NullOpcode : std::uint8_t
+{
+    SetGraphicsAPIDependentState,   // std::uint8_t[]
+    SetViewport,                    // Viewport
+    SetViewports,                   // Viewport[]
+    SetScissor,                     // Scissor
+    SetScissors,                    // Scissor[]
+    SetClearColor,                  // ColorRGBAf
+    SetClearDepth,                  // float
+    SetClearStencil,                // std::uint32_t
+    Clear,                          // long
+    ClearAttachments,               // AttachmentClear[]
+    UpdateBuffer,                   // NullCmdUpdateBuffer, std::uint8_t[]
+    CopyBuffer,                     // NullCmdCopyBuffer
+    CopyBufferToTexture,            // NullCmdCopyBufferToTexture
+    CopyTexture,                    // NullCmdCopyTexture
+    SetVertexBuffer,                // Buffer*
+    SetVertexBufferArray,           // BufferArray*
+    SetIndexBuffer,                 // Buffer*
+    SetConstantBuffer,              // NullCmdSetResource
+    SetStorageBuffer,               // NullCmdSetResource
+    SetStreamOutputBuffer,          // Buffer*
+    SetStreamOutputBufferArray,     // BufferArray*
+    BeginStreamOutput,              // PrimitiveType
+    EndStreamOutput,
+    SetTexture,                     // NullCmdSetResource
+    SetSampler,                     // NullCmdSetSampler
+    SetGraphicsResourceHeap,        // NullCmdSetResourceHeap
+    SetComputeResourceHeap,         // NullCmdSetResourceHeap
+    SetRenderTarget,                // RenderTarget*
+    SetRenderTargetContext,         // RenderContext*
+    SetGraphicsPipeline,            // GraphicsPipeline*
+    SetComputePipeline,             // ComputePipeline*
+    BeginQuery,                     // Query*
+    EndQuery,                       // Query*
+    BeginRenderCondition,           // NullCmdBeginRenderCondition
+    EndRenderCondition,
+    Draw,                           // NullCmdDraw
+    DrawIndexed,                    // NullCmdDrawIndexed
+    DrawIndirect,                   // NullCmdDrawIndirect
+    DrawIndexedIndirect,            // NullCmdDrawIndirect
+    Dispatch,                       // NullCmdDispatch
+    DispatchIndirect,               // NullCmdDrawIndirect
+};
+
+struct NullCmdUpdateBuffer
+{
+    Buffer*                 buffer;
+    std::uint64_t           offset;
+    std::uint16_t           size;
+};
+
+struct NullCmdCopyBuffer
+{
+    Buffer*                 dstBuffer;
+    std::uint64_t           dstOffset;
+    Buffer*                 srcBuffer;
+    std::uint64_t           srcOffset;
+    std::uint64_t           size;
+};
+
+struct NullCmdCopyBufferToTexture
+{
+    Texture*                dstTexture;
+    SubTextureDescriptor    dstRegion;
+    Buffer*                 srcBuffer;
+    std::uint64_t           srcOffset;
+};
+
+struct NullCmdCopyTexture
+{
+    Texture*                dstTexture;
+    SubTextureDescriptor    dstRegion;
+    Texture*                srcTexture;
+    std::uint32_t           srcMipLevel;
+    Offset3D                srcOffset;
+};
+
+struct NullCmdSetResource
+{
+    Resource*           resource;
+    std::uint32_t       slot;
+    long                stageFlags;
+};
+
+struct NullCmdSetSampler
+{
+    Sampler*            sampler;
+    std::uint32_t       slot;
+    long                stageFlags;
+};
+
+struct NullCmdSetResourceHeap
+{
+    ResourceHeap*       resourceHeap;
+    std::uint32_t       firstSet;
+};
+
+struct NullCmdBeginRenderCondition
+{
+    Query*              query;
+    RenderConditionMode mode;
+};
+
+struct NullCmdDraw
+{
+    std::uint32_t       numVertices;
+    std::uint32_t       firstVertex;
+    std::uint32_t       numInstances;
+    std::uint32_t       firstInstance;
+};
+
+struct NullCmdDrawIndexed
+{
+    std::uint32_t       numIndices;
+    std::uint32_t       numInstances;
+    std::uint32_t       firstIndex;
+    std::int32_t        vertexOffset;
+    std::uint32_t       firstInstance;
+};
+
+struct NullCmdDrawIndirect
+{
+    Buffer*             buffer;
+    std::uint64_t       offset;
+    Buffer*             countBuffer;
+    std::uint64_t       countOffset;
+    std::uint32_t       numCommands;
+    std::uint32_t       stride;
+};
+
+struct NullCmdDispatch
+{
+    std::uint32_t       groupSizeX;
+    std::uint32_t       groupSizeY;
+    std::uint32_t       groupSizeZ;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,51 @@
+/*
+ * NullCommandQueue.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullCommandQueue.h"
+#include "NullCommandBuffer.h"
+#include "RenderState/NullFence.h"
+#include "../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Command queues ----- */
+
+void NullCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferNull = LLGL_CAST(NullCommandBuffer&, commandBuffer);
+    commandBufferNull.Execute();
+}
+
+/* ----- Fences ----- */
+
+void NullCommandQueue::Submit(Fence& fence)
+{
+    /* All previously submitted commands have already been executed */
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    fenceNull.Signal();
+}
+
+bool NullCommandQueue::WaitFence(Fence& fence, std::uint64_t /*timeout*/)
+{
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    return fenceNull.IsSignaled();
+}
+
+void NullCommandQueue::WaitIdle()
+{
+    // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,40 @@
+/*
+ * NullModuleInterface.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "../ModuleInterface.h"
+#include "NullRenderSystem.h"
+
+
+extern "C"
+{
+
+LLGL_EXPORT int LLGL_RenderSystem_BuildID()
+{
+    return LLGL_BUILD_ID;
+}
+
+LLGL_EXPORT int LLGL_RenderSystem_RendererID()
+{
+    return LLGL::RendererID::Null;
+}
+
+LLGL_EXPORT const char* LLGL_RenderSystem_Name()
+{
+    return "Null";
+}
+
+LLGL_EXPORT void* LLGL_RenderSystem_Alloc(const void* renderSystemDesc)
+{
+    auto desc = reinterpret_cast<const LLGL::RenderSystemDescriptor*>(renderSystemDesc);
+    return new LLGL::NullRenderSystem(*desc);
+}
+
+} // /extern "C"
+
+
+
+// ================================================================================
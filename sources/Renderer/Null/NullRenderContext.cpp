@@ -0,0 +1,81 @@
+/*
+ * NullRenderContext.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderContext.h"
+
+
+namespace LLGL
+{
+
+
+static Format GetNullDepthStencilFormat(int depthBits, int stencilBits)
+{
+    if (stencilBits > 0)
+        return (depthBits > 24 ? Format::D32FloatS8X24UInt : Format::D24UNormS8UInt);
+    else if (depthBits > 24)
+        return Format::D32Float;
+    else if (depthBits > 16)
+        return Format::D24UNormS8UInt;
+    else if (depthBits > 0)
+        return Format::D16UNorm;
+    else
+        return Format::Undefined;
+}
+
+NullRenderContext::NullRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface, const HWObjectContainer<NullCommandBuffer>& commandBuffers) :
+    RenderContext   { desc.videoMode, desc.vsync },
+    commandBuffers_ ( commandBuffers             )
+{
+    depthStencilFormat_ = GetNullDepthStencilFormat(desc.videoMode.depthBits, desc.videoMode.stencilBits);
+
+    /* Only use a surface if one is specified; the Null renderer never creates a window on its own */
+    if (surface)
+        SetOrCreateSurface(surface, desc.videoMode, nullptr);
+}
+
+void NullRenderContext::Present()
+{
+    for (const auto& commandBuffer : commandBuffers_)
+    {
+        if (commandBuffer->HasPendingCommands())
+            commandBuffer->Execute();
+    }
+    ++numPresentedFrames_;
+}
+
+Format NullRenderContext::QueryColorFormat() const
+{
+    return Format::RGBA8UNorm;
+}
+
+Format NullRenderContext::QueryDepthStencilFormat() const
+{
+    return depthStencilFormat_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool NullRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
+{
+    depthStencilFormat_ = GetNullDepthStencilFormat(videoModeDesc.depthBits, videoModeDesc.stencilBits);
+    return true;
+}
+
+bool NullRenderContext::OnSetVsync(const VsyncDescriptor& /*vsyncDesc*/)
+{
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,64 @@
+/*
+ * NullRenderContext.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_CONTEXT_H
+#define LLGL_NULL_RENDER_CONTEXT_H
+
+
+#include <LLGL/RenderContext.h>
+#include "NullCommandBuffer.h"
+#include "../ContainerTypes.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Render context without a swap-chain. A surface is only used if one is specified, otherwise the render context is headless.
+Presenting the render context executes all command buffers with pending commands,
+so applications that never submit their command buffers (like with the immediate contexts of OpenGL and Direct3D 11) are supported as well.
+*/
+class NullRenderContext final : public RenderContext
+{
+
+    public:
+
+        NullRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface, const HWObjectContainer<NullCommandBuffer>& commandBuffers);
+
+        void Present() override;
+
+        Format QueryColorFormat() const override;
+        Format QueryDepthStencilFormat() const override;
+
+        // Returns the number of frames that have been presented.
+        inline std::uint64_t GetNumPresentedFrames() const
+        {
+            return numPresentedFrames_;
+        }
+
+    private:
+
+        bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
+        bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
+
+        const HWObjectContainer<NullCommandBuffer>& commandBuffers_;
+        Format                                      depthStencilFormat_ = Format::Undefined;
+        std::uint64_t                               numPresentedFrames_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
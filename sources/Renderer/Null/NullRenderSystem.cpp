@@ -0,0 +1,434 @@
+/*
+ * NullRenderSystem.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderSystem.h"
+#include "../CheckedCast.h"
+#include "../../Core/Helper.h"
+#include "../../Core/Assertion.h"
+#include <LLGL/ImageFlags.h>
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+/* ----- Common ----- */
+
+NullRenderSystem::NullRenderSystem(const RenderSystemDescriptor& /*renderSystemDesc*/) :
+    commandQueue_ { MakeUnique<NullCommandQueue>() }
+{
+    QueryRendererInfo();
+    QueryRenderingCaps();
+}
+
+/* ----- Render Context ----- */
+
+RenderContext* NullRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
+{
+    return TakeOwnership(renderContexts_, MakeUnique<NullRenderContext>(desc, surface, commandBuffers_));
+}
+
+void NullRenderSystem::Release(RenderContext& renderContext)
+{
+    RemoveFromUniqueSet(renderContexts_, &renderContext);
+}
+
+/* ----- Command queues ----- */
+
+CommandQueue* NullRenderSystem::GetCommandQueue()
+{
+    return commandQueue_.get();
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* NullRenderSystem::CreateCommandBuffer()
+{
+    return CreateCommandBufferExt();
+}
+
+CommandBufferExt* NullRenderSystem::CreateCommandBufferExt()
+{
+    return TakeOwnership(commandBuffers_, MakeUnique<NullCommandBuffer>());
+}
+
+void NullRenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* NullRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
+{
+    AssertCreateBuffer(desc, GetRenderingCaps().limits.maxBufferSize);
+    return TakeOwnership(buffers_, MakeUnique<NullBuffer>(desc, initialData));
+}
+
+BufferArray* NullRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    AssertCreateBufferArray(numBuffers, bufferArray);
+    auto refBufferType = bufferArray[0]->GetType();
+    return TakeOwnership(bufferArrays_, MakeUnique<NullBufferArray>(refBufferType, numBuffers, bufferArray));
+}
+
+void NullRenderSystem::Release(Buffer& buffer)
+{
+    RemoveFromUniqueSet(buffers_, &buffer);
+}
+
+void NullRenderSystem::Release(BufferArray& bufferArray)
+{
+    RemoveFromUniqueSet(bufferArrays_, &bufferArray);
+}
+
+void NullRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t dataSize, std::size_t offset)
+{
+    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    bufferNull.Write(offset, data, dataSize);
+}
+
+void* NullRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess /*access*/)
+{
+    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    return bufferNull.GetData();
+}
+
+void NullRenderSystem::UnmapBuffer(Buffer& /*buffer*/)
+{
+    // dummy
+}
+
+/* ----- Textures ----- */
+
+Texture* NullRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+{
+    auto texture = MakeUnique<NullTexture>(textureDesc);
+
+    /* Write initial image data into all array layers of the first MIP-map level */
+    if (imageDesc)
+    {
+        SubTextureDescriptor region;
+        {
+            region.mipLevel = 0;
+            region.extent   = texture->QueryMipExtent(0);
+        }
+        WriteTextureRegion(*texture, region, *imageDesc);
+    }
+
+    return TakeOwnership(textures_, std::move(texture));
+}
+
+void NullRenderSystem::Release(Texture& texture)
+{
+    RemoveFromUniqueSet(textures_, &texture);
+}
+
+void NullRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc)
+{
+    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+    WriteTextureRegion(textureNull, subTextureDesc, imageDesc);
+}
+
+// Returns the image format and data type that match the memory layout of the specified texture format, if it can be converted.
+static bool FindNullTextureImageFormat(const Format textureFormat, ImageFormat& imageFormat, DataType& dataType)
+{
+    if (IsCompressedFormat(textureFormat) || IsDepthStencilFormat(textureFormat))
+        return false;
+    if (!FindSuitableImageFormat(textureFormat, imageFormat, dataType))
+        return false;
+    return (ImageFormatSize(imageFormat) * DataTypeSize(dataType) * 8 == FormatBitSize(textureFormat));
+}
+
+void NullRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    LLGL_ASSERT_PTR(imageDesc.data);
+
+    auto& textureNull = LLGL_CAST(const NullTexture&, texture);
+
+    SubTextureDescriptor region;
+    {
+        region.mipLevel = mipLevel;
+        region.extent   = textureNull.QueryMipExtent(mipLevel);
+    }
+    const auto dataSize = textureNull.GetRegionSize(region.extent);
+
+    ImageFormat format;
+    DataType    dataType;
+
+    if (FindNullTextureImageFormat(textureNull.GetFormat(), format, dataType) &&
+        (imageDesc.format != format || imageDesc.dataType != dataType))
+    {
+        /* Read texture into intermediate buffer and convert it into the output image format */
+        std::vector<char> intermediate(dataSize);
+        textureNull.Read(region, intermediate.data(), dataSize);
+        ConvertImageBuffer(
+            SrcImageDescriptor{ format, dataType, intermediate.data(), dataSize },
+            imageDesc,
+            GetConfiguration().threadCount
+        );
+    }
+    else
+    {
+        AssertImageDataSize(imageDesc.dataSize, dataSize);
+        textureNull.Read(region, imageDesc.data, dataSize);
+    }
+}
+
+void NullRenderSystem::GenerateMips(Texture& /*texture*/)
+{
+    // dummy
+}
+
+void NullRenderSystem::GenerateMips(Texture& /*texture*/, std::uint32_t /*baseMipLevel*/, std::uint32_t /*numMipLevels*/, std::uint32_t /*baseArrayLayer*/, std::uint32_t /*numArrayLayers*/)
+{
+    // dummy
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* NullRenderSystem::CreateSampler(const SamplerDescriptor& desc)
+{
+    return TakeOwnership(samplers_, MakeUnique<NullSampler>(desc));
+}
+
+void NullRenderSystem::Release(Sampler& sampler)
+{
+    RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* NullRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    return TakeOwnership(resourceHeaps_, MakeUnique<NullResourceHeap>(desc));
+}
+
+void NullRenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* NullRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
+{
+    return TakeOwnership(renderTargets_, MakeUnique<NullRenderTarget>(desc));
+}
+
+void NullRenderSystem::Release(RenderTarget& renderTarget)
+{
+    RemoveFromUniqueSet(renderTargets_, &renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* NullRenderSystem::CreateShader(const ShaderDescriptor& desc)
+{
+    AssertCreateShader(desc);
+    return TakeOwnership(shaders_, MakeUnique<NullShader>(desc));
+}
+
+ShaderProgram* NullRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    AssertCreateShaderProgram(desc);
+    return TakeOwnership(shaderPrograms_, MakeUnique<NullShaderProgram>(desc));
+}
+
+void NullRenderSystem::Release(Shader& shader)
+{
+    RemoveFromUniqueSet(shaders_, &shader);
+}
+
+void NullRenderSystem::Release(ShaderProgram& shaderProgram)
+{
+    RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
+}
+
+/* ----- Pipeline Layouts ----- */
+
+PipelineLayout* NullRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
+{
+    return TakeOwnership(pipelineLayouts_, MakeUnique<NullPipelineLayout>(desc));
+}
+
+void NullRenderSystem::Release(PipelineLayout& pipelineLayout)
+{
+    RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+}
+
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* NullRenderSystem::CreatePipelineCache(const void* initialBlob, std::size_t initialBlobSize)
+{
+    return TakeOwnership(pipelineCaches_, MakeUnique<NullPipelineCache>(initialBlob, initialBlobSize));
+}
+
+void NullRenderSystem::Release(PipelineCache& pipelineCache)
+{
+    RemoveFromUniqueSet(pipelineCaches_, &pipelineCache);
+}
+
+/* ----- Pipeline States ----- */
+
+GraphicsPipeline* NullRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    return TakeOwnership(graphicsPipelines_, MakeUnique<NullGraphicsPipeline>(desc));
+}
+
+ComputePipeline* NullRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+{
+    return TakeOwnership(computePipelines_, MakeUnique<NullComputePipeline>(desc));
+}
+
+void NullRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
+{
+    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+}
+
+void NullRenderSystem::Release(ComputePipeline& computePipeline)
+{
+    RemoveFromUniqueSet(computePipelines_, &computePipeline);
+}
+
+/* ----- Queries ----- */
+
+Query* NullRenderSystem::CreateQuery(const QueryDescriptor& desc)
+{
+    return TakeOwnership(queries_, MakeUnique<NullQuery>(desc));
+}
+
+void NullRenderSystem::Release(Query& query)
+{
+    RemoveFromUniqueSet(queries_, &query);
+}
+
+/* ----- Fences ----- */
+
+Fence* NullRenderSystem::CreateFence()
+{
+    return TakeOwnership(fences_, MakeUnique<NullFence>());
+}
+
+void NullRenderSystem::Release(Fence& fence)
+{
+    RemoveFromUniqueSet(fences_, &fence);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullRenderSystem::QueryRendererInfo()
+{
+    RendererInfo info;
+    {
+        info.rendererName           = "Null";
+        info.deviceName             = "Host Memory";
+        info.vendorName             = "LLGL";
+        info.shadingLanguageName    = "None";
+    }
+    SetRendererInfo(info);
+}
+
+void NullRenderSystem::QueryRenderingCaps()
+{
+    /* The Null renderer supports all features, so every code path of an application can be exercised */
+    RenderingCapabilities caps;
+    {
+        caps.screenOrigin                               = ScreenOrigin::UpperLeft;
+        caps.clippingRange                              = ClippingRange::ZeroToOne;
+        caps.shadingLanguages                           = { ShadingLanguage::GLSL, ShadingLanguage::GLSL_450, ShadingLanguage::HLSL, ShadingLanguage::HLSL_5_0, ShadingLanguage::SPIRV, ShadingLanguage::SPIRV_100 };
+
+        for (auto format = static_cast<int>(Format::R8UNorm); format <= static_cast<int>(Format::BC3RGBA); ++format)
+            caps.textureFormats.push_back(static_cast<Format>(format));
+
+        /* Features */
+        caps.features.hasCommandBufferExt               = true;
+        caps.features.hasRenderTargets                  = true;
+        caps.features.has3DTextures                     = true;
+        caps.features.hasCubeTextures                   = true;
+        caps.features.hasArrayTextures                  = true;
+        caps.features.hasCubeArrayTextures              = true;
+        caps.features.hasMultiSampleTextures            = true;
+        caps.features.hasSamplers                       = true;
+        caps.features.hasConstantBuffers                = true;
+        caps.features.hasStorageBuffers                 = true;
+        caps.features.hasUniforms                       = true;
+        caps.features.hasGeometryShaders                = true;
+        caps.features.hasTessellationShaders            = true;
+        caps.features.hasComputeShaders                 = true;
+        caps.features.hasInstancing                     = true;
+        caps.features.hasOffsetInstancing               = true;
+        caps.features.hasViewportArrays                 = true;
+        caps.features.hasConservativeRasterization      = true;
+        caps.features.hasStreamOutputs                  = true;
+        caps.features.hasLogicOp                        = true;
+        caps.features.hasIndirectDrawing                = true;
+        caps.features.hasIndirectCountDrawing           = true;
+        caps.features.hasTimestampQueries               = true;
+
+        /* Limits */
+        caps.limits.lineWidthRange[0]                   = 1.0f;
+        caps.limits.lineWidthRange[1]                   = 1.0f;
+        caps.limits.maxNumTextureArrayLayers            = 2048u;
+        caps.limits.maxNumRenderTargetAttachments       = 8u;
+        caps.limits.maxPatchVertices                    = 32u;
+        caps.limits.max1DTextureSize                    = 16384u;
+        caps.limits.max2DTextureSize                    = 16384u;
+        caps.limits.max3DTextureSize                    = 2048u;
+        caps.limits.maxCubeTextureSize                  = 16384u;
+        caps.limits.maxAnisotropy                       = 16u;
+        caps.limits.maxNumComputeShaderWorkGroups[0]    = 65535u;
+        caps.limits.maxNumComputeShaderWorkGroups[1]    = 65535u;
+        caps.limits.maxNumComputeShaderWorkGroups[2]    = 65535u;
+        caps.limits.maxComputeShaderWorkGroupSize[0]    = 1024u;
+        caps.limits.maxComputeShaderWorkGroupSize[1]    = 1024u;
+        caps.limits.maxComputeShaderWorkGroupSize[2]    = 64u;
+        caps.limits.maxNumViewports                     = 16u;
+        caps.limits.maxViewportSize[0]                  = 16384u;
+        caps.limits.maxViewportSize[1]                  = 16384u;
+        caps.limits.maxBufferSize                       = std::numeric_limits<std::uint64_t>::max();
+        caps.limits.maxConstantBufferSize               = 65536u;
+        caps.limits.minConstantBufferOffsetAlignment    = 256u;
+        caps.limits.minStorageBufferOffsetAlignment     = 16u;
+    }
+    SetRenderingCaps(caps);
+}
+
+void NullRenderSystem::WriteTextureRegion(NullTexture& textureNull, const SubTextureDescriptor& region, const SrcImageDescriptor& imageDesc)
+{
+    LLGL_ASSERT_PTR(imageDesc.data);
+
+    const auto dataSize = textureNull.GetRegionSize(region.extent);
+
+    ImageFormat format;
+    DataType    dataType;
+
+    if (FindNullTextureImageFormat(textureNull.GetFormat(), format, dataType) &&
+        (imageDesc.format != format || imageDesc.dataType != dataType))
+    {
+        /* Convert image data into the memory layout of the texture format */
+        auto image      = ConvertImageBuffer(imageDesc, format, dataType, GetConfiguration().threadCount);
+        auto numPixels  = imageDesc.dataSize / (ImageFormatSize(imageDesc.format) * DataTypeSize(imageDesc.dataType));
+        textureNull.Write(region, image.get(), numPixels * ImageFormatSize(format) * DataTypeSize(dataType));
+    }
+    else
+    {
+        AssertImageDataSize(imageDesc.dataSize, dataSize);
+        textureNull.Write(region, imageDesc.data, dataSize);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,27 @@
+/*
+ * NullComputePipeline.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullComputePipeline.h"
+#include "../../../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+NullComputePipeline::NullComputePipeline(const ComputePipelineDescriptor& desc) :
+    desc_ { desc }
+{
+    LLGL_ASSERT_PTR(desc.shaderProgram);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
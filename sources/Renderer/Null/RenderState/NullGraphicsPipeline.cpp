@@ -0,0 +1,27 @@
+/*
+ * NullGraphicsPipeline.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullGraphicsPipeline.h"
+#include "../../../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+NullGraphicsPipeline::NullGraphicsPipeline(const GraphicsPipelineDescriptor& desc) :
+    desc_ { desc }
+{
+    LLGL_ASSERT_PTR(desc.shaderProgram);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,29 @@
+/*
+ * NullPipelineCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_PIPELINE_CACHE_H
+#define LLGL_NULL_PIPELINE_CACHE_H
+
+
+#include "../../BasicPipelineCache.h"
+
+
+namespace LLGL
+{
+
+
+using NullPipelineCache = BasicPipelineCache;
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
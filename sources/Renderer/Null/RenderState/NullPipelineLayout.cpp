@@ -0,0 +1,25 @@
+/*
+ * NullPipelineLayout.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullPipelineLayout.h"
+
+
+namespace LLGL
+{
+
+
+NullPipelineLayout::NullPipelineLayout(const PipelineLayoutDescriptor& desc) :
+    bindings_ { desc.bindings }
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
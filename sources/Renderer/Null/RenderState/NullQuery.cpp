@@ -0,0 +1,59 @@
+/*
+ * NullQuery.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullQuery.h"
+
+
+namespace LLGL
+{
+
+
+NullQuery::NullQuery(const QueryDescriptor& desc) :
+    Query { desc.type }
+{
+}
+
+void NullQuery::Begin()
+{
+    available_ = false;
+    if (GetType() == QueryType::TimeElapsed)
+        beginTime_ = std::chrono::high_resolution_clock::now();
+}
+
+void NullQuery::End()
+{
+    if (GetType() == QueryType::TimeElapsed)
+    {
+        auto elapsed = std::chrono::high_resolution_clock::now() - beginTime_;
+        result_ = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+    else if (GetType() == QueryType::Timestamp)
+    {
+        auto time = std::chrono::high_resolution_clock::now().time_since_epoch();
+        result_ = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+    }
+    else
+        result_ = 0;
+    available_ = true;
+}
+
+bool NullQuery::QueryResult(std::uint64_t& result) const
+{
+    if (available_)
+    {
+        result = result_;
+        return true;
+    }
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,59 @@
+/*
+ * NullQuery.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_QUERY_H
+#define LLGL_NULL_QUERY_H
+
+
+#include <LLGL/Query.h>
+#include <LLGL/QueryFlags.h>
+#include <chrono>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Query whose result becomes available when the command buffer with its end-query command has been submitted.
+Time-elapsed queries measure the CPU time between the execution of the begin- and end-query commands,
+and timestamp queries yield the CPU time of the end-query command; all other queries yield zero.
+*/
+class NullQuery final : public Query
+{
+
+    public:
+
+        NullQuery(const QueryDescriptor& desc);
+
+        // Marks the result as unavailable and records the begin time.
+        void Begin();
+
+        // Stores the result and marks it as available.
+        void End();
+
+        // Returns true and the query result if it is available.
+        bool QueryResult(std::uint64_t& result) const;
+
+    private:
+
+        std::chrono::high_resolution_clock::time_point  beginTime_;
+        std::uint64_t                                   result_     = 0;
+        bool                                            available_  = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,27 @@
+/*
+ * NullResourceHeap.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullResourceHeap.h"
+#include "../../../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+NullResourceHeap::NullResourceHeap(const ResourceHeapDescriptor& desc) :
+    resourceViews_ { desc.resourceViews }
+{
+    LLGL_ASSERT_PTR(desc.pipelineLayout);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
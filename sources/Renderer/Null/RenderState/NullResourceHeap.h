@@ -0,0 +1,48 @@
+/*
+ * NullResourceHeap.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RESOURCE_HEAP_H
+#define LLGL_NULL_RESOURCE_HEAP_H
+
+
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/ResourceHeapFlags.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class NullResourceHeap final : public ResourceHeap
+{
+
+    public:
+
+        NullResourceHeap(const ResourceHeapDescriptor& desc);
+
+        // Returns the list of resource views.
+        inline const std::vector<ResourceViewDescriptor>& GetResourceViews() const
+        {
+            return resourceViews_;
+        }
+
+    private:
+
+        std::vector<ResourceViewDescriptor> resourceViews_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
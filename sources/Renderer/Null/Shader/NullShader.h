@@ -0,0 +1,44 @@
+/*
+ * NullShader.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_SHADER_H
+#define LLGL_NULL_SHADER_H
+
+
+#include <LLGL/Shader.h>
+#include <LLGL/ShaderFlags.h>
+
+
+namespace LLGL
+{
+
+
+// Shader without a native shader object; the source code or byte code is never compiled.
+class NullShader final : public Shader
+{
+
+    public:
+
+        NullShader(const ShaderDescriptor& desc);
+
+        bool HasErrors() const override;
+
+        std::string Disassemble(int flags = 0) override;
+
+        std::string QueryInfoLog() override;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
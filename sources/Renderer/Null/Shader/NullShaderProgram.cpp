@@ -0,0 +1,75 @@
+/*
+ * NullShaderProgram.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullShaderProgram.h"
+
+
+namespace LLGL
+{
+
+
+NullShaderProgram::NullShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    Shader* shaders[] =
+    {
+        desc.vertexShader,
+        desc.tessControlShader,
+        desc.tessEvaluationShader,
+        desc.geometryShader,
+        desc.fragmentShader,
+        desc.computeShader,
+    };
+
+    if (!ShaderProgram::ValidateShaderComposition(shaders, sizeof(shaders)/sizeof(shaders[0])))
+        linkError_ = LinkError::InvalidComposition;
+}
+
+bool NullShaderProgram::HasErrors() const
+{
+    return (linkError_ != LinkError::NoError);
+}
+
+std::string NullShaderProgram::QueryInfoLog()
+{
+    if (auto s = ShaderProgram::LinkErrorToString(linkError_))
+        return s;
+    else
+        return "";
+}
+
+ShaderReflectionDescriptor NullShaderProgram::QueryReflectionDesc() const
+{
+    /* There is no shader code to reflect */
+    return {};
+}
+
+void NullShaderProgram::BindConstantBuffer(const std::string& /*name*/, std::uint32_t /*bindingIndex*/)
+{
+    // dummy
+}
+
+void NullShaderProgram::BindStorageBuffer(const std::string& /*name*/, std::uint32_t /*bindingIndex*/)
+{
+    // dummy
+}
+
+ShaderUniform* NullShaderProgram::LockShaderUniform()
+{
+    return nullptr; // dummy
+}
+
+void NullShaderProgram::UnlockShaderUniform()
+{
+    // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
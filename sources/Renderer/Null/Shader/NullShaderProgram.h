@@ -0,0 +1,53 @@
+/*
+ * NullShaderProgram.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_SHADER_PROGRAM_H
+#define LLGL_NULL_SHADER_PROGRAM_H
+
+
+#include <LLGL/ShaderProgram.h>
+#include <LLGL/ShaderProgramFlags.h>
+
+
+namespace LLGL
+{
+
+
+class NullShaderProgram final : public ShaderProgram
+{
+
+    public:
+
+        NullShaderProgram(const ShaderProgramDescriptor& desc);
+
+        bool HasErrors() const override;
+
+        std::string QueryInfoLog() override;
+
+        ShaderReflectionDescriptor QueryReflectionDesc() const override;
+
+        void BindConstantBuffer(const std::string& name, std::uint32_t bindingIndex) override;
+        void BindStorageBuffer(const std::string& name, std::uint32_t bindingIndex) override;
+
+        ShaderUniform* LockShaderUniform() override;
+        void UnlockShaderUniform() override;
+
+    private:
+
+        LinkError linkError_ = LinkError::NoError;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,63 @@
+/*
+ * NullRenderTarget.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderTarget.h"
+
+
+namespace LLGL
+{
+
+
+NullRenderTarget::NullRenderTarget(const RenderTargetDescriptor& desc) :
+    RenderTarget { desc.resolution }
+{
+    for (const auto& attachment : desc.attachments)
+    {
+        /* Validate resolution of texture attachments */
+        if (auto texture = attachment.texture)
+            ValidateMipResolution(*texture, attachment.mipLevel);
+
+        switch (attachment.type)
+        {
+            case AttachmentType::Color:
+                ++numColorAttachments_;
+                break;
+            case AttachmentType::Depth:
+                hasDepthAttachment_ = true;
+                break;
+            case AttachmentType::DepthStencil:
+                hasDepthAttachment_ = true;
+                hasStencilAttachment_ = true;
+                break;
+            case AttachmentType::Stencil:
+                hasStencilAttachment_ = true;
+                break;
+        }
+    }
+}
+
+std::uint32_t NullRenderTarget::GetNumColorAttachments() const
+{
+    return numColorAttachments_;
+}
+
+bool NullRenderTarget::HasDepthAttachment() const
+{
+    return hasDepthAttachment_;
+}
+
+bool NullRenderTarget::HasStencilAttachment() const
+{
+    return hasStencilAttachment_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,48 @@
+/*
+ * NullRenderTarget.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_TARGET_H
+#define LLGL_NULL_RENDER_TARGET_H
+
+
+#include <LLGL/RenderTarget.h>
+#include <LLGL/RenderTargetFlags.h>
+
+
+namespace LLGL
+{
+
+
+class NullRenderTarget final : public RenderTarget
+{
+
+    public:
+
+        NullRenderTarget(const RenderTargetDescriptor& desc);
+
+        std::uint32_t GetNumColorAttachments() const override;
+
+        bool HasDepthAttachment() const override;
+        bool HasStencilAttachment() const override;
+
+    private:
+
+        std::uint32_t   numColorAttachments_    = 0;
+        bool            hasDepthAttachment_     = false;
+        bool            hasStencilAttachment_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
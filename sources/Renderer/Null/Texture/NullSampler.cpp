@@ -0,0 +1,25 @@
+/*
+ * NullSampler.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullSampler.h"
+
+
+namespace LLGL
+{
+
+
+NullSampler::NullSampler(const SamplerDescriptor& desc) :
+    desc_ { desc }
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
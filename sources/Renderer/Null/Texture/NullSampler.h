@@ -0,0 +1,47 @@
+/*
+ * NullSampler.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_SAMPLER_H
+#define LLGL_NULL_SAMPLER_H
+
+
+#include <LLGL/Sampler.h>
+#include <LLGL/SamplerFlags.h>
+
+
+namespace LLGL
+{
+
+
+class NullSampler final : public Sampler
+{
+
+    public:
+
+        NullSampler(const SamplerDescriptor& desc);
+
+        // Returns the descriptor this sampler was created with.
+        inline const SamplerDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+    private:
+
+        SamplerDescriptor desc_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
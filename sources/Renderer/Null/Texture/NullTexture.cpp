@@ -0,0 +1,213 @@
+/*
+ * NullTexture.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullTexture.h"
+#include <LLGL/Format.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+static std::uint32_t MipExtentComponent(std::uint32_t extent, std::uint32_t mipLevel)
+{
+    return std::max(1u, extent >> mipLevel);
+}
+
+static std::uint32_t DivideRoundUp(std::uint32_t x, std::uint32_t y)
+{
+    return (x + y - 1) / y;
+}
+
+static std::uint32_t GetNullTextureMipLevels(const TextureDescriptor& desc)
+{
+    if (IsMultiSampleTexture(desc.type))
+        return 1u;
+    else
+        return std::max(1u, NumMipLevels(desc));
+}
+
+NullTexture::NullTexture(const TextureDescriptor& desc) :
+    Texture { desc.type   },
+    desc_   { desc        },
+    format_ { desc.format }
+{
+    if (IsCompressedFormat(format_))
+    {
+        blockSize_      = 4;
+        bytesPerBlock_  = FormatBitSize(format_) * 16 / 8;
+    }
+    else
+        bytesPerBlock_  = FormatBitSize(format_) / 8;
+
+    if (bytesPerBlock_ == 0)
+        throw std::invalid_argument("cannot create Null texture with undefined format");
+
+    /* Allocate zero-initialized host memory for each MIP-map level */
+    mips_.resize(GetNullTextureMipLevels(desc));
+
+    for (std::uint32_t mipLevel = 0; mipLevel < GetNumMipLevels(); ++mipLevel)
+    {
+        const auto extent = GetBlockExtent(mipLevel);
+        mips_[mipLevel].resize(static_cast<std::size_t>(extent.width) * extent.height * extent.depth * bytesPerBlock_, 0);
+    }
+
+    desc_.flags     = 0;
+    desc_.mipLevels = GetNumMipLevels();
+}
+
+TextureDescriptor NullTexture::QueryDesc() const
+{
+    return desc_;
+}
+
+Extent3D NullTexture::QueryMipExtent(std::uint32_t mipLevel) const
+{
+    const auto& extent = desc_.extent;
+    switch (GetType())
+    {
+        case TextureType::Texture1D:
+            return { MipExtentComponent(extent.width, mipLevel), 1u, 1u };
+
+        case TextureType::Texture1DArray:
+            return { MipExtentComponent(extent.width, mipLevel), desc_.arrayLayers, 1u };
+
+        case TextureType::Texture2D:
+        case TextureType::Texture2DMS:
+            return { MipExtentComponent(extent.width, mipLevel), MipExtentComponent(extent.height, mipLevel), 1u };
+
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DMSArray:
+            return { MipExtentComponent(extent.width, mipLevel), MipExtentComponent(extent.height, mipLevel), desc_.arrayLayers };
+
+        case TextureType::Texture3D:
+            return { MipExtentComponent(extent.width, mipLevel), MipExtentComponent(extent.height, mipLevel), MipExtentComponent(extent.depth, mipLevel) };
+    }
+    return { 1u, 1u, 1u };
+}
+
+void NullTexture::Write(const SubTextureDescriptor& region, const void* data, std::size_t dataSize)
+{
+    if (dataSize < GetRegionSize(region.extent))
+        throw std::invalid_argument("image data size is too small to write Null texture region");
+
+    auto& mip = mips_[region.mipLevel];
+    auto src = reinterpret_cast<const char*>(data);
+
+    ForEachRow(
+        region,
+        [&mip, src](std::size_t mipOffset, std::size_t bufferOffset, std::size_t rowSize)
+        {
+            ::memcpy(&mip[mipOffset], src + bufferOffset, rowSize);
+        }
+    );
+}
+
+void NullTexture::Read(const SubTextureDescriptor& region, void* data, std::size_t dataSize) const
+{
+    if (dataSize < GetRegionSize(region.extent))
+        throw std::invalid_argument("image data size is too small to read Null texture region");
+
+    const auto& mip = mips_[region.mipLevel];
+    auto dst = reinterpret_cast<char*>(data);
+
+    ForEachRow(
+        region,
+        [&mip, dst](std::size_t mipOffset, std::size_t bufferOffset, std::size_t rowSize)
+        {
+            ::memcpy(dst + bufferOffset, &mip[mipOffset], rowSize);
+        }
+    );
+}
+
+void NullTexture::CopyFrom(const SubTextureDescriptor& dstRegion, const NullTexture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    if (srcTexture.bytesPerBlock_ != bytesPerBlock_ || srcTexture.blockSize_ != blockSize_)
+        throw std::invalid_argument("cannot copy Null textures with incompatible formats");
+
+    SubTextureDescriptor srcRegion;
+    {
+        srcRegion.mipLevel  = srcMipLevel;
+        srcRegion.offset    = srcOffset;
+        srcRegion.extent    = dstRegion.extent;
+    }
+
+    /* Copy through an intermediate buffer, since source and destination region may overlap */
+    std::vector<char> intermediate(GetRegionSize(dstRegion.extent));
+    srcTexture.Read(srcRegion, intermediate.data(), intermediate.size());
+    Write(dstRegion, intermediate.data(), intermediate.size());
+}
+
+std::size_t NullTexture::GetRegionSize(const Extent3D& extent) const
+{
+    return
+    (
+        static_cast<std::size_t>(DivideRoundUp(extent.width, blockSize_)) *
+        DivideRoundUp(extent.height, blockSize_) *
+        extent.depth *
+        bytesPerBlock_
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+Extent3D NullTexture::GetBlockExtent(std::uint32_t mipLevel) const
+{
+    auto extent = QueryMipExtent(mipLevel);
+    return { DivideRoundUp(extent.width, blockSize_), DivideRoundUp(extent.height, blockSize_), extent.depth };
+}
+
+template <typename TFunc>
+void NullTexture::ForEachRow(const SubTextureDescriptor& region, TFunc func) const
+{
+    if (region.mipLevel >= GetNumMipLevels())
+        throw std::out_of_range("MIP-map level " + std::to_string(region.mipLevel) + " exceeds number of MIP-map levels of Null texture");
+
+    if (region.offset.x < 0 || region.offset.y < 0 || region.offset.z < 0)
+        throw std::out_of_range("negative offset for Null texture region");
+
+    /* Convert region into units of blocks */
+    const auto mipExtent    = GetBlockExtent(region.mipLevel);
+    const auto x            = static_cast<std::uint32_t>(region.offset.x) / blockSize_;
+    const auto y            = static_cast<std::uint32_t>(region.offset.y) / blockSize_;
+    const auto z            = static_cast<std::uint32_t>(region.offset.z);
+    const auto width        = DivideRoundUp(region.extent.width, blockSize_);
+    const auto height       = DivideRoundUp(region.extent.height, blockSize_);
+    const auto depth        = region.extent.depth;
+
+    if (x + width > mipExtent.width || y + height > mipExtent.height || z + depth > mipExtent.depth)
+        throw std::out_of_range("region exceeds extent of Null texture MIP-map level " + std::to_string(region.mipLevel));
+
+    const auto rowSize = static_cast<std::size_t>(width) * bytesPerBlock_;
+
+    std::size_t bufferOffset = 0;
+    for (std::uint32_t slice = 0; slice < depth; ++slice)
+    {
+        for (std::uint32_t row = 0; row < height; ++row)
+        {
+            const auto mipOffset = ((static_cast<std::size_t>(z + slice) * mipExtent.height + (y + row)) * mipExtent.width + x) * bytesPerBlock_;
+            func(mipOffset, bufferOffset, rowSize);
+            bufferOffset += rowSize;
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,91 @@
+/*
+ * NullTexture.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_TEXTURE_H
+#define LLGL_NULL_TEXTURE_H
+
+
+#include <LLGL/Texture.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Texture that is backed by host memory.
+Each MIP-map level is stored as a tightly packed 3D box, where the array layers are folded into the height (1D-array textures)
+or depth extent (2D-array and cube textures) as described at Texture::QueryMipExtent.
+Compressed formats are stored in units of 4x4 blocks.
+*/
+class NullTexture final : public Texture
+{
+
+    public:
+
+        NullTexture(const TextureDescriptor& desc);
+
+        TextureDescriptor QueryDesc() const override;
+
+        Extent3D QueryMipExtent(std::uint32_t mipLevel) const override;
+
+        // Writes the tightly packed image data into the specified region. The data must have the memory layout of the texture format.
+        void Write(const SubTextureDescriptor& region, const void* data, std::size_t dataSize);
+
+        // Reads the specified region into the tightly packed output buffer.
+        void Read(const SubTextureDescriptor& region, void* data, std::size_t dataSize) const;
+
+        // Copies the region from the source texture into the specified destination region of this texture.
+        void CopyFrom(const SubTextureDescriptor& dstRegion, const NullTexture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset);
+
+        // Returns the size (in bytes) of a tightly packed region with the specified extent.
+        std::size_t GetRegionSize(const Extent3D& extent) const;
+
+        // Returns the hardware texture format.
+        inline Format GetFormat() const
+        {
+            return format_;
+        }
+
+        // Returns the number of MIP-map levels.
+        inline std::uint32_t GetNumMipLevels() const
+        {
+            return static_cast<std::uint32_t>(mips_.size());
+        }
+
+    private:
+
+        // Returns the extent of the specified MIP-map level in units of blocks.
+        Extent3D GetBlockExtent(std::uint32_t mipLevel) const;
+
+        /*
+        Calls the specified function for each row of the region with the byte offset of the row within the MIP-map level,
+        the byte offset within a tightly packed buffer of the region, and the size (in bytes) of a row.
+        */
+        template <typename TFunc>
+        void ForEachRow(const SubTextureDescriptor& region, TFunc func) const;
+
+        TextureDescriptor               desc_;
+        Format                          format_         = Format::Undefined;
+        std::uint32_t                   blockSize_      = 1;    // Width and height of a block (4 for compressed formats)
+        std::uint32_t                   bytesPerBlock_  = 0;
+        std::vector<std::vector<char>>  mips_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
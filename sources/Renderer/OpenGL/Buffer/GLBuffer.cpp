@@ -39,6 +39,11 @@ GLBuffer::~GLBuffer()
     GLStateManager::active->NotifyBufferRelease(id_, GLStateManager::GetBufferTarget(GetType()));
 }
 
+void GLBuffer::EnableStreaming(GLsizeiptr size)
+{
+    streamingSize_ = size;
+}
+
 
 } // /namespace LLGL
 
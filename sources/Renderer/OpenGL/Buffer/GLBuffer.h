@@ -31,9 +31,38 @@ class GLBuffer : public Buffer
             return id_;
         }
 
+        // Enables updates through the streaming ring buffer for this buffer with the specified size (see BufferFlags::StreamingUsage).
+        void EnableStreaming(GLsizeiptr size);
+
+        // Returns true if this buffer is updated through the streaming ring buffer.
+        inline bool IsStreaming() const
+        {
+            return (streamingSize_ > 0);
+        }
+
+        // Returns the size of this buffer if it is updated through the streaming ring buffer, otherwise 0.
+        inline GLsizeiptr GetStreamingSize() const
+        {
+            return streamingSize_;
+        }
+
+        // Sets the offset within the streaming ring buffer while this buffer is mapped, or -1 if it is not mapped via the ring buffer.
+        inline void SetStreamingMapOffset(GLintptr offset)
+        {
+            streamingMapOffset_ = offset;
+        }
+
+        // Returns the offset within the streaming ring buffer while this buffer is mapped, or -1 if it is not mapped via the ring buffer.
+        inline GLintptr GetStreamingMapOffset() const
+        {
+            return streamingMapOffset_;
+        }
+
     private:
 
-        GLuint id_ = 0;
+        GLuint      id_                 = 0;
+        GLsizeiptr  streamingSize_      = 0;
+        GLintptr    streamingMapOffset_ = -1;
 
 };
 
@@ -0,0 +1,172 @@
+/*
+ * GLStreamingRingBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLStreamingRingBuffer.h"
+#include "GLBuffer.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../../Core/Helper.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Alignment of each allocation within the ring buffer.
+static const GLsizeiptr g_streamingRingBufferAlignment = 16;
+
+// Timeout (in nanoseconds) for each attempt to wait for a region fence.
+static const GLuint64 g_streamingRingBufferWaitTimeout = 1000000000ull;
+
+GLStreamingRingBuffer::GLStreamingRingBuffer(GLsizeiptr size, GLuint numRegions) :
+    numRegions_ { std::max(1u, numRegions)                                      },
+    regionSize_ { (size / numRegions_) & ~(g_streamingRingBufferAlignment - 1)  },
+    fences_     ( numRegions_, nullptr                                          )
+{
+    if (regionSize_ == 0)
+        throw std::invalid_argument("size of GL streaming ring buffer is too small for " + std::to_string(numRegions_) + " regions");
+
+    #if defined GL_ARB_buffer_storage && defined GL_ARB_map_buffer_range
+    const GLsizeiptr    bufferSize  = regionSize_ * numRegions_;
+    const GLbitfield    flags       = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+    /* Allocate immutable storage and map the entire buffer persistently */
+    glGenBuffers(1, &id_);
+    GLStateManager::active->BindBuffer(GLBufferTarget::COPY_READ_BUFFER, id_);
+    glBufferStorage(GL_COPY_READ_BUFFER, bufferSize, nullptr, flags);
+    mappedData_ = reinterpret_cast<char*>(glMapBufferRange(GL_COPY_READ_BUFFER, 0, bufferSize, flags));
+    #endif
+
+    if (!mappedData_)
+        throw std::runtime_error("failed to map GL streaming ring buffer persistently");
+}
+
+GLStreamingRingBuffer::~GLStreamingRingBuffer()
+{
+    for (auto sync : fences_)
+    {
+        if (sync)
+            glDeleteSync(sync);
+    }
+
+    /* Deleting the buffer also unmaps it */
+    glDeleteBuffers(1, &id_);
+    GLStateManager::active->NotifyBufferRelease(id_, GLBufferTarget::COPY_READ_BUFFER);
+}
+
+bool GLStreamingRingBuffer::IsSupported()
+{
+    #if defined GL_ARB_buffer_storage && defined GL_ARB_map_buffer_range
+    return
+    (
+        HasExtension(GLExt::ARB_buffer_storage)     &&
+        HasExtension(GLExt::ARB_map_buffer_range)   &&
+        HasExtension(GLExt::ARB_copy_buffer)        &&
+        HasExtension(GLExt::ARB_sync)
+    );
+    #else
+    return false;
+    #endif
+}
+
+char* GLStreamingRingBuffer::Allocate(GLsizeiptr size, GLintptr& offset)
+{
+    if (size > regionSize_)
+        return nullptr;
+
+    /* Move on to the next region if the remaining memory of the current region is too small */
+    auto alignedOffset = GetAlignedSize(regionOffset_, g_streamingRingBufferAlignment);
+    if (alignedOffset + size > regionSize_)
+    {
+        NextRegion();
+        alignedOffset = 0;
+    }
+
+    offset          = static_cast<GLintptr>(currentRegion_) * regionSize_ + alignedOffset;
+    regionOffset_   = alignedOffset + size;
+
+    return (mappedData_ + offset);
+}
+
+void GLStreamingRingBuffer::CopyToBuffer(const GLBuffer& dstBuffer, GLintptr srcOffset, GLintptr dstOffset, GLsizeiptr size)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glCopyNamedBufferSubData(id_, dstBuffer.GetID(), srcOffset, dstOffset, size);
+    }
+    else
+    #endif
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::COPY_READ_BUFFER, id_);
+        GLStateManager::active->BindBuffer(GLBufferTarget::COPY_WRITE_BUFFER, dstBuffer.GetID());
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, dstOffset, size);
+    }
+}
+
+bool GLStreamingRingBuffer::WriteBuffer(const GLBuffer& dstBuffer, GLintptr dstOffset, const void* data, GLsizeiptr dataSize)
+{
+    GLintptr srcOffset = 0;
+    if (auto dst = Allocate(dataSize, srcOffset))
+    {
+        /* Memory is coherent, so no explicit flush is required before the copy command */
+        ::memcpy(dst, data, static_cast<std::size_t>(dataSize));
+        CopyToBuffer(dstBuffer, srcOffset, dstOffset, dataSize);
+        return true;
+    }
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLStreamingRingBuffer::NextRegion()
+{
+    /* Protect current region until all copy commands that read from it have been executed */
+    fences_[currentRegion_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    currentRegion_  = (currentRegion_ + 1) % numRegions_;
+    regionOffset_   = 0;
+
+    WaitForRegion(currentRegion_);
+}
+
+void GLStreamingRingBuffer::WaitForRegion(GLuint region)
+{
+    auto& sync = fences_[region];
+    if (sync)
+    {
+        /* Poll fence first, which is usually already signaled when enough regions are used */
+        auto result = glClientWaitSync(sync, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            ++numStalls_;
+            do
+            {
+                result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, g_streamingRingBufferWaitTimeout);
+            }
+            while (result == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(sync);
+        sync = nullptr;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
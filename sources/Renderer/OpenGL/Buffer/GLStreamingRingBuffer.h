@@ -0,0 +1,96 @@
+/*
+ * GLStreamingRingBuffer.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_STREAMING_RING_BUFFER_H
+#define LLGL_GL_STREAMING_RING_BUFFER_H
+
+
+#include "../OpenGL.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLBuffer;
+
+/*
+Persistently mapped and coherent ring buffer (GL_ARB_buffer_storage) for streaming buffer and texture updates.
+The ring buffer is divided into regions; each region is protected by a fence once it is filled and the next region is used.
+The data is written into the mapped memory and then copied into the destination buffer with glCopyBufferSubData,
+so neither the CPU nor the driver has to synchronize with draw commands that still read from the destination buffer.
+For texture updates, the ring buffer is bound as GL_PIXEL_UNPACK_BUFFER and the offset is passed to glTexSubImage* instead of a client pointer.
+*/
+class GLStreamingRingBuffer
+{
+
+    public:
+
+        GLStreamingRingBuffer(GLsizeiptr size, GLuint numRegions = 3);
+        ~GLStreamingRingBuffer();
+
+        GLStreamingRingBuffer(const GLStreamingRingBuffer&) = delete;
+        GLStreamingRingBuffer& operator = (const GLStreamingRingBuffer&) = delete;
+
+        // Returns true if all extensions for the streaming ring buffer are supported.
+        static bool IsSupported();
+
+        /*
+        Allocates a memory range of the specified size and returns a pointer to its mapped memory, or null if the size exceeds a region.
+        The offset of the range within the ring buffer is returned in 'offset'.
+        */
+        char* Allocate(GLsizeiptr size, GLintptr& offset);
+
+        // Copies the specified range of this ring buffer into the destination buffer.
+        void CopyToBuffer(const GLBuffer& dstBuffer, GLintptr srcOffset, GLintptr dstOffset, GLsizeiptr size);
+
+        // Writes the specified data into the destination buffer via this ring buffer. Returns false if the data is larger than a region.
+        bool WriteBuffer(const GLBuffer& dstBuffer, GLintptr dstOffset, const void* data, GLsizeiptr dataSize);
+
+        // Returns the hardware buffer ID, e.g. to bind the ring buffer as GL_PIXEL_UNPACK_BUFFER.
+        inline GLuint GetID() const
+        {
+            return id_;
+        }
+
+        // Returns the number of times a region was still in use by the GPU when it was about to be reused.
+        inline std::size_t GetNumStalls() const
+        {
+            return numStalls_;
+        }
+
+    private:
+
+        // Protects the current region with a fence and moves on to the next region.
+        void NextRegion();
+
+        // Waits until the GPU has finished all commands that read from the specified region.
+        void WaitForRegion(GLuint region);
+
+        GLuint              id_             = 0;
+        char*               mappedData_     = nullptr;
+
+        GLuint              numRegions_     = 0;
+        GLsizeiptr          regionSize_     = 0;
+        GLuint              currentRegion_  = 0;
+        GLsizeiptr          regionOffset_   = 0;    // Offset within the current region
+
+        std::vector<GLsync> fences_;                // Fence for each region (null if the region is not in use)
+        std::size_t         numStalls_      = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
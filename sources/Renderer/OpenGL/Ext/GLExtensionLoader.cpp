@@ -559,6 +559,46 @@ static bool Load_GL_ARB_buffer_storage(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_copy_buffer(bool usePlaceholder)
+{
+    LOAD_GLPROC( glCopyBufferSubData );
+    return true;
+}
+
+static bool Load_GL_ARB_copy_image(bool usePlaceholder)
+{
+    LOAD_GLPROC( glCopyImageSubData );
+    return true;
+}
+
+static bool Load_GL_ARB_map_buffer_range(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMapBufferRange         );
+    LOAD_GLPROC( glFlushMappedBufferRange );
+    return true;
+}
+
+static bool Load_GL_ARB_draw_indirect(bool usePlaceholder)
+{
+    LOAD_GLPROC( glDrawArraysIndirect   );
+    LOAD_GLPROC( glDrawElementsIndirect );
+    return true;
+}
+
+static bool Load_GL_ARB_multi_draw_indirect(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirect   );
+    LOAD_GLPROC( glMultiDrawElementsIndirect );
+    return true;
+}
+
+static bool Load_GL_ARB_indirect_parameters(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirectCountARB   );
+    LOAD_GLPROC( glMultiDrawElementsIndirectCountARB );
+    return true;
+}
+
 static bool Load_GL_ARB_polygon_offset_clamp(bool usePlaceholder)
 {
     LOAD_GLPROC( glPolygonOffsetClamp );
@@ -585,6 +625,12 @@ static bool Load_GL_ARB_framebuffer_no_attachments(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_KHR_parallel_shader_compile(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
 static bool Load_GL_ARB_direct_state_access(bool usePlaceholder)
 {
     LOAD_GLPROC( glCreateTransformFeedbacks                 );
@@ -807,6 +853,9 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( EXT_transform_feedback           );
     ENABLE_GLEXT( ARB_sync                         );
     ENABLE_GLEXT( ARB_polygon_offset_clamp         );
+    ENABLE_GLEXT( ARB_copy_buffer                  );
+    ENABLE_GLEXT( ARB_map_buffer_range             );
+    ENABLE_GLEXT( ARB_draw_indirect                );
 
     /* Enable extensions without procedures */
     ENABLE_GLEXT( ARB_texture_cube_map             );
@@ -923,10 +972,17 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_texture_storage              );
     LOAD_GLEXT( ARB_texture_storage_multisample  );
     LOAD_GLEXT( ARB_buffer_storage               );
+    LOAD_GLEXT( ARB_copy_buffer                  );
+    LOAD_GLEXT( ARB_copy_image                   );
+    LOAD_GLEXT( ARB_map_buffer_range             );
+    LOAD_GLEXT( ARB_draw_indirect                );
+    LOAD_GLEXT( ARB_multi_draw_indirect          );
+    LOAD_GLEXT( ARB_indirect_parameters          );
     LOAD_GLEXT( ARB_polygon_offset_clamp         );
     LOAD_GLEXT( ARB_texture_view                 );
     LOAD_GLEXT( ARB_shader_image_load_store      );
     LOAD_GLEXT( ARB_framebuffer_no_attachments   );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
     #endif
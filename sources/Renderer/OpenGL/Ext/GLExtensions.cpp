@@ -385,6 +385,34 @@ PFNGLTEXSTORAGE3DMULTISAMPLEPROC                        glTexStorage3DMultisampl
 
 PFNGLBUFFERSTORAGEPROC                                  glBufferStorage                                 = nullptr;
 
+/* GL_ARB_copy_buffer */
+
+PFNGLCOPYBUFFERSUBDATAPROC                              glCopyBufferSubData                             = nullptr;
+
+/* GL_ARB_copy_image */
+
+PFNGLCOPYIMAGESUBDATAPROC                               glCopyImageSubData                              = nullptr;
+
+/* GL_ARB_map_buffer_range */
+
+PFNGLMAPBUFFERRANGEPROC                                 glMapBufferRange                                = nullptr;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC                         glFlushMappedBufferRange                        = nullptr;
+
+/* GL_ARB_draw_indirect */
+
+PFNGLDRAWARRAYSINDIRECTPROC                             glDrawArraysIndirect                            = nullptr;
+PFNGLDRAWELEMENTSINDIRECTPROC                           glDrawElementsIndirect                          = nullptr;
+
+/* GL_ARB_multi_draw_indirect */
+
+PFNGLMULTIDRAWARRAYSINDIRECTPROC                        glMultiDrawArraysIndirect                       = nullptr;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC                      glMultiDrawElementsIndirect                     = nullptr;
+
+/* GL_ARB_indirect_parameters */
+
+PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC                glMultiDrawArraysIndirectCountARB               = nullptr;
+PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC              glMultiDrawElementsIndirectCountARB             = nullptr;
+
 /* GL_ARB_polygon_offset_clamp */
 
 PFNGLPOLYGONOFFSETCLAMPPROC                             glPolygonOffsetClamp                            = nullptr;
@@ -403,6 +431,10 @@ PFNGLMEMORYBARRIERPROC                                  glMemoryBarrier
 PFNGLFRAMEBUFFERPARAMETERIPROC                          glFramebufferParameteri                         = nullptr;
 PFNGLGETFRAMEBUFFERPARAMETERIVPROC                      glGetFramebufferParameteriv                     = nullptr;
 
+/* GL_KHR_parallel_shader_compile */
+
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC                    glMaxShaderCompilerThreadsKHR                   = nullptr;
+
 /* GL_ARB_direct_state_access */
 
 PFNGLCREATETRANSFORMFEEDBACKSPROC                       glCreateTransformFeedbacks                      = nullptr;
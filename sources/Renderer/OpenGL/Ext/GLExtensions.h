@@ -388,6 +388,34 @@ extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC                     glTexStorage3DMultis
 
 extern PFNGLBUFFERSTORAGEPROC                               glBufferStorage;
 
+/* GL_ARB_copy_buffer */
+
+extern PFNGLCOPYBUFFERSUBDATAPROC                           glCopyBufferSubData;
+
+/* GL_ARB_copy_image */
+
+extern PFNGLCOPYIMAGESUBDATAPROC                            glCopyImageSubData;
+
+/* GL_ARB_map_buffer_range */
+
+extern PFNGLMAPBUFFERRANGEPROC                              glMapBufferRange;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC                      glFlushMappedBufferRange;
+
+/* GL_ARB_draw_indirect */
+
+extern PFNGLDRAWARRAYSINDIRECTPROC                          glDrawArraysIndirect;
+extern PFNGLDRAWELEMENTSINDIRECTPROC                        glDrawElementsIndirect;
+
+/* GL_ARB_multi_draw_indirect */
+
+extern PFNGLMULTIDRAWARRAYSINDIRECTPROC                     glMultiDrawArraysIndirect;
+extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC                   glMultiDrawElementsIndirect;
+
+/* GL_ARB_indirect_parameters */
+
+extern PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC             glMultiDrawArraysIndirectCountARB;
+extern PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC           glMultiDrawElementsIndirectCountARB;
+
 /* GL_ARB_polygon_offset_clamp */
 
 extern PFNGLPOLYGONOFFSETCLAMPPROC                          glPolygonOffsetClamp;
@@ -406,6 +434,10 @@ extern PFNGLMEMORYBARRIERPROC                               glMemoryBarrier;
 extern PFNGLFRAMEBUFFERPARAMETERIPROC                       glFramebufferParameteri;
 extern PFNGLGETFRAMEBUFFERPARAMETERIVPROC                   glGetFramebufferParameteriv;
 
+/* GL_KHR_parallel_shader_compile */
+
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC                 glMaxShaderCompilerThreadsKHR;
+
 /* GL_ARB_direct_state_access */
 
 extern PFNGLCREATETRANSFORMFEEDBACKSPROC                    glCreateTransformFeedbacks;
@@ -415,6 +415,34 @@ DECL_GLPROC(void, glTexStorage3DMultisample, (GLenum, GLsizei, GLenum, GLsizei,
 
 DECL_GLPROC(void, glBufferStorage, (GLenum, GLsizeiptr, const void*, GLbitfield));
 
+/* GL_ARB_copy_buffer */
+
+DECL_GLPROC(void, glCopyBufferSubData, (GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr));
+
+/* GL_ARB_copy_image */
+
+DECL_GLPROC(void, glCopyImageSubData, (GLuint, GLenum, GLint, GLint, GLint, GLint, GLuint, GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei));
+
+/* GL_ARB_map_buffer_range */
+
+DECL_GLPROC(void*, glMapBufferRange, (GLenum, GLintptr, GLsizeiptr, GLbitfield));
+DECL_GLPROC(void, glFlushMappedBufferRange, (GLenum, GLintptr, GLsizeiptr));
+
+/* GL_ARB_draw_indirect */
+
+DECL_GLPROC(void, glDrawArraysIndirect, (GLenum, const void*));
+DECL_GLPROC(void, glDrawElementsIndirect, (GLenum, GLenum, const void*));
+
+/* GL_ARB_multi_draw_indirect */
+
+DECL_GLPROC(void, glMultiDrawArraysIndirect, (GLenum, const void*, GLsizei, GLsizei));
+DECL_GLPROC(void, glMultiDrawElementsIndirect, (GLenum, GLenum, const void*, GLsizei, GLsizei));
+
+/* GL_ARB_indirect_parameters */
+
+DECL_GLPROC(void, glMultiDrawArraysIndirectCountARB, (GLenum, const void*, GLintptr, GLsizei, GLsizei));
+DECL_GLPROC(void, glMultiDrawElementsIndirectCountARB, (GLenum, GLenum, const void*, GLintptr, GLsizei, GLsizei));
+
 /* GL_ARB_polygon_offset_clamp */
 
 DECL_GLPROC(void, glPolygonOffsetClamp, (GLfloat, GLfloat, GLfloat));
@@ -433,6 +461,10 @@ DECL_GLPROC(void, glMemoryBarrier, (GLbitfield));
 DECL_GLPROC(void, glFramebufferParameteri, (GLenum, GLenum, GLint));
 DECL_GLPROC(void, glGetFramebufferParameteriv, (GLenum, GLenum, GLint*));
 
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(void, glMaxShaderCompilerThreadsKHR, (GLuint));
+
 /* GL_ARB_direct_state_access */
 
 DECL_GLPROC(void, glCreateTransformFeedbacks, (GLsizei, GLuint*));
@@ -0,0 +1,391 @@
+/*
+ * GLCommandExecutor.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLCommandExecutor.h"
+#include "GLCommandOpcode.h"
+#include "GLImmediateCommandBuffer.h"
+#include "../CommandStream.h"
+
+
+namespace LLGL
+{
+
+
+void ExecuteGLCommandStream(const std::vector<std::uint8_t>& stream, GLImmediateCommandBuffer& cmdBuffer)
+{
+    const auto begin    = stream.data();
+    const auto end      = begin + stream.size();
+
+    for (auto pc = begin; pc < end;)
+    {
+        /* Decode opcode and execute command with immediate command buffer (no virtual call, since the class is final) */
+        const auto opcode = static_cast<GLOpcode>(*pc++);
+
+        switch (opcode)
+        {
+            case GLOpcode::SetGraphicsAPIDependentState:
+            {
+                auto cmd = ReadCmd<OpenGLDependentStateDescriptor>(pc);
+                cmdBuffer.SetGraphicsAPIDependentState(&cmd, sizeof(cmd));
+            }
+            break;
+
+            case GLOpcode::SetViewport:
+            {
+                cmdBuffer.SetViewport(ReadCmd<Viewport>(pc));
+            }
+            break;
+
+            case GLOpcode::SetViewports:
+            {
+                std::uint32_t count = 0;
+                auto viewports = ReadCmdArray<Viewport>(begin, pc, count);
+                cmdBuffer.SetViewports(count, viewports);
+            }
+            break;
+
+            case GLOpcode::SetScissor:
+            {
+                cmdBuffer.SetScissor(ReadCmd<Scissor>(pc));
+            }
+            break;
+
+            case GLOpcode::SetScissors:
+            {
+                std::uint32_t count = 0;
+                auto scissors = ReadCmdArray<Scissor>(begin, pc, count);
+                cmdBuffer.SetScissors(count, scissors);
+            }
+            break;
+
+            case GLOpcode::SetClearColor:
+            {
+                auto cmd = ReadCmd<GLCmdSetClearColor>(pc);
+                cmdBuffer.SetClearColor(ColorRGBAf{ cmd.color[0], cmd.color[1], cmd.color[2], cmd.color[3] });
+            }
+            break;
+
+            case GLOpcode::SetClearDepth:
+            {
+                cmdBuffer.SetClearDepth(ReadCmd<float>(pc));
+            }
+            break;
+
+            case GLOpcode::SetClearStencil:
+            {
+                cmdBuffer.SetClearStencil(ReadCmd<std::uint32_t>(pc));
+            }
+            break;
+
+            case GLOpcode::Clear:
+            {
+                cmdBuffer.Clear(ReadCmd<long>(pc));
+            }
+            break;
+
+            case GLOpcode::ClearAttachments:
+            {
+                std::uint32_t count = 0;
+                auto cmds = ReadCmdArray<GLCmdClearAttachment>(begin, pc, count);
+                for (; count-- > 0; ++cmds)
+                {
+                    AttachmentClear attachment;
+                    {
+                        attachment.flags                = cmds->flags;
+                        attachment.colorAttachment      = cmds->colorAttachment;
+                        attachment.clearValue.color     = ColorRGBAf{ cmds->color[0], cmds->color[1], cmds->color[2], cmds->color[3] };
+                        attachment.clearValue.depth     = cmds->depth;
+                        attachment.clearValue.stencil   = cmds->stencil;
+                    }
+                    cmdBuffer.ClearAttachments(1, &attachment);
+                }
+            }
+            break;
+
+            case GLOpcode::UpdateBuffer:
+            {
+                auto cmd = ReadCmd<GLCmdUpdateBuffer>(pc);
+                cmdBuffer.UpdateBuffer(*cmd.buffer, cmd.offset, pc, cmd.size);
+                pc += cmd.size;
+            }
+            break;
+
+            case GLOpcode::CopyBuffer:
+            {
+                auto cmd = ReadCmd<GLCmdCopyBuffer>(pc);
+                cmdBuffer.CopyBuffer(*cmd.dstBuffer, cmd.dstOffset, *cmd.srcBuffer, cmd.srcOffset, cmd.size);
+            }
+            break;
+
+            case GLOpcode::CopyBufferToTexture:
+            {
+                auto cmd = ReadCmd<GLCmdCopyBufferToTexture>(pc);
+                cmdBuffer.CopyBufferToTexture(*cmd.dstTexture, cmd.dstRegion, *cmd.srcBuffer, cmd.srcOffset);
+            }
+            break;
+
+            case GLOpcode::CopyTexture:
+            {
+                auto cmd = ReadCmd<GLCmdCopyTexture>(pc);
+                cmdBuffer.CopyTexture(*cmd.dstTexture, cmd.dstRegion, *cmd.srcTexture, cmd.srcMipLevel, cmd.srcOffset);
+            }
+            break;
+
+            case GLOpcode::SetVertexBuffer:
+            {
+                cmdBuffer.SetVertexBuffer(*ReadCmd<Buffer*>(pc));
+            }
+            break;
+
+            case GLOpcode::SetVertexBufferArray:
+            {
+                cmdBuffer.SetVertexBufferArray(*ReadCmd<BufferArray*>(pc));
+            }
+            break;
+
+            case GLOpcode::SetIndexBuffer:
+            {
+                cmdBuffer.SetIndexBuffer(*ReadCmd<Buffer*>(pc));
+            }
+            break;
+
+            case GLOpcode::SetConstantBuffer:
+            {
+                auto cmd = ReadCmd<GLCmdSetBuffer>(pc);
+                cmdBuffer.SetConstantBuffer(*cmd.buffer, cmd.slot, cmd.stageFlags);
+            }
+            break;
+
+            case GLOpcode::SetStorageBuffer:
+            {
+                auto cmd = ReadCmd<GLCmdSetBuffer>(pc);
+                cmdBuffer.SetStorageBuffer(*cmd.buffer, cmd.slot, cmd.stageFlags);
+            }
+            break;
+
+            case GLOpcode::SetStreamOutputBuffer:
+            {
+                cmdBuffer.SetStreamOutputBuffer(*ReadCmd<Buffer*>(pc));
+            }
+            break;
+
+            case GLOpcode::SetStreamOutputBufferArray:
+            {
+                cmdBuffer.SetStreamOutputBufferArray(*ReadCmd<BufferArray*>(pc));
+            }
+            break;
+
+            case GLOpcode::BeginStreamOutput:
+            {
+                cmdBuffer.BeginStreamOutput(ReadCmd<PrimitiveType>(pc));
+            }
+            break;
+
+            case GLOpcode::EndStreamOutput:
+            {
+                cmdBuffer.EndStreamOutput();
+            }
+            break;
+
+            case GLOpcode::SetTexture:
+            {
+                auto cmd = ReadCmd<GLCmdSetTexture>(pc);
+                cmdBuffer.SetTexture(*cmd.texture, cmd.slot, cmd.stageFlags);
+            }
+            break;
+
+            case GLOpcode::SetSampler:
+            {
+                auto cmd = ReadCmd<GLCmdSetSampler>(pc);
+                cmdBuffer.SetSampler(*cmd.sampler, cmd.slot, cmd.stageFlags);
+            }
+            break;
+
+            case GLOpcode::SetGraphicsResourceHeap:
+            {
+                auto cmd = ReadCmd<GLCmdSetResourceHeap>(pc);
+                cmdBuffer.SetGraphicsResourceHeap(*cmd.resourceHeap, cmd.firstSet);
+            }
+            break;
+
+            case GLOpcode::SetComputeResourceHeap:
+            {
+                auto cmd = ReadCmd<GLCmdSetResourceHeap>(pc);
+                cmdBuffer.SetComputeResourceHeap(*cmd.resourceHeap, cmd.firstSet);
+            }
+            break;
+
+            case GLOpcode::SetRenderTarget:
+            {
+                cmdBuffer.SetRenderTarget(*ReadCmd<RenderTarget*>(pc));
+            }
+            break;
+
+            case GLOpcode::SetRenderTargetContext:
+            {
+                cmdBuffer.SetRenderTarget(*ReadCmd<RenderContext*>(pc));
+            }
+            break;
+
+            case GLOpcode::SetGraphicsPipeline:
+            {
+                cmdBuffer.SetGraphicsPipeline(*ReadCmd<GraphicsPipeline*>(pc));
+            }
+            break;
+
+            case GLOpcode::SetComputePipeline:
+            {
+                cmdBuffer.SetComputePipeline(*ReadCmd<ComputePipeline*>(pc));
+            }
+            break;
+
+            case GLOpcode::BeginQuery:
+            {
+                cmdBuffer.BeginQuery(*ReadCmd<Query*>(pc));
+            }
+            break;
+
+            case GLOpcode::EndQuery:
+            {
+                cmdBuffer.EndQuery(*ReadCmd<Query*>(pc));
+            }
+            break;
+
+            case GLOpcode::BeginRenderCondition:
+            {
+                auto cmd = ReadCmd<GLCmdBeginRenderCondition>(pc);
+                cmdBuffer.BeginRenderCondition(*cmd.query, cmd.mode);
+            }
+            break;
+
+            case GLOpcode::EndRenderCondition:
+            {
+                cmdBuffer.EndRenderCondition();
+            }
+            break;
+
+            case GLOpcode::Draw:
+            {
+                auto cmd = ReadCmd<GLCmdDraw>(pc);
+                cmdBuffer.Draw(cmd.numVertices, cmd.firstVertex);
+            }
+            break;
+
+            case GLOpcode::DrawInstanced:
+            {
+                auto cmd = ReadCmd<GLCmdDraw>(pc);
+                cmdBuffer.DrawInstanced(cmd.numVertices, cmd.firstVertex, cmd.numInstances);
+            }
+            break;
+
+            case GLOpcode::DrawInstancedOffset:
+            {
+                auto cmd = ReadCmd<GLCmdDraw>(pc);
+                cmdBuffer.DrawInstanced(cmd.numVertices, cmd.firstVertex, cmd.numInstances, cmd.firstInstance);
+            }
+            break;
+
+            case GLOpcode::DrawIndexed:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndexed>(pc);
+                cmdBuffer.DrawIndexed(cmd.numIndices, cmd.firstIndex);
+            }
+            break;
+
+            case GLOpcode::DrawIndexedOffset:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndexed>(pc);
+                cmdBuffer.DrawIndexed(cmd.numIndices, cmd.firstIndex, cmd.vertexOffset);
+            }
+            break;
+
+            case GLOpcode::DrawIndexedInstanced:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndexed>(pc);
+                cmdBuffer.DrawIndexedInstanced(cmd.numIndices, cmd.numInstances, cmd.firstIndex);
+            }
+            break;
+
+            case GLOpcode::DrawIndexedInstancedOffset:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndexed>(pc);
+                cmdBuffer.DrawIndexedInstanced(cmd.numIndices, cmd.numInstances, cmd.firstIndex, cmd.vertexOffset);
+            }
+            break;
+
+            case GLOpcode::DrawIndexedInstancedBase:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndexed>(pc);
+                cmdBuffer.DrawIndexedInstanced(cmd.numIndices, cmd.numInstances, cmd.firstIndex, cmd.vertexOffset, cmd.firstInstance);
+            }
+            break;
+
+            case GLOpcode::DrawIndirect:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndirect>(pc);
+                cmdBuffer.DrawIndirect(*cmd.buffer, cmd.offset);
+            }
+            break;
+
+            case GLOpcode::DrawIndirectMulti:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndirect>(pc);
+                cmdBuffer.DrawIndirect(*cmd.buffer, cmd.offset, cmd.numCommands, cmd.stride);
+            }
+            break;
+
+            case GLOpcode::DrawIndirectCount:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndirectCount>(pc);
+                cmdBuffer.DrawIndirectCount(*cmd.buffer, cmd.offset, *cmd.countBuffer, cmd.countOffset, cmd.maxNumCommands, cmd.stride);
+            }
+            break;
+
+            case GLOpcode::DrawIndexedIndirect:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndirect>(pc);
+                cmdBuffer.DrawIndexedIndirect(*cmd.buffer, cmd.offset);
+            }
+            break;
+
+            case GLOpcode::DrawIndexedIndirectMulti:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndirect>(pc);
+                cmdBuffer.DrawIndexedIndirect(*cmd.buffer, cmd.offset, cmd.numCommands, cmd.stride);
+            }
+            break;
+
+            case GLOpcode::DrawIndexedIndirectCount:
+            {
+                auto cmd = ReadCmd<GLCmdDrawIndirectCount>(pc);
+                cmdBuffer.DrawIndexedIndirectCount(*cmd.buffer, cmd.offset, *cmd.countBuffer, cmd.countOffset, cmd.maxNumCommands, cmd.stride);
+            }
+            break;
+
+            case GLOpcode::Dispatch:
+            {
+                auto cmd = ReadCmd<GLCmdDispatch>(pc);
+                cmdBuffer.Dispatch(cmd.groupSizeX, cmd.groupSizeY, cmd.groupSizeZ);
+            }
+            break;
+
+            case GLOpcode::DispatchIndirect:
+            {
+                auto cmd = ReadCmd<GLCmdDispatchIndirect>(pc);
+                cmdBuffer.DispatchIndirect(*cmd.buffer, cmd.offset);
+            }
+            break;
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
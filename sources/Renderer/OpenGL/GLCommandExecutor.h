@@ -0,0 +1,33 @@
+/*
+ * GLCommandExecutor.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_COMMAND_EXECUTOR_H
+#define LLGL_GL_COMMAND_EXECUTOR_H
+
+
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLImmediateCommandBuffer;
+
+// Decodes the specified command stream of a deferred command buffer and executes each command with the immediate command buffer.
+void ExecuteGLCommandStream(const std::vector<std::uint8_t>& stream, GLImmediateCommandBuffer& cmdBuffer);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,223 @@
+/*
+ * GLCommandOpcode.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_COMMAND_OPCODE_H
+#define LLGL_GL_COMMAND_OPCODE_H
+
+
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class Buffer;
+class Texture;
+class Sampler;
+class ResourceHeap;
+class Query;
+
+/*
+Opcodes of the command stream that is recorded by a deferred GL command buffer.
+Each opcode is followed by its command structure (if any) without padding.
+Arrays (e.g. viewports) are preceded by their number of elements and aligned to their element type.
+*/
+enum class GLOpcode : std::uint8_t
+{
+    SetGraphicsAPIDependentState,   // OpenGLDependentStateDescriptor
+    SetViewport,                    // Viewport
+    SetViewports,                   // std::uint32_t, Viewport[]
+    SetScissor,                     // Scissor
+    SetScissors,                    // std::uint32_t, Scissor[]
+    SetClearColor,                  // GLCmdSetClearColor
+    SetClearDepth,                  // float
+    SetClearStencil,                // std::uint32_t
+    Clear,                          // long
+    ClearAttachments,               // std::uint32_t, GLCmdClearAttachment[]
+    UpdateBuffer,                   // GLCmdUpdateBuffer, std::uint8_t[]
+    CopyBuffer,                     // GLCmdCopyBuffer
+    CopyBufferToTexture,            // GLCmdCopyBufferToTexture
+    CopyTexture,                    // GLCmdCopyTexture
+    SetVertexBuffer,                // Buffer*
+    SetVertexBufferArray,           // BufferArray*
+    SetIndexBuffer,                 // Buffer*
+    SetConstantBuffer,              // GLCmdSetBuffer
+    SetStorageBuffer,               // GLCmdSetBuffer
+    SetStreamOutputBuffer,          // Buffer*
+    SetStreamOutputBufferArray,     // BufferArray*
+    BeginStreamOutput,              // PrimitiveType
+    EndStreamOutput,
+    SetTexture,                     // GLCmdSetTexture
+    SetSampler,                     // GLCmdSetSampler
+    SetGraphicsResourceHeap,        // GLCmdSetResourceHeap
+    SetComputeResourceHeap,         // GLCmdSetResourceHeap
+    SetRenderTarget,                // RenderTarget*
+    SetRenderTargetContext,         // RenderContext*
+    SetGraphicsPipeline,            // GraphicsPipeline*
+    SetComputePipeline,             // ComputePipeline*
+    BeginQuery,                     // Query*
+    EndQuery,                       // Query*
+    BeginRenderCondition,           // GLCmdBeginRenderCondition
+    EndRenderCondition,
+    Draw,                           // GLCmdDraw
+    DrawInstanced,                  // GLCmdDraw
+    DrawInstancedOffset,            // GLCmdDraw
+    DrawIndexed,                    // GLCmdDrawIndexed
+    DrawIndexedOffset,              // GLCmdDrawIndexed
+    DrawIndexedInstanced,           // GLCmdDrawIndexed
+    DrawIndexedInstancedOffset,     // GLCmdDrawIndexed
+    DrawIndexedInstancedBase,       // GLCmdDrawIndexed
+    DrawIndirect,                   // GLCmdDrawIndirect
+    DrawIndirectMulti,              // GLCmdDrawIndirect
+    DrawIndirectCount,              // GLCmdDrawIndirectCount
+    DrawIndexedIndirect,            // GLCmdDrawIndirect
+    DrawIndexedIndirectMulti,       // GLCmdDrawIndirect
+    DrawIndexedIndirectCount,       // GLCmdDrawIndirectCount
+    Dispatch,                       // GLCmdDispatch
+    DispatchIndirect,               // GLCmdDispatchIndirect
+};
+
+struct GLCmdSetClearColor
+{
+    float                   color[4];
+};
+
+struct GLCmdClearAttachment
+{
+    long                    flags;
+    std::uint32_t           colorAttachment;
+    float                   color[4];
+    float                   depth;
+    std::uint32_t           stencil;
+};
+
+struct GLCmdUpdateBuffer
+{
+    Buffer*                 buffer;
+    std::uint64_t           offset;
+    std::uint16_t           size;
+};
+
+struct GLCmdCopyBuffer
+{
+    Buffer*                 dstBuffer;
+    std::uint64_t           dstOffset;
+    Buffer*                 srcBuffer;
+    std::uint64_t           srcOffset;
+    std::uint64_t           size;
+};
+
+struct GLCmdCopyBufferToTexture
+{
+    Texture*                dstTexture;
+    SubTextureDescriptor    dstRegion;
+    Buffer*                 srcBuffer;
+    std::uint64_t           srcOffset;
+};
+
+struct GLCmdCopyTexture
+{
+    Texture*                dstTexture;
+    SubTextureDescriptor    dstRegion;
+    Texture*                srcTexture;
+    std::uint32_t           srcMipLevel;
+    Offset3D                srcOffset;
+};
+
+struct GLCmdSetBuffer
+{
+    Buffer*             buffer;
+    std::uint32_t       slot;
+    long                stageFlags;
+};
+
+struct GLCmdSetTexture
+{
+    Texture*            texture;
+    std::uint32_t       slot;
+    long                stageFlags;
+};
+
+struct GLCmdSetSampler
+{
+    Sampler*            sampler;
+    std::uint32_t       slot;
+    long                stageFlags;
+};
+
+struct GLCmdSetResourceHeap
+{
+    ResourceHeap*       resourceHeap;
+    std::uint32_t       firstSet;
+};
+
+struct GLCmdBeginRenderCondition
+{
+    Query*              query;
+    RenderConditionMode mode;
+};
+
+struct GLCmdDraw
+{
+    std::uint32_t       numVertices;
+    std::uint32_t       firstVertex;
+    std::uint32_t       numInstances;
+    std::uint32_t       firstInstance;
+};
+
+struct GLCmdDrawIndexed
+{
+    std::uint32_t       numIndices;
+    std::uint32_t       numInstances;
+    std::uint32_t       firstIndex;
+    std::int32_t        vertexOffset;
+    std::uint32_t       firstInstance;
+};
+
+struct GLCmdDrawIndirect
+{
+    Buffer*             buffer;
+    std::uint64_t       offset;
+    std::uint32_t       numCommands;
+    std::uint32_t       stride;
+};
+
+struct GLCmdDrawIndirectCount
+{
+    Buffer*             buffer;
+    std::uint64_t       offset;
+    Buffer*             countBuffer;
+    std::uint64_t       countOffset;
+    std::uint32_t       maxNumCommands;
+    std::uint32_t       stride;
+};
+
+struct GLCmdDispatch
+{
+    std::uint32_t       groupSizeX;
+    std::uint32_t       groupSizeY;
+    std::uint32_t       groupSizeZ;
+};
+
+struct GLCmdDispatchIndirect
+{
+    Buffer*             buffer;
+    std::uint64_t       offset;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "GLCommandQueue.h"
 #include "../CheckedCast.h"
+#include "GLDeferredCommandBuffer.h"
 #include "RenderState/GLFence.h"
 
 
@@ -16,9 +17,15 @@ namespace LLGL
 
 /* ----- Command queues ----- */
 
-void GLCommandQueue::Submit(CommandBuffer& /*commandBuffer*/)
+void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
-    // dummy
+    /* Immediate command buffers have already been executed, only deferred command buffers must be executed now */
+    auto& cmdBufferGL = LLGL_CAST(GLCommandBuffer&, commandBuffer);
+    if (!cmdBufferGL.IsImmediateCmdBuffer())
+    {
+        auto& deferredCmdBufferGL = LLGL_CAST(GLDeferredCommandBuffer&, cmdBufferGL);
+        deferredCmdBufferGL.Execute();
+    }
 }
 
 /* ----- Fences ----- */
@@ -0,0 +1,404 @@
+/*
+ * GLDeferredCommandBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLDeferredCommandBuffer.h"
+#include "GLCommandExecutor.h"
+#include "../../Core/Helper.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+GLDeferredCommandBuffer::GLDeferredCommandBuffer(const std::shared_ptr<GLStateManager>& stateManager, std::size_t initialBufferSize) :
+    immediateCmdBuffer_ { stateManager }
+{
+    buffer_.reserve(initialBufferSize);
+}
+
+bool GLDeferredCommandBuffer::IsImmediateCmdBuffer() const
+{
+    return false;
+}
+
+/* ----- Configuration ----- */
+
+void GLDeferredCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
+{
+    if (stateDesc != nullptr && stateDescSize == sizeof(OpenGLDependentStateDescriptor))
+        WriteCmd(GLOpcode::SetGraphicsAPIDependentState, *reinterpret_cast<const OpenGLDependentStateDescriptor*>(stateDesc));
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void GLDeferredCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    WriteCmd(GLOpcode::SetViewport, viewport);
+}
+
+void GLDeferredCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    WriteCmdArray(GLOpcode::SetViewports, numViewports, viewports);
+}
+
+void GLDeferredCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    WriteCmd(GLOpcode::SetScissor, scissor);
+}
+
+void GLDeferredCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    WriteCmdArray(GLOpcode::SetScissors, numScissors, scissors);
+}
+
+/* ----- Clear ----- */
+
+void GLDeferredCommandBuffer::SetClearColor(const ColorRGBAf& color)
+{
+    WriteCmd(GLOpcode::SetClearColor, GLCmdSetClearColor{ { color.r, color.g, color.b, color.a } });
+}
+
+void GLDeferredCommandBuffer::SetClearDepth(float depth)
+{
+    WriteCmd(GLOpcode::SetClearDepth, depth);
+}
+
+void GLDeferredCommandBuffer::SetClearStencil(std::uint32_t stencil)
+{
+    WriteCmd(GLOpcode::SetClearStencil, stencil);
+}
+
+void GLDeferredCommandBuffer::Clear(long flags)
+{
+    WriteCmd(GLOpcode::Clear, flags);
+}
+
+void GLDeferredCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    WriteCmd(GLOpcode::ClearAttachments, numAttachments);
+
+    /* Convert attachment clears into aligned array of command structures */
+    buffer_.resize(GetAlignedSize(buffer_.size(), alignof(GLCmdClearAttachment)));
+
+    for (; numAttachments-- > 0; ++attachments)
+    {
+        const auto& clearValue = attachments->clearValue;
+        const GLCmdClearAttachment cmd
+        {
+            attachments->flags,
+            attachments->colorAttachment,
+            { clearValue.color.r, clearValue.color.g, clearValue.color.b, clearValue.color.a },
+            clearValue.depth,
+            clearValue.stencil
+        };
+        WriteBytes(&cmd, sizeof(cmd));
+    }
+}
+
+/* ----- Copy ----- */
+
+void GLDeferredCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    /* Store data inline after the command structure */
+    WriteCmd(GLOpcode::UpdateBuffer, GLCmdUpdateBuffer{ &dstBuffer, dstOffset, dataSize });
+    WriteBytes(data, dataSize);
+}
+
+void GLDeferredCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    WriteCmd(GLOpcode::CopyBuffer, GLCmdCopyBuffer{ &dstBuffer, dstOffset, &srcBuffer, srcOffset, size });
+}
+
+void GLDeferredCommandBuffer::CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset)
+{
+    WriteCmd(GLOpcode::CopyBufferToTexture, GLCmdCopyBufferToTexture{ &dstTexture, dstRegion, &srcBuffer, srcOffset });
+}
+
+void GLDeferredCommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    WriteCmd(GLOpcode::CopyTexture, GLCmdCopyTexture{ &dstTexture, dstRegion, &srcTexture, srcMipLevel, srcOffset });
+}
+
+/* ----- Input Assembly ------ */
+
+void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    WriteCmd(GLOpcode::SetVertexBuffer, &buffer);
+}
+
+void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    WriteCmd(GLOpcode::SetVertexBufferArray, &bufferArray);
+}
+
+void GLDeferredCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    WriteCmd(GLOpcode::SetIndexBuffer, &buffer);
+}
+
+/* ----- Constant Buffers ------ */
+
+void GLDeferredCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags)
+{
+    WriteCmd(GLOpcode::SetConstantBuffer, GLCmdSetBuffer{ &buffer, slot, stageFlags });
+}
+
+/* ----- Storage Buffers ------ */
+
+void GLDeferredCommandBuffer::SetStorageBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags)
+{
+    WriteCmd(GLOpcode::SetStorageBuffer, GLCmdSetBuffer{ &buffer, slot, stageFlags });
+}
+
+/* ----- Stream Output Buffers ------ */
+
+void GLDeferredCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+{
+    WriteCmd(GLOpcode::SetStreamOutputBuffer, &buffer);
+}
+
+void GLDeferredCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+{
+    WriteCmd(GLOpcode::SetStreamOutputBufferArray, &bufferArray);
+}
+
+void GLDeferredCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
+{
+    WriteCmd(GLOpcode::BeginStreamOutput, primitiveType);
+}
+
+void GLDeferredCommandBuffer::EndStreamOutput()
+{
+    WriteOpcode(GLOpcode::EndStreamOutput);
+}
+
+/* ----- Textures ----- */
+
+void GLDeferredCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long stageFlags)
+{
+    WriteCmd(GLOpcode::SetTexture, GLCmdSetTexture{ &texture, slot, stageFlags });
+}
+
+/* ----- Sampler States ----- */
+
+void GLDeferredCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long stageFlags)
+{
+    WriteCmd(GLOpcode::SetSampler, GLCmdSetSampler{ &sampler, slot, stageFlags });
+}
+
+/* ----- Resource Heaps ----- */
+
+void GLDeferredCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot)
+{
+    WriteCmd(GLOpcode::SetGraphicsResourceHeap, GLCmdSetResourceHeap{ &resourceHeap, startSlot });
+}
+
+void GLDeferredCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot)
+{
+    WriteCmd(GLOpcode::SetComputeResourceHeap, GLCmdSetResourceHeap{ &resourceHeap, startSlot });
+}
+
+/* ----- Render Targets ----- */
+
+void GLDeferredCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+{
+    WriteCmd(GLOpcode::SetRenderTarget, &renderTarget);
+}
+
+void GLDeferredCommandBuffer::SetRenderTarget(RenderContext& renderContext)
+{
+    WriteCmd(GLOpcode::SetRenderTargetContext, &renderContext);
+}
+
+/* ----- Pipeline States ----- */
+
+void GLDeferredCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    WriteCmd(GLOpcode::SetGraphicsPipeline, &graphicsPipeline);
+}
+
+void GLDeferredCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+{
+    WriteCmd(GLOpcode::SetComputePipeline, &computePipeline);
+}
+
+bool GLDeferredCommandBuffer::QueryStateChangeStatistics(StateChangeStatistics& statistics) const
+{
+    return immediateCmdBuffer_.QueryStateChangeStatistics(statistics);
+}
+
+/* ----- Queries ----- */
+
+void GLDeferredCommandBuffer::BeginQuery(Query& query)
+{
+    WriteCmd(GLOpcode::BeginQuery, &query);
+}
+
+void GLDeferredCommandBuffer::EndQuery(Query& query)
+{
+    WriteCmd(GLOpcode::EndQuery, &query);
+}
+
+// Query results are not commands, so they are read immediately (this requires the GL context)
+bool GLDeferredCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
+{
+    return immediateCmdBuffer_.QueryResult(query, result);
+}
+
+bool GLDeferredCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result)
+{
+    return immediateCmdBuffer_.QueryPipelineStatisticsResult(query, result);
+}
+
+void GLDeferredCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
+{
+    WriteCmd(GLOpcode::BeginRenderCondition, GLCmdBeginRenderCondition{ &query, mode });
+}
+
+void GLDeferredCommandBuffer::EndRenderCondition()
+{
+    WriteOpcode(GLOpcode::EndRenderCondition);
+}
+
+/* ----- Drawing ----- */
+
+void GLDeferredCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    WriteCmd(GLOpcode::Draw, GLCmdDraw{ numVertices, firstVertex, 1, 0 });
+}
+
+void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    WriteCmd(GLOpcode::DrawIndexed, GLCmdDrawIndexed{ numIndices, 1, firstIndex, 0, 0 });
+}
+
+void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    WriteCmd(GLOpcode::DrawIndexedOffset, GLCmdDrawIndexed{ numIndices, 1, firstIndex, vertexOffset, 0 });
+}
+
+void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    WriteCmd(GLOpcode::DrawInstanced, GLCmdDraw{ numVertices, firstVertex, numInstances, 0 });
+}
+
+void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    WriteCmd(GLOpcode::DrawInstancedOffset, GLCmdDraw{ numVertices, firstVertex, numInstances, firstInstance });
+}
+
+void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    WriteCmd(GLOpcode::DrawIndexedInstanced, GLCmdDrawIndexed{ numIndices, numInstances, firstIndex, 0, 0 });
+}
+
+void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    WriteCmd(GLOpcode::DrawIndexedInstancedOffset, GLCmdDrawIndexed{ numIndices, numInstances, firstIndex, vertexOffset, 0 });
+}
+
+void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    WriteCmd(GLOpcode::DrawIndexedInstancedBase, GLCmdDrawIndexed{ numIndices, numInstances, firstIndex, vertexOffset, firstInstance });
+}
+
+void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    WriteCmd(GLOpcode::DrawIndirect, GLCmdDrawIndirect{ &buffer, offset, 1, 0 });
+}
+
+void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    WriteCmd(GLOpcode::DrawIndirectMulti, GLCmdDrawIndirect{ &buffer, offset, numCommands, stride });
+}
+
+void GLDeferredCommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    WriteCmd(GLOpcode::DrawIndirectCount, GLCmdDrawIndirectCount{ &buffer, offset, &countBuffer, countOffset, maxNumCommands, stride });
+}
+
+void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    WriteCmd(GLOpcode::DrawIndexedIndirect, GLCmdDrawIndirect{ &buffer, offset, 1, 0 });
+}
+
+void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    WriteCmd(GLOpcode::DrawIndexedIndirectMulti, GLCmdDrawIndirect{ &buffer, offset, numCommands, stride });
+}
+
+void GLDeferredCommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    WriteCmd(GLOpcode::DrawIndexedIndirectCount, GLCmdDrawIndirectCount{ &buffer, offset, &countBuffer, countOffset, maxNumCommands, stride });
+}
+
+/* ----- Compute ----- */
+
+void GLDeferredCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
+{
+    WriteCmd(GLOpcode::Dispatch, GLCmdDispatch{ groupSizeX, groupSizeY, groupSizeZ });
+}
+
+void GLDeferredCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    WriteCmd(GLOpcode::DispatchIndirect, GLCmdDispatchIndirect{ &buffer, offset });
+}
+
+/* ----- Internal ----- */
+
+void GLDeferredCommandBuffer::Execute()
+{
+    ExecuteGLCommandStream(buffer_, immediateCmdBuffer_);
+    executed_ = true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLDeferredCommandBuffer::WriteOpcode(const GLOpcode opcode)
+{
+    /* Start a new recording if the previous one has already been submitted */
+    if (executed_)
+    {
+        buffer_.clear();
+        executed_ = false;
+    }
+    buffer_.push_back(static_cast<std::uint8_t>(opcode));
+}
+
+void GLDeferredCommandBuffer::WriteBytes(const void* data, std::size_t size)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+    buffer_.insert(buffer_.end(), bytes, bytes + size);
+}
+
+template <typename T>
+void GLDeferredCommandBuffer::WriteCmd(const GLOpcode opcode, const T& cmd)
+{
+    WriteOpcode(opcode);
+    WriteBytes(&cmd, sizeof(T));
+}
+
+template <typename T>
+void GLDeferredCommandBuffer::WriteCmdArray(const GLOpcode opcode, std::uint32_t count, const T* data)
+{
+    WriteCmd(opcode, count);
+
+    /* Align array within the stream, so the executor can pass it on without copying */
+    buffer_.resize(GetAlignedSize(buffer_.size(), alignof(T)));
+    WriteBytes(data, sizeof(T) * count);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -1,14 +1,15 @@
 /*
- * GLCommandBuffer.cpp
+ * GLImmediateCommandBuffer.cpp
  * 
  * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
  * See "LICENSE.txt" for license information.
  */
 
-#include "GLCommandBuffer.h"
+#include "GLImmediateCommandBuffer.h"
 #include "GLRenderContext.h"
 #include "../GLCommon/GLTypes.h"
 #include "../GLCommon/GLCore.h"
+#include "../GLCommon/Texture/GLTexSubImage.h"
 #include "Ext/GLExtensions.h"
 #include "Ext/GLExtensionLoader.h"
 #include "../CheckedCast.h"
@@ -30,6 +31,8 @@
 #include "RenderState/GLResourceHeap.h"
 #include "RenderState/GLQuery.h"
 
+#include <stdexcept>
+
 
 namespace LLGL
 {
@@ -38,14 +41,19 @@ namespace LLGL
 // Maximal number of viewports for the GL renderer.
 static const std::uint32_t g_maxNumViewportsGL = 16;
 
-GLCommandBuffer::GLCommandBuffer(const std::shared_ptr<GLStateManager>& stateMngr) :
+GLImmediateCommandBuffer::GLImmediateCommandBuffer(const std::shared_ptr<GLStateManager>& stateMngr) :
     stateMngr_ { stateMngr }
 {
 }
 
+bool GLImmediateCommandBuffer::IsImmediateCmdBuffer() const
+{
+    return true;
+}
+
 /* ----- Configuration ----- */
 
-void GLCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
+void GLImmediateCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
 {
     if (stateDesc != nullptr && stateDescSize == sizeof(OpenGLDependentStateDescriptor))
     {
@@ -57,7 +65,7 @@ void GLCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::s
 
 /* ----- Viewport and Scissor ----- */
 
-void GLCommandBuffer::SetViewport(const Viewport& viewport)
+void GLImmediateCommandBuffer::SetViewport(const Viewport& viewport)
 {
     /* Setup GL viewport and depth-range */
     GLViewport viewportGL { viewport.x, viewport.y, viewport.width, viewport.height };
@@ -68,7 +76,7 @@ void GLCommandBuffer::SetViewport(const Viewport& viewport)
     stateMngr_->SetDepthRange(depthRangeGL);
 }
 
-void GLCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+void GLImmediateCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
     GLViewport viewportsGL[g_maxNumViewportsGL];
     GLDepthRange depthRangesGL[g_maxNumViewportsGL];
@@ -97,14 +105,14 @@ void GLCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* v
     }
 }
 
-void GLCommandBuffer::SetScissor(const Scissor& scissor)
+void GLImmediateCommandBuffer::SetScissor(const Scissor& scissor)
 {
     /* Setup and submit GL scissor to state manager */
     GLScissor scissorGL { scissor.x, scissor.y, scissor.width, scissor.height };
     stateMngr_->SetScissor(scissorGL);
 }
 
-void GLCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+void GLImmediateCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
     GLScissor scissorsGL[g_maxNumViewportsGL];
 
@@ -129,23 +137,23 @@ void GLCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scis
 
 /* ----- Clear ----- */
 
-void GLCommandBuffer::SetClearColor(const ColorRGBAf& color)
+void GLImmediateCommandBuffer::SetClearColor(const ColorRGBAf& color)
 {
     glClearColor(color.r, color.g, color.b, color.a);
 }
 
-void GLCommandBuffer::SetClearDepth(float depth)
+void GLImmediateCommandBuffer::SetClearDepth(float depth)
 {
     glClearDepth(depth);
 }
 
-void GLCommandBuffer::SetClearStencil(std::uint32_t stencil)
+void GLImmediateCommandBuffer::SetClearStencil(std::uint32_t stencil)
 {
     glClearStencil(static_cast<GLint>(stencil));
 }
 
 //TODO: maybe glColorMask must be set to (1, 1, 1, 1) to clear color correctly
-void GLCommandBuffer::Clear(long flags)
+void GLImmediateCommandBuffer::Clear(long flags)
 {
     /* Setup GL clear mask and clear respective buffer */
     GLbitfield mask = 0;
@@ -172,7 +180,7 @@ void GLCommandBuffer::Clear(long flags)
 }
 
 //TODO: maybe glColorMask must be set to (1, 1, 1, 1) to clear color correctly
-void GLCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+void GLImmediateCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
     for (; numAttachments-- > 0; ++attachments)
     {
@@ -209,23 +217,137 @@ void GLCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Attac
     }
 }
 
+/* ----- Copy ----- */
+
+void GLImmediateCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glNamedBufferSubData(
+            dstBufferGL.GetID(),
+            static_cast<GLintptr>(dstOffset),
+            static_cast<GLsizeiptr>(dataSize),
+            data
+        );
+    }
+    else
+    #endif
+    {
+        stateMngr_->BindBuffer(GLBufferTarget::COPY_WRITE_BUFFER, dstBufferGL.GetID());
+        glBufferSubData(
+            GL_COPY_WRITE_BUFFER,
+            static_cast<GLintptr>(dstOffset),
+            static_cast<GLsizeiptr>(dataSize),
+            data
+        );
+    }
+}
+
+void GLImmediateCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    auto& srcBufferGL = LLGL_CAST(GLBuffer&, srcBuffer);
+
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glCopyNamedBufferSubData(
+            srcBufferGL.GetID(),
+            dstBufferGL.GetID(),
+            static_cast<GLintptr>(srcOffset),
+            static_cast<GLintptr>(dstOffset),
+            static_cast<GLsizeiptr>(size)
+        );
+    }
+    else
+    #endif
+    {
+        stateMngr_->BindBuffer(GLBufferTarget::COPY_READ_BUFFER, srcBufferGL.GetID());
+        stateMngr_->BindBuffer(GLBufferTarget::COPY_WRITE_BUFFER, dstBufferGL.GetID());
+        glCopyBufferSubData(
+            GL_COPY_READ_BUFFER,
+            GL_COPY_WRITE_BUFFER,
+            static_cast<GLintptr>(srcOffset),
+            static_cast<GLintptr>(dstOffset),
+            static_cast<GLsizeiptr>(size)
+        );
+    }
+}
+
+void GLImmediateCommandBuffer::CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset)
+{
+    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
+    auto& srcBufferGL = LLGL_CAST(GLBuffer&, srcBuffer);
+
+    /* Determine image format that matches the hardware format of the texture */
+    Format format = Format::Undefined;
+    GLTypes::Unmap(format, dstTextureGL.QueryGLInternalFormat());
+
+    SrcImageDescriptor imageDesc;
+    if (!FindSuitableImageFormat(format, imageDesc.format, imageDesc.dataType))
+        throw std::runtime_error("cannot copy buffer to GL texture with unsupported hardware format");
+
+    const auto numTexels = dstRegion.extent.width * dstRegion.extent.height * dstRegion.extent.depth;
+
+    /* With a bound pixel unpack buffer, the image data pointer is interpreted as offset into that buffer */
+    imageDesc.data      = reinterpret_cast<const void*>(static_cast<GLintptr>(srcOffset));
+    imageDesc.dataSize  = TextureBufferSize(format, numTexels);
+
+    stateMngr_->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, srcBufferGL.GetID());
+    {
+        stateMngr_->BindTexture(dstTextureGL);
+        GLTexSubImage(dstTextureGL.GetType(), dstRegion, imageDesc);
+    }
+    stateMngr_->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+}
+
+void GLImmediateCommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    #ifndef __APPLE__
+    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
+    auto& srcTextureGL = LLGL_CAST(GLTexture&, srcTexture);
+    glCopyImageSubData(
+        srcTextureGL.GetID(),
+        GLTypes::Map(srcTextureGL.GetType()),
+        static_cast<GLint>(srcMipLevel),
+        srcOffset.x,
+        srcOffset.y,
+        srcOffset.z,
+        dstTextureGL.GetID(),
+        GLTypes::Map(dstTextureGL.GetType()),
+        static_cast<GLint>(dstRegion.mipLevel),
+        dstRegion.offset.x,
+        dstRegion.offset.y,
+        dstRegion.offset.z,
+        static_cast<GLsizei>(dstRegion.extent.width),
+        static_cast<GLsizei>(dstRegion.extent.height),
+        static_cast<GLsizei>(dstRegion.extent.depth)
+    );
+    #else
+    ErrUnsupportedGLProc("glCopyImageSubData");
+    #endif
+}
+
 /* ----- Input Assembly ------ */
 
-void GLCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     /* Bind vertex buffer */
     auto& vertexBufferGL = LLGL_CAST(GLVertexBuffer&, buffer);
     stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
 }
 
-void GLCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
     /* Bind vertex buffer */
     auto& vertexBufferArrayGL = LLGL_CAST(GLVertexBufferArray&, bufferArray);
     stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
 }
 
-void GLCommandBuffer::SetIndexBuffer(Buffer& buffer)
+void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     /* Bind index buffer deferred (can only be bound to the active VAO) */
     auto& indexBufferGL = LLGL_CAST(GLIndexBuffer&, buffer);
@@ -239,26 +361,26 @@ void GLCommandBuffer::SetIndexBuffer(Buffer& buffer)
 
 /* ----- Constant Buffers ------ */
 
-void GLCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
+void GLImmediateCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
 {
     SetGenericBuffer(GLBufferTarget::UNIFORM_BUFFER, buffer, slot);
 }
 
 /* ----- Storage Buffers ------ */
 
-void GLCommandBuffer::SetStorageBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
+void GLImmediateCommandBuffer::SetStorageBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
 {
     SetGenericBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, buffer, slot);
 }
 
 /* ----- Stream Output Buffers ------ */
 
-void GLCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+void GLImmediateCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
 {
     SetGenericBuffer(GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER, buffer, 0);
 }
 
-void GLCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+void GLImmediateCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
 {
     SetGenericBufferArray(GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER, bufferArray, 0);
 }
@@ -273,7 +395,7 @@ static void ErrTransformFeedbackNotSupported(const char* funcName)
 
 #endif
 
-void GLCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
+void GLImmediateCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
 {
     #ifdef __APPLE__
     glBeginTransformFeedback(GLTypes::Map(primitiveType));
@@ -287,7 +409,7 @@ void GLCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
     #endif
 }
 
-void GLCommandBuffer::EndStreamOutput()
+void GLImmediateCommandBuffer::EndStreamOutput()
 {
     #ifdef __APPLE__
     glEndTransformFeedback();
@@ -303,7 +425,7 @@ void GLCommandBuffer::EndStreamOutput()
 
 /* ----- Textures ----- */
 
-void GLCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long /*stageFlags*/)
+void GLImmediateCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long /*stageFlags*/)
 {
     /* Bind texture to layer */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
@@ -313,7 +435,7 @@ void GLCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long /*st
 
 /* ----- Sampler States ----- */
 
-void GLCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long /*stageFlags*/)
+void GLImmediateCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long /*stageFlags*/)
 {
     auto& samplerGL = LLGL_CAST(GLSampler&, sampler);
     stateMngr_->BindSampler(slot, samplerGL.GetID());
@@ -321,12 +443,12 @@ void GLCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long /*st
 
 /* ----- Resource Heaps ----- */
 
-void GLCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/)
+void GLImmediateCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/)
 {
     SetResourceHeap(resourceHeap);
 }
 
-void GLCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/)
+void GLImmediateCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/)
 {
     SetResourceHeap(resourceHeap);
 }
@@ -334,13 +456,13 @@ void GLCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::ui
 /* ----- Render Targets ----- */
 
 //private
-void GLCommandBuffer::BlitBoundRenderTarget()
+void GLImmediateCommandBuffer::BlitBoundRenderTarget()
 {
     if (boundRenderTarget_)
         boundRenderTarget_->BlitOntoFramebuffer();
 }
 
-void GLCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+void GLImmediateCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
 {
     /* Blit previously bound render target (in case mutli-sampling is used) */
     BlitBoundRenderTarget();
@@ -358,7 +480,7 @@ void GLCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
     //TODO: maybe use 'glClipControl(GL_UPPER_LEFT, GL_ZERO_TO_ONE)' to allow better compatibility to D3D
 }
 
-void GLCommandBuffer::SetRenderTarget(RenderContext& renderContext)
+void GLImmediateCommandBuffer::SetRenderTarget(RenderContext& renderContext)
 {
     auto& renderContextGL = LLGL_CAST(GLRenderContext&, renderContext);
 
@@ -382,39 +504,53 @@ void GLCommandBuffer::SetRenderTarget(RenderContext& renderContext)
 
 /* ----- Pipeline States ----- */
 
-void GLCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+void GLImmediateCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 {
     /* Set graphics pipeline render states */
     auto& graphicsPipelineGL = LLGL_CAST(GLGraphicsPipeline&, graphicsPipeline);
+
+    const auto numIssued    = stateMngr_->GetNumStateGroupsIssued();
+    const auto numSkipped   = stateMngr_->GetNumStateGroupsSkipped();
+
     graphicsPipelineGL.Bind(*stateMngr_);
 
+    /* Accumulate state changes of this command buffer only, since the state manager is shared by all command buffers of the GL context */
+    stateChangeStats_.issuedStateChanges    += (stateMngr_->GetNumStateGroupsIssued() - numIssued);
+    stateChangeStats_.skippedStateChanges   += (stateMngr_->GetNumStateGroupsSkipped() - numSkipped);
+
     /* Store draw modes */
     renderState_.drawMode = graphicsPipelineGL.GetDrawMode();
 }
 
-void GLCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+void GLImmediateCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
 {
     auto& computePipelineGL = LLGL_CAST(GLComputePipeline&, computePipeline);
     computePipelineGL.Bind(*stateMngr_);
 }
 
+bool GLImmediateCommandBuffer::QueryStateChangeStatistics(StateChangeStatistics& statistics) const
+{
+    statistics = stateChangeStats_;
+    return true;
+}
+
 /* ----- Queries ----- */
 
-void GLCommandBuffer::BeginQuery(Query& query)
+void GLImmediateCommandBuffer::BeginQuery(Query& query)
 {
     /* Begin query with internal target */
     auto& queryGL = LLGL_CAST(GLQuery&, query);
     queryGL.Begin();
 }
 
-void GLCommandBuffer::EndQuery(Query& query)
+void GLImmediateCommandBuffer::EndQuery(Query& query)
 {
     /* Begin query with internal target */
     auto& queryGL = LLGL_CAST(GLQuery&, query);
     queryGL.End();
 }
 
-bool GLCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
+bool GLImmediateCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
 {
     auto& queryGL = LLGL_CAST(GLQuery&, query);
 
@@ -442,7 +578,7 @@ bool GLCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
     return false;
 }
 
-bool GLCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result)
+bool GLImmediateCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result)
 {
     auto& queryGL = LLGL_CAST(GLQuery&, query);
 
@@ -515,13 +651,13 @@ bool GLCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineS
     return true;
 }
 
-void GLCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
+void GLImmediateCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
 {
     auto& queryGL = LLGL_CAST(GLQuery&, query);
     glBeginConditionalRender(queryGL.GetFirstID(), GLTypes::Map(mode));
 }
 
-void GLCommandBuffer::EndRenderCondition()
+void GLImmediateCommandBuffer::EndRenderCondition()
 {
     glEndConditionalRender();
 }
@@ -534,7 +670,7 @@ In the following Draw* functions, 'indices' is from type 'GLsizeiptr' to have th
 The indices actually store the index start offset, but must be passed to GL as a void-pointer, due to an obsolete API.
 */
 
-void GLCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
     glDrawArrays(
         renderState_.drawMode,
@@ -543,7 +679,7 @@ void GLCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
     );
 }
 
-void GLCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
     glDrawElements(
@@ -554,7 +690,7 @@ void GLCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstI
     );
 }
 
-void GLCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
     glDrawElementsBaseVertex(
@@ -566,7 +702,7 @@ void GLCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstI
     );
 }
 
-void GLCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
     glDrawArraysInstanced(
         renderState_.drawMode,
@@ -576,7 +712,7 @@ void GLCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fir
     );
 }
 
-void GLCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
     #ifndef __APPLE__
     glDrawArraysInstancedBaseInstance(
@@ -591,7 +727,7 @@ void GLCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fir
     #endif
 }
 
-void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
     glDrawElementsInstanced(
@@ -603,7 +739,7 @@ void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
     );
 }
 
-void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     auto indices = static_cast<GLsizeiptr>(firstIndex * renderState_.indexBufferStride);
     glDrawElementsInstancedBaseVertex(
@@ -616,7 +752,7 @@ void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
     );
 }
 
-void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
     #ifndef __APPLE__
     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
@@ -634,28 +770,156 @@ void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
     #endif
 }
 
+void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    BindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+    glDrawArraysIndirect(
+        renderState_.drawMode,
+        reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset))
+    );
+}
+
+void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    BindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+
+    #ifndef __APPLE__
+    if (HasExtension(GLExt::ARB_multi_draw_indirect))
+    {
+        glMultiDrawArraysIndirect(
+            renderState_.drawMode,
+            reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset)),
+            static_cast<GLsizei>(numCommands),
+            static_cast<GLsizei>(stride)
+        );
+    }
+    else
+    #endif
+    {
+        /* Emulate multi-draw-indirect with a sequence of single indirect draw commands */
+        for (; numCommands-- > 0; offset += stride)
+        {
+            glDrawArraysIndirect(
+                renderState_.drawMode,
+                reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset))
+            );
+        }
+    }
+}
+
+void GLImmediateCommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifndef __APPLE__
+    if (!HasExtension(GLExt::ARB_indirect_parameters))
+        ThrowRenderingFeatureNotSupportedExcept(__FUNCTION__, "hasIndirectCountDrawing");
+
+    BindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+    BindIndirectBuffer(GLBufferTarget::PARAMETER_BUFFER, countBuffer);
+    glMultiDrawArraysIndirectCountARB(
+        renderState_.drawMode,
+        reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset)),
+        static_cast<GLintptr>(countOffset),
+        static_cast<GLsizei>(maxNumCommands),
+        static_cast<GLsizei>(stride)
+    );
+    #else
+    ErrUnsupportedGLProc("glMultiDrawArraysIndirectCountARB");
+    #endif
+}
+
+void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    BindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+    glDrawElementsIndirect(
+        renderState_.drawMode,
+        renderState_.indexBufferDataType,
+        reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset))
+    );
+}
+
+void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    BindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+
+    #ifndef __APPLE__
+    if (HasExtension(GLExt::ARB_multi_draw_indirect))
+    {
+        glMultiDrawElementsIndirect(
+            renderState_.drawMode,
+            renderState_.indexBufferDataType,
+            reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset)),
+            static_cast<GLsizei>(numCommands),
+            static_cast<GLsizei>(stride)
+        );
+    }
+    else
+    #endif
+    {
+        /* Emulate multi-draw-indirect with a sequence of single indirect draw commands */
+        for (; numCommands-- > 0; offset += stride)
+        {
+            glDrawElementsIndirect(
+                renderState_.drawMode,
+                renderState_.indexBufferDataType,
+                reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset))
+            );
+        }
+    }
+}
+
+void GLImmediateCommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifndef __APPLE__
+    if (!HasExtension(GLExt::ARB_indirect_parameters))
+        ThrowRenderingFeatureNotSupportedExcept(__FUNCTION__, "hasIndirectCountDrawing");
+
+    BindIndirectBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+    BindIndirectBuffer(GLBufferTarget::PARAMETER_BUFFER, countBuffer);
+    glMultiDrawElementsIndirectCountARB(
+        renderState_.drawMode,
+        renderState_.indexBufferDataType,
+        reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset)),
+        static_cast<GLintptr>(countOffset),
+        static_cast<GLsizei>(maxNumCommands),
+        static_cast<GLsizei>(stride)
+    );
+    #else
+    ErrUnsupportedGLProc("glMultiDrawElementsIndirectCountARB");
+    #endif
+}
+
 /* ----- Compute ----- */
 
-void GLCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
+void GLImmediateCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
 {
     #ifndef __APPLE__
     glDispatchCompute(groupSizeX, groupSizeY, groupSizeZ);
     #endif
 }
 
+void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    #ifndef __APPLE__
+    BindIndirectBuffer(GLBufferTarget::DISPATCH_INDIRECT_BUFFER, buffer);
+    glDispatchComputeIndirect(static_cast<GLintptr>(offset));
+    #else
+    ErrUnsupportedGLProc("glDispatchComputeIndirect");
+    #endif
+}
+
 
 /*
  * ======= Private: =======
  */
 
-void GLCommandBuffer::SetGenericBuffer(const GLBufferTarget bufferTarget, Buffer& buffer, std::uint32_t slot)
+void GLImmediateCommandBuffer::SetGenericBuffer(const GLBufferTarget bufferTarget, Buffer& buffer, std::uint32_t slot)
 {
     /* Bind buffer with BindBufferBase */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBufferBase(bufferTarget, slot, bufferGL.GetID());
 }
 
-void GLCommandBuffer::SetGenericBufferArray(const GLBufferTarget bufferTarget, BufferArray& bufferArray, std::uint32_t startSlot)
+void GLImmediateCommandBuffer::SetGenericBufferArray(const GLBufferTarget bufferTarget, BufferArray& bufferArray, std::uint32_t startSlot)
 {
     /* Bind buffers with BindBuffersBase */
     auto& bufferArrayGL = LLGL_CAST(GLBufferArray&, bufferArray);
@@ -667,7 +931,13 @@ void GLCommandBuffer::SetGenericBufferArray(const GLBufferTarget bufferTarget, B
     );
 }
 
-void GLCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
+void GLImmediateCommandBuffer::BindIndirectBuffer(const GLBufferTarget bufferTarget, Buffer& buffer)
+{
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBuffer(bufferTarget, bufferGL.GetID());
+}
+
+void GLImmediateCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
 {
     auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
     resourceHeapGL.Bind(*stateMngr_);
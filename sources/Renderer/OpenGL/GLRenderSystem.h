@@ -14,14 +14,18 @@
 #include "../ContainerTypes.h"
 
 #include "GLCommandQueue.h"
-#include "GLCommandBuffer.h"
+#include "GLImmediateCommandBuffer.h"
+#include "GLDeferredCommandBuffer.h"
 #include "GLRenderContext.h"
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
+#include "Buffer/GLStreamingRingBuffer.h"
+#include "Texture/GLTextureReadbackRing.h"
 
 #include "Shader/GLShader.h"
 #include "Shader/GLShaderProgram.h"
+#include "Shader/GLProgramBinaryCache.h"
 
 #include "Texture/GLTexture.h"
 #include "Texture/GLSampler.h"
@@ -30,6 +34,7 @@
 #include "RenderState/GLQuery.h"
 #include "RenderState/GLFence.h"
 #include "RenderState/GLPipelineLayout.h"
+#include "RenderState/GLPipelineCache.h"
 #include "RenderState/GLGraphicsPipeline.h"
 #include "RenderState/GLComputePipeline.h"
 #include "RenderState/GLResourceHeap.h"
@@ -54,6 +59,8 @@ class GLRenderSystem final : public RenderSystem
 
         /* ----- Common ----- */
 
+        GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
+
         void SetConfiguration(const RenderSystemConfiguration& config) override;
 
         /* ----- Render Context ----- */
@@ -95,6 +102,9 @@ class GLRenderSystem final : public RenderSystem
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        bool QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait = false) override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
 
@@ -130,6 +140,12 @@ class GLRenderSystem final : public RenderSystem
 
         void Release(PipelineLayout& pipelineLayout) override;
 
+        /* ----- Pipeline Caches ----- */
+
+        PipelineCache* CreatePipelineCache(const void* initialBlob = nullptr, std::size_t initialBlobSize = 0) override;
+
+        void Release(PipelineCache& pipelineCache) override;
+
         /* ----- Pipeline States ----- */
 
         GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
@@ -164,6 +180,18 @@ class GLRenderSystem final : public RenderSystem
 
         GLRenderContext* GetSharedRenderContext() const;
 
+        // Returns the streaming ring buffer (created on first use), or null if it is not supported.
+        GLStreamingRingBuffer* GetStreamingRingBuffer();
+
+        // Returns the streaming ring buffer for texture uploads (created on first use), or null if it is not supported.
+        GLStreamingRingBuffer* GetTextureStreamingRingBuffer();
+
+        /*
+        Copies the specified image data into the texture streaming ring buffer and binds it as GL_PIXEL_UNPACK_BUFFER.
+        The data pointer of 'streamImageDesc' is set to the offset within the ring buffer. Returns false if the ring buffer cannot be used.
+        */
+        bool StreamTextureImage(const SrcImageDescriptor& imageDesc, std::size_t dataSize, SrcImageDescriptor& streamImageDesc);
+
         void GenerateMipsPrimary(GLuint texID, const TextureType texType);
         void GenerateSubMipsWithFBO(GLTexture& textureGL, const Extent3D& extent, GLint baseMipLevel, GLint numMipLevels, GLint baseArrayLayer, GLint numArrayLayers);
         void GenerateSubMipsWithTextureView(GLTexture& textureGL, GLuint baseMipLevel, GLuint numMipLevels, GLuint baseArrayLayer, GLuint numArrayLayers);
@@ -193,6 +221,7 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLShader>             shaders_;
         HWObjectContainer<GLShaderProgram>      shaderPrograms_;
         HWObjectContainer<GLPipelineLayout>     pipelineLayouts_;
+        HWObjectContainer<GLPipelineCache>      pipelineCaches_;
         HWObjectContainer<GLGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<GLComputePipeline>    computePipelines_;
         HWObjectContainer<GLResourceHeap>       resourceHeaps_;
@@ -201,6 +230,17 @@ class GLRenderSystem final : public RenderSystem
 
         DebugCallback                           debugCallback_;
 
+        std::unique_ptr<GLProgramBinaryCache>   programBinaryCache_;
+        bool                                    deferredCommandBuffers_ = false;
+
+        std::unique_ptr<GLStreamingRingBuffer>  streamingRingBuffer_;
+        std::size_t                             streamingBufferSize_        = 0;
+
+        std::unique_ptr<GLStreamingRingBuffer>  textureStreamingRingBuffer_;
+        std::size_t                             textureStreamingBufferSize_ = 0;
+
+        GLTextureReadbackRing                   textureReadbackRing_;
+
         #ifdef LLGL_ENABLE_CUSTOM_SUB_MIPGEN
         MipGenerationFBOPair                    mipGenerationFBOPair_;
         #endif // /LLGL_ENABLE_CUSTOM_SUB_MIPGEN
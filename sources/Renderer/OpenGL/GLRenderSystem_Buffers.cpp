@@ -42,7 +42,11 @@ static GLbitfield GetGLBufferFlags(long flags)
 
 static GLenum GetGLBufferUsage(long flags)
 {
-    return ((flags & BufferFlags::DynamicUsage) != 0 ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    if ((flags & BufferFlags::StreamingUsage) != 0)
+        return GL_STREAM_DRAW;
+    if ((flags & BufferFlags::DynamicUsage) != 0)
+        return GL_DYNAMIC_DRAW;
+    return GL_STATIC_DRAW;
 }
 
 static GLenum GetGLBufferTarget(const GLBuffer& bufferGL)
@@ -52,6 +56,10 @@ static GLenum GetGLBufferTarget(const GLBuffer& bufferGL)
 
 static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& desc, const void* initialData)
 {
+    /* Update buffers with streaming usage through the persistently mapped ring buffer */
+    if ((desc.flags & BufferFlags::StreamingUsage) != 0 && GLStreamingRingBuffer::IsSupported())
+        bufferGL.EnableStreaming(static_cast<GLsizeiptr>(desc.size));
+
     #ifdef GL_ARB_buffer_storage
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
@@ -151,6 +159,14 @@ void GLRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t d
 {
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
 
+    /* Write data through the streaming ring buffer (falls back to regular update if the data exceeds a ring buffer region) */
+    if (bufferGL.IsStreaming())
+    {
+        auto ringBuffer = GetStreamingRingBuffer();
+        if (ringBuffer != nullptr && ringBuffer->WriteBuffer(bufferGL, static_cast<GLintptr>(offset), data, static_cast<GLsizeiptr>(dataSize)))
+            return;
+    }
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -178,6 +194,23 @@ void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
 
+    /*
+    Map write-discard access to a range of the streaming ring buffer, which is copied into the buffer when it is unmapped.
+    This is only valid if the previous content is discarded, because the range does not contain the current buffer content.
+    */
+    if (bufferGL.IsStreaming() && access == CPUAccess::WriteDiscard)
+    {
+        if (auto ringBuffer = GetStreamingRingBuffer())
+        {
+            GLintptr offset = 0;
+            if (auto data = ringBuffer->Allocate(bufferGL.GetStreamingSize(), offset))
+            {
+                bufferGL.SetStreamingMapOffset(offset);
+                return data;
+            }
+        }
+    }
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -195,6 +228,15 @@ void GLRenderSystem::UnmapBuffer(Buffer& buffer)
 {
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
 
+    /* Copy mapped range of the streaming ring buffer into the buffer */
+    const auto streamingMapOffset = bufferGL.GetStreamingMapOffset();
+    if (streamingMapOffset >= 0)
+    {
+        bufferGL.SetStreamingMapOffset(-1);
+        GetStreamingRingBuffer()->CopyToBuffer(bufferGL, streamingMapOffset, 0, bufferGL.GetStreamingSize());
+        return;
+    }
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -209,6 +251,18 @@ void GLRenderSystem::UnmapBuffer(Buffer& buffer)
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+GLStreamingRingBuffer* GLRenderSystem::GetStreamingRingBuffer()
+{
+    if (!streamingRingBuffer_ && streamingBufferSize_ > 0 && GLStreamingRingBuffer::IsSupported())
+        streamingRingBuffer_ = MakeUnique<GLStreamingRingBuffer>(static_cast<GLsizeiptr>(streamingBufferSize_));
+    return streamingRingBuffer_.get();
+}
+
+
 } // /namespace LLGL
 
 
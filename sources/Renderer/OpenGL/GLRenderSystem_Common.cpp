@@ -22,6 +22,34 @@ namespace LLGL
 
 /* ----- Render System ----- */
 
+GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
+{
+    /* Extract optional renderer configuartion */
+    if (renderSystemDesc.rendererConfig != nullptr && renderSystemDesc.rendererConfigSize > 0)
+    {
+        if (renderSystemDesc.rendererConfigSize != sizeof(OpenGLRendererConfiguration))
+            throw std::invalid_argument("invalid renderer configuration structure (expected size of 'OpenGLRendererConfiguration' structure)");
+
+        auto rendererConfigGL = reinterpret_cast<const OpenGLRendererConfiguration*>(renderSystemDesc.rendererConfig);
+
+        /* Create program binary cache if a cache directory or callbacks are specified */
+        if ( !rendererConfigGL->programCacheDirectory.empty() ||
+             (rendererConfigGL->loadProgramBinary && rendererConfigGL->storeProgramBinary) )
+        {
+            programBinaryCache_ = MakeUnique<GLProgramBinaryCache>(*rendererConfigGL);
+        }
+
+        deferredCommandBuffers_ = rendererConfigGL->deferredCommandBuffers;
+        streamingBufferSize_        = rendererConfigGL->streamingBufferSize;
+        textureStreamingBufferSize_ = rendererConfigGL->textureStreamingBufferSize;
+    }
+    else
+    {
+        streamingBufferSize_        = OpenGLRendererConfiguration{}.streamingBufferSize;
+        textureStreamingBufferSize_ = OpenGLRendererConfiguration{}.textureStreamingBufferSize;
+    }
+}
+
 void GLRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
 {
     RenderSystem::SetConfiguration(config);
@@ -64,7 +92,12 @@ CommandBufferExt* GLRenderSystem::CreateCommandBufferExt()
 {
     /* Get state manager from shared render context */
     if (auto sharedContext = GetSharedRenderContext())
-        return TakeOwnership(commandBuffers_, MakeUnique<GLCommandBuffer>(sharedContext->GetStateManager()));
+    {
+        if (deferredCommandBuffers_)
+            return TakeOwnership(commandBuffers_, MakeUnique<GLDeferredCommandBuffer>(sharedContext->GetStateManager()));
+        else
+            return TakeOwnership(commandBuffers_, MakeUnique<GLImmediateCommandBuffer>(sharedContext->GetStateManager()));
+    }
     else
         throw std::runtime_error("cannot create OpenGL command buffer without active render context");
 }
@@ -155,7 +188,7 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& desc)
 ShaderProgram* GLRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
 {
     AssertCreateShaderProgram(desc);
-    return TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(desc));
+    return TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(desc, programBinaryCache_.get()));
 }
 
 void GLRenderSystem::Release(Shader& shader)
@@ -181,6 +214,18 @@ void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* GLRenderSystem::CreatePipelineCache(const void* initialBlob, std::size_t initialBlobSize)
+{
+    return TakeOwnership(pipelineCaches_, MakeUnique<GLPipelineCache>(initialBlob, initialBlobSize));
+}
+
+void GLRenderSystem::Release(PipelineCache& pipelineCache)
+{
+    RemoveFromUniqueSet(pipelineCaches_, &pipelineCache);
+}
+
 /* ----- Pipeline States ----- */
 
 GraphicsPipeline* GLRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
@@ -266,6 +311,12 @@ void GLRenderSystem::LoadGLExtensions(const ProfileOpenGLDescriptor& profileDesc
         auto extensions = QueryExtensions(coreProfile);
         LoadAllExtensions(extensions, coreProfile);
 
+        /* Let the driver compile and link shaders on its own worker threads */
+        #ifndef __APPLE__
+        if (HasExtension(GLExt::KHR_parallel_shader_compile))
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        #endif
+
         /* Query and store all renderer information and capabilities */
         QueryRendererInfo();
         QueryRenderingCaps();
@@ -13,6 +13,7 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include "../../Core/Assertion.h"
+#include <string.h>
 
 
 namespace LLGL
@@ -29,10 +30,31 @@ static GLint GetGlTextureMinFilter(const TextureDescriptor& textureDesc)
         return GL_LINEAR;
 }
 
+// Returns the size (in bytes) that is read from the specified source image with the specified number of texels.
+static std::size_t GetSrcImageDataSize(const SrcImageDescriptor& imageDesc, std::uint32_t numTexels)
+{
+    if (IsCompressedFormat(imageDesc.format))
+        return imageDesc.dataSize;
+    else
+        return ImageDataSize(imageDesc.format, imageDesc.dataType, numTexels);
+}
+
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
     auto texture = MakeUnique<GLTexture>(textureDesc.type);
 
+    /* Upload initial image data from the texture streaming ring buffer if possible (compressed cube faces are not streamed) */
+    SrcImageDescriptor streamImageDesc;
+    const bool streaming =
+    (
+        imageDesc != nullptr &&
+        !IsCompressedFormat(textureDesc.format) &&
+        StreamTextureImage(*imageDesc, GetSrcImageDataSize(*imageDesc, TextureSize(textureDesc)), streamImageDesc)
+    );
+
+    if (streaming)
+        imageDesc = &streamImageDesc;
+
     /* Bind texture */
     GLStateManager::active->BindTexture(*texture);
 
@@ -93,6 +115,9 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             break;
     }
 
+    if (streaming)
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+
     return TakeOwnership(textures_, std::move(texture));
 }
 
@@ -106,6 +131,13 @@ void GLRenderSystem::Release(Texture& texture)
 
 void GLRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc)
 {
+    /* Upload image data from the texture streaming ring buffer if possible, so the driver does not copy from client memory synchronously */
+    const auto numTexels = subTextureDesc.extent.width * subTextureDesc.extent.height * subTextureDesc.extent.depth;
+
+    SrcImageDescriptor streamImageDesc;
+    const bool streaming = StreamTextureImage(imageDesc, GetSrcImageDataSize(imageDesc, numTexels), streamImageDesc);
+    const auto& srcImageDesc = (streaming ? streamImageDesc : imageDesc);
+
     /* Bind texture and write texture sub data */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
     GLStateManager::active->BindTexture(textureGL);
@@ -114,41 +146,44 @@ void GLRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor&
     switch (texture.GetType())
     {
         case TextureType::Texture1D:
-            GLTexSubImage1D(subTextureDesc, imageDesc);
+            GLTexSubImage1D(subTextureDesc, srcImageDesc);
             break;
 
         case TextureType::Texture2D:
-            GLTexSubImage2D(subTextureDesc, imageDesc);
+            GLTexSubImage2D(subTextureDesc, srcImageDesc);
             break;
 
         case TextureType::Texture3D:
             LLGL_ASSERT_FEATURE_SUPPORT(has3DTextures);
-            GLTexSubImage3D(subTextureDesc, imageDesc);
+            GLTexSubImage3D(subTextureDesc, srcImageDesc);
             break;
 
         case TextureType::TextureCube:
             LLGL_ASSERT_FEATURE_SUPPORT(hasCubeTextures);
-            GLTexSubImageCube(subTextureDesc, imageDesc);
+            GLTexSubImageCube(subTextureDesc, srcImageDesc);
             break;
 
         case TextureType::Texture1DArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexSubImage1DArray(subTextureDesc, imageDesc);
+            GLTexSubImage1DArray(subTextureDesc, srcImageDesc);
             break;
 
         case TextureType::Texture2DArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexSubImage2DArray(subTextureDesc, imageDesc);
+            GLTexSubImage2DArray(subTextureDesc, srcImageDesc);
             break;
 
         case TextureType::TextureCubeArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasCubeArrayTextures);
-            GLTexSubImageCubeArray(subTextureDesc, imageDesc);
+            GLTexSubImageCubeArray(subTextureDesc, srcImageDesc);
             break;
 
         default:
             break;
     }
+
+    if (streaming)
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
 }
 
 void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
@@ -185,6 +220,18 @@ void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel,
     }
 }
 
+std::uint64_t GLRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+    return textureReadbackRing_.ReadTexture(textureGL, mipLevel);
+}
+
+bool GLRenderSystem::QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait)
+{
+    LLGL_ASSERT_PTR(imageDesc.data);
+    return textureReadbackRing_.QueryResult(ticket, imageDesc.data, imageDesc.dataSize, wait);
+}
+
 void GLRenderSystem::GenerateMips(Texture& texture)
 {
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
@@ -250,6 +297,50 @@ void GLRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
  * ======= Private: =======
  */
 
+// Minimal offset within the texture streaming ring buffer, since offset 0 would be interpreted as null pointer (i.e. no image data).
+// This must be a multiple of the largest pixel data type size.
+static const GLintptr g_minPixelUnpackOffset = 16;
+
+GLStreamingRingBuffer* GLRenderSystem::GetTextureStreamingRingBuffer()
+{
+    if (!textureStreamingRingBuffer_ && textureStreamingBufferSize_ > 0 && GLStreamingRingBuffer::IsSupported())
+        textureStreamingRingBuffer_ = MakeUnique<GLStreamingRingBuffer>(static_cast<GLsizeiptr>(textureStreamingBufferSize_));
+    return textureStreamingRingBuffer_.get();
+}
+
+bool GLRenderSystem::StreamTextureImage(const SrcImageDescriptor& imageDesc, std::size_t dataSize, SrcImageDescriptor& streamImageDesc)
+{
+    /* Image data must provide at least as many bytes as GL will read from the pixel unpack buffer */
+    if (imageDesc.data == nullptr || dataSize == 0 || imageDesc.dataSize < dataSize)
+        return false;
+
+    if (auto ringBuffer = GetTextureStreamingRingBuffer())
+    {
+        GLintptr offset = 0;
+        if (auto dst = ringBuffer->Allocate(static_cast<GLsizeiptr>(dataSize) + g_minPixelUnpackOffset, offset))
+        {
+            if (offset == 0)
+            {
+                offset  += g_minPixelUnpackOffset;
+                dst     += g_minPixelUnpackOffset;
+            }
+
+            /* Memory is coherent, so no explicit flush is required before the texture upload */
+            ::memcpy(dst, imageDesc.data, dataSize);
+
+            streamImageDesc             = imageDesc;
+            streamImageDesc.data        = reinterpret_cast<const void*>(offset);
+            streamImageDesc.dataSize    = dataSize;
+
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, ringBuffer->GetID());
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void GLRenderSystem::GenerateMipsPrimary(GLuint texID, const TextureType texType)
 {
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
@@ -250,6 +250,9 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasConservativeRasterization   = ( HasExtension(GLExt::NV_conservative_raster) || HasExtension(GLExt::INTEL_conservative_rasterization) );
     features.hasStreamOutputs               = ( HasExtension(GLExt::EXT_transform_feedback) || HasExtension(GLExt::NV_transform_feedback) );
     features.hasLogicOp                     = true;
+    features.hasIndirectDrawing             = HasExtension(GLExt::ARB_draw_indirect);
+    features.hasIndirectCountDrawing        = HasExtension(GLExt::ARB_indirect_parameters);
+    features.hasTimestampQueries            = HasExtension(GLExt::ARB_timer_query);
 }
 
 static void GLGetFeatureLimits(RenderingLimits& limits)
@@ -289,6 +292,13 @@ static void GLGetFeatureLimits(RenderingLimits& limits)
     /* Set maximum buffer size to maximum value for <GLsizei> (used in 'glBufferData') */
     limits.maxBufferSize          = static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max());
     limits.maxConstantBufferSize  = static_cast<std::uint64_t>(GLGetUInt(GL_MAX_UNIFORM_BLOCK_SIZE));
+
+    /* Query alignment for offsets within uniform buffers (used in 'glBindBufferRange') */
+    limits.minConstantBufferOffsetAlignment = static_cast<std::uint64_t>(GLGetUInt(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT));
+
+    /* Query alignment for offsets within shader storage buffers */
+    if (HasExtension(GLExt::ARB_shader_storage_buffer_object))
+        limits.minStorageBufferOffsetAlignment = static_cast<std::uint64_t>(GLGetUInt(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT));
 }
 
 static void GLGetTextureLimits(const RenderingFeatures& features, RenderingLimits& limits)
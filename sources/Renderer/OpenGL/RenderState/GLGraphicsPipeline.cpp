@@ -11,6 +11,7 @@
 #include "../../GLCommon/GLCore.h"
 #include "../../CheckedCast.h"
 #include <LLGL/GraphicsPipelineFlags.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -44,14 +45,6 @@ static void Convert(GLBlend& to, const BlendTargetDescriptor& from)
     to.colorMask.a  = GLBoolean(from.colorMask.a);
 }
 
-template <typename DstType, typename SrcType>
-void Convert(std::vector<DstType>& to, const std::vector<SrcType>& from)
-{
-    to.resize(from.size());
-    for (std::size_t i = 0, n = from.size(); i < n; ++i)
-        Convert(to[i], from[i]);
-}
-
 static bool IsBlendColorNeeded(const BlendOp blendOp)
 {
     return (blendOp == BlendOp::BlendFactor || blendOp == BlendOp::InvBlendFactor);
@@ -126,47 +119,65 @@ GLGraphicsPipeline::GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, c
         patchVertices_ = 0;
 
     /* Convert depth state */
-    depthTestEnabled_       = desc.depth.testEnabled;
-    depthMask_              = (desc.depth.writeEnabled ? GL_TRUE : GL_FALSE);
-    depthFunc_              = GLTypes::Map(desc.depth.compareOp);
+    auto& depth = stateBlock_.depth;
+    depth.testEnabled                   = GLBoolean(desc.depth.testEnabled);
+    depth.writeMask                     = GLBoolean(desc.depth.writeEnabled);
+    if (desc.depth.testEnabled)
+        depth.func                      = GLTypes::Map(desc.depth.compareOp);
 
     /* Convert stencil state */
-    stencilTestEnabled_     = desc.stencil.testEnabled;
-    Convert(stencilFront_, desc.stencil.front);
-    Convert(stencilBack_, desc.stencil.back);
+    auto& stencil = stateBlock_.stencil;
+    stencil.testEnabled                 = GLBoolean(desc.stencil.testEnabled);
+    if (desc.stencil.testEnabled)
+    {
+        Convert(stencil.front, desc.stencil.front);
+        Convert(stencil.back, desc.stencil.back);
+    }
 
     /* Convert rasterizer state */
-    polygonMode_            = GLTypes::Map(desc.rasterizer.polygonMode);
-    cullFace_               = GLTypes::Map(desc.rasterizer.cullMode);
-    frontFace_              = (desc.rasterizer.frontCCW ? GL_CCW : GL_CW);
-    scissorTestEnabled_     = desc.rasterizer.scissorTestEnabled;
-    depthClampEnabled_      = desc.rasterizer.depthClampEnabled;
-    multiSampleEnabled_     = desc.rasterizer.multiSampling.enabled;
-    lineSmoothEnabled_      = desc.rasterizer.antiAliasedLineEnabled;
-    lineWidth_              = desc.rasterizer.lineWidth;
-    polygonOffsetEnabled_   = IsPolygonOffsetEnabled(desc.rasterizer.depthBias);
-    polygonOffsetMode_      = PolygonModeToPolygonOffset(desc.rasterizer.polygonMode);
-    polygonOffsetFactor_    = desc.rasterizer.depthBias.slopeFactor;
-    polygonOffsetUnits_     = desc.rasterizer.depthBias.constantFactor;
-    polygonOffsetClamp_     = desc.rasterizer.depthBias.clamp;
+    auto& rasterizer = stateBlock_.rasterizer;
+    rasterizer.polygonMode              = GLTypes::Map(desc.rasterizer.polygonMode);
+    rasterizer.cullFace                 = GLTypes::Map(desc.rasterizer.cullMode);
+    rasterizer.frontFace                = (desc.rasterizer.frontCCW ? GL_CCW : GL_CW);
+    rasterizer.scissorTestEnabled       = GLBoolean(desc.rasterizer.scissorTestEnabled);
+    rasterizer.depthClampEnabled        = GLBoolean(desc.rasterizer.depthClampEnabled);
+    rasterizer.multiSampleEnabled       = GLBoolean(desc.rasterizer.multiSampling.enabled);
+    rasterizer.lineSmoothEnabled        = GLBoolean(desc.rasterizer.antiAliasedLineEnabled);
+    rasterizer.polygonOffsetEnabled     = GLBoolean(IsPolygonOffsetEnabled(desc.rasterizer.depthBias));
+    rasterizer.polygonOffsetMode        = PolygonModeToPolygonOffset(desc.rasterizer.polygonMode);
+    if (rasterizer.polygonOffsetEnabled != GL_FALSE)
+    {
+        rasterizer.polygonOffsetFactor  = desc.rasterizer.depthBias.slopeFactor;
+        rasterizer.polygonOffsetUnits   = desc.rasterizer.depthBias.constantFactor;
+        rasterizer.polygonOffsetClamp   = desc.rasterizer.depthBias.clamp;
+    }
+    rasterizer.lineWidth                = desc.rasterizer.lineWidth;
 
     #ifdef LLGL_GL_ENABLE_VENDOR_EXT
-    conservativeRaster_ = desc.rasterizer.conservativeRasterization;
+    rasterizer.conservativeRaster       = GLBoolean(desc.rasterizer.conservativeRasterization);
     #endif
 
-    /* Convert blend state */
-    blendEnabled_           = desc.blend.blendEnabled;
-    blendColor_             = desc.blend.blendFactor;
-    blendColorNeeded_       = IsBlendColorNeeded(desc.blend);
-    Convert(blendStates_, desc.blend.targets);
-    sampleAlphaToCoverage_  = desc.blend.alphaToCoverageEnabled;
+    /* Convert blend state (further targets than the maximum are ignored) */
+    auto& blend = stateBlock_.blend;
+    blend.blendEnabled                  = GLBoolean(desc.blend.blendEnabled);
+    blend.blendColorNeeded              = GLBoolean(IsBlendColorNeeded(desc.blend));
+    if (blend.blendColorNeeded != GL_FALSE)
+        blend.blendColor                = desc.blend.blendFactor;
+    blend.alphaToCoverageNeeded         = rasterizer.multiSampleEnabled;
+    if (blend.alphaToCoverageNeeded != GL_FALSE)
+        blend.alphaToCoverageEnabled    = GLBoolean(desc.blend.alphaToCoverageEnabled);
+    blend.numTargets                    = static_cast<GLuint>(std::min(desc.blend.targets.size(), g_maxNumGLBlendTargets));
+    for (GLuint i = 0; i < blend.numTargets; ++i)
+        Convert(blend.targets[i], desc.blend.targets[i]);
 
     /* Convert color logic operation state */
     if (desc.blend.logicOp != LogicOp::Disabled)
     {
-        logicOpEnabled_ = true;
-        logicOp_        = GLTypes::Map(desc.blend.logicOp);
+        stateBlock_.logicOp.enabled     = GL_TRUE;
+        stateBlock_.logicOp.opcode      = GLTypes::Map(desc.blend.logicOp);
     }
+
+    stateBlock_.UpdateHashes();
 }
 
 void GLGraphicsPipeline::Bind(GLStateManager& stateMngr)
@@ -179,75 +190,8 @@ void GLGraphicsPipeline::Bind(GLStateManager& stateMngr)
     if (patchVertices_ > 0)
         stateMngr.SetPatchVertices(patchVertices_);
 
-    /* Setup depth state */
-    if (depthTestEnabled_)
-    {
-        stateMngr.Enable(GLState::DEPTH_TEST);
-        stateMngr.SetDepthFunc(depthFunc_);
-    }
-    else
-        stateMngr.Disable(GLState::DEPTH_TEST);
-
-    stateMngr.SetDepthMask(depthMask_);
-
-    /* Setup stencil state */
-    if (stencilTestEnabled_)
-    {
-        stateMngr.Enable(GLState::STENCIL_TEST);
-        stateMngr.SetStencilState(GL_FRONT, stencilFront_);
-        stateMngr.SetStencilState(GL_BACK, stencilBack_);
-    }
-    else
-        stateMngr.Disable(GLState::STENCIL_TEST);
-
-    /* Setup rasterizer state */
-    stateMngr.SetPolygonMode(polygonMode_);
-    stateMngr.SetFrontFace(frontFace_);
-
-    if (cullFace_ != 0)
-    {
-        stateMngr.Enable(GLState::CULL_FACE);
-        stateMngr.SetCullFace(cullFace_);
-    }
-    else
-        stateMngr.Disable(GLState::CULL_FACE);
-
-    if (polygonOffsetEnabled_)
-    {
-        stateMngr.Enable(polygonOffsetMode_);
-        stateMngr.SetPolygonOffset(polygonOffsetFactor_, polygonOffsetUnits_, polygonOffsetClamp_);
-    }
-    else
-        stateMngr.Disable(polygonOffsetMode_);
-
-    stateMngr.Set(GLState::SCISSOR_TEST, scissorTestEnabled_);
-    stateMngr.Set(GLState::DEPTH_CLAMP, depthClampEnabled_);
-    stateMngr.Set(GLState::MULTISAMPLE, multiSampleEnabled_);
-    stateMngr.Set(GLState::LINE_SMOOTH, lineSmoothEnabled_);
-    stateMngr.SetLineWidth(lineWidth_);
-
-    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
-    stateMngr.Set(GLStateExt::CONSERVATIVE_RASTERIZATION, conservativeRaster_);
-    #endif
-
-    /* Setup blend state */
-    stateMngr.Set(GLState::BLEND, blendEnabled_);
-    stateMngr.SetBlendStates(blendStates_, blendEnabled_);
-
-    if (blendColorNeeded_)
-        stateMngr.SetBlendColor(blendColor_);
-
-    if (multiSampleEnabled_)
-        stateMngr.Set(GLState::SAMPLE_ALPHA_TO_COVERAGE, sampleAlphaToCoverage_);
-
-    /* Setup color logic operation */
-    if (logicOpEnabled_)
-    {
-        stateMngr.Enable(GLState::COLOR_LOGIC_OP);
-        stateMngr.SetLogicOp(logicOp_);
-    }
-    else
-        stateMngr.Disable(GLState::COLOR_LOGIC_OP);
+    /* Setup all remaining states, but only those state groups that have changed since the last pipeline */
+    stateMngr.BindPipelineStateBlock(stateBlock_);
 }
 
 
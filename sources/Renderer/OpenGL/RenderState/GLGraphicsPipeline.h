@@ -11,10 +11,10 @@
 
 #include "../OpenGL.h"
 #include "GLStateManager.h"
+#include "GLPipelineState.h"
 #include "../Shader/GLShaderProgram.h"
 #include <LLGL/GraphicsPipeline.h>
 #include <LLGL/RenderSystemFlags.h>
-#include <vector>
 
 
 namespace LLGL
@@ -48,45 +48,8 @@ class GLGraphicsPipeline final : public GraphicsPipeline
         GLenum                  drawMode_               = GL_TRIANGLES;
         GLint                   patchVertices_          = 0;
 
-        // depth state
-        bool                    depthTestEnabled_       = false;    // glEnable(GL_DEPTH_TEST)
-        GLboolean               depthMask_              = false;    // glDepthMask(GL_TRUE)
-        GLenum                  depthFunc_              = GL_LESS;
-
-        // stencil state
-        bool                    stencilTestEnabled_     = false;    // glEnable(GL_STENCIL_TEST)
-        GLStencil               stencilFront_;
-        GLStencil               stencilBack_;
-
-        // rasterizer state
-        GLenum                  polygonMode_            = GL_FILL;
-        GLenum                  cullFace_               = 0;
-        GLenum                  frontFace_              = GL_CCW;
-        bool                    scissorTestEnabled_     = false;    // glEnable(GL_SCISSOR_TEST)
-        bool                    depthClampEnabled_      = false;    // glEnable(GL_DEPTH_CLAMP)
-        bool                    multiSampleEnabled_     = false;    // glEnable(GL_MULTISAMPLE)
-        bool                    lineSmoothEnabled_      = false;    // glEnable(GL_LINE_SMOOTH)
-        GLfloat                 lineWidth_              = 1.0f;
-        bool                    polygonOffsetEnabled_   = false;
-        GLState                 polygonOffsetMode_      = GLState::POLYGON_OFFSET_FILL;
-        GLfloat                 polygonOffsetFactor_    = 0.0f;
-        GLfloat                 polygonOffsetUnits_     = 0.0f;
-        GLfloat                 polygonOffsetClamp_     = 0.0f;
-
-        #ifdef LLGL_GL_ENABLE_VENDOR_EXT
-        bool                    conservativeRaster_     = false;    // glEnable(GL_CONSERVATIVE_RASTERIZATION_NV/INTEL)
-        #endif
-
-        // blend state
-        bool                    blendEnabled_           = false;
-        ColorRGBAf              blendColor_             = { 0.0f, 0.0f, 0.0f, 0.0f };
-        bool                    blendColorNeeded_       = false;
-        std::vector<GLBlend>    blendStates_;
-        bool                    sampleAlphaToCoverage_  = false;
-
-        // color logic operation state
-        bool                    logicOpEnabled_         = false;
-        GLenum                  logicOp_                = GL_COPY;
+        // depth, stencil, rasterizer, blend, and color logic operation states
+        GLPipelineStateBlock    stateBlock_;
 
 };
 
@@ -0,0 +1,41 @@
+/*
+ * GLPipelineState.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLPipelineState.h"
+#include "../../GLCommon/GLHash.h"
+
+
+namespace LLGL
+{
+
+
+// State groups are hashed bytewise, so they must not contain any padding
+static_assert(sizeof(GLStencil) == 7*4, "GLStencil must not contain padding");
+static_assert(sizeof(GLBlend) == 7*4, "GLBlend must not contain padding");
+static_assert(sizeof(GLBlendStateGroup) == 9*4 + g_maxNumGLBlendTargets*sizeof(GLBlend), "GLBlendStateGroup must not contain padding");
+
+template <typename T>
+std::uint64_t HashStateGroup(const T& group)
+{
+    return GLHashBytes(&group, sizeof(group));
+}
+
+void GLPipelineStateBlock::UpdateHashes()
+{
+    hashes[static_cast<std::size_t>(GLPipelineStateGroup::Depth     )] = HashStateGroup(depth);
+    hashes[static_cast<std::size_t>(GLPipelineStateGroup::Stencil   )] = HashStateGroup(stencil);
+    hashes[static_cast<std::size_t>(GLPipelineStateGroup::Rasterizer)] = HashStateGroup(rasterizer);
+    hashes[static_cast<std::size_t>(GLPipelineStateGroup::Blend     )] = HashStateGroup(blend);
+    hashes[static_cast<std::size_t>(GLPipelineStateGroup::LogicOp   )] = HashStateGroup(logicOp);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
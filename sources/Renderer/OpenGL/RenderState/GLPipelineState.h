@@ -0,0 +1,120 @@
+/*
+ * GLPipelineState.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_PIPELINE_STATE_H
+#define LLGL_GL_PIPELINE_STATE_H
+
+
+#include "GLState.h"
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Packed state groups of a graphics pipeline.
+All members are 4-byte values (booleans are stored as GLuint), so the groups have no padding and can be hashed and compared bytewise.
+Values that are not applied (e.g. the depth function while the depth test is disabled) must be left at their defaults.
+*/
+
+// Maximum number of blend targets of a graphics pipeline (see BlendDescriptor::targets).
+static const std::size_t g_maxNumGLBlendTargets = 8;
+
+// Depth state group: GL_DEPTH_TEST, glDepthMask, glDepthFunc.
+struct GLDepthStateGroup
+{
+    GLuint      testEnabled             = GL_FALSE;
+    GLuint      writeMask               = GL_FALSE;
+    GLenum      func                    = GL_LESS;
+};
+
+// Stencil state group: GL_STENCIL_TEST, glStencilOpSeparate, glStencilFuncSeparate, glStencilMaskSeparate.
+struct GLStencilStateGroup
+{
+    GLuint      testEnabled             = GL_FALSE;
+    GLStencil   front;
+    GLStencil   back;
+};
+
+// Rasterizer state group: polygon mode, culling, polygon offset, and the rasterizer related boolean states.
+struct GLRasterizerStateGroup
+{
+    GLenum      polygonMode             = GL_FILL;
+    GLenum      cullFace                = 0;
+    GLenum      frontFace               = GL_CCW;
+    GLuint      scissorTestEnabled      = GL_FALSE;
+    GLuint      depthClampEnabled       = GL_FALSE;
+    GLuint      multiSampleEnabled      = GL_FALSE;
+    GLuint      lineSmoothEnabled       = GL_FALSE;
+    GLuint      polygonOffsetEnabled    = GL_FALSE;
+    GLState     polygonOffsetMode       = GLState::POLYGON_OFFSET_FILL;
+    GLfloat     polygonOffsetFactor     = 0.0f;
+    GLfloat     polygonOffsetUnits      = 0.0f;
+    GLfloat     polygonOffsetClamp      = 0.0f;
+    GLfloat     lineWidth               = 1.0f;
+    GLuint      conservativeRaster      = GL_FALSE;
+};
+
+// Blend state group: GL_BLEND, GL_SAMPLE_ALPHA_TO_COVERAGE, blend color, and the blend states of all draw buffers.
+struct GLBlendStateGroup
+{
+    GLuint      blendEnabled            = GL_FALSE;
+    GLuint      blendColorNeeded        = GL_FALSE;
+    GLuint      alphaToCoverageNeeded   = GL_FALSE; // GL_SAMPLE_ALPHA_TO_COVERAGE is only modified if multi-sampling is enabled
+    GLuint      alphaToCoverageEnabled  = GL_FALSE;
+    ColorRGBAf  blendColor              = { 0.0f, 0.0f, 0.0f, 0.0f };
+    GLuint      numTargets              = 0;
+    GLBlend     targets[g_maxNumGLBlendTargets];
+};
+
+// Color logic operation state group: GL_COLOR_LOGIC_OP, glLogicOp.
+struct GLLogicOpStateGroup
+{
+    GLuint      enabled                 = GL_FALSE;
+    GLenum      opcode                  = GL_COPY;
+};
+
+// Enumeration of all pipeline state groups (used as bit indices).
+enum class GLPipelineStateGroup
+{
+    Depth = 0,
+    Stencil,
+    Rasterizer,
+    Blend,
+    LogicOp,
+};
+
+// Number of entries in the GLPipelineStateGroup enumeration.
+static const std::size_t g_numGLPipelineStateGroups = 5;
+
+// Precomputed state block of a graphics pipeline, which is diffed against the last bound block in the GLStateManager.
+struct GLPipelineStateBlock
+{
+    // Computes the hash of each state group. Must be called after all groups have been filled.
+    void UpdateHashes();
+
+    GLDepthStateGroup       depth;
+    GLStencilStateGroup     stencil;
+    GLRasterizerStateGroup  rasterizer;
+    GLBlendStateGroup       blend;
+    GLLogicOpStateGroup     logicOp;
+
+    std::uint64_t           hashes[g_numGLPipelineStateGroups] = {};
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
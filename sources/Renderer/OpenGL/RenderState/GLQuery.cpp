@@ -94,6 +94,10 @@ GLQuery::~GLQuery()
 
 void GLQuery::Begin()
 {
+    /* Timestamp queries are only written at the end (no reset required for GL) */
+    if (GetType() == QueryType::Timestamp)
+        return;
+
     /* Begin all queries in forward order: [0, n) */
     for (std::size_t i = 0, n = ids_.size(); i < n; ++i)
         glBeginQuery(MapQueryType(GetType(), i), ids_[i]);
@@ -101,6 +105,15 @@ void GLQuery::Begin()
 
 void GLQuery::End()
 {
+    #if defined LLGL_OPENGL && defined GL_ARB_timer_query
+    if (GetType() == QueryType::Timestamp)
+    {
+        /* Write timestamp when all previous commands have been completed */
+        glQueryCounter(GetFirstID(), GL_TIMESTAMP);
+        return;
+    }
+    #endif
+
     /* End all queries in reverse order: (n, 0] */
     for (std::size_t i = 1, n = ids_.size(); i <= n; ++i)
         glEndQuery(MapQueryType(GetType(), n - i));
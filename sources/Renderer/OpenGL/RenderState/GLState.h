@@ -74,6 +74,7 @@ enum class GLBufferTarget
     ELEMENT_ARRAY_BUFFER,
     PIXEL_PACK_BUFFER,
     PIXEL_UNPACK_BUFFER,
+    PARAMETER_BUFFER,
     QUERY_BUFFER,
     SHADER_STORAGE_BUFFER,
     TEXTURE_BUFFER,
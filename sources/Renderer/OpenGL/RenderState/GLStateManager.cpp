@@ -11,6 +11,7 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/Helper.h"
 #include "../../../Core/Assertion.h"
+#include <string.h>
 
 
 namespace LLGL
@@ -63,6 +64,7 @@ static const GLenum g_bufferTargetsEnum[] =
     GL_ELEMENT_ARRAY_BUFFER,
     GL_PIXEL_PACK_BUFFER,
     GL_PIXEL_UNPACK_BUFFER,
+    GL_PARAMETER_BUFFER_ARB,
     GL_QUERY_BUFFER,
     GL_SHADER_STORAGE_BUFFER,
     GL_TEXTURE_BUFFER,
@@ -184,6 +186,9 @@ void GLStateManager::SetGraphicsAPIDependentState(const OpenGLDependentStateDesc
 
 void GLStateManager::Reset()
 {
+    /* Invalidate all pipeline state groups */
+    validPipelineStateGroups_ = 0;
+
     /* Query all states from OpenGL */
     for (std::size_t i = 0; i < numStates; ++i)
         renderState_.values[i] = (glIsEnabled(g_stateCapsEnum[i]) != GL_FALSE);
@@ -191,6 +196,7 @@ void GLStateManager::Reset()
 
 void GLStateManager::Set(GLState state, bool value)
 {
+    InvalidatePipelineStateGroup(state);
     auto idx = static_cast<std::size_t>(state);
     if (renderState_.values[idx] != value)
     {
@@ -204,6 +210,7 @@ void GLStateManager::Set(GLState state, bool value)
 
 void GLStateManager::Enable(GLState state)
 {
+    InvalidatePipelineStateGroup(state);
     auto idx = static_cast<std::size_t>(state);
     if (!renderState_.values[idx])
     {
@@ -214,6 +221,7 @@ void GLStateManager::Enable(GLState state)
 
 void GLStateManager::Disable(GLState state)
 {
+    InvalidatePipelineStateGroup(state);
     auto idx = static_cast<std::size_t>(state);
     if (renderState_.values[idx])
     {
@@ -257,6 +265,7 @@ void GLStateManager::PopStates(std::size_t count)
 
 void GLStateManager::Set(GLStateExt state, bool value)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
     auto idx = static_cast<std::size_t>(state);
     auto& val = renderStateExt_.values[idx];
     if (val.cap != 0 && val.enabled != value)
@@ -271,6 +280,7 @@ void GLStateManager::Set(GLStateExt state, bool value)
 
 void GLStateManager::Enable(GLStateExt state)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
     auto idx = static_cast<std::size_t>(state);
     auto& val = renderStateExt_.values[idx];
     if (val.cap != 0 && !val.enabled)
@@ -282,6 +292,7 @@ void GLStateManager::Enable(GLStateExt state)
 
 void GLStateManager::Disable(GLStateExt state)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
     auto idx = static_cast<std::size_t>(state);
     auto& val = renderStateExt_.values[idx];
     if (val.cap != 0 && val.enabled)
@@ -413,12 +424,14 @@ void GLStateManager::SetScissorArray(GLuint first, GLsizei count, GLScissor* sci
     }
 }
 
-void GLStateManager::SetBlendStates(const std::vector<GLBlend>& blendStates, bool blendEnabled)
+void GLStateManager::SetBlendStates(const GLBlend* blendStates, std::size_t numBlendStates, bool blendEnabled)
 {
-    if (blendStates.size() == 1)
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Blend);
+
+    if (numBlendStates == 1)
     {
         /* Set blend state only for the single draw buffer */
-        const auto& state = blendStates.front();
+        const auto& state = blendStates[0];
 
         glColorMask(state.colorMask.r, state.colorMask.g, state.colorMask.b, state.colorMask.a);
         if (blendEnabled)
@@ -427,13 +440,13 @@ void GLStateManager::SetBlendStates(const std::vector<GLBlend>& blendStates, boo
             glBlendEquationSeparate(state.funcColor, state.funcAlpha);
         }
     }
-    else if (blendStates.size() > 1)
+    else if (numBlendStates > 1)
     {
         GLenum drawBuffer = GL_COLOR_ATTACHMENT0;
 
         /* Set respective blend state for each draw buffer */
-        for (const auto& state : blendStates)
-            SetBlendState(drawBuffer++, state, blendEnabled);
+        for (std::size_t i = 0; i < numBlendStates; ++i)
+            SetBlendState(drawBuffer++, blendStates[i], blendEnabled);
     }
 }
 
@@ -478,6 +491,8 @@ void GLStateManager::SetClipControl(GLenum origin, GLenum depth)
 
 void GLStateManager::SetDepthFunc(GLenum func)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Depth);
+
     if (commonState_.depthFunc != func)
     {
         commonState_.depthFunc = func;
@@ -487,6 +502,8 @@ void GLStateManager::SetDepthFunc(GLenum func)
 
 void GLStateManager::SetStencilState(GLenum face, const GLStencil& state)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Stencil);
+
     switch (face)
     {
         case GL_FRONT:
@@ -530,6 +547,8 @@ void GLStateManager::SetStencilState(GLenum face, GLStencil& to, const GLStencil
 // <face> parameter must always be 'GL_FRONT_AND_BACK' since GL 3.2+
 void GLStateManager::SetPolygonMode(GLenum mode)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
+
     if (commonState_.polygonMode != mode)
     {
         commonState_.polygonMode = mode;
@@ -539,6 +558,8 @@ void GLStateManager::SetPolygonMode(GLenum mode)
 
 void GLStateManager::SetPolygonOffset(GLfloat factor, GLfloat units, GLfloat clamp)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
+
     #ifdef GL_ARB_polygon_offset_clamp
     if (HasExtension(GLExt::ARB_polygon_offset_clamp))
     {
@@ -564,6 +585,8 @@ void GLStateManager::SetPolygonOffset(GLfloat factor, GLfloat units, GLfloat cla
 
 void GLStateManager::SetCullFace(GLenum face)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
+
     if (commonState_.cullFace != face)
     {
         commonState_.cullFace = face;
@@ -573,6 +596,8 @@ void GLStateManager::SetCullFace(GLenum face)
 
 void GLStateManager::SetFrontFace(GLenum mode)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
+
     /* Store actual input front face (without inversion) */
     commonState_.frontFaceAct = mode;
 
@@ -590,6 +615,8 @@ void GLStateManager::SetFrontFace(GLenum mode)
 
 void GLStateManager::SetDepthMask(GLboolean flag)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Depth);
+
     if (commonState_.depthMask != flag)
     {
         commonState_.depthMask = flag;
@@ -608,6 +635,8 @@ void GLStateManager::SetPatchVertices(GLint patchVertices)
 
 void GLStateManager::SetBlendColor(const ColorRGBAf& color)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Blend);
+
     if (color != commonState_.blendColor)
     {
         commonState_.blendColor = color;
@@ -617,6 +646,8 @@ void GLStateManager::SetBlendColor(const ColorRGBAf& color)
 
 void GLStateManager::SetLogicOp(GLenum opcode)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::LogicOp);
+
     if (commonState_.logicOpCode != opcode)
     {
         commonState_.logicOpCode = opcode;
@@ -626,6 +657,8 @@ void GLStateManager::SetLogicOp(GLenum opcode)
 
 void GLStateManager::SetLineWidth(GLfloat width)
 {
+    InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
+
     /* Clamp width silently into limited range */
     width = std::max(limits_.lineWidthRange[0], std::min(width, limits_.lineWidthRange[1]));
     if (commonState_.lineWidth != width)
@@ -635,6 +668,46 @@ void GLStateManager::SetLineWidth(GLfloat width)
     }
 }
 
+/* ----- Pipeline state blocks ----- */
+
+void GLStateManager::BindPipelineStateBlock(const GLPipelineStateBlock& block)
+{
+    /* Apply only those state groups that differ from the last bound ones */
+    applyingPipelineState_ = true;
+    {
+        if (CheckPipelineStateGroup(block, GLPipelineStateGroup::Depth, &boundPipelineState_.depth, &block.depth, sizeof(block.depth)))
+        {
+            boundPipelineState_.depth = block.depth;
+            ApplyDepthStateGroup(block.depth);
+        }
+
+        if (CheckPipelineStateGroup(block, GLPipelineStateGroup::Stencil, &boundPipelineState_.stencil, &block.stencil, sizeof(block.stencil)))
+        {
+            boundPipelineState_.stencil = block.stencil;
+            ApplyStencilStateGroup(block.stencil);
+        }
+
+        if (CheckPipelineStateGroup(block, GLPipelineStateGroup::Rasterizer, &boundPipelineState_.rasterizer, &block.rasterizer, sizeof(block.rasterizer)))
+        {
+            boundPipelineState_.rasterizer = block.rasterizer;
+            ApplyRasterizerStateGroup(block.rasterizer);
+        }
+
+        if (CheckPipelineStateGroup(block, GLPipelineStateGroup::Blend, &boundPipelineState_.blend, &block.blend, sizeof(block.blend)))
+        {
+            boundPipelineState_.blend = block.blend;
+            ApplyBlendStateGroup(block.blend);
+        }
+
+        if (CheckPipelineStateGroup(block, GLPipelineStateGroup::LogicOp, &boundPipelineState_.logicOp, &block.logicOp, sizeof(block.logicOp)))
+        {
+            boundPipelineState_.logicOp = block.logicOp;
+            ApplyLogicOpStateGroup(block.logicOp);
+        }
+    }
+    applyingPipelineState_ = false;
+}
+
 /* ----- Buffer ----- */
 
 GLBufferTarget GLStateManager::GetBufferTarget(const BufferType type)
@@ -1036,6 +1109,155 @@ void GLStateManager::SetActiveTextureLayer(std::uint32_t layer)
     activeTextureLayer_ = &(textureState_.layers[textureState_.activeTexture]);
 }
 
+bool GLStateManager::CheckPipelineStateGroup(
+    const GLPipelineStateBlock& block,
+    GLPipelineStateGroup        group,
+    const void*                 boundGroup,
+    const void*                 newGroup,
+    std::size_t                 groupSize)
+{
+    const auto idx = static_cast<std::size_t>(group);
+    const auto bit = (1u << idx);
+
+    /* Compare hashes first and only compare the entire state group if the hashes are equal */
+    if ( (validPipelineStateGroups_ & bit) != 0               &&
+         boundPipelineState_.hashes[idx] == block.hashes[idx] &&
+         ::memcmp(boundGroup, newGroup, groupSize) == 0 )
+    {
+        ++numStateGroupsSkipped_;
+        return false;
+    }
+
+    validPipelineStateGroups_ |= bit;
+    boundPipelineState_.hashes[idx] = block.hashes[idx];
+    ++numStateGroupsIssued_;
+
+    return true;
+}
+
+void GLStateManager::ApplyDepthStateGroup(const GLDepthStateGroup& group)
+{
+    if (group.testEnabled != GL_FALSE)
+    {
+        Enable(GLState::DEPTH_TEST);
+        SetDepthFunc(group.func);
+    }
+    else
+        Disable(GLState::DEPTH_TEST);
+
+    SetDepthMask(static_cast<GLboolean>(group.writeMask));
+}
+
+void GLStateManager::ApplyStencilStateGroup(const GLStencilStateGroup& group)
+{
+    if (group.testEnabled != GL_FALSE)
+    {
+        Enable(GLState::STENCIL_TEST);
+        SetStencilState(GL_FRONT, group.front);
+        SetStencilState(GL_BACK, group.back);
+    }
+    else
+        Disable(GLState::STENCIL_TEST);
+}
+
+void GLStateManager::ApplyRasterizerStateGroup(const GLRasterizerStateGroup& group)
+{
+    SetPolygonMode(group.polygonMode);
+    SetFrontFace(group.frontFace);
+
+    if (group.cullFace != 0)
+    {
+        Enable(GLState::CULL_FACE);
+        SetCullFace(group.cullFace);
+    }
+    else
+        Disable(GLState::CULL_FACE);
+
+    if (group.polygonOffsetEnabled != GL_FALSE)
+    {
+        Enable(group.polygonOffsetMode);
+        SetPolygonOffset(group.polygonOffsetFactor, group.polygonOffsetUnits, group.polygonOffsetClamp);
+    }
+    else
+        Disable(group.polygonOffsetMode);
+
+    Set(GLState::SCISSOR_TEST, (group.scissorTestEnabled != GL_FALSE));
+    Set(GLState::DEPTH_CLAMP, (group.depthClampEnabled != GL_FALSE));
+    Set(GLState::MULTISAMPLE, (group.multiSampleEnabled != GL_FALSE));
+    Set(GLState::LINE_SMOOTH, (group.lineSmoothEnabled != GL_FALSE));
+    SetLineWidth(group.lineWidth);
+
+    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
+    Set(GLStateExt::CONSERVATIVE_RASTERIZATION, (group.conservativeRaster != GL_FALSE));
+    #endif
+}
+
+void GLStateManager::ApplyBlendStateGroup(const GLBlendStateGroup& group)
+{
+    Set(GLState::BLEND, (group.blendEnabled != GL_FALSE));
+    SetBlendStates(group.targets, group.numTargets, (group.blendEnabled != GL_FALSE));
+
+    if (group.blendColorNeeded != GL_FALSE)
+        SetBlendColor(group.blendColor);
+
+    if (group.alphaToCoverageNeeded != GL_FALSE)
+        Set(GLState::SAMPLE_ALPHA_TO_COVERAGE, (group.alphaToCoverageEnabled != GL_FALSE));
+}
+
+void GLStateManager::ApplyLogicOpStateGroup(const GLLogicOpStateGroup& group)
+{
+    if (group.enabled != GL_FALSE)
+    {
+        Enable(GLState::COLOR_LOGIC_OP);
+        SetLogicOp(group.opcode);
+    }
+    else
+        Disable(GLState::COLOR_LOGIC_OP);
+}
+
+void GLStateManager::InvalidatePipelineStateGroup(GLPipelineStateGroup group)
+{
+    if (!applyingPipelineState_)
+        validPipelineStateGroups_ &= ~(1u << static_cast<std::uint32_t>(group));
+}
+
+void GLStateManager::InvalidatePipelineStateGroup(GLState state)
+{
+    switch (state)
+    {
+        case GLState::DEPTH_TEST:
+            InvalidatePipelineStateGroup(GLPipelineStateGroup::Depth);
+            break;
+
+        case GLState::STENCIL_TEST:
+            InvalidatePipelineStateGroup(GLPipelineStateGroup::Stencil);
+            break;
+
+        case GLState::CULL_FACE:
+        case GLState::DEPTH_CLAMP:
+        case GLState::LINE_SMOOTH:
+        case GLState::MULTISAMPLE:
+        case GLState::POLYGON_OFFSET_FILL:
+        case GLState::POLYGON_OFFSET_LINE:
+        case GLState::POLYGON_OFFSET_POINT:
+        case GLState::SCISSOR_TEST:
+            InvalidatePipelineStateGroup(GLPipelineStateGroup::Rasterizer);
+            break;
+
+        case GLState::BLEND:
+        case GLState::SAMPLE_ALPHA_TO_COVERAGE:
+            InvalidatePipelineStateGroup(GLPipelineStateGroup::Blend);
+            break;
+
+        case GLState::COLOR_LOGIC_OP:
+            InvalidatePipelineStateGroup(GLPipelineStateGroup::LogicOp);
+            break;
+
+        default:
+            break;
+    }
+}
+
 void GLStateManager::DetermineLimits()
 {
     glGetIntegerv(GL_MAX_VIEWPORTS, &limits_.maxViewports);
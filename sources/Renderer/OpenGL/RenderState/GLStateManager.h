@@ -10,6 +10,7 @@
 
 
 #include "GLState.h"
+#include "GLPipelineState.h"
 #include "../Buffer/GLBuffer.h"
 #include "../Texture/GLTexture.h"
 #include <LLGL/CommandBufferFlags.h>
@@ -83,7 +84,7 @@ class GLStateManager
         void SetScissor(GLScissor& scissor);
         void SetScissorArray(GLuint first, GLsizei count, GLScissor* scissors);
 
-        void SetBlendStates(const std::vector<GLBlend>& blendStates, bool blendEnabled);
+        void SetBlendStates(const GLBlend* blendStates, std::size_t numBlendStates, bool blendEnabled);
 
         void SetClipControl(GLenum origin, GLenum depth);
         void SetDepthFunc(GLenum func);
@@ -98,6 +99,26 @@ class GLStateManager
         void SetLogicOp(GLenum opcode);
         void SetLineWidth(GLfloat width);
 
+        /* ----- Pipeline state blocks ----- */
+
+        /*
+        Binds the specified pipeline state block and only applies the state groups that differ from the last bound block.
+        State groups are invalidated whenever one of their states is modified outside of this function.
+        */
+        void BindPipelineStateBlock(const GLPipelineStateBlock& block);
+
+        // Returns the number of state groups that have been applied by BindPipelineStateBlock.
+        inline std::uint64_t GetNumStateGroupsIssued() const
+        {
+            return numStateGroupsIssued_;
+        }
+
+        // Returns the number of state groups that have been skipped by BindPipelineStateBlock, because they were already bound.
+        inline std::uint64_t GetNumStateGroupsSkipped() const
+        {
+            return numStateGroupsSkipped_;
+        }
+
         /* ----- Buffer ----- */
 
         static GLBufferTarget GetBufferTarget(const BufferType type);
@@ -185,6 +206,25 @@ class GLStateManager
 
         void SetActiveTextureLayer(std::uint32_t layer);
 
+        // Returns true if the specified state group must be applied, and stores its hash as the bound one.
+        bool CheckPipelineStateGroup(
+            const GLPipelineStateBlock& block,
+            GLPipelineStateGroup        group,
+            const void*                 boundGroup,
+            const void*                 newGroup,
+            std::size_t                 groupSize
+        );
+
+        void ApplyDepthStateGroup(const GLDepthStateGroup& group);
+        void ApplyStencilStateGroup(const GLStencilStateGroup& group);
+        void ApplyRasterizerStateGroup(const GLRasterizerStateGroup& group);
+        void ApplyBlendStateGroup(const GLBlendStateGroup& group);
+        void ApplyLogicOpStateGroup(const GLLogicOpStateGroup& group);
+
+        // Invalidates the specified state group unless it is currently applied by BindPipelineStateBlock.
+        void InvalidatePipelineStateGroup(GLPipelineStateGroup group);
+        void InvalidatePipelineStateGroup(GLState state);
+
         void DetermineLimits();
 
         #ifdef LLGL_GL_ENABLE_VENDOR_EXT
@@ -348,6 +388,12 @@ class GLStateManager
         bool                            emulateClipControl_ = false;
         GLint                           renderTargetHeight_ = 0;
 
+        GLPipelineStateBlock            boundPipelineState_;
+        std::uint32_t                   validPipelineStateGroups_   = 0;        // Bit mask of GLPipelineStateGroup entries
+        bool                            applyingPipelineState_      = false;
+        std::uint64_t                   numStateGroupsIssued_       = 0;
+        std::uint64_t                   numStateGroupsSkipped_      = 0;
+
 };
 
 
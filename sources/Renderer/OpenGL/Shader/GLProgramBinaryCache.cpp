@@ -0,0 +1,175 @@
+/*
+ * GLProgramBinaryCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLProgramBinaryCache.h"
+#include "../../GLCommon/GLHash.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+static std::uint64_t GLHashDriverString(GLenum name, std::uint64_t hash)
+{
+    auto str = reinterpret_cast<const char*>(glGetString(name));
+    return (str != nullptr ? GLHashBytes(str, std::strlen(str) + 1, hash) : hash);
+}
+
+GLProgramBinaryCache::GLProgramBinaryCache(const OpenGLRendererConfiguration& config) :
+    config_ { config }
+{
+}
+
+bool GLProgramBinaryCache::IsSupported()
+{
+    if (!supportQueried_)
+    {
+        #ifdef GL_ARB_get_program_binary
+        if (HasExtension(GLExt::ARB_get_program_binary))
+        {
+            GLint numFormats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+            supported_ = (numFormats > 0);
+        }
+        #endif // /GL_ARB_get_program_binary
+        supportQueried_ = true;
+    }
+    return supported_;
+}
+
+std::uint64_t GLProgramBinaryCache::GetDriverHash()
+{
+    if (!driverHashed_)
+    {
+        /* Program binaries are only valid for the same driver, so hash all driver identification strings */
+        driverHash_ = g_glHashOffsetBasis;
+        driverHash_ = GLHashDriverString(GL_VENDOR, driverHash_);
+        driverHash_ = GLHashDriverString(GL_RENDERER, driverHash_);
+        driverHash_ = GLHashDriverString(GL_VERSION, driverHash_);
+        driverHash_ = GLHashDriverString(GL_SHADING_LANGUAGE_VERSION, driverHash_);
+        driverHashed_ = true;
+    }
+    return driverHash_;
+}
+
+bool GLProgramBinaryCache::Load(std::uint64_t key, GLuint program)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    /* Read blob from cache */
+    std::vector<char> blob;
+    if (!ReadBlob(key, blob) || blob.size() <= sizeof(GLenum))
+        return false;
+
+    /* Pass binary to program object and check if the driver accepted it */
+    GLenum binaryFormat = 0;
+    std::memcpy(&binaryFormat, blob.data(), sizeof(binaryFormat));
+
+    glProgramBinary(program, binaryFormat, blob.data() + sizeof(GLenum), static_cast<GLsizei>(blob.size() - sizeof(GLenum)));
+
+    GLint status = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+
+    return (status != GL_FALSE);
+
+    #else
+
+    return false;
+
+    #endif // /GL_ARB_get_program_binary
+}
+
+void GLProgramBinaryCache::Store(std::uint64_t key, GLuint program)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    /* Query program binary length */
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0)
+        return;
+
+    /* Retrieve program binary behind its format */
+    std::vector<char> blob(sizeof(GLenum) + static_cast<std::size_t>(binaryLength));
+
+    GLenum  binaryFormat    = 0;
+    GLsizei bytesWritten    = 0;
+    glGetProgramBinary(program, binaryLength, &bytesWritten, &binaryFormat, blob.data() + sizeof(GLenum));
+
+    if (bytesWritten <= 0)
+        return;
+
+    std::memcpy(blob.data(), &binaryFormat, sizeof(binaryFormat));
+    blob.resize(sizeof(GLenum) + static_cast<std::size_t>(bytesWritten));
+
+    /* Write blob to cache */
+    WriteBlob(key, blob);
+
+    #endif // /GL_ARB_get_program_binary
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLProgramBinaryCache::ReadBlob(std::uint64_t key, std::vector<char>& blob)
+{
+    if (config_.loadProgramBinary && config_.storeProgramBinary)
+        return config_.loadProgramBinary(key, blob);
+
+    if (!config_.programCacheDirectory.empty())
+    {
+        std::ifstream file { GetFilename(key), (std::ios_base::binary | std::ios_base::ate) };
+        if (file.good())
+        {
+            auto fileSize = static_cast<std::size_t>(file.tellg());
+            blob.resize(fileSize);
+            file.seekg(0);
+            file.read(blob.data(), fileSize);
+            return file.good();
+        }
+    }
+
+    return false;
+}
+
+void GLProgramBinaryCache::WriteBlob(std::uint64_t key, const std::vector<char>& blob)
+{
+    if (config_.loadProgramBinary && config_.storeProgramBinary)
+        config_.storeProgramBinary(key, blob.data(), blob.size());
+    else if (!config_.programCacheDirectory.empty())
+    {
+        std::ofstream file { GetFilename(key), (std::ios_base::binary | std::ios_base::trunc) };
+        if (file.good())
+            file.write(blob.data(), blob.size());
+    }
+}
+
+std::string GLProgramBinaryCache::GetFilename(std::uint64_t key) const
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+
+    auto filename = config_.programCacheDirectory;
+    if (filename.back() != '/' && filename.back() != '\\')
+        filename += '/';
+
+    return filename + name;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,75 @@
+/*
+ * GLProgramBinaryCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_PROGRAM_BINARY_CACHE_H
+#define LLGL_GL_PROGRAM_BINARY_CACHE_H
+
+
+#include <LLGL/RenderSystemFlags.h>
+#include "../OpenGL.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Cache for linked program binaries (GL_ARB_get_program_binary).
+Binaries are stored either in a directory (one file per key) or via user-defined callbacks.
+Each blob starts with the binary format (GLenum) followed by the driver specific program binary.
+*/
+class GLProgramBinaryCache
+{
+
+    public:
+
+        GLProgramBinaryCache(const OpenGLRendererConfiguration& config);
+
+        // Returns true if the driver supports at least one program binary format.
+        bool IsSupported();
+
+        // Returns the hash of the driver identification strings; this must be part of each key.
+        std::uint64_t GetDriverHash();
+
+        /*
+        Loads the program binary for the specified key into the specified program.
+        Returns false if there is no cache entry or the driver rejected the binary.
+        */
+        bool Load(std::uint64_t key, GLuint program);
+
+        // Stores the program binary of the specified (successfully linked) program for the specified key.
+        void Store(std::uint64_t key, GLuint program);
+
+    private:
+
+        bool ReadBlob(std::uint64_t key, std::vector<char>& blob);
+        void WriteBlob(std::uint64_t key, const std::vector<char>& blob);
+
+        std::string GetFilename(std::uint64_t key) const;
+
+        OpenGLRendererConfiguration config_;
+
+        bool                        supportQueried_ = false;
+        bool                        supported_      = false;
+
+        bool                        driverHashed_   = false;
+        std::uint64_t               driverHash_     = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
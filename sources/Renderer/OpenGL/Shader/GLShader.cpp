@@ -6,12 +6,14 @@
  */
 
 #include "GLShader.h"
+#include "../../GLCommon/GLHash.h"
 #include "../Ext/GLExtensions.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/Helper.h"
 #include "../../../Core/Exception.h"
 #include <vector>
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
 
@@ -111,6 +113,10 @@ void GLShader::CompileSource(const ShaderDescriptor& shaderDesc)
         strings[0] = shaderDesc.source;
     }
 
+    /* Hash shader type and source code to identify this shader in the program binary cache */
+    sourceHash_ = GLHashBytes(&(shaderDesc.type), sizeof(shaderDesc.type));
+    sourceHash_ = GLHashBytes(strings[0], std::strlen(strings[0]), sourceHash_);
+
     /* Load shader source code, then compile shader */
     glShaderSource(id_, 1, strings, nullptr);
     glCompileShader(id_);
@@ -143,11 +149,17 @@ void GLShader::LoadBinary(const ShaderDescriptor& shaderDesc)
             binaryLength = static_cast<GLsizei>(shaderDesc.sourceSize);
         }
 
+        /* Hash shader type, binary, and entry point to identify this shader in the program binary cache */
+        const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
+
+        sourceHash_ = GLHashBytes(&(shaderDesc.type), sizeof(shaderDesc.type));
+        sourceHash_ = GLHashBytes(binaryBuffer, static_cast<std::size_t>(binaryLength), sourceHash_);
+        sourceHash_ = GLHashString(entryPoint, sourceHash_);
+
         /* Load shader binary */
         glShaderBinary(1, &id_, GL_SHADER_BINARY_FORMAT_SPIR_V, binaryBuffer, binaryLength);
 
         /* Specialize for the default "main" function in a SPIR-V module  */
-        const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
         glSpecializeShader(id_, entryPoint, 0, nullptr, nullptr);
 
         /* Store stream-output format */
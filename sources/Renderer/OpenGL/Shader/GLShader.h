@@ -37,6 +37,12 @@ class GLShader final : public Shader
             return id_;
         }
 
+        // Returns the hash of the shader type and source (or binary) this shader was built from.
+        inline std::uint64_t GetSourceHash() const
+        {
+            return sourceHash_;
+        }
+
     protected:
 
         friend class GLShaderProgram;
@@ -49,7 +55,8 @@ class GLShader final : public Shader
         void CompileSource(const ShaderDescriptor& shaderDesc);
         void LoadBinary(const ShaderDescriptor& shaderDesc);
 
-        GLuint              id_ = 0;
+        GLuint              id_         = 0;
+        std::uint64_t       sourceHash_ = 0;
         StreamOutputFormat  streamOutputFormat_;
 
 };
@@ -7,12 +7,14 @@
 
 #include "GLShaderProgram.h"
 #include "GLShader.h"
+#include "GLProgramBinaryCache.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionLoader.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Exception.h"
 #include "../RenderState/GLStateManager.h"
 #include "../../GLCommon/GLTypes.h"
+#include "../../GLCommon/GLHash.h"
 #include <LLGL/VertexFormat.h>
 #include <LLGL/Constants.h>
 #include <vector>
@@ -23,7 +25,7 @@ namespace LLGL
 {
 
 
-GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc) :
+GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc, GLProgramBinaryCache* binaryCache) :
     id_      { glCreateProgram() },
     uniform_ { id_               }
 {
@@ -33,8 +35,14 @@ GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc) :
     Attach(desc.geometryShader);
     Attach(desc.fragmentShader);
     Attach(desc.computeShader);
-    BuildInputLayout(desc.vertexFormats.size(), desc.vertexFormats.data());
-    Link();
+
+    if (binaryCache != nullptr && IsBinaryCacheable(*binaryCache))
+        LinkWithBinaryCache(desc, *binaryCache);
+    else
+    {
+        BuildInputLayout(desc.vertexFormats.size(), desc.vertexFormats.data());
+        Link();
+    }
 }
 
 GLShaderProgram::~GLShaderProgram()
@@ -217,6 +225,71 @@ void GLShaderProgram::Link()
     glLinkProgram(id_);
 }
 
+bool GLShaderProgram::IsBinaryCacheable(GLProgramBinaryCache& binaryCache) const
+{
+    if (!binaryCache.IsSupported())
+        return false;
+
+    #ifndef __APPLE__
+    /* Varyings of GL_NV_transform_feedback are specified after linking, so they are not part of the program binary */
+    if (!streamOutputFormat_.attributes.empty() && !HasExtension(GLExt::EXT_transform_feedback))
+        return false;
+    #endif
+
+    return true;
+}
+
+static std::uint64_t HashShader(const Shader* shader, std::uint64_t hash)
+{
+    if (shader != nullptr)
+    {
+        auto shaderGL = LLGL_CAST(const GLShader*, shader);
+        auto sourceHash = shaderGL->GetSourceHash();
+        return GLHashBytes(&sourceHash, sizeof(sourceHash), hash);
+    }
+    return GLHashBytes("", 1, hash);
+}
+
+void GLShaderProgram::LinkWithBinaryCache(const ShaderProgramDescriptor& desc, GLProgramBinaryCache& binaryCache)
+{
+    /* Hash everything that affects the linked program: driver, shader sources, vertex attribute locations, and stream-output varyings */
+    auto key = binaryCache.GetDriverHash();
+
+    key = HashShader(desc.vertexShader, key);
+    key = HashShader(desc.tessControlShader, key);
+    key = HashShader(desc.tessEvaluationShader, key);
+    key = HashShader(desc.geometryShader, key);
+    key = HashShader(desc.fragmentShader, key);
+    key = HashShader(desc.computeShader, key);
+
+    for (const auto& vertexFormat : desc.vertexFormats)
+    {
+        for (const auto& attrib : vertexFormat.attributes)
+        {
+            key = GLHashString(attrib.name, key);
+            key = GLHashBytes(&(attrib.semanticIndex), sizeof(attrib.semanticIndex), key);
+        }
+        key = GLHashBytes("", 1, key);
+    }
+
+    for (const auto& attrib : streamOutputFormat_.attributes)
+        key = GLHashString(attrib.name, key);
+
+    /* Try to load program binary, otherwise link from shader sources and store the new program binary */
+    if (!binaryCache.Load(key, id_))
+    {
+        #ifdef GL_ARB_get_program_binary
+        glProgramParameteri(id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        #endif
+
+        BuildInputLayout(desc.vertexFormats.size(), desc.vertexFormats.data());
+        Link();
+
+        if (!HasErrors())
+            binaryCache.Store(key, id_);
+    }
+}
+
 bool GLShaderProgram::QueryActiveAttribs(
     GLenum attribCountType, GLenum attribNameLengthType,
     GLint& numAttribs, GLint& maxNameLength, std::vector<char>& nameBuffer) const
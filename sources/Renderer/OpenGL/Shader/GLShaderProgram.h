@@ -18,12 +18,14 @@ namespace LLGL
 {
 
 
+class GLProgramBinaryCache;
+
 class GLShaderProgram final : public ShaderProgram
 {
 
     public:
 
-        GLShaderProgram(const ShaderProgramDescriptor& desc);
+        GLShaderProgram(const ShaderProgramDescriptor& desc, GLProgramBinaryCache* binaryCache = nullptr);
         ~GLShaderProgram();
 
         bool HasErrors() const override;
@@ -56,6 +58,12 @@ class GLShaderProgram final : public ShaderProgram
         void BuildInputLayout(std::size_t numVertexFormats, const VertexFormat* vertexFormats);
         void Link();
 
+        // Returns true if this shader program can be stored in a program binary cache.
+        bool IsBinaryCacheable(GLProgramBinaryCache& binaryCache) const;
+
+        // Loads the program binary from the cache, or links the shader program and stores its binary in the cache.
+        void LinkWithBinaryCache(const ShaderProgramDescriptor& desc, GLProgramBinaryCache& binaryCache);
+
         bool QueryActiveAttribs(
             GLenum attribCountType, GLenum attribNameLengthType,
             GLint& numAttribs, GLint& maxNameLength, std::vector<char>& nameBuffer
@@ -0,0 +1,221 @@
+/*
+ * GLTextureReadbackRing.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLTextureReadbackRing.h"
+#include "GLTexture.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../GLCommon/GLTypes.h"
+#include "../RenderState/GLStateManager.h"
+#include <LLGL/ImageFlags.h>
+#include <stdexcept>
+#include <string>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Timeout (in nanoseconds) for each attempt to wait for a read operation.
+static const GLuint64 g_textureReadbackWaitTimeout = 1000000000ull;
+
+GLTextureReadbackRing::~GLTextureReadbackRing()
+{
+    for (const auto& slot : slots_)
+    {
+        #ifdef GL_ARB_sync
+        if (slot.sync)
+            glDeleteSync(slot.sync);
+        #endif
+        glDeleteBuffers(1, &slot.buffer);
+        GLStateManager::active->NotifyBufferRelease(slot.buffer, GLBufferTarget::PIXEL_PACK_BUFFER);
+    }
+}
+
+std::uint64_t GLTextureReadbackRing::ReadTexture(const GLTexture& textureGL, std::uint32_t mipLevel)
+{
+    /* Determine image format that matches the hardware format of the texture */
+    Format format = Format::Undefined;
+    GLTypes::Unmap(format, textureGL.QueryGLInternalFormat());
+
+    ImageFormat imageFormat = ImageFormat::RGBA;
+    DataType    dataType    = DataType::UInt8;
+
+    if (!FindSuitableImageFormat(format, imageFormat, dataType))
+        throw std::runtime_error("cannot read GL texture with unsupported hardware format asynchronously");
+
+    const auto extent   = textureGL.QueryMipExtent(mipLevel);
+    const auto dataSize = static_cast<GLsizeiptr>(ImageDataSize(imageFormat, dataType, extent.width * extent.height * extent.depth));
+
+    auto& slot = AllocSlot(dataSize);
+
+    /*
+    Pack rows with byte-alignment (default is word-alignment), otherwise rows of formats like RGB
+    would be padded and the image data would exceed the size of the slot
+    */
+    GLint prevPackAlignment = 4;
+    glGetIntegerv(GL_PACK_ALIGNMENT, &prevPackAlignment);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    /* With a bound pixel pack buffer, the image data pointer is interpreted as offset into that buffer */
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot.buffer);
+    {
+        #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+        if (HasExtension(GLExt::ARB_direct_state_access))
+        {
+            glGetTextureImage(
+                textureGL.GetID(),
+                static_cast<GLint>(mipLevel),
+                GLTypes::Map(imageFormat),
+                GLTypes::Map(dataType),
+                static_cast<GLsizei>(dataSize),
+                nullptr
+            );
+        }
+        else
+        #endif
+        {
+            GLStateManager::active->BindTexture(textureGL);
+            glGetTexImage(
+                GLTypes::Map(textureGL.GetType()),
+                static_cast<GLint>(mipLevel),
+                GLTypes::Map(imageFormat),
+                GLTypes::Map(dataType),
+                nullptr
+            );
+        }
+    }
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, prevPackAlignment);
+
+    /* Protect buffer until the copy command has been executed */
+    #ifdef GL_ARB_sync
+    if (HasExtension(GLExt::ARB_sync))
+        slot.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    #endif
+
+    slot.size   = dataSize;
+    slot.ticket = ++lastTicket_;
+
+    return slot.ticket;
+}
+
+bool GLTextureReadbackRing::QueryResult(std::uint64_t ticket, void* data, std::size_t dataSize, bool wait)
+{
+    for (auto& slot : slots_)
+    {
+        if (ticket != 0 && slot.ticket == ticket)
+        {
+            if (dataSize < static_cast<std::size_t>(slot.size))
+            {
+                throw std::invalid_argument(
+                    "image data size too small for asynchronous texture read (" + std::to_string(dataSize) +
+                    " is specified but " + std::to_string(slot.size) + " is required)"
+                );
+            }
+
+            if (!WaitForSlot(slot, wait))
+                return false;
+
+            /* Copy image data from pixel pack buffer (the content is undefined if unmapping fails) */
+            bool copied = false;
+
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot.buffer);
+            {
+                if (auto src = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY))
+                {
+                    ::memcpy(data, src, static_cast<std::size_t>(slot.size));
+                    copied = (glUnmapBuffer(GL_PIXEL_PACK_BUFFER) == GL_TRUE);
+                }
+            }
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+            /* Free slot for the next read operation */
+            slot.ticket = 0;
+
+            if (!copied)
+                throw std::runtime_error("failed to map pixel pack buffer for asynchronous texture read: " + std::to_string(ticket));
+
+            return true;
+        }
+    }
+    throw std::invalid_argument("invalid ticket for asynchronous texture read: " + std::to_string(ticket));
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+GLTextureReadbackRing::Slot& GLTextureReadbackRing::AllocSlot(GLsizeiptr size)
+{
+    /* Find next free slot in ring order, or append a new slot if all slots are pending */
+    auto index = slots_.size();
+
+    for (std::size_t i = 0; i < slots_.size(); ++i)
+    {
+        auto j = (nextSlot_ + i) % slots_.size();
+        if (slots_[j].ticket == 0)
+        {
+            index = j;
+            break;
+        }
+    }
+
+    if (index == slots_.size())
+    {
+        slots_.push_back({});
+        glGenBuffers(1, &(slots_.back().buffer));
+    }
+
+    nextSlot_ = (index + 1) % slots_.size();
+
+    /* Grow buffer storage if necessary */
+    auto& slot = slots_[index];
+    if (slot.capacity < size)
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot.buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        slot.capacity = size;
+    }
+
+    return slot;
+}
+
+bool GLTextureReadbackRing::WaitForSlot(Slot& slot, bool wait)
+{
+    #ifdef GL_ARB_sync
+    if (slot.sync)
+    {
+        /* Poll fence first and flush the command stream, so the fence is guaranteed to be signaled eventually */
+        auto result = glClientWaitSync(slot.sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            if (!wait)
+                return false;
+            do
+            {
+                result = glClientWaitSync(slot.sync, GL_SYNC_FLUSH_COMMANDS_BIT, g_textureReadbackWaitTimeout);
+            }
+            while (result == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(slot.sync);
+        slot.sync = nullptr;
+    }
+    #endif // /GL_ARB_sync
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,82 @@
+/*
+ * GLTextureReadbackRing.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_TEXTURE_READBACK_RING_H
+#define LLGL_GL_TEXTURE_READBACK_RING_H
+
+
+#include "../OpenGL.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+
+/*
+Ring of pixel pack buffers (GL_PIXEL_PACK_BUFFER) for asynchronous texture read operations.
+Each read operation copies the texture into a free buffer of the ring and is protected by a fence (GL_ARB_sync),
+so the image data can be retrieved without stalling the CPU once the GPU has executed the copy command.
+Buffers are reused in ring order and the ring grows if all buffers are still pending.
+*/
+class GLTextureReadbackRing
+{
+
+    public:
+
+        GLTextureReadbackRing() = default;
+        ~GLTextureReadbackRing();
+
+        GLTextureReadbackRing(const GLTextureReadbackRing&) = delete;
+        GLTextureReadbackRing& operator = (const GLTextureReadbackRing&) = delete;
+
+        // Issues a read operation of the specified MIP-map level into the next free pixel pack buffer and returns its ticket.
+        std::uint64_t ReadTexture(const GLTexture& textureGL, std::uint32_t mipLevel);
+
+        /*
+        Copies the image data of the specified read operation into 'data' and frees its buffer.
+        Returns false if the operation is still pending and 'wait' is false.
+        Throws std::runtime_error if the buffer could not be mapped, in which case the read operation is discarded.
+        */
+        bool QueryResult(std::uint64_t ticket, void* data, std::size_t dataSize, bool wait);
+
+    private:
+
+        struct Slot
+        {
+            GLuint          buffer      = 0;
+            GLsizeiptr      capacity    = 0;
+            GLsizeiptr      size        = 0;        // Size of the pending image data
+            GLsync          sync        = nullptr;  // Fence of the pending read operation (null if GL_ARB_sync is not supported)
+            std::uint64_t   ticket      = 0;        // Ticket of the pending read operation (0 if the slot is free)
+        };
+
+        // Returns the next free slot in ring order with a buffer of at least the specified size.
+        Slot& AllocSlot(GLsizeiptr size);
+
+        // Waits for or polls the fence of the specified slot. Returns true if the read operation has been completed.
+        bool WaitForSlot(Slot& slot, bool wait);
+
+        std::vector<Slot>   slots_;
+        std::size_t         nextSlot_   = 0;
+        std::uint64_t       lastTicket_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,398 @@
+/*
+ * ProfCommandBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ProfCommandBuffer.h"
+#include "ProfGraphicsPipeline.h"
+#include "../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+ProfCommandBuffer::ProfCommandBuffer(CommandBuffer& instance, CommandBufferExt* instanceExt, RenderingProfiler& profiler) :
+    instance    { instance    },
+    instanceExt { instanceExt },
+    profiler_   { profiler    }
+{
+}
+
+/* ----- Configuration ----- */
+
+void ProfCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
+{
+    instance.SetGraphicsAPIDependentState(stateDesc, stateDescSize);
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void ProfCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    instance.SetViewport(viewport);
+}
+
+void ProfCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    instance.SetViewports(numViewports, viewports);
+}
+
+void ProfCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    instance.SetScissor(scissor);
+}
+
+void ProfCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    instance.SetScissors(numScissors, scissors);
+}
+
+/* ----- Clear ----- */
+
+void ProfCommandBuffer::SetClearColor(const ColorRGBAf& color)
+{
+    instance.SetClearColor(color);
+}
+
+void ProfCommandBuffer::SetClearDepth(float depth)
+{
+    instance.SetClearDepth(depth);
+}
+
+void ProfCommandBuffer::SetClearStencil(std::uint32_t stencil)
+{
+    instance.SetClearStencil(stencil);
+}
+
+void ProfCommandBuffer::Clear(long flags)
+{
+    instance.Clear(flags);
+}
+
+void ProfCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    instance.ClearAttachments(numAttachments, attachments);
+}
+
+/* ----- Copy ----- */
+
+void ProfCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    instance.UpdateBuffer(dstBuffer, dstOffset, data, dataSize);
+}
+
+void ProfCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    instance.CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
+}
+
+void ProfCommandBuffer::CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset)
+{
+    instance.CopyBufferToTexture(dstTexture, dstRegion, srcBuffer, srcOffset);
+}
+
+void ProfCommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    instance.CopyTexture(dstTexture, dstRegion, srcTexture, srcMipLevel, srcOffset);
+}
+
+/* ----- Input Assembly ------ */
+
+void ProfCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    instance.SetVertexBuffer(buffer);
+    profiler_.setVertexBuffer.Inc();
+}
+
+void ProfCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    instance.SetVertexBufferArray(bufferArray);
+    profiler_.setVertexBuffer.Inc();
+}
+
+void ProfCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    instance.SetIndexBuffer(buffer);
+    profiler_.setIndexBuffer.Inc();
+}
+
+/* ----- Constant Buffers ------ */
+
+void ProfCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags)
+{
+    instanceExt->SetConstantBuffer(buffer, slot, stageFlags);
+    profiler_.setConstantBuffer.Inc();
+}
+
+/* ----- Storage Buffers ------ */
+
+void ProfCommandBuffer::SetStorageBuffer(Buffer& buffer, std::uint32_t slot, long stageFlags)
+{
+    instanceExt->SetStorageBuffer(buffer, slot, stageFlags);
+    profiler_.setStorageBuffer.Inc();
+}
+
+/* ----- Stream Output Buffers ------ */
+
+void ProfCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+{
+    instance.SetStreamOutputBuffer(buffer);
+    profiler_.setStreamOutputBuffer.Inc();
+}
+
+void ProfCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+{
+    instance.SetStreamOutputBufferArray(bufferArray);
+    profiler_.setStreamOutputBuffer.Inc();
+}
+
+void ProfCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
+{
+    instance.BeginStreamOutput(primitiveType);
+}
+
+void ProfCommandBuffer::EndStreamOutput()
+{
+    instance.EndStreamOutput();
+}
+
+/* ----- Textures ----- */
+
+void ProfCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long stageFlags)
+{
+    instanceExt->SetTexture(texture, slot, stageFlags);
+    profiler_.setTexture.Inc();
+}
+
+/* ----- Sampler States ----- */
+
+void ProfCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long stageFlags)
+{
+    instanceExt->SetSampler(sampler, slot, stageFlags);
+    profiler_.setSampler.Inc();
+}
+
+/* ----- Resource View Heaps ----- */
+
+void ProfCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    instance.SetGraphicsResourceHeap(resourceHeap, firstSet);
+}
+
+void ProfCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    instance.SetComputeResourceHeap(resourceHeap, firstSet);
+}
+
+void ProfCommandBuffer::SetGraphicsResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    instance.SetGraphicsResourceHeapWithOffsets(resourceHeap, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
+void ProfCommandBuffer::SetComputeResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    instance.SetComputeResourceHeapWithOffsets(resourceHeap, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
+/* ----- Render Targets ----- */
+
+void ProfCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+{
+    instance.SetRenderTarget(renderTarget);
+    profiler_.setRenderTarget.Inc();
+}
+
+void ProfCommandBuffer::SetRenderTarget(RenderContext& renderContext)
+{
+    instance.SetRenderTarget(renderContext);
+    profiler_.setRenderTarget.Inc();
+}
+
+/* ----- Pipeline States ----- */
+
+void ProfCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    auto& graphicsPipelineProf = LLGL_CAST(ProfGraphicsPipeline&, graphicsPipeline);
+
+    /* Store primitive topology used in graphics pipeline */
+    topology_ = graphicsPipelineProf.topology;
+
+    instance.SetGraphicsPipeline(graphicsPipelineProf.instance);
+
+    profiler_.setGraphicsPipeline.Inc();
+    RecordStateChangeStatistics();
+}
+
+void ProfCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+{
+    instance.SetComputePipeline(computePipeline);
+    profiler_.setComputePipeline.Inc();
+}
+
+bool ProfCommandBuffer::QueryStateChangeStatistics(StateChangeStatistics& statistics) const
+{
+    return instance.QueryStateChangeStatistics(statistics);
+}
+
+/* ----- Queries ----- */
+
+void ProfCommandBuffer::BeginQuery(Query& query)
+{
+    instance.BeginQuery(query);
+}
+
+void ProfCommandBuffer::EndQuery(Query& query)
+{
+    instance.EndQuery(query);
+}
+
+bool ProfCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
+{
+    return instance.QueryResult(query, result);
+}
+
+bool ProfCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result)
+{
+    return instance.QueryPipelineStatisticsResult(query, result);
+}
+
+void ProfCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
+{
+    instance.BeginRenderCondition(query, mode);
+}
+
+void ProfCommandBuffer::EndRenderCondition()
+{
+    instance.EndRenderCondition();
+}
+
+/* ----- Drawing ----- */
+
+void ProfCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    instance.Draw(numVertices, firstVertex);
+    profiler_.RecordDrawCall(topology_, numVertices);
+}
+
+void ProfCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    instance.DrawIndexed(numIndices, firstIndex);
+    profiler_.RecordDrawCall(topology_, numIndices);
+}
+
+void ProfCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    instance.DrawIndexed(numIndices, firstIndex, vertexOffset);
+    profiler_.RecordDrawCall(topology_, numIndices);
+}
+
+void ProfCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    instance.DrawInstanced(numVertices, firstVertex, numInstances);
+    profiler_.RecordDrawCall(topology_, numVertices, numInstances);
+}
+
+void ProfCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    instance.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+    profiler_.RecordDrawCall(topology_, numVertices, numInstances);
+}
+
+void ProfCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+    profiler_.RecordDrawCall(topology_, numIndices, numInstances);
+}
+
+void ProfCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+    profiler_.RecordDrawCall(topology_, numIndices, numInstances);
+}
+
+void ProfCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+    profiler_.RecordDrawCall(topology_, numIndices, numInstances);
+}
+
+void ProfCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    instance.DrawIndirect(buffer, offset);
+    profiler_.drawCalls.Inc();
+}
+
+void ProfCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    instance.DrawIndirect(buffer, offset, numCommands, stride);
+    profiler_.drawCalls.Inc(numCommands);
+}
+
+void ProfCommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    instance.DrawIndirectCount(buffer, offset, countBuffer, countOffset, maxNumCommands, stride);
+    profiler_.drawCalls.Inc();
+}
+
+void ProfCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    instance.DrawIndexedIndirect(buffer, offset);
+    profiler_.drawCalls.Inc();
+}
+
+void ProfCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    instance.DrawIndexedIndirect(buffer, offset, numCommands, stride);
+    profiler_.drawCalls.Inc(numCommands);
+}
+
+void ProfCommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    instance.DrawIndexedIndirectCount(buffer, offset, countBuffer, countOffset, maxNumCommands, stride);
+    profiler_.drawCalls.Inc();
+}
+
+/* ----- Compute ----- */
+
+void ProfCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
+{
+    instance.Dispatch(groupSizeX, groupSizeY, groupSizeZ);
+    profiler_.dispatchComputeCalls.Inc();
+}
+
+void ProfCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    instance.DispatchIndirect(buffer, offset);
+    profiler_.dispatchComputeCalls.Inc();
+}
+
+/* ----- Profiling members ----- */
+
+void ProfCommandBuffer::RecordStateChangeStatistics()
+{
+    StateChangeStatistics stats;
+    if (instance.QueryStateChangeStatistics(stats))
+    {
+        profiler_.pipelineStateChanges.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.issuedStateChanges - stateChangeStats_.issuedStateChanges));
+        profiler_.pipelineStateChangesSkipped.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.skippedStateChanges - stateChangeStats_.skippedStateChanges));
+        stateChangeStats_ = stats;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,55 @@
+/*
+ * ProfCommandQueue.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ProfCommandQueue.h"
+#include "ProfCommandBuffer.h"
+#include "../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+ProfCommandQueue::ProfCommandQueue(CommandQueue& instance) :
+    instance { instance }
+{
+}
+
+/* ----- Command queues ----- */
+
+void ProfCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferProf = LLGL_CAST(ProfCommandBuffer&, commandBuffer);
+    instance.Submit(commandBufferProf.instance);
+
+    /* Deferred command buffers issue their state changes when they are submitted */
+    commandBufferProf.RecordStateChangeStatistics();
+}
+
+/* ----- Fences ----- */
+
+void ProfCommandQueue::Submit(Fence& fence)
+{
+    instance.Submit(fence);
+}
+
+bool ProfCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    return instance.WaitFence(fence, timeout);
+}
+
+void ProfCommandQueue::WaitIdle()
+{
+    instance.WaitIdle();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
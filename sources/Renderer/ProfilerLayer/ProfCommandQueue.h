@@ -0,0 +1,49 @@
+/*
+ * ProfCommandQueue.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_PROF_COMMAND_QUEUE_H
+#define LLGL_PROF_COMMAND_QUEUE_H
+
+
+#include <LLGL/CommandQueue.h>
+
+
+namespace LLGL
+{
+
+
+class ProfCommandQueue : public CommandQueue
+{
+
+    public:
+
+        ProfCommandQueue(CommandQueue& instance);
+
+        /* ----- Command queues ----- */
+
+        void Submit(CommandBuffer& commandBuffer) override;
+
+        /* ----- Fences ----- */
+
+        void Submit(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+        void WaitIdle() override;
+
+        CommandQueue& instance;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,45 @@
+/*
+ * ProfGraphicsPipeline.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_PROF_GRAPHICS_PIPELINE_H
+#define LLGL_PROF_GRAPHICS_PIPELINE_H
+
+
+#include <LLGL/GraphicsPipeline.h>
+#include <LLGL/GraphicsPipelineFlags.h>
+
+
+namespace LLGL
+{
+
+
+// Graphics pipeline of the profiling layer, which only stores the primitive topology to count the rendered primitives.
+class ProfGraphicsPipeline : public GraphicsPipeline
+{
+
+    public:
+
+        ProfGraphicsPipeline(GraphicsPipeline& instance, const PrimitiveTopology topology) :
+            instance { instance },
+            topology { topology }
+        {
+        }
+
+        GraphicsPipeline&       instance;
+        const PrimitiveTopology topology;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
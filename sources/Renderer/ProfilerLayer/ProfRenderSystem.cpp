@@ -0,0 +1,356 @@
+/*
+ * ProfRenderSystem.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ProfRenderSystem.h"
+#include "../../Core/Helper.h"
+#include "../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+ProfRenderSystem::ProfRenderSystem(const std::shared_ptr<RenderSystem>& instance, RenderingProfiler& profiler) :
+    instance_ { instance },
+    profiler_ { profiler }
+{
+    /* Some render systems already provide their capabilities before a render context is created */
+    SetRendererInfo(instance_->GetRendererInfo());
+    SetRenderingCaps(instance_->GetRenderingCaps());
+}
+
+void ProfRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
+{
+    RenderSystem::SetConfiguration(config);
+    instance_->SetConfiguration(config);
+}
+
+/* ----- Render Context ----- */
+
+RenderContext* ProfRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
+{
+    auto renderContext = instance_->CreateRenderContext(desc, surface);
+
+    SetRendererInfo(instance_->GetRendererInfo());
+    SetRenderingCaps(instance_->GetRenderingCaps());
+
+    return renderContext;
+}
+
+void ProfRenderSystem::Release(RenderContext& renderContext)
+{
+    instance_->Release(renderContext);
+}
+
+/* ----- Command queues ----- */
+
+CommandQueue* ProfRenderSystem::GetCommandQueue()
+{
+    /* Wrap command queue of the instance, so that profiling command buffers can be unwrapped on submission */
+    if (!commandQueue_)
+    {
+        if (auto commandQueueInstance = instance_->GetCommandQueue())
+            commandQueue_ = MakeUnique<ProfCommandQueue>(*commandQueueInstance);
+    }
+    return commandQueue_.get();
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* ProfRenderSystem::CreateCommandBuffer()
+{
+    return TakeOwnership(commandBuffers_, MakeUnique<ProfCommandBuffer>(*instance_->CreateCommandBuffer(), nullptr, profiler_));
+}
+
+CommandBufferExt* ProfRenderSystem::CreateCommandBufferExt()
+{
+    if (auto instance = instance_->CreateCommandBufferExt())
+        return TakeOwnership(commandBuffers_, MakeUnique<ProfCommandBuffer>(*instance, instance, profiler_));
+    return nullptr;
+}
+
+void ProfRenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferProf = LLGL_CAST(ProfCommandBuffer&, commandBuffer);
+    instance_->Release(commandBufferProf.instance);
+    RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* ProfRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
+{
+    return instance_->CreateBuffer(desc, initialData);
+}
+
+BufferArray* ProfRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    return instance_->CreateBufferArray(numBuffers, bufferArray);
+}
+
+void ProfRenderSystem::Release(Buffer& buffer)
+{
+    instance_->Release(buffer);
+}
+
+void ProfRenderSystem::Release(BufferArray& bufferArray)
+{
+    instance_->Release(bufferArray);
+}
+
+void ProfRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t dataSize, std::size_t offset)
+{
+    instance_->WriteBuffer(buffer, data, dataSize, offset);
+    profiler_.writeBuffer.Inc();
+    profiler_.writeBufferBytes.Inc(static_cast<RenderingProfiler::Counter::ValueType>(dataSize));
+    RecordStagingStatistics();
+}
+
+void* ProfRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
+{
+    auto result = instance_->MapBuffer(buffer, access);
+    profiler_.mapBuffer.Inc();
+    return result;
+}
+
+void ProfRenderSystem::UnmapBuffer(Buffer& buffer)
+{
+    instance_->UnmapBuffer(buffer);
+}
+
+bool ProfRenderSystem::QueryStagingStatistics(StagingStatistics& statistics) const
+{
+    return instance_->QueryStagingStatistics(statistics);
+}
+
+/* ----- Textures ----- */
+
+Texture* ProfRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+{
+    return instance_->CreateTexture(textureDesc, imageDesc);
+}
+
+void ProfRenderSystem::Release(Texture& texture)
+{
+    instance_->Release(texture);
+}
+
+void ProfRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc)
+{
+    instance_->WriteTexture(texture, subTextureDesc, imageDesc);
+}
+
+void ProfRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    instance_->ReadTexture(texture, mipLevel, imageDesc);
+}
+
+std::uint64_t ProfRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    return instance_->ReadTextureAsync(texture, mipLevel);
+}
+
+bool ProfRenderSystem::QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait)
+{
+    return instance_->QueryTextureReadResult(ticket, imageDesc, wait);
+}
+
+void ProfRenderSystem::GenerateMips(Texture& texture)
+{
+    instance_->GenerateMips(texture);
+}
+
+void ProfRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers)
+{
+    instance_->GenerateMips(texture, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* ProfRenderSystem::CreateSampler(const SamplerDescriptor& desc)
+{
+    return instance_->CreateSampler(desc);
+}
+
+void ProfRenderSystem::Release(Sampler& sampler)
+{
+    instance_->Release(sampler);
+}
+
+/* ----- Resource Views ----- */
+
+ResourceHeap* ProfRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    return instance_->CreateResourceHeap(desc);
+}
+
+void ProfRenderSystem::Release(ResourceHeap& resourceViewHeap)
+{
+    instance_->Release(resourceViewHeap);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* ProfRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
+{
+    return instance_->CreateRenderTarget(desc);
+}
+
+void ProfRenderSystem::Release(RenderTarget& renderTarget)
+{
+    instance_->Release(renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* ProfRenderSystem::CreateShader(const ShaderDescriptor& desc)
+{
+    return instance_->CreateShader(desc);
+}
+
+ShaderProgram* ProfRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    return instance_->CreateShaderProgram(desc);
+}
+
+void ProfRenderSystem::Release(Shader& shader)
+{
+    instance_->Release(shader);
+}
+
+void ProfRenderSystem::Release(ShaderProgram& shaderProgram)
+{
+    instance_->Release(shaderProgram);
+}
+
+/* ----- Pipeline Layouts ----- */
+
+PipelineLayout* ProfRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
+{
+    return instance_->CreatePipelineLayout(desc);
+}
+
+void ProfRenderSystem::Release(PipelineLayout& pipelineLayout)
+{
+    instance_->Release(pipelineLayout);
+}
+
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* ProfRenderSystem::CreatePipelineCache(const void* initialBlob, std::size_t initialBlobSize)
+{
+    return instance_->CreatePipelineCache(initialBlob, initialBlobSize);
+}
+
+void ProfRenderSystem::Release(PipelineCache& pipelineCache)
+{
+    instance_->Release(pipelineCache);
+}
+
+/* ----- Pipeline States ----- */
+
+GraphicsPipeline* ProfRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    auto pipelineProf = MakeUnique<ProfGraphicsPipeline>(*instance_->CreateGraphicsPipeline(desc), desc.primitiveTopology);
+
+    std::lock_guard<std::mutex> lock { pipelineMutex_ };
+    return TakeOwnership(graphicsPipelines_, std::move(pipelineProf));
+}
+
+ComputePipeline* ProfRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+{
+    return instance_->CreateComputePipeline(desc);
+}
+
+std::future<GraphicsPipeline*> ProfRenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    /*
+    Start the creation with the wrapped render system right away, so it keeps running asynchronously,
+    and wrap its result with a deferred continuation once the client waits for the future
+    */
+    return std::async(
+        std::launch::deferred,
+        [this](std::future<GraphicsPipeline*> instanceFuture, PrimitiveTopology topology) -> GraphicsPipeline*
+        {
+            auto pipelineProf = MakeUnique<ProfGraphicsPipeline>(*instanceFuture.get(), topology);
+
+            std::lock_guard<std::mutex> lock { pipelineMutex_ };
+            return TakeOwnership(graphicsPipelines_, std::move(pipelineProf));
+        },
+        instance_->CreateGraphicsPipelineAsync(desc),
+        desc.primitiveTopology
+    );
+}
+
+std::future<ComputePipeline*> ProfRenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    /* Compute pipelines are not wrapped, so the future of the wrapped render system can be passed on */
+    return instance_->CreateComputePipelineAsync(desc);
+}
+
+void ProfRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
+{
+    auto& graphicsPipelineProf = LLGL_CAST(ProfGraphicsPipeline&, graphicsPipeline);
+    instance_->Release(graphicsPipelineProf.instance);
+
+    std::lock_guard<std::mutex> lock { pipelineMutex_ };
+    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+}
+
+void ProfRenderSystem::Release(ComputePipeline& computePipeline)
+{
+    instance_->Release(computePipeline);
+}
+
+/* ----- Queries ----- */
+
+Query* ProfRenderSystem::CreateQuery(const QueryDescriptor& desc)
+{
+    return instance_->CreateQuery(desc);
+}
+
+void ProfRenderSystem::Release(Query& query)
+{
+    instance_->Release(query);
+}
+
+/* ----- Fences ----- */
+
+Fence* ProfRenderSystem::CreateFence()
+{
+    return instance_->CreateFence();
+}
+
+void ProfRenderSystem::Release(Fence& fence)
+{
+    instance_->Release(fence);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void ProfRenderSystem::RecordStagingStatistics()
+{
+    StagingStatistics stats;
+    if (instance_->QueryStagingStatistics(stats))
+    {
+        profiler_.stagingRingBufferBytes.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.ringBufferBytes - stagingStats_.ringBufferBytes));
+        profiler_.stagingRingBufferHighWaterMark.Max(static_cast<RenderingProfiler::Counter::ValueType>(stats.ringBufferHighWaterMark));
+        profiler_.stagingRingBufferStalls.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.ringBufferStalls - stagingStats_.ringBufferStalls));
+        profiler_.temporaryStagingBuffers.Inc(static_cast<RenderingProfiler::Counter::ValueType>(stats.temporaryStagingBuffers - stagingStats_.temporaryStagingBuffers));
+        stagingStats_ = stats;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,176 @@
+/*
+ * ProfRenderSystem.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_PROF_RENDER_SYSTEM_H
+#define LLGL_PROF_RENDER_SYSTEM_H
+
+
+#include <LLGL/RenderSystem.h>
+#include "ProfCommandQueue.h"
+#include "ProfCommandBuffer.h"
+#include "ProfGraphicsPipeline.h"
+
+#include "../ContainerTypes.h"
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Profiling layer render system, which is used instead of the debug layer if only a profiler but no debugger is specified.
+It performs no validation and only wraps the objects that are required to update the profiler counters,
+i.e. command queues, command buffers, and graphics pipelines. All other objects of the wrapped render system are passed on directly.
+*/
+class ProfRenderSystem : public RenderSystem
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        ProfRenderSystem(const std::shared_ptr<RenderSystem>& instance, RenderingProfiler& profiler);
+
+        void SetConfiguration(const RenderSystemConfiguration& config) override;
+
+        /* ----- Render Context ------ */
+
+        RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
+
+        void Release(RenderContext& renderContext) override;
+
+        /* ----- Command queues ----- */
+
+        CommandQueue* GetCommandQueue() override;
+
+        /* ----- Command buffers ----- */
+
+        CommandBuffer* CreateCommandBuffer() override;
+        CommandBufferExt* CreateCommandBufferExt() override;
+
+        void Release(CommandBuffer& commandBuffer) override;
+
+        /* ----- Buffers ------ */
+
+        Buffer* CreateBuffer(const BufferDescriptor& desc, const void* initialData = nullptr) override;
+        BufferArray* CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray) override;
+
+        void Release(Buffer& buffer) override;
+        void Release(BufferArray& bufferArray) override;
+
+        void WriteBuffer(Buffer& buffer, const void* data, std::size_t dataSize, std::size_t offset) override;
+
+        void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
+        void UnmapBuffer(Buffer& buffer) override;
+
+        bool QueryStagingStatistics(StagingStatistics& statistics) const override;
+
+        /* ----- Textures ----- */
+
+        Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+
+        void Release(Texture& texture) override;
+
+        void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc) override;
+        void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
+
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        bool QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait = false) override;
+
+        void GenerateMips(Texture& texture) override;
+        void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
+
+        /* ----- Sampler States ---- */
+
+        Sampler* CreateSampler(const SamplerDescriptor& desc) override;
+
+        void Release(Sampler& sampler) override;
+
+        /* ----- Resource Views ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceViewHeap) override;
+
+        /* ----- Render Targets ----- */
+
+        RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
+
+        void Release(RenderTarget& renderTarget) override;
+
+        /* ----- Shader ----- */
+
+        Shader* CreateShader(const ShaderDescriptor& desc) override;
+
+        ShaderProgram* CreateShaderProgram(const ShaderProgramDescriptor& desc) override;
+
+        void Release(Shader& shader) override;
+        void Release(ShaderProgram& shaderProgram) override;
+
+        /* ----- Pipeline Layouts ----- */
+
+        PipelineLayout* CreatePipelineLayout(const PipelineLayoutDescriptor& desc) override;
+
+        void Release(PipelineLayout& pipelineLayout) override;
+
+        /* ----- Pipeline Caches ----- */
+
+        PipelineCache* CreatePipelineCache(const void* initialBlob = nullptr, std::size_t initialBlobSize = 0) override;
+
+        void Release(PipelineCache& pipelineCache) override;
+
+        /* ----- Pipeline States ----- */
+
+        GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
+        ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
+
+        std::future<GraphicsPipeline*> CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc) override;
+        std::future<ComputePipeline*> CreateComputePipelineAsync(const ComputePipelineDescriptor& desc) override;
+
+        void Release(GraphicsPipeline& graphicsPipeline) override;
+        void Release(ComputePipeline& computePipeline) override;
+
+        /* ----- Queries ----- */
+
+        Query* CreateQuery(const QueryDescriptor& desc) override;
+
+        void Release(Query& query) override;
+
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+    private:
+
+        void RecordStagingStatistics();
+
+    private:
+
+        std::shared_ptr<RenderSystem>               instance_;
+        RenderingProfiler&                          profiler_;
+
+        HWObjectInstance<ProfCommandQueue>          commandQueue_;
+        HWObjectContainer<ProfCommandBuffer>        commandBuffers_;
+        HWObjectContainer<ProfGraphicsPipeline>     graphicsPipelines_;
+        std::mutex                                  pipelineMutex_;     // Guards 'graphicsPipelines_' against asynchronous pipeline creation
+
+        StagingStatistics                           stagingStats_;      // Last queried staging statistics of the wrapped render system
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
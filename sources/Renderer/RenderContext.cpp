@@ -28,6 +28,11 @@ static bool IsVideoModeValid(const VideoModeDescriptor& videoModeDesc)
     return (videoModeDesc.resolution.width > 0 && videoModeDesc.resolution.height > 0 && videoModeDesc.swapChainSize > 0);
 }
 
+bool RenderContext::QueryFramePacingStatistics(FramePacingStatistics& /*stats*/) const
+{
+    return false;
+}
+
 bool RenderContext::SetVideoMode(const VideoModeDescriptor& videoModeDesc)
 {
     if (IsVideoModeValid(videoModeDesc))
@@ -145,6 +150,17 @@ bool RenderContext::SwitchFullscreenMode(const VideoModeDescriptor& videoModeDes
 
 bool RenderContext::SetVideoModePrimary(const VideoModeDescriptor& videoModeDesc)
 {
+    /* Headless render contexts (e.g. of the Null renderer) have no surface to adapt */
+    if (!surface_)
+    {
+        if (OnSetVideoMode(videoModeDesc))
+        {
+            videoModeDesc_ = videoModeDesc;
+            return true;
+        }
+        return false;
+    }
+
     bool result = true;
 
     auto& surface = GetSurface();
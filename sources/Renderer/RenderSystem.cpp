@@ -7,6 +7,7 @@
 
 #include "../Platform/Module.h"
 #include "../Core/Helper.h"
+#include "../Core/ThreadPool.h"
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Log.h>
 #include "BuildID.h"
@@ -14,6 +15,10 @@
 #include <LLGL/RenderSystem.h>
 #include <array>
 #include <map>
+#include <string.h>
+
+#include "ProfilerLayer/ProfRenderSystem.h"
+#include "CaptureLayer/CaptureRenderSystem.h"
 
 #ifdef LLGL_ENABLE_DEBUG_LAYER
 #   include "DebugLayer/DbgRenderSystem.h"
@@ -32,6 +37,25 @@ namespace LLGL
 
 static std::map<RenderSystem*, std::unique_ptr<Module>> g_renderSystemModules;
 
+// Pending results of the default asynchronous texture read implementation
+struct RenderSystem::TextureReadResults
+{
+    std::map<std::uint64_t, std::vector<char>>  reads;
+    std::uint64_t                               lastTicket  = 0;
+};
+
+RenderSystem::RenderSystem()
+{
+    /* Keep the worker threads of the shared job pool alive as long as this render system exists */
+    AcquireSharedThreadPool();
+}
+
+RenderSystem::~RenderSystem()
+{
+    /* Join the worker threads with the last render system, i.e. before its module is unloaded */
+    ReleaseSharedThreadPool();
+}
+
 std::vector<std::string> RenderSystem::FindModules()
 {
     /* Iterate over all known modules and return those that are available on the current platform */
@@ -53,6 +77,8 @@ std::vector<std::string> RenderSystem::FindModules()
         "Direct3D11",
         "Direct3D12",
         #endif
+
+        "Null",
     };
 
     std::vector<std::string> modules;
@@ -118,6 +144,44 @@ static RenderSystem* LoadRenderSystem(Module& module, const std::string& moduleF
 
 #endif // /LLGL_BUILD_STATIC_LIB
 
+/*
+Wraps the specified render system into the debug layer if a debugger is specified,
+or into the lightweight profiling layer if only a profiler is specified.
+*/
+static void WrapRenderSystemLayer(std::unique_ptr<RenderSystem>& renderSystem, RenderingProfiler* profiler, RenderingDebugger* debugger)
+{
+    if (debugger != nullptr)
+    {
+        #ifdef LLGL_ENABLE_DEBUG_LAYER
+
+        /* Create debug layer render system */
+        renderSystem = MakeUnique<DbgRenderSystem>(std::move(renderSystem), profiler, debugger);
+        return;
+
+        #else
+
+        Log::StdErr() << "LLGL was not compiled with debug layer support" << std::endl;
+
+        #endif // /LLGL_ENABLE_DEBUG_LAYER
+    }
+
+    if (profiler != nullptr)
+    {
+        /* Create profiling layer render system */
+        renderSystem = MakeUnique<ProfRenderSystem>(std::move(renderSystem), *profiler);
+    }
+}
+
+/*
+Wraps the specified render system into the capture layer if a capture filename is specified.
+This is the outermost layer, so the trace contains exactly the calls of the application.
+*/
+static void WrapRenderSystemCapture(std::unique_ptr<RenderSystem>& renderSystem, const RenderSystemDescriptor& renderSystemDesc)
+{
+    if (!renderSystemDesc.captureFilename.empty())
+        renderSystem = MakeUnique<CaptureRenderSystem>(std::move(renderSystem), renderSystemDesc.captureFilename);
+}
+
 std::unique_ptr<RenderSystem> RenderSystem::Load(
     const RenderSystemDescriptor& renderSystemDesc, RenderingProfiler* profiler, RenderingDebugger* debugger)
 {
@@ -133,19 +197,9 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
     /* Allocate render system */
     auto renderSystem   = std::unique_ptr<RenderSystem>(reinterpret_cast<RenderSystem*>(LLGL_RenderSystem_Alloc()));
 
-    if (profiler != nullptr || debugger != nullptr)
-    {
-        #ifdef LLGL_ENABLE_DEBUG_LAYER
-
-        /* Create debug layer render system */
-        renderSystem = MakeUnique<DbgRenderSystem>(std::move(renderSystem), profiler, debugger);
-
-        #else
-
-        Log::StdErr() << "LLGL was not compiled with debug layer support" << std::endl;
-
-        #endif // /LLGL_ENABLE_DEBUG_LAYER
-    }
+    /* Wrap render system into debug or profiling layer, and into capture layer */
+    WrapRenderSystemLayer(renderSystem, profiler, debugger);
+    WrapRenderSystemCapture(renderSystem, renderSystemDesc);
 
     renderSystem->name_         = LLGL_RenderSystem_Name();
     renderSystem->rendererID_   = LLGL_RenderSystem_RendererID();
@@ -171,19 +225,9 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
         /* Allocate render system */
         auto renderSystem = std::unique_ptr<RenderSystem>(LoadRenderSystem(*module, moduleFilename, renderSystemDesc));
 
-        if (profiler != nullptr || debugger != nullptr)
-        {
-            #ifdef LLGL_ENABLE_DEBUG_LAYER
-
-            /* Create debug layer render system */
-            renderSystem = MakeUnique<DbgRenderSystem>(std::move(renderSystem), profiler, debugger);
-
-            #else
-
-            Log::StdErr() << "LLGL was not compiled with debug layer support" << std::endl;
-
-            #endif // /LLGL_ENABLE_DEBUG_LAYER
-        }
+        /* Wrap render system into debug or profiling layer, and into capture layer */
+        WrapRenderSystemLayer(renderSystem, profiler, debugger);
+        WrapRenderSystemCapture(renderSystem, renderSystemDesc);
 
         renderSystem->name_         = LoadRenderSystemName(*module);
         renderSystem->rendererID_   = LoadRenderSystemRendererID(*module);
@@ -219,6 +263,84 @@ void RenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     config_ = config;
 }
 
+std::future<GraphicsPipeline*> RenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    /* Create pipeline immediately and return a future that is already ready */
+    std::promise<GraphicsPipeline*> promise;
+    try
+    {
+        promise.set_value(CreateGraphicsPipeline(desc));
+    }
+    catch (...)
+    {
+        promise.set_exception(std::current_exception());
+    }
+    return promise.get_future();
+}
+
+std::future<ComputePipeline*> RenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    /* Create pipeline immediately and return a future that is already ready */
+    std::promise<ComputePipeline*> promise;
+    try
+    {
+        promise.set_value(CreateComputePipeline(desc));
+    }
+    catch (...)
+    {
+        promise.set_exception(std::current_exception());
+    }
+    return promise.get_future();
+}
+
+bool RenderSystem::QueryStagingStatistics(StagingStatistics& /*statistics*/) const
+{
+    return false;
+}
+
+std::uint64_t RenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    /* Determine image format that matches the hardware format of the texture */
+    ImageFormat imageFormat = ImageFormat::RGBA;
+    DataType    dataType    = DataType::UInt8;
+
+    if (!FindSuitableImageFormat(texture.QueryDesc().format, imageFormat, dataType))
+        throw std::invalid_argument("cannot read texture with unsupported format asynchronously");
+
+    /* Read texture immediately and keep image data until the result is queried */
+    const auto extent   = texture.QueryMipExtent(mipLevel);
+    const auto dataSize = ImageDataSize(imageFormat, dataType, extent.width * extent.height * extent.depth);
+
+    std::vector<char> imageData(dataSize);
+    ReadTexture(texture, mipLevel, { imageFormat, dataType, imageData.data(), imageData.size() });
+
+    if (!textureReadResults_)
+        textureReadResults_ = MakeUnique<TextureReadResults>();
+
+    const auto ticket = ++textureReadResults_->lastTicket;
+    textureReadResults_->reads[ticket] = std::move(imageData);
+
+    return ticket;
+}
+
+bool RenderSystem::QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool /*wait*/)
+{
+    if (textureReadResults_)
+    {
+        auto& reads = textureReadResults_->reads;
+        auto it = reads.find(ticket);
+        if (it != reads.end())
+        {
+            /* Copy image data to output buffer and invalidate ticket */
+            AssertImageDataSize(imageDesc.dataSize, it->second.size());
+            ::memcpy(imageDesc.data, it->second.data(), it->second.size());
+            reads.erase(it);
+            return true;
+        }
+    }
+    throw std::invalid_argument("invalid ticket for asynchronous texture read: " + std::to_string(ticket));
+}
+
 
 /*
  * ======= Protected: =======
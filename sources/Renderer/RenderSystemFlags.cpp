@@ -95,6 +95,9 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasConservativeRasterization, "conservative rasterization" );
     LLGL_VALIDATE_FEATURE( hasStreamOutputs,             "stream outputs"             );
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"  );
+    LLGL_VALIDATE_FEATURE( hasIndirectDrawing,           "indirect drawing"           );
+    LLGL_VALIDATE_FEATURE( hasIndirectCountDrawing,      "indirect count drawing"     );
+    LLGL_VALIDATE_FEATURE( hasTimestampQueries,          "timestamp queries"          );
 
     #undef LLGL_VALIDATE_FEATURE
 
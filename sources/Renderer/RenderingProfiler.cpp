@@ -15,7 +15,12 @@ namespace LLGL
 void RenderingProfiler::ResetCounters()
 {
     writeBuffer.Reset();
+    writeBufferBytes.Reset();
     mapBuffer.Reset();
+    stagingRingBufferBytes.Reset();
+    stagingRingBufferHighWaterMark.Reset();
+    stagingRingBufferStalls.Reset();
+    temporaryStagingBuffers.Reset();
 
     setVertexBuffer.Reset();
     setIndexBuffer.Reset();
@@ -27,6 +32,8 @@ void RenderingProfiler::ResetCounters()
     setTexture.Reset();
     setSampler.Reset();
     setRenderTarget.Reset();
+    pipelineStateChanges.Reset();
+    pipelineStateChangesSkipped.Reset();
 
     drawCalls.Reset();
     dispatchComputeCalls.Reset();
@@ -0,0 +1,230 @@
+/*
+ * TimestampProfiler.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TimestampProfiler.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+// Number of scopes the queries of each frame can hold before any scope has been recorded.
+static const std::uint32_t g_initialTimestampScopeCapacity = 16;
+
+static const std::uint32_t g_invalidScopeIndex = ~0u;
+
+TimestampProfiler::TimestampProfiler(RenderSystem& renderSystem, std::uint32_t numFramesInFlight, std::uint32_t maxScopesPerFrame) :
+    renderSystem_       { renderSystem                                                          },
+    supported_          { renderSystem.GetRenderingCaps().features.hasTimestampQueries          },
+    maxScopesPerFrame_  { maxScopesPerFrame                                                     },
+    frameSlots_         ( std::max(1u, numFramesInFlight)                                       ),
+    scopeDemand_        { std::min(g_initialTimestampScopeCapacity, maxScopesPerFrame)          }
+{
+}
+
+TimestampProfiler::~TimestampProfiler()
+{
+    for (auto& slot : frameSlots_)
+        ResizeQueries(slot, 0);
+}
+
+void TimestampProfiler::BeginFrame(CommandBuffer& commandBuffer)
+{
+    if (currentSlot_)
+        throw std::runtime_error("cannot begin timestamp profiler frame before the previous frame has been ended");
+
+    auto& slot = frameSlots_[frameCounter_ % frameSlots_.size()];
+
+    if (supported_)
+    {
+        /* Resolve previous frames without waiting for their results */
+        ResolvePendingFrames(commandBuffer);
+
+        /* Drop the frame of this slot if its results are still not available, instead of stalling the CPU */
+        if (slot.pending)
+        {
+            slot.pending = false;
+            ++numDroppedFrames_;
+        }
+
+        /* Grow queries to the highest number of scopes any previous frame has requested */
+        scopeCapacity_ = scopeDemand_;
+        ResizeQueries(slot, 2 + static_cast<std::size_t>(scopeCapacity_) * 2);
+
+        /* Reset all queries of this slot, which must happen outside of a render pass */
+        for (auto query : slot.queries)
+            commandBuffer.BeginQuery(*query);
+
+        commandBuffer.EndQuery(*slot.queries[0]);
+    }
+
+    slot.scopes.clear();
+    slot.frameIndex = frameCounter_++;
+    numFrameScopes_ = 0;
+
+    currentSlot_ = &slot;
+}
+
+void TimestampProfiler::EndFrame(CommandBuffer& commandBuffer)
+{
+    if (!currentSlot_)
+        throw std::runtime_error("cannot end timestamp profiler frame without a previous call to BeginFrame");
+    if (!scopeStack_.empty())
+        throw std::runtime_error("cannot end timestamp profiler frame with " + std::to_string(scopeStack_.size()) + " unterminated scope(s)");
+
+    if (supported_)
+    {
+        commandBuffer.EndQuery(*currentSlot_->queries[1]);
+        currentSlot_->pending = true;
+    }
+
+    currentSlot_ = nullptr;
+}
+
+void TimestampProfiler::BeginScope(CommandBuffer& commandBuffer, const char* name)
+{
+    if (!currentSlot_)
+        throw std::runtime_error("cannot begin timestamp profiler scope outside of a frame");
+
+    auto& scopes = currentSlot_->scopes;
+
+    /* Keep track of the number of requested scopes, so the next frames can hold them */
+    if (++numFrameScopes_ > scopeDemand_ && numFrameScopes_ <= maxScopesPerFrame_)
+        scopeDemand_ = numFrameScopes_;
+
+    if (!supported_ || scopes.size() >= scopeCapacity_)
+    {
+        /* Drop scope, but keep it on the stack to match the next call to EndScope */
+        if (supported_)
+            ++numDroppedScopes_;
+        scopeStack_.push_back(g_invalidScopeIndex);
+        return;
+    }
+
+    /* Find innermost scope that has not been dropped; dropped scopes can only be nested inside recorded scopes */
+    auto parent = g_invalidScopeIndex;
+    for (auto it = scopeStack_.rbegin(); it != scopeStack_.rend(); ++it)
+    {
+        if (*it != g_invalidScopeIndex)
+        {
+            parent = *it;
+            break;
+        }
+    }
+
+    const auto index = static_cast<std::uint32_t>(scopes.size());
+    scopes.push_back({ name, static_cast<std::uint32_t>(scopeStack_.size()), parent });
+    scopeStack_.push_back(index);
+
+    commandBuffer.EndQuery(*currentSlot_->queries[2 + index * 2]);
+}
+
+void TimestampProfiler::EndScope(CommandBuffer& commandBuffer)
+{
+    if (scopeStack_.empty())
+        throw std::runtime_error("cannot end timestamp profiler scope without a previous call to BeginScope");
+
+    const auto index = scopeStack_.back();
+    scopeStack_.pop_back();
+
+    if (index != g_invalidScopeIndex)
+        commandBuffer.EndQuery(*currentSlot_->queries[3 + index * 2]);
+}
+
+const TimestampFrameRecord* TimestampProfiler::GetLatestFrame() const
+{
+    return (hasLatestFrame_ ? &latestFrame_ : nullptr);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void TimestampProfiler::ResizeQueries(FrameSlot& slot, std::size_t numQueries)
+{
+    /* Release queries that are no longer needed */
+    while (slot.queries.size() > numQueries)
+    {
+        renderSystem_.Release(*slot.queries.back());
+        slot.queries.pop_back();
+    }
+
+    /* Create missing queries */
+    slot.queries.reserve(numQueries);
+    while (slot.queries.size() < numQueries)
+        slot.queries.push_back(renderSystem_.CreateQuery(QueryDescriptor{ QueryType::Timestamp }));
+}
+
+// Returns the difference between two timestamps, or zero if the timestamps are out of order (e.g. after a wrap-around).
+static std::uint64_t TimestampDiff(std::uint64_t begin, std::uint64_t end)
+{
+    return (end > begin ? end - begin : 0);
+}
+
+bool TimestampProfiler::ResolveFrame(CommandBuffer& commandBuffer, FrameSlot& slot)
+{
+    const auto numQueries = 2 + slot.scopes.size() * 2;
+
+    /* Query all timestamps of this frame; abort if any result is not available yet */
+    std::vector<std::uint64_t> timestamps(numQueries);
+    for (std::size_t i = 0; i < numQueries; ++i)
+    {
+        if (!commandBuffer.QueryResult(*slot.queries[i], timestamps[i]))
+            return false;
+    }
+
+    /* Store frame record, unless a more recent frame has already been resolved */
+    if (!hasLatestFrame_ || slot.frameIndex > latestFrame_.frameIndex)
+    {
+        latestFrame_.frameIndex     = slot.frameIndex;
+        latestFrame_.elapsedTime    = TimestampDiff(timestamps[0], timestamps[1]);
+        latestFrame_.scopes.resize(slot.scopes.size());
+
+        for (std::size_t i = 0; i < slot.scopes.size(); ++i)
+        {
+            const auto& src = slot.scopes[i];
+            auto&       dst = latestFrame_.scopes[i];
+            {
+                dst.name        = src.name;
+                dst.depth       = src.depth;
+                dst.parent      = src.parent;
+                dst.startTime   = TimestampDiff(timestamps[0], timestamps[2 + i * 2]);
+                dst.elapsedTime = TimestampDiff(timestamps[2 + i * 2], timestamps[3 + i * 2]);
+            }
+        }
+
+        hasLatestFrame_ = true;
+    }
+
+    slot.pending = false;
+
+    return true;
+}
+
+void TimestampProfiler::ResolvePendingFrames(CommandBuffer& commandBuffer)
+{
+    /* Resolve frames from oldest to newest; results of newer frames cannot be available before older ones */
+    const auto numSlots = frameSlots_.size();
+    for (std::size_t i = 0; i < numSlots; ++i)
+    {
+        auto& slot = frameSlots_[(frameCounter_ + i) % numSlots];
+        if (slot.pending && !ResolveFrame(commandBuffer, slot))
+            break;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,880 @@
+/*
+ * TraceReplayer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TraceReplayer.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBufferExt.h>
+#include <LLGL/Timer.h>
+#include "CaptureLayer/CaptureStream.h"
+#include "../Core/Helper.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+static void ReleaseObject(RenderSystem& renderSystem, const CaptureReader::ObjectEntry& entry)
+{
+    auto object = entry.object;
+    if (object == nullptr)
+        return;
+
+    switch (entry.createOpcode)
+    {
+        case CaptureOpcode::CreateRenderContext:
+            renderSystem.Release(*static_cast<RenderContext*>(object));
+            break;
+        case CaptureOpcode::CreateCommandBuffer:
+        case CaptureOpcode::CreateCommandBufferExt:
+            renderSystem.Release(*static_cast<CommandBuffer*>(object));
+            break;
+        case CaptureOpcode::CreateBuffer:
+            renderSystem.Release(*static_cast<Buffer*>(object));
+            break;
+        case CaptureOpcode::CreateBufferArray:
+            renderSystem.Release(*static_cast<BufferArray*>(object));
+            break;
+        case CaptureOpcode::CreateTexture:
+            renderSystem.Release(*static_cast<Texture*>(object));
+            break;
+        case CaptureOpcode::CreateSampler:
+            renderSystem.Release(*static_cast<Sampler*>(object));
+            break;
+        case CaptureOpcode::CreateResourceHeap:
+            renderSystem.Release(*static_cast<ResourceHeap*>(object));
+            break;
+        case CaptureOpcode::CreateRenderTarget:
+            renderSystem.Release(*static_cast<RenderTarget*>(object));
+            break;
+        case CaptureOpcode::CreateShader:
+            renderSystem.Release(*static_cast<Shader*>(object));
+            break;
+        case CaptureOpcode::CreateShaderProgram:
+            renderSystem.Release(*static_cast<ShaderProgram*>(object));
+            break;
+        case CaptureOpcode::CreatePipelineLayout:
+            renderSystem.Release(*static_cast<PipelineLayout*>(object));
+            break;
+        case CaptureOpcode::CreatePipelineCache:
+            renderSystem.Release(*static_cast<PipelineCache*>(object));
+            break;
+        case CaptureOpcode::CreateGraphicsPipeline:
+            renderSystem.Release(*static_cast<GraphicsPipeline*>(object));
+            break;
+        case CaptureOpcode::CreateComputePipeline:
+            renderSystem.Release(*static_cast<ComputePipeline*>(object));
+            break;
+        case CaptureOpcode::CreateQuery:
+            renderSystem.Release(*static_cast<Query*>(object));
+            break;
+        case CaptureOpcode::CreateFence:
+            renderSystem.Release(*static_cast<Fence*>(object));
+            break;
+        default:
+            break;
+    }
+}
+
+static CommandQueue& GetReplayCommandQueue(RenderSystem& renderSystem)
+{
+    if (auto commandQueue = renderSystem.GetCommandQueue())
+        return *commandQueue;
+    throw std::runtime_error("render system has no command queue to replay trace");
+}
+
+// Replays all commands of the render system and the command queue.
+static void ReplayRenderSystemRecord(const CaptureOpcode opcode, RenderSystem& renderSystem, CaptureReader& reader, std::vector<char>& scratch)
+{
+    switch (opcode)
+    {
+        case CaptureOpcode::SetConfiguration:
+        {
+            RenderSystemConfiguration config;
+            reader.Read(config);
+            renderSystem.SetConfiguration(config);
+        }
+        break;
+
+        case CaptureOpcode::CreateRenderContext:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            RenderContextDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreateRenderContext(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::SetVideoMode:
+        {
+            auto& renderContext = reader.ReadObjectRef<RenderContext>();
+            VideoModeDescriptor desc;
+            reader.Read(desc);
+            renderContext.SetVideoMode(desc);
+        }
+        break;
+
+        case CaptureOpcode::SetVsync:
+        {
+            auto& renderContext = reader.ReadObjectRef<RenderContext>();
+            VsyncDescriptor desc;
+            reader.Read(desc);
+            renderContext.SetVsync(desc);
+        }
+        break;
+
+        case CaptureOpcode::Present:
+        {
+            reader.ReadObjectRef<RenderContext>().Present();
+        }
+        break;
+
+        case CaptureOpcode::CreateCommandBuffer:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            reader.RegisterObject(id, renderSystem.CreateCommandBuffer(), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateCommandBufferExt:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            reader.RegisterObject(id, renderSystem.CreateCommandBufferExt(), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateBuffer:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            BufferDescriptor desc;
+            reader.Read(desc);
+            reader.Read(scratch);
+            reader.RegisterObject(id, renderSystem.CreateBuffer(desc, (scratch.empty() ? nullptr : scratch.data())), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateBufferArray:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            std::vector<Buffer*> buffers(reader.Read<std::uint32_t>());
+            for (auto& buffer : buffers)
+                buffer = reader.ReadObject<Buffer>();
+            reader.RegisterObject(id, renderSystem.CreateBufferArray(static_cast<std::uint32_t>(buffers.size()), buffers.data()), opcode);
+        }
+        break;
+
+        case CaptureOpcode::WriteBuffer:
+        {
+            auto& buffer = reader.ReadObjectRef<Buffer>();
+            auto offset = reader.Read<std::uint64_t>();
+            reader.Read(scratch);
+            renderSystem.WriteBuffer(buffer, scratch.data(), scratch.size(), static_cast<std::size_t>(offset));
+        }
+        break;
+
+        case CaptureOpcode::CreateTexture:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            TextureDescriptor textureDesc;
+            SrcImageDescriptor imageDesc;
+            reader.Read(textureDesc);
+            reader.Read(imageDesc, scratch);
+            reader.RegisterObject(id, renderSystem.CreateTexture(textureDesc, (imageDesc.data != nullptr ? &imageDesc : nullptr)), opcode);
+        }
+        break;
+
+        case CaptureOpcode::WriteTexture:
+        {
+            auto& texture = reader.ReadObjectRef<Texture>();
+            SubTextureDescriptor subTextureDesc;
+            SrcImageDescriptor imageDesc;
+            reader.Read(subTextureDesc);
+            reader.Read(imageDesc, scratch);
+            renderSystem.WriteTexture(texture, subTextureDesc, imageDesc);
+        }
+        break;
+
+        case CaptureOpcode::GenerateMips:
+        {
+            renderSystem.GenerateMips(reader.ReadObjectRef<Texture>());
+        }
+        break;
+
+        case CaptureOpcode::GenerateMipsRange:
+        {
+            auto& texture           = reader.ReadObjectRef<Texture>();
+            auto baseMipLevel       = reader.Read<std::uint32_t>();
+            auto numMipLevels       = reader.Read<std::uint32_t>();
+            auto baseArrayLayer     = reader.Read<std::uint32_t>();
+            auto numArrayLayers     = reader.Read<std::uint32_t>();
+            renderSystem.GenerateMips(texture, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
+        }
+        break;
+
+        case CaptureOpcode::CreateSampler:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            SamplerDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreateSampler(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateResourceHeap:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            ResourceHeapDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreateResourceHeap(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateRenderTarget:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            RenderTargetDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreateRenderTarget(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateShader:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            ShaderDescriptor desc;
+            CaptureShaderStorage storage;
+            reader.Read(desc, storage);
+            reader.RegisterObject(id, renderSystem.CreateShader(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateShaderProgram:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            ShaderProgramDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreateShaderProgram(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::BindConstantBuffer:
+        {
+            auto& shaderProgram = reader.ReadObjectRef<ShaderProgram>();
+            auto name           = reader.Read<std::string>();
+            auto bindingIndex   = reader.Read<std::uint32_t>();
+            shaderProgram.BindConstantBuffer(name, bindingIndex);
+        }
+        break;
+
+        case CaptureOpcode::BindStorageBuffer:
+        {
+            auto& shaderProgram = reader.ReadObjectRef<ShaderProgram>();
+            auto name           = reader.Read<std::string>();
+            auto bindingIndex   = reader.Read<std::uint32_t>();
+            shaderProgram.BindStorageBuffer(name, bindingIndex);
+        }
+        break;
+
+        case CaptureOpcode::CreatePipelineLayout:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            PipelineLayoutDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreatePipelineLayout(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreatePipelineCache:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            reader.Read(scratch);
+            reader.RegisterObject(id, renderSystem.CreatePipelineCache((scratch.empty() ? nullptr : scratch.data()), scratch.size()), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateGraphicsPipeline:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            GraphicsPipelineDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreateGraphicsPipeline(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateComputePipeline:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            ComputePipelineDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreateComputePipeline(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateQuery:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            QueryDescriptor desc;
+            reader.Read(desc);
+            reader.RegisterObject(id, renderSystem.CreateQuery(desc), opcode);
+        }
+        break;
+
+        case CaptureOpcode::CreateFence:
+        {
+            auto id = reader.Read<std::uint32_t>();
+            reader.RegisterObject(id, renderSystem.CreateFence(), opcode);
+        }
+        break;
+
+        case CaptureOpcode::ReleaseRenderContext:
+        case CaptureOpcode::ReleaseCommandBuffer:
+        case CaptureOpcode::ReleaseBuffer:
+        case CaptureOpcode::ReleaseBufferArray:
+        case CaptureOpcode::ReleaseTexture:
+        case CaptureOpcode::ReleaseSampler:
+        case CaptureOpcode::ReleaseResourceHeap:
+        case CaptureOpcode::ReleaseRenderTarget:
+        case CaptureOpcode::ReleaseShader:
+        case CaptureOpcode::ReleaseShaderProgram:
+        case CaptureOpcode::ReleasePipelineLayout:
+        case CaptureOpcode::ReleasePipelineCache:
+        case CaptureOpcode::ReleaseGraphicsPipeline:
+        case CaptureOpcode::ReleaseComputePipeline:
+        case CaptureOpcode::ReleaseQuery:
+        case CaptureOpcode::ReleaseFence:
+        {
+            /* Release object by the opcode it has been created with */
+            ReleaseObject(renderSystem, reader.UnregisterObject());
+        }
+        break;
+
+        case CaptureOpcode::SubmitCommandBuffer:
+        {
+            GetReplayCommandQueue(renderSystem).Submit(reader.ReadObjectRef<CommandBuffer>());
+        }
+        break;
+
+        case CaptureOpcode::SubmitFence:
+        {
+            GetReplayCommandQueue(renderSystem).Submit(reader.ReadObjectRef<Fence>());
+        }
+        break;
+
+        case CaptureOpcode::WaitFence:
+        {
+            GetReplayCommandQueue(renderSystem).WaitFence(reader.ReadObjectRef<Fence>(), ~0ull);
+        }
+        break;
+
+        case CaptureOpcode::WaitIdle:
+        {
+            GetReplayCommandQueue(renderSystem).WaitIdle();
+        }
+        break;
+
+        default:
+        {
+            throw std::runtime_error("invalid opcode in trace record: " + std::to_string(static_cast<int>(opcode)));
+        }
+        break;
+    }
+}
+
+static long ReadFlags(CaptureReader& reader)
+{
+    return static_cast<long>(reader.Read<std::int64_t>());
+}
+
+// Replays a single command of a command buffer. The ID of the command buffer has already been read.
+static void ReplayCommandRecord(const CaptureOpcode opcode, CommandBuffer& commandBuffer, CaptureReader& reader, std::vector<char>& scratch)
+{
+    switch (opcode)
+    {
+        case CaptureOpcode::SetGraphicsAPIDependentState:
+        {
+            reader.Read(scratch);
+            commandBuffer.SetGraphicsAPIDependentState(scratch.data(), scratch.size());
+        }
+        break;
+
+        case CaptureOpcode::SetViewport:
+        {
+            Viewport viewport;
+            reader.Read(viewport);
+            commandBuffer.SetViewport(viewport);
+        }
+        break;
+
+        case CaptureOpcode::SetViewports:
+        {
+            std::vector<Viewport> viewports;
+            reader.Read(viewports);
+            commandBuffer.SetViewports(static_cast<std::uint32_t>(viewports.size()), viewports.data());
+        }
+        break;
+
+        case CaptureOpcode::SetScissor:
+        {
+            Scissor scissor;
+            reader.Read(scissor);
+            commandBuffer.SetScissor(scissor);
+        }
+        break;
+
+        case CaptureOpcode::SetScissors:
+        {
+            std::vector<Scissor> scissors;
+            reader.Read(scissors);
+            commandBuffer.SetScissors(static_cast<std::uint32_t>(scissors.size()), scissors.data());
+        }
+        break;
+
+        case CaptureOpcode::SetClearColor:
+        {
+            ColorRGBAf color;
+            reader.Read(color);
+            commandBuffer.SetClearColor(color);
+        }
+        break;
+
+        case CaptureOpcode::SetClearDepth:
+        {
+            commandBuffer.SetClearDepth(reader.Read<float>());
+        }
+        break;
+
+        case CaptureOpcode::SetClearStencil:
+        {
+            commandBuffer.SetClearStencil(reader.Read<std::uint32_t>());
+        }
+        break;
+
+        case CaptureOpcode::Clear:
+        {
+            commandBuffer.Clear(ReadFlags(reader));
+        }
+        break;
+
+        case CaptureOpcode::ClearAttachments:
+        {
+            std::vector<AttachmentClear> attachments;
+            reader.Read(attachments);
+            commandBuffer.ClearAttachments(static_cast<std::uint32_t>(attachments.size()), attachments.data());
+        }
+        break;
+
+        case CaptureOpcode::UpdateBuffer:
+        {
+            auto& dstBuffer = reader.ReadObjectRef<Buffer>();
+            auto dstOffset  = reader.Read<std::uint64_t>();
+            reader.Read(scratch);
+            commandBuffer.UpdateBuffer(dstBuffer, dstOffset, scratch.data(), static_cast<std::uint16_t>(scratch.size()));
+        }
+        break;
+
+        case CaptureOpcode::CopyBuffer:
+        {
+            auto& dstBuffer = reader.ReadObjectRef<Buffer>();
+            auto dstOffset  = reader.Read<std::uint64_t>();
+            auto& srcBuffer = reader.ReadObjectRef<Buffer>();
+            auto srcOffset  = reader.Read<std::uint64_t>();
+            auto size       = reader.Read<std::uint64_t>();
+            commandBuffer.CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
+        }
+        break;
+
+        case CaptureOpcode::CopyBufferToTexture:
+        {
+            auto& dstTexture = reader.ReadObjectRef<Texture>();
+            SubTextureDescriptor dstRegion;
+            reader.Read(dstRegion);
+            auto& srcBuffer = reader.ReadObjectRef<Buffer>();
+            auto srcOffset  = reader.Read<std::uint64_t>();
+            commandBuffer.CopyBufferToTexture(dstTexture, dstRegion, srcBuffer, srcOffset);
+        }
+        break;
+
+        case CaptureOpcode::CopyTexture:
+        {
+            auto& dstTexture = reader.ReadObjectRef<Texture>();
+            SubTextureDescriptor dstRegion;
+            reader.Read(dstRegion);
+            auto& srcTexture    = reader.ReadObjectRef<Texture>();
+            auto srcMipLevel    = reader.Read<std::uint32_t>();
+            Offset3D srcOffset;
+            reader.Read(srcOffset);
+            commandBuffer.CopyTexture(dstTexture, dstRegion, srcTexture, srcMipLevel, srcOffset);
+        }
+        break;
+
+        case CaptureOpcode::SetVertexBuffer:
+        {
+            commandBuffer.SetVertexBuffer(reader.ReadObjectRef<Buffer>());
+        }
+        break;
+
+        case CaptureOpcode::SetVertexBufferArray:
+        {
+            commandBuffer.SetVertexBufferArray(reader.ReadObjectRef<BufferArray>());
+        }
+        break;
+
+        case CaptureOpcode::SetIndexBuffer:
+        {
+            commandBuffer.SetIndexBuffer(reader.ReadObjectRef<Buffer>());
+        }
+        break;
+
+        case CaptureOpcode::SetConstantBuffer:
+        {
+            auto& buffer    = reader.ReadObjectRef<Buffer>();
+            auto slot       = reader.Read<std::uint32_t>();
+            auto stageFlags = ReadFlags(reader);
+            static_cast<CommandBufferExt&>(commandBuffer).SetConstantBuffer(buffer, slot, stageFlags);
+        }
+        break;
+
+        case CaptureOpcode::SetStorageBuffer:
+        {
+            auto& buffer    = reader.ReadObjectRef<Buffer>();
+            auto slot       = reader.Read<std::uint32_t>();
+            auto stageFlags = ReadFlags(reader);
+            static_cast<CommandBufferExt&>(commandBuffer).SetStorageBuffer(buffer, slot, stageFlags);
+        }
+        break;
+
+        case CaptureOpcode::SetStreamOutputBuffer:
+        {
+            commandBuffer.SetStreamOutputBuffer(reader.ReadObjectRef<Buffer>());
+        }
+        break;
+
+        case CaptureOpcode::SetStreamOutputBufferArray:
+        {
+            commandBuffer.SetStreamOutputBufferArray(reader.ReadObjectRef<BufferArray>());
+        }
+        break;
+
+        case CaptureOpcode::BeginStreamOutput:
+        {
+            commandBuffer.BeginStreamOutput(reader.Read<PrimitiveType>());
+        }
+        break;
+
+        case CaptureOpcode::EndStreamOutput:
+        {
+            commandBuffer.EndStreamOutput();
+        }
+        break;
+
+        case CaptureOpcode::SetTexture:
+        {
+            auto& texture   = reader.ReadObjectRef<Texture>();
+            auto slot       = reader.Read<std::uint32_t>();
+            auto stageFlags = ReadFlags(reader);
+            static_cast<CommandBufferExt&>(commandBuffer).SetTexture(texture, slot, stageFlags);
+        }
+        break;
+
+        case CaptureOpcode::SetSampler:
+        {
+            auto& sampler   = reader.ReadObjectRef<Sampler>();
+            auto slot       = reader.Read<std::uint32_t>();
+            auto stageFlags = ReadFlags(reader);
+            static_cast<CommandBufferExt&>(commandBuffer).SetSampler(sampler, slot, stageFlags);
+        }
+        break;
+
+        case CaptureOpcode::SetGraphicsResourceHeap:
+        {
+            auto& resourceHeap  = reader.ReadObjectRef<ResourceHeap>();
+            auto firstSet       = reader.Read<std::uint32_t>();
+            std::vector<std::uint32_t> dynamicOffsets;
+            reader.Read(dynamicOffsets);
+            if (dynamicOffsets.empty())
+                commandBuffer.SetGraphicsResourceHeap(resourceHeap, firstSet);
+            else
+                commandBuffer.SetGraphicsResourceHeapWithOffsets(resourceHeap, firstSet, static_cast<std::uint32_t>(dynamicOffsets.size()), dynamicOffsets.data());
+        }
+        break;
+
+        case CaptureOpcode::SetComputeResourceHeap:
+        {
+            auto& resourceHeap  = reader.ReadObjectRef<ResourceHeap>();
+            auto firstSet       = reader.Read<std::uint32_t>();
+            std::vector<std::uint32_t> dynamicOffsets;
+            reader.Read(dynamicOffsets);
+            if (dynamicOffsets.empty())
+                commandBuffer.SetComputeResourceHeap(resourceHeap, firstSet);
+            else
+                commandBuffer.SetComputeResourceHeapWithOffsets(resourceHeap, firstSet, static_cast<std::uint32_t>(dynamicOffsets.size()), dynamicOffsets.data());
+        }
+        break;
+
+        case CaptureOpcode::SetRenderTarget:
+        {
+            commandBuffer.SetRenderTarget(reader.ReadObjectRef<RenderTarget>());
+        }
+        break;
+
+        case CaptureOpcode::SetRenderTargetContext:
+        {
+            commandBuffer.SetRenderTarget(reader.ReadObjectRef<RenderContext>());
+        }
+        break;
+
+        case CaptureOpcode::SetGraphicsPipeline:
+        {
+            commandBuffer.SetGraphicsPipeline(reader.ReadObjectRef<GraphicsPipeline>());
+        }
+        break;
+
+        case CaptureOpcode::SetComputePipeline:
+        {
+            commandBuffer.SetComputePipeline(reader.ReadObjectRef<ComputePipeline>());
+        }
+        break;
+
+        case CaptureOpcode::BeginQuery:
+        {
+            commandBuffer.BeginQuery(reader.ReadObjectRef<Query>());
+        }
+        break;
+
+        case CaptureOpcode::EndQuery:
+        {
+            commandBuffer.EndQuery(reader.ReadObjectRef<Query>());
+        }
+        break;
+
+        case CaptureOpcode::BeginRenderCondition:
+        {
+            auto& query = reader.ReadObjectRef<Query>();
+            auto mode   = reader.Read<RenderConditionMode>();
+            commandBuffer.BeginRenderCondition(query, mode);
+        }
+        break;
+
+        case CaptureOpcode::EndRenderCondition:
+        {
+            commandBuffer.EndRenderCondition();
+        }
+        break;
+
+        case CaptureOpcode::Draw:
+        {
+            auto numVertices    = reader.Read<std::uint32_t>();
+            auto firstVertex    = reader.Read<std::uint32_t>();
+            commandBuffer.Draw(numVertices, firstVertex);
+        }
+        break;
+
+        case CaptureOpcode::DrawIndexed:
+        {
+            auto numIndices     = reader.Read<std::uint32_t>();
+            auto firstIndex     = reader.Read<std::uint32_t>();
+            commandBuffer.DrawIndexed(numIndices, firstIndex);
+        }
+        break;
+
+        case CaptureOpcode::DrawIndexedOffset:
+        {
+            auto numIndices     = reader.Read<std::uint32_t>();
+            auto firstIndex     = reader.Read<std::uint32_t>();
+            auto vertexOffset   = reader.Read<std::int32_t>();
+            commandBuffer.DrawIndexed(numIndices, firstIndex, vertexOffset);
+        }
+        break;
+
+        case CaptureOpcode::DrawInstanced:
+        {
+            auto numVertices    = reader.Read<std::uint32_t>();
+            auto firstVertex    = reader.Read<std::uint32_t>();
+            auto numInstances   = reader.Read<std::uint32_t>();
+            commandBuffer.DrawInstanced(numVertices, firstVertex, numInstances);
+        }
+        break;
+
+        case CaptureOpcode::DrawInstancedOffset:
+        {
+            auto numVertices    = reader.Read<std::uint32_t>();
+            auto firstVertex    = reader.Read<std::uint32_t>();
+            auto numInstances   = reader.Read<std::uint32_t>();
+            auto firstInstance  = reader.Read<std::uint32_t>();
+            commandBuffer.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+        }
+        break;
+
+        case CaptureOpcode::DrawIndexedInstanced:
+        {
+            auto numIndices     = reader.Read<std::uint32_t>();
+            auto numInstances   = reader.Read<std::uint32_t>();
+            auto firstIndex     = reader.Read<std::uint32_t>();
+            commandBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+        }
+        break;
+
+        case CaptureOpcode::DrawIndexedInstancedOffset:
+        {
+            auto numIndices     = reader.Read<std::uint32_t>();
+            auto numInstances   = reader.Read<std::uint32_t>();
+            auto firstIndex     = reader.Read<std::uint32_t>();
+            auto vertexOffset   = reader.Read<std::int32_t>();
+            commandBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+        }
+        break;
+
+        case CaptureOpcode::DrawIndexedInstancedOffsetFirst:
+        {
+            auto numIndices     = reader.Read<std::uint32_t>();
+            auto numInstances   = reader.Read<std::uint32_t>();
+            auto firstIndex     = reader.Read<std::uint32_t>();
+            auto vertexOffset   = reader.Read<std::int32_t>();
+            auto firstInstance  = reader.Read<std::uint32_t>();
+            commandBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+        }
+        break;
+
+        case CaptureOpcode::DrawIndirect:
+        case CaptureOpcode::DrawIndexedIndirect:
+        case CaptureOpcode::DispatchIndirect:
+        {
+            auto& buffer    = reader.ReadObjectRef<Buffer>();
+            auto offset     = reader.Read<std::uint64_t>();
+            if (opcode == CaptureOpcode::DrawIndirect)
+                commandBuffer.DrawIndirect(buffer, offset);
+            else if (opcode == CaptureOpcode::DrawIndexedIndirect)
+                commandBuffer.DrawIndexedIndirect(buffer, offset);
+            else
+                commandBuffer.DispatchIndirect(buffer, offset);
+        }
+        break;
+
+        case CaptureOpcode::DrawIndirectMulti:
+        case CaptureOpcode::DrawIndexedIndirectMulti:
+        {
+            auto& buffer        = reader.ReadObjectRef<Buffer>();
+            auto offset         = reader.Read<std::uint64_t>();
+            auto numCommands    = reader.Read<std::uint32_t>();
+            auto stride         = reader.Read<std::uint32_t>();
+            if (opcode == CaptureOpcode::DrawIndirectMulti)
+                commandBuffer.DrawIndirect(buffer, offset, numCommands, stride);
+            else
+                commandBuffer.DrawIndexedIndirect(buffer, offset, numCommands, stride);
+        }
+        break;
+
+        case CaptureOpcode::DrawIndirectCount:
+        case CaptureOpcode::DrawIndexedIndirectCount:
+        {
+            auto& buffer        = reader.ReadObjectRef<Buffer>();
+            auto offset         = reader.Read<std::uint64_t>();
+            auto& countBuffer   = reader.ReadObjectRef<Buffer>();
+            auto countOffset    = reader.Read<std::uint64_t>();
+            auto maxNumCommands = reader.Read<std::uint32_t>();
+            auto stride         = reader.Read<std::uint32_t>();
+            if (opcode == CaptureOpcode::DrawIndirectCount)
+                commandBuffer.DrawIndirectCount(buffer, offset, countBuffer, countOffset, maxNumCommands, stride);
+            else
+                commandBuffer.DrawIndexedIndirectCount(buffer, offset, countBuffer, countOffset, maxNumCommands, stride);
+        }
+        break;
+
+        case CaptureOpcode::Dispatch:
+        {
+            auto groupSizeX = reader.Read<std::uint32_t>();
+            auto groupSizeY = reader.Read<std::uint32_t>();
+            auto groupSizeZ = reader.Read<std::uint32_t>();
+            commandBuffer.Dispatch(groupSizeX, groupSizeY, groupSizeZ);
+        }
+        break;
+
+        default:
+        {
+            throw std::runtime_error("invalid opcode in trace record: " + std::to_string(static_cast<int>(opcode)));
+        }
+        break;
+    }
+}
+
+static bool IsCommandOpcode(const CaptureOpcode opcode)
+{
+    return (opcode >= CaptureOpcode::SetGraphicsAPIDependentState);
+}
+
+
+/* ----- TraceReplayer class ----- */
+
+TraceReplayer::TraceReplayer(RenderSystem& renderSystem, const std::string& filename) :
+    renderSystem_ { renderSystem                        },
+    reader_       { MakeUnique<CaptureReader>(filename) },
+    timer_        { Timer::Create()                     }
+{
+}
+
+TraceReplayer::~TraceReplayer()
+{
+    /* Wait for all submitted commands before any object is released */
+    if (auto commandQueue = renderSystem_.GetCommandQueue())
+        commandQueue->WaitIdle();
+
+    /* Release remaining objects in reverse order of creation, so that dependent objects are released first */
+    const auto& objects = reader_->GetObjects();
+    for (auto it = objects.rbegin(); it != objects.rend(); ++it)
+        ReleaseObject(renderSystem_, *it);
+}
+
+bool TraceReplayer::ReplayFrame(TraceFrameStatistics* statistics)
+{
+    std::uint32_t numRecords = 0, numCommands = 0;
+
+    timer_->Start();
+
+    CaptureOpcode opcode;
+    while (reader_->ReadOpcode(opcode))
+    {
+        if (IsCommandOpcode(opcode))
+        {
+            auto& commandBuffer = reader_->ReadObjectRef<CommandBuffer>();
+            ReplayCommandRecord(opcode, commandBuffer, *reader_, scratch_);
+            ++numCommands;
+        }
+        else
+            ReplayRenderSystemRecord(opcode, renderSystem_, *reader_, scratch_);
+
+        ++numRecords;
+
+        if (opcode == CaptureOpcode::Present)
+            break;
+    }
+
+    auto elapsedTicks = timer_->Stop();
+
+    if (numRecords == 0)
+        return false;
+
+    if (statistics)
+    {
+        statistics->frameIndex  = frameCounter_;
+        statistics->numRecords  = numRecords;
+        statistics->numCommands = numCommands;
+        statistics->cpuTime     = static_cast<std::uint64_t>(static_cast<double>(elapsedTicks) * 1000000000.0 / static_cast<double>(timer_->GetFrequency()));
+    }
+
+    ++frameCounter_;
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
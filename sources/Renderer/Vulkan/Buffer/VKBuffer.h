@@ -14,6 +14,7 @@
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <memory>
+#include <cstdint>
 
 
 namespace LLGL
@@ -50,6 +51,18 @@ class VKBuffer : public Buffer
         // Updates the staging buffer (if it was created).
         void UpdateStagingBuffer(VkDevice device, const void* data, VkDeviceSize dataSize, VkDeviceSize offset = 0);
 
+        // Sets the ID of the last upload batch that accesses this buffer or its staging buffer (see VKUploadBatcher).
+        inline void SetUploadBatchID(std::uint64_t batchID)
+        {
+            uploadBatchID_ = batchID;
+        }
+
+        // Returns the ID of the last upload batch that accesses this buffer or its staging buffer.
+        inline std::uint64_t GetUploadBatchID() const
+        {
+            return uploadBatchID_;
+        }
+
         // Returns the hardware buffer object.
         inline VkBuffer GetVkBuffer() const
         {
@@ -102,6 +115,7 @@ class VKBuffer : public Buffer
 
         VkDeviceSize                size_                   = 0;
         CPUAccess                   mappingCPUAccess_       = CPUAccess::ReadOnly;
+        std::uint64_t               uploadBatchID_          = 0;
 
 };
 
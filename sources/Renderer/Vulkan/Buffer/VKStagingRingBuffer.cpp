@@ -0,0 +1,165 @@
+/*
+ * VKStagingRingBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKStagingRingBuffer.h"
+#include "../VKCore.h"
+#include "../../../Core/Helper.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Alignment of each allocation within the ring buffer.
+static const VkDeviceSize g_stagingRingBufferAlignment = 16;
+
+VKStagingRingBuffer::VKStagingRingBuffer(
+    const VKPtr<VkDevice>&                  device,
+    const VkPhysicalDeviceMemoryProperties& memoryProperties,
+    VkDeviceSize                            size) :
+        device_ { device },
+        buffer_ { device },
+        size_   { size   }
+{
+    /* Create staging buffer */
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.size                     = size;
+        createInfo.usage                    = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+    buffer_.Create(device, createInfo);
+
+    /* Allocate dedicated device memory, so it can stay mapped independently of other staging buffers */
+    auto memoryTypeIndex = VKFindMemoryType(
+        memoryProperties,
+        buffer_.requirements.memoryTypeBits,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+    );
+
+    deviceMemory_ = MakeUnique<VKDeviceMemory>(device, buffer_.requirements.size, memoryTypeIndex);
+
+    auto result = vkBindBufferMemory(device, buffer_.buffer, deviceMemory_->GetVkDeviceMemory(), 0);
+    VKThrowIfFailed(result, "failed to bind Vulkan buffer to device memory");
+
+    /* Map entire buffer persistently */
+    mappedData_ = reinterpret_cast<char*>(deviceMemory_->Map(device, 0, size));
+}
+
+VKStagingRingBuffer::~VKStagingRingBuffer()
+{
+    deviceMemory_->Unmap(device_);
+}
+
+bool VKStagingRingBuffer::Write(const void* data, VkDeviceSize dataSize, std::uint64_t batchID, VkDeviceSize& offset)
+{
+    VkDeviceSize allocatedSize = 0;
+
+    if (!Allocate(dataSize, offset, allocatedSize))
+        return false;
+
+    /* Copy data into mapped memory (memory is host coherent, so no flush is required) */
+    ::memcpy(mappedData_ + offset, data, static_cast<std::size_t>(dataSize));
+
+    /* Merge allocation with previous segment if they belong to the same batch */
+    if (!segments_.empty() && segments_.back().batchID == batchID)
+    {
+        segments_.back().end    = head_;
+        segments_.back().size  += allocatedSize;
+    }
+    else
+        segments_.push_back({ batchID, head_, allocatedSize, false });
+
+    return true;
+}
+
+void VKStagingRingBuffer::Recycle(std::uint64_t batchID)
+{
+    for (auto& segment : segments_)
+    {
+        if (segment.batchID == batchID)
+            segment.recycled = true;
+    }
+
+    /* Move tail forward over all leading recycled segments */
+    while (!segments_.empty() && segments_.front().recycled)
+    {
+        tail_   = segments_.front().end;
+        usage_ -= segments_.front().size;
+        segments_.pop_front();
+    }
+
+    /* Reset to the beginning when the ring buffer is empty to reduce wasted memory at the end */
+    if (segments_.empty())
+    {
+        head_   = 0;
+        tail_   = 0;
+        usage_  = 0;
+    }
+}
+
+std::uint64_t VKStagingRingBuffer::GetOldestBatchID() const
+{
+    return (segments_.empty() ? 0 : segments_.front().batchID);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool VKStagingRingBuffer::Allocate(VkDeviceSize size, VkDeviceSize& offset, VkDeviceSize& allocatedSize)
+{
+    const auto alignedHead = GetAlignedSize(head_, g_stagingRingBufferAlignment);
+
+    if (usage_ == 0 || head_ > tail_)
+    {
+        /* Free memory is at the end [head, size) and at the beginning [0, tail) */
+        if (alignedHead + size <= size_)
+        {
+            offset          = alignedHead;
+            allocatedSize   = (alignedHead + size) - head_;
+        }
+        else if (size <= tail_)
+        {
+            /* Wrap around and skip the remaining memory at the end */
+            offset          = 0;
+            allocatedSize   = (size_ - head_) + size;
+        }
+        else
+            return false;
+    }
+    else
+    {
+        /* Free memory is between [head, tail) */
+        if (alignedHead + size <= tail_)
+        {
+            offset          = alignedHead;
+            allocatedSize   = (alignedHead + size) - head_;
+        }
+        else
+            return false;
+    }
+
+    head_   = offset + size;
+    usage_ += allocatedSize;
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
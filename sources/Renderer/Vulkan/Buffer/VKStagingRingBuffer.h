@@ -0,0 +1,112 @@
+/*
+ * VKStagingRingBuffer.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_STAGING_RING_BUFFER_H
+#define LLGL_VK_STAGING_RING_BUFFER_H
+
+
+#include "VKBuffer.h"
+#include "../Memory/VKDeviceMemory.h"
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <deque>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Persistently mapped, host-visible staging buffer for transient uploads.
+Memory is sub-allocated linearly and each allocation is tagged with the ID of the staging batch it is used in.
+Once a batch has been executed by the GPU, its memory range is recycled.
+*/
+class VKStagingRingBuffer
+{
+
+    public:
+
+        VKStagingRingBuffer(
+            const VKPtr<VkDevice>&                  device,
+            const VkPhysicalDeviceMemoryProperties& memoryProperties,
+            VkDeviceSize                            size
+        );
+
+        ~VKStagingRingBuffer();
+
+        VKStagingRingBuffer(const VKStagingRingBuffer&) = delete;
+        VKStagingRingBuffer& operator = (const VKStagingRingBuffer&) = delete;
+
+        /*
+        Copies the specified data into the ring buffer for the specified batch and returns the offset in 'offset'.
+        Returns false if there is currently not enough free memory, i.e. older batches must be recycled first.
+        */
+        bool Write(const void* data, VkDeviceSize dataSize, std::uint64_t batchID, VkDeviceSize& offset);
+
+        // Recycles all memory ranges that were allocated for the specified batch.
+        void Recycle(std::uint64_t batchID);
+
+        // Returns the ID of the oldest batch that still holds memory of this ring buffer, or 0 if the ring buffer is empty.
+        std::uint64_t GetOldestBatchID() const;
+
+        // Returns the hardware buffer object.
+        inline VkBuffer GetVkBuffer() const
+        {
+            return buffer_.buffer.Get();
+        }
+
+        // Returns the size of the entire ring buffer.
+        inline VkDeviceSize GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns the number of bytes that are currently in use (including alignment padding).
+        inline VkDeviceSize GetUsage() const
+        {
+            return usage_;
+        }
+
+    private:
+
+        struct Segment
+        {
+            std::uint64_t   batchID;
+            VkDeviceSize    end;
+            VkDeviceSize    size;
+            bool            recycled;
+        };
+
+        // Allocates a memory range of the specified size and returns false if there is not enough free memory.
+        bool Allocate(VkDeviceSize size, VkDeviceSize& offset, VkDeviceSize& allocatedSize);
+
+        VkDevice                        device_         = VK_NULL_HANDLE;
+
+        VKBufferWithRequirements        buffer_;
+        std::unique_ptr<VKDeviceMemory> deviceMemory_;
+        char*                           mappedData_     = nullptr;
+
+        VkDeviceSize                    size_           = 0;
+        VkDeviceSize                    head_           = 0;
+        VkDeviceSize                    tail_           = 0;
+        VkDeviceSize                    usage_          = 0;
+
+        std::deque<Segment>             segments_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
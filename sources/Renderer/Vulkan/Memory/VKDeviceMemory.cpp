@@ -8,17 +8,72 @@
 #include "VKDeviceMemory.h"
 #include "../VKCore.h"
 #include "../../../Core/Helper.h"
+#include <algorithm>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
 
 
 namespace LLGL
 {
 
 
+/* ----- Internal functions ----- */
+
+// Number of regions that are allocated at once for the region pool of each device memory chunk.
+static const std::size_t g_regionPoolPageSize = 64;
+
+// Returns the index of the most significant bit of the specified value (must not be zero).
+static std::uint32_t BitScanMSB(std::uint64_t value)
+{
+    #if defined _MSC_VER && defined _WIN64
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return static_cast<std::uint32_t>(index);
+    #elif defined _MSC_VER
+    unsigned long index = 0;
+    if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32)))
+        return static_cast<std::uint32_t>(index + 32);
+    _BitScanReverse(&index, static_cast<unsigned long>(value));
+    return static_cast<std::uint32_t>(index);
+    #else
+    return static_cast<std::uint32_t>(63 - __builtin_clzll(value));
+    #endif
+}
+
+// Returns the index of the least significant bit of the specified value (must not be zero).
+static std::uint32_t BitScanLSB(std::uint64_t value)
+{
+    #if defined _MSC_VER && defined _WIN64
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return static_cast<std::uint32_t>(index);
+    #elif defined _MSC_VER
+    unsigned long index = 0;
+    if (_BitScanForward(&index, static_cast<unsigned long>(value)))
+        return static_cast<std::uint32_t>(index);
+    _BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+    return static_cast<std::uint32_t>(index + 32);
+    #else
+    return static_cast<std::uint32_t>(__builtin_ctzll(value));
+    #endif
+}
+
+// Returns true if a block of the specified size and alignment fits into the specified region.
+static bool FitsIntoRegion(const VKDeviceMemoryRegion& region, VkDeviceSize alignedSize, VkDeviceSize alignment)
+{
+    const auto alignedOffset = GetAlignedSize(region.GetOffset(), alignment);
+    return (alignedOffset + alignedSize <= region.GetOffsetWithSize());
+}
+
+
+/* ----- VKDeviceMemory class ----- */
+
 VKDeviceMemory::VKDeviceMemory(const VKPtr<VkDevice>& device, VkDeviceSize size, std::uint32_t memoryTypeIndex) :
     deviceMemory_    { device, vkFreeMemory },
     size_            { size                 },
-    memoryTypeIndex_ { memoryTypeIndex      },
-    maxNewBlockSize_ { size                 }
+    memoryTypeIndex_ { memoryTypeIndex      }
 {
     /* Allocate device memory */
     VkMemoryAllocateInfo allocInfo;
@@ -35,6 +90,17 @@ VKDeviceMemory::VKDeviceMemory(const VKPtr<VkDevice>& device, VkDeviceSize size,
         std::string info = "failed to allocate Vulkan device memory of " + std::to_string(size) + " bytes";
         VKThrowIfFailed(result, info.c_str());
     }
+
+    /* Initialize free lists with a single free block that covers the entire chunk */
+    Fill(slBitmaps_, 0u);
+    for (auto& freeList : freeLists_)
+        Fill(freeList, nullptr);
+
+    if (size > 0)
+    {
+        firstRegion_ = AcquireRegion(size, 0);
+        InsertFreeBlock(firstRegion_);
+    }
 }
 
 void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
@@ -54,76 +120,109 @@ void VKDeviceMemory::Unmap(VkDevice device)
 
 VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
 {
-    if (size > 0 && alignment > 0)
+    if (size == 0 || alignment == 0)
+        return nullptr;
+
+    const auto alignedSize = GetAlignedSize(size, alignment);
+    if (alignedSize > GetSize())
+        return nullptr;
+
+    /* Find free block either in the exact size class first or in the next larger size class first */
+    VKDeviceMemoryRegion* block = nullptr;
+
+    if (reduceFragmentation)
+    {
+        block = FindTightFitFreeBlock(alignedSize, alignment);
+        if (!block)
+            block = FindGoodFitFreeBlock(alignedSize, alignment);
+    }
+    else
     {
-        /* Adjust size and offset by alignment */
-        auto alignedSize    = GetAlignedSize(size, alignment);
-        auto alignedOffset  = GetAlignedSize(GetNextOffset(), alignment);
+        block = FindGoodFitFreeBlock(alignedSize, alignment);
+        if (!block)
+            block = FindTightFitFreeBlock(alignedSize, alignment);
+    }
 
-        if (reduceFragmentation)
-        {
-            /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
+    if (!block)
+        return nullptr;
 
-            /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
-        }
-        else
-        {
-            /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
+    RemoveFreeBlock(block);
 
-            /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
-        }
+    /* Split off the lower part for the alignment padding: [PADDING][BLOCK+++++] */
+    const auto alignedOffset = GetAlignedSize(block->GetOffset(), alignment);
+    if (alignedOffset > block->GetOffset())
+    {
+        auto lowerBlock = block;
+        SplitFreeBlock(lowerBlock, alignedOffset - lowerBlock->GetOffset());
+        block = lowerBlock->nextPhysical_;
+        RemoveFreeBlock(block);
+        InsertFreeBlock(lowerBlock);
     }
-    return nullptr;
+
+    /* Split off the upper part that is not required: [BLOCK][REMAINDER] */
+    if (block->GetSize() > alignedSize)
+        SplitFreeBlock(block, alignedSize);
+
+    block->free_ = false;
+    ++numBlocks_;
+
+    return block;
 }
 
 void VKDeviceMemory::Release(VKDeviceMemoryRegion* region)
 {
-    if (region)
+    if (region && region->GetParentChunk() == this && !region->IsFree())
     {
-        /* Increase maximal size of fragmented blocks */
-        maxFragmentedBlockSize_ = std::max(maxFragmentedBlockSize_, region->GetSize());
+        region->free_ = true;
+        --numBlocks_;
 
-        auto it = std::find_if(
-            blocks_.begin(), blocks_.end(),
-            [region](const std::unique_ptr<VKDeviceMemoryRegion>& entry)
+        /* Merge with upper neighbor: [REGION][UPPER] --> [+++REGION++++] */
+        if (auto upper = region->nextPhysical_)
+        {
+            if (upper->IsFree())
             {
-                return (entry.get() == region);
+                RemoveFreeBlock(upper);
+                MergeWithNext(region);
             }
-        );
+        }
 
-        if (it != blocks_.end())
+        /* Merge with lower neighbor: [LOWER][REGION] --> [+++LOWER++++] */
+        if (auto lower = region->prevPhysical_)
         {
-            InsertBlockToFragmentsSorted(std::move(*it));
-            blocks_.erase(it);
+            if (lower->IsFree())
+            {
+                RemoveFreeBlock(lower);
+                MergeWithNext(lower);
+                region = lower;
+            }
         }
+
+        InsertFreeBlock(region);
     }
 }
 
 bool VKDeviceMemory::IsEmpty() const
 {
-    return blocks_.empty();
-}
-
-VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
-{
-    return std::max(maxNewBlockSize_, maxFragmentedBlockSize_);
+    return (numBlocks_ == 0);
 }
 
 void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
 {
-    details.numChunks               += 1;
-    details.numBlocks               += blocks_.size();
-    details.numFragments            += fragmentedBlocks_.size();
-    details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
-    details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
+    details.numChunks   += 1;
+    details.numBlocks   += numBlocks_;
+    details.totalSize   += GetSize();
+
+    for (auto region = firstRegion_; region != nullptr; region = region->nextPhysical_)
+    {
+        if (region->IsFree())
+        {
+            details.numFragments            += 1;
+            details.freeSize                += region->GetSize();
+            details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, region->GetSize());
+        }
+        else
+            details.usedSize += region->GetSize();
+    }
 }
 
 #ifdef LLGL_DEBUG
@@ -179,20 +278,26 @@ static void PrintDeviceMemoryRegion(std::ostream& s, VKDeviceMemoryRegion& regio
 void VKDeviceMemory::PrintBlocks(std::ostream& s) const
 {
     VKDeviceMemoryRegion* prevBlock = nullptr;
-    for (const auto& block : blocks_)
+    for (auto block = firstRegion_; block != nullptr; block = block->nextPhysical_)
     {
-        PrintDeviceMemoryRegion(s, *block, prevBlock);
-        prevBlock = block.get();
+        if (!block->IsFree())
+        {
+            PrintDeviceMemoryRegion(s, *block, prevBlock);
+            prevBlock = block;
+        }
     }
 }
 
 void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
 {
     VKDeviceMemoryRegion* prevBlock = nullptr;
-    for (const auto& block : fragmentedBlocks_)
+    for (auto block = firstRegion_; block != nullptr; block = block->nextPhysical_)
     {
-        PrintDeviceMemoryRegion(s, *block, prevBlock);
-        prevBlock = block.get();
+        if (block->IsFree())
+        {
+            PrintDeviceMemoryRegion(s, *block, prevBlock);
+            prevBlock = block;
+        }
     }
 }
 
@@ -203,238 +308,192 @@ void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
  * ======= Private: =======
  */
 
-VkDeviceSize VKDeviceMemory::GetNextOffset() const
-{
-    if (blocks_.empty())
-        return 0;
-    else
-        return blocks_.back()->GetOffsetWithSize();
-}
-
-std::unique_ptr<VKDeviceMemoryRegion> VKDeviceMemory::MakeUniqueBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
-{
-    return MakeUnique<VKDeviceMemoryRegion>(this, alignedSize, alignedOffset, memoryTypeIndex_);
-}
-
-VKDeviceMemoryRegion* VKDeviceMemory::AllocAndAppendBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
+void VKDeviceMemory::MapSizeToClass(VkDeviceSize size, std::uint32_t& fl, std::uint32_t& sl)
 {
-    /* Update maximal free block size */
-    maxNewBlockSize_ = GetSize() - (alignedSize + alignedOffset);
-
-    /* Check if the aligned offset results in a new fragment */
-    const auto nextOffset = GetNextOffset();
-
-    if (nextOffset < alignedOffset)
+    if (size < slCount)
     {
-        /*
-        Check if new fragment can be immediately merged with previous fragment:
-        Before: blocks:    [++]........[++++]
-                fragments: ....[++++]
-        After:  blocks:    [++]........[++++]
-                fragments: ....[++++++]
-        */
-        if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() == nextOffset)
-        {
-            /* Resize last fragmented block */
-            fragmentedBlocks_.back()->MoveAt(alignedOffset - nextOffset, nextOffset);
-        }
-        else
-        {
-            /* Append new fragmented block at the end */
-            fragmentedBlocks_.push_back(MakeUniqueBlock(alignedOffset - nextOffset, nextOffset));
-        }
+        /* Small sizes are mapped linearly into the first size class */
+        fl = 0;
+        sl = static_cast<std::uint32_t>(size);
     }
     else
     {
-        /* Check if last fragmented block can be replaced by new block */
-        if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() == nextOffset)
-        {
-            /* Move fragmented block into main blocks and resize it */
-            auto block = TakeOwnership(blocks_, std::move(fragmentedBlocks_.back()));
-            block->MoveAt(alignedSize, alignedOffset);
-            fragmentedBlocks_.pop_back();
-            return block;
-        }
+        const auto msb = BitScanMSB(size);
+        fl = msb - slBits + 1;
+        sl = static_cast<std::uint32_t>(size >> (msb - slBits)) ^ slCount;
     }
-
-    /* Allocate new block */
-    return TakeOwnership(blocks_, MakeUniqueBlock(alignedSize, alignedOffset));
 }
 
-VKDeviceMemoryRegion* VKDeviceMemory::InsertBlock(std::unique_ptr<VKDeviceMemoryRegion>&& region)
+VKDeviceMemoryRegion* VKDeviceMemory::AcquireRegion(VkDeviceSize size, VkDeviceSize offset)
 {
-    auto regionRef = region.get();
-
-    /* Add block by insertion sort */
-    if (!blocks_.empty())
+    if (!unusedRegions_)
     {
-        for (auto it = blocks_.rbegin(); it != blocks_.rend(); ++it)
-        {
-            if ((*it)->GetOffset() < region->GetOffset())
-            {
-                blocks_.insert(it.base(), std::move(region));
-                break;
-            }
-        }
+        /* Allocate new page of regions and link them into the list of unused regions */
+        auto page = std::unique_ptr<VKDeviceMemoryRegion[]>(new VKDeviceMemoryRegion[g_regionPoolPageSize]);
+        for (std::size_t i = 0; i + 1 < g_regionPoolPageSize; ++i)
+            page[i].nextFree_ = &page[i + 1];
+        unusedRegions_ = &page[0];
+        regionPages_.push_back(std::move(page));
     }
-    else
-        blocks_.emplace_back(std::move(region));
 
-    return regionRef;
+    auto region = unusedRegions_;
+    unusedRegions_ = region->nextFree_;
+
+    region->deviceMemory_       = this;
+    region->size_               = size;
+    region->offset_             = offset;
+    region->memoryTypeIndex_    = memoryTypeIndex_;
+    region->free_               = true;
+    region->prevPhysical_       = nullptr;
+    region->nextPhysical_       = nullptr;
+    region->prevFree_           = nullptr;
+    region->nextFree_           = nullptr;
+
+    return region;
 }
 
-VKDeviceMemoryRegion* VKDeviceMemory::FindReusableBlock(VkDeviceSize alignedSize, VkDeviceSize alignment)
+void VKDeviceMemory::ReleaseRegion(VKDeviceMemoryRegion* region)
 {
-    VKDeviceMemoryRegion* prevBlock = nullptr;
-    VKDeviceMemoryRegion* nextBlock = nullptr;
+    region->deviceMemory_   = nullptr;
+    region->nextFree_       = unusedRegions_;
+    unusedRegions_          = region;
+}
 
-    /* Search for fragmented block that fits the requirement */
-    for (auto it = fragmentedBlocks_.begin(); it != fragmentedBlocks_.end(); ++it)
-    {
-        auto block = it->get();
+void VKDeviceMemory::InsertFreeBlock(VKDeviceMemoryRegion* region)
+{
+    std::uint32_t fl = 0, sl = 0;
+    MapSizeToClass(region->GetSize(), fl, sl);
 
-        /* Check if required size plus the additional aligned offset fits into the current block */
-        const auto alignedOffset = GetAlignedSize(block->GetOffset(), alignment);
-        if (alignedSize + alignedOffset - block->GetOffset() <= block->GetSize())
-        {
-            /* If this block has the maximum fragmented block size, this value must be updated */
-            const bool mustUpdateMaxSize = (block->GetSize() == maxFragmentedBlockSize_);
+    /* Insert region at the front of its free list */
+    auto& head = freeLists_[fl][sl];
 
-            /* If block can be reused with its entire size, it can be removed from the fragmented blocks */
-            InsertBlock(std::move(*it));
+    region->free_       = true;
+    region->prevFree_   = nullptr;
+    region->nextFree_   = head;
 
-            it = fragmentedBlocks_.erase(it);
-            if (it != fragmentedBlocks_.end())
-                nextBlock = it->get();
+    if (head)
+        head->prevFree_ = region;
 
-            /* Check if block must be split up at the lower part */
-            if (block->GetOffset() < alignedOffset)
-            {
-                /* Allocate fragmented lower block (left to the current block) */
-                auto blockLower = MakeUniqueBlock(alignedOffset - block->GetOffset(), block->GetOffset());
-
-                if (!prevBlock || !MergeFragmentedBlockWith(*prevBlock, *blockLower))
-                {
-                    it = fragmentedBlocks_.insert(it, std::move(blockLower));
-                    ++it;
-                }
-            }
+    head = region;
 
-            /* Check if block must be split up at the upper part */
-            auto alignedSizeWithOffset = alignedSize + alignedOffset - block->GetOffset();
-            if (alignedSizeWithOffset < block->GetSize())
-            {
-                /* Allocate fragmented upper block (right to the current block) */
-                auto blockUpperSize = block->GetSize() - alignedSizeWithOffset;
-                auto blockUpper     = MakeUniqueBlock(blockUpperSize, block->GetOffsetWithSize() - blockUpperSize);
+    /* Mark size class as non-empty */
+    flBitmap_       |= (std::uint64_t(1) << fl);
+    slBitmaps_[fl]  |= (1u << sl);
+}
 
-                if (!nextBlock || !MergeFragmentedBlockWith(*blockUpper, *nextBlock))
-                    fragmentedBlocks_.insert(it, std::move(blockUpper));
-            }
+void VKDeviceMemory::RemoveFreeBlock(VKDeviceMemoryRegion* region)
+{
+    std::uint32_t fl = 0, sl = 0;
+    MapSizeToClass(region->GetSize(), fl, sl);
 
-            /* Move reused block to new offset and size */
-            block->MoveAt(alignedSize, alignedOffset);
+    /* Unlink region from its free list */
+    if (region->prevFree_)
+        region->prevFree_->nextFree_ = region->nextFree_;
+    else
+        freeLists_[fl][sl] = region->nextFree_;
 
-            if (mustUpdateMaxSize)
-                UpdateMaxFragmentedBlockSize();
+    if (region->nextFree_)
+        region->nextFree_->prevFree_ = region->prevFree_;
 
-            /* Reuse current block */
-            return block;
-        }
+    region->prevFree_ = nullptr;
+    region->nextFree_ = nullptr;
 
-        prevBlock = block;
+    /* Mark size class as empty if this was the last region */
+    if (freeLists_[fl][sl] == nullptr)
+    {
+        slBitmaps_[fl] &= ~(1u << sl);
+        if (slBitmaps_[fl] == 0)
+            flBitmap_ &= ~(std::uint64_t(1) << fl);
     }
-
-    /* No reusable block found */
-    return nullptr;
 }
 
-void VKDeviceMemory::UpdateMaxFragmentedBlockSize()
+VKDeviceMemoryRegion* VKDeviceMemory::FindTightFitFreeBlock(VkDeviceSize alignedSize, VkDeviceSize alignment) const
 {
-    maxFragmentedBlockSize_ = 0;
-    for (const auto& block : fragmentedBlocks_)
-        maxFragmentedBlockSize_ = std::max(maxFragmentedBlockSize_, block->GetSize());
+    /* Only check the first block of the smallest non-empty size class, which might be a tighter fit than any block of the rounded up size class */
+    std::uint32_t fl = 0, sl = 0;
+    MapSizeToClass(alignedSize, fl, sl);
+
+    auto block = FindFreeBlock(fl, sl);
+    if (block != nullptr && FitsIntoRegion(*block, alignedSize, alignment))
+        return block;
+
+    return nullptr;
 }
 
-void VKDeviceMemory::InsertBlockToFragmentsSorted(std::unique_ptr<VKDeviceMemoryRegion>&& region)
+VKDeviceMemoryRegion* VKDeviceMemory::FindGoodFitFreeBlock(VkDeviceSize alignedSize, VkDeviceSize alignment) const
 {
-    auto offset = region->GetOffset();
-    auto count  = fragmentedBlocks_.size();
+    /* Round up the requested size (plus worst-case alignment padding) to the next size class, so any block of that class fits */
+    auto searchSize = alignedSize;
+    if (alignment > 1)
+        searchSize += alignment - 1;
 
-    /* Start serach in half-open range [begin, end) */
-    decltype(count) begin = 0, end = count;
+    if (searchSize >= slCount)
+        searchSize += (VkDeviceSize(1) << (BitScanMSB(searchSize) - slBits)) - 1;
 
-    while (begin + 2 < end)
-    {
-        /* Check if region's offset is before or after the middle's element */
-        auto center = (begin + end) / 2;
+    if (searchSize > GetSize())
+        return nullptr;
 
-        if (offset < fragmentedBlocks_[center]->GetOffset())
-        {
-            /* Restrict search to lower half */
-            end = center + 1;
-        }
-        else
-        {
-            /* Restrict search to upper half */
-            begin = center;
-        }
-    }
+    std::uint32_t fl = 0, sl = 0;
+    MapSizeToClass(searchSize, fl, sl);
 
-    /* Insert region by insertion-sort of the remaining half-open range [begin, begin + 2) */
-    if (begin < count && offset < fragmentedBlocks_[begin]->GetOffset())
-        InsertBlockToFragmentsAt(std::move(region), begin);
-    else if (begin + 1 < count)
-    {
-        if (offset < fragmentedBlocks_[begin + 1]->GetOffset())
-            InsertBlockToFragmentsAt(std::move(region), begin + 1);
-        else
-            InsertBlockToFragmentsAt(std::move(region), begin + 2);
-    }
-    else
-        InsertBlockToFragmentsAt(std::move(region), count);
+    return FindFreeBlock(fl, sl);
 }
 
-void VKDeviceMemory::InsertBlockToFragmentsAt(std::unique_ptr<VKDeviceMemoryRegion>&& region, std::size_t position)
+VKDeviceMemoryRegion* VKDeviceMemory::FindFreeBlock(std::uint32_t& fl, std::uint32_t& sl) const
 {
-    auto count = fragmentedBlocks_.size();
+    if (fl >= flCount)
+        return nullptr;
 
-    /* Try to merge region into lower part: [LOWER][BLOCK] --> [+++LOWER++++] */
-    if (position > 0 && MergeFragmentedBlockWith(*fragmentedBlocks_[position - 1], *region))
-    {
-        /* Try to merge upper part into lower part: [+++LOWER++++][UPPER] --> [+++++++LOWER+++++++] */
-        if (position < count && MergeFragmentedBlockWith(*fragmentedBlocks_[position - 1], *fragmentedBlocks_[position]))
-        {
-            /* Remove previous upper part after two-phase-merge */
-            fragmentedBlocks_.erase(fragmentedBlocks_.begin() + position);
-        }
-    }
-    /* Try to merge region into upper part: [BLOCK][UPPER] --> [+++UPPER++++] */
-    else if (position >= count || !MergeFragmentedBlockWith(*fragmentedBlocks_[position], *region))
-    {
-        /* Insert new fragmented block: [LOWER]..[BLOCK]..[UPPER] */
-        fragmentedBlocks_.insert(fragmentedBlocks_.begin() + position, std::move(region));
-    }
-}
+    /* Search for a non-empty size class within the same first-level class */
+    auto slMap = slBitmaps_[fl] & (~0u << sl);
 
-bool VKDeviceMemory::MergeFragmentedBlockWith(VKDeviceMemoryRegion& region, VKDeviceMemoryRegion& appendixRegion)
-{
-    if (region.MergeWith(appendixRegion))
+    if (slMap == 0)
     {
-        IncMaxFragmentedBlockSize(region.GetSize());
-        return true;
+        /* Search for a non-empty first-level class with a larger size */
+        if (fl + 1 >= flCount)
+            return nullptr;
+
+        const auto flMap = flBitmap_ & (~std::uint64_t(0) << (fl + 1));
+        if (flMap == 0)
+            return nullptr;
+
+        fl      = BitScanLSB(flMap);
+        slMap   = slBitmaps_[fl];
     }
-    return false;
+
+    sl = BitScanLSB(slMap);
+
+    return freeLists_[fl][sl];
 }
 
-VkDeviceSize VKDeviceMemory::GetFragmentBlockOffsetEnd(std::size_t position) const
+void VKDeviceMemory::SplitFreeBlock(VKDeviceMemoryRegion* region, VkDeviceSize relativeOffset)
 {
-    return fragmentedBlocks_[position]->GetOffsetWithSize();
+    /* Allocate upper part and link it between this region and its upper neighbor */
+    auto upper = AcquireRegion(region->GetSize() - relativeOffset, region->GetOffset() + relativeOffset);
+
+    upper->prevPhysical_ = region;
+    upper->nextPhysical_ = region->nextPhysical_;
+
+    if (region->nextPhysical_)
+        region->nextPhysical_->prevPhysical_ = upper;
+
+    region->nextPhysical_   = upper;
+    region->size_           = relativeOffset;
+
+    InsertFreeBlock(upper);
 }
 
-void VKDeviceMemory::IncMaxFragmentedBlockSize(VkDeviceSize size)
+void VKDeviceMemory::MergeWithNext(VKDeviceMemoryRegion* region)
 {
-    maxFragmentedBlockSize_ = std::max(maxFragmentedBlockSize_, size);
+    auto upper = region->nextPhysical_;
+
+    region->size_           += upper->GetSize();
+    region->nextPhysical_   = upper->nextPhysical_;
+
+    if (upper->nextPhysical_)
+        upper->nextPhysical_->prevPhysical_ = region;
+
+    ReleaseRegion(upper);
 }
 
 
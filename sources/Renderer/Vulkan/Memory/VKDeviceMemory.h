@@ -29,13 +29,20 @@ namespace LLGL
 struct VKDeviceMemoryDetails
 {
     std::size_t     numChunks               = 0;
-    std::size_t     numBlocks               = 0;
-    std::size_t     numFragments            = 0;
-    VkDeviceSize    maxNewBlockSize         = 0;
-    VkDeviceSize    maxFragmentedBlockSize  = 0;
+    std::size_t     numBlocks               = 0;    // Number of allocated blocks.
+    std::size_t     numFragments            = 0;    // Number of free blocks.
+    VkDeviceSize    totalSize               = 0;    // Accumulated size of all chunks.
+    VkDeviceSize    usedSize                = 0;    // Accumulated size of all allocated blocks.
+    VkDeviceSize    freeSize                = 0;    // Accumulated size of all free blocks.
+    VkDeviceSize    maxFragmentedBlockSize  = 0;    // Size of the largest free block.
+    float           fragmentation           = 0.0f; // Ratio of free memory that is not part of the largest free block, in the range [0, 1] (only set by VKDeviceMemoryManager).
 };
 
-// An instance of this class holds a single VkDeviceMemory allocation chunk.
+/*
+An instance of this class holds a single VkDeviceMemory allocation chunk.
+Blocks are sub-allocated with a two-level segregated fit (TLSF) allocator,
+so allocating and releasing a block takes constant time regardless of the number of blocks.
+*/
 class VKDeviceMemory
 {
 
@@ -46,24 +53,21 @@ class VKDeviceMemory
         VKDeviceMemory(const VKDeviceMemory&) = delete;
         VKDeviceMemory& operator = (const VKDeviceMemory&) = delete;
 
-        VKDeviceMemory(VKDeviceMemory&&) = default;
-        VKDeviceMemory& operator = (VKDeviceMemory&&) = default;
-
         void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
         void Unmap(VkDevice device);
 
-        // Tries to allocate a new block within this device memory chunk, and returns null of failure.
+        /*
+        Tries to allocate a new block within this device memory chunk, and returns null of failure.
+        If 'reduceFragmentation' is true, the free list of the exact size class is checked first before a larger block is split up.
+        */
         VKDeviceMemoryRegion* Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation = false);
 
-        // Releases the specified block within this device memory chunk.
+        // Releases the specified block within this device memory chunk and merges it with its adjacent free blocks.
         void Release(VKDeviceMemoryRegion* region);
 
         // Returns true if this device memory has no more blocks.
         bool IsEmpty() const;
 
-        // Returns the maximal size that can be allocated for a device memory region within this device memory chunk.
-        VkDeviceSize GetMaxAllocationSize() const;
-
         // Accumulates the memory details of this device memory into the output structure.
         void AccumDetails(VKDeviceMemoryDetails& details) const;
 
@@ -94,48 +98,56 @@ class VKDeviceMemory
 
     private:
 
-        // Returns the next offset after the last block.
-        VkDeviceSize GetNextOffset() const;
+        // Number of bits for the second-level index, i.e. each power-of-two size range is split into 2^slBits size classes.
+        static const std::uint32_t slBits   = 4;
+        static const std::uint32_t slCount  = (1u << slBits);
+
+        // Number of first-level size classes to cover the entire 64-bit range of VkDeviceSize.
+        static const std::uint32_t flCount  = (64 - slBits + 1);
+
+        // Maps the specified size to its first-level (fl) and second-level (sl) size class.
+        static void MapSizeToClass(VkDeviceSize size, std::uint32_t& fl, std::uint32_t& sl);
 
-        // Makes a new device memory block.
-        std::unique_ptr<VKDeviceMemoryRegion> MakeUniqueBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
+        // Returns a region from the region pool.
+        VKDeviceMemoryRegion* AcquireRegion(VkDeviceSize size, VkDeviceSize offset);
 
-        // Allocates a new block.
-        VKDeviceMemoryRegion* AllocAndAppendBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
+        // Returns the specified region to the region pool.
+        void ReleaseRegion(VKDeviceMemoryRegion* region);
 
-        // Inserts the specified region into the main block list by insertion-sort.
-        VKDeviceMemoryRegion* InsertBlock(std::unique_ptr<VKDeviceMemoryRegion>&& region);
+        // Inserts the specified region into the free list of its size class.
+        void InsertFreeBlock(VKDeviceMemoryRegion* region);
 
-        // Tries to find a fragmented block that can be reused.
-        VKDeviceMemoryRegion* FindReusableBlock(VkDeviceSize alignedSize, VkDeviceSize alignment);
+        // Removes the specified region from the free list of its size class.
+        void RemoveFreeBlock(VKDeviceMemoryRegion* region);
 
-        // Updates the maximal size of fragmanted blocks.
-        void UpdateMaxFragmentedBlockSize();
+        // Returns the first free block of the exact size class (or the next non-empty size class) if the requested block fits into it, or null otherwise.
+        VKDeviceMemoryRegion* FindTightFitFreeBlock(VkDeviceSize alignedSize, VkDeviceSize alignment) const;
 
-        // Inserts the specified region into the fragmented block list by insertion-sort.
-        void InsertBlockToFragmentsSorted(std::unique_ptr<VKDeviceMemoryRegion>&& region);
+        // Returns a free block of the next larger size class, into which the requested block is guaranteed to fit, or null if there is none.
+        VKDeviceMemoryRegion* FindGoodFitFreeBlock(VkDeviceSize alignedSize, VkDeviceSize alignment) const;
 
-        // Inserts the specified region into the fragmented block list at the specified position and merges it with surrounding blocks if possible.
-        void InsertBlockToFragmentsAt(std::unique_ptr<VKDeviceMemoryRegion>&& region, std::size_t position);
+        // Returns the first free block of the size class (fl, sl) or any larger size class, or null if there is none.
+        VKDeviceMemoryRegion* FindFreeBlock(std::uint32_t& fl, std::uint32_t& sl) const;
 
-        // Merges the two fragmented blocks and records the maximal fragmented block size.
-        bool MergeFragmentedBlockWith(VKDeviceMemoryRegion& region, VKDeviceMemoryRegion& appendixRegion);
+        // Splits the specified region at the relative offset and returns the upper part as a new free block.
+        void SplitFreeBlock(VKDeviceMemoryRegion* region, VkDeviceSize relativeOffset);
 
-        // Returns the offset after the specified fragmented block.
-        VkDeviceSize GetFragmentBlockOffsetEnd(std::size_t position) const;
+        // Merges the specified region with its physically following region, which is returned to the region pool.
+        void MergeWithNext(VKDeviceMemoryRegion* region);
 
-        // Increases the maximal fragmented block size.
-        void IncMaxFragmentedBlockSize(VkDeviceSize size);
+        VKPtr<VkDeviceMemory>                                       deviceMemory_;
+        VkDeviceSize                                                size_                   = 0;
+        std::uint32_t                                               memoryTypeIndex_        = 0;
 
-        VKPtr<VkDeviceMemory>                               deviceMemory_;
-        VkDeviceSize                                        size_                   = 0;
-        std::uint32_t                                       memoryTypeIndex_        = 0;
+        VKDeviceMemoryRegion*                                       firstRegion_            = nullptr;
+        std::size_t                                                 numBlocks_              = 0;
 
-        VkDeviceSize                                        maxNewBlockSize_        = 0;
-        std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  blocks_;
+        std::uint64_t                                               flBitmap_               = 0;
+        std::uint32_t                                               slBitmaps_[flCount];
+        VKDeviceMemoryRegion*                                       freeLists_[flCount][slCount];
 
-        VkDeviceSize                                        maxFragmentedBlockSize_ = 0;
-        std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  fragmentedBlocks_;
+        std::vector<std::unique_ptr<VKDeviceMemoryRegion[]>>        regionPages_;
+        VKDeviceMemoryRegion*                                       unusedRegions_          = nullptr;
 
 };
 
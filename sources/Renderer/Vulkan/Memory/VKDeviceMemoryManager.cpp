@@ -27,12 +27,14 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(VkDeviceSize size, VkDevic
 {
     const auto alignedSize      = GetAlignedSize(size, alignment);
     const auto memoryTypeIndex  = FindMemoryType(memoryTypeBits, properties);
-    const auto allocationSize   = std::max(minAllocationSize_, alignedSize);
 
-    if (auto chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
-        return chunk->Allocate(size, alignment);
-    else
-        return nullptr;
+    /* Try to allocate block within one of the existing chunks (each attempt takes constant time) */
+    if (auto region = AllocInExistingChunk(size, alignment, memoryTypeIndex))
+        return region;
+
+    /* Allocate block within a new chunk */
+    const auto allocationSize = std::max(minAllocationSize_, alignedSize);
+    return AllocChunk(allocationSize, memoryTypeIndex)->Allocate(size, alignment, reduceFragmentation_);
 }
 
 void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
@@ -48,7 +50,7 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
             if (chunk->IsEmpty())
             {
                 RemoveFromListIf(
-                    chunks_,
+                    chunks_[chunk->GetMemoryTypeIndex()],
                     [chunk](std::unique_ptr<VKDeviceMemory>& entry)
                     {
                         return (entry.get() == chunk);
@@ -63,8 +65,14 @@ VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 {
     VKDeviceMemoryDetails details;
     {
-        for (const auto& chunk : chunks_)
-            chunk->AccumDetails(details);
+        for (const auto& chunkList : chunks_)
+        {
+            for (const auto& chunk : chunkList)
+                chunk->AccumDetails(details);
+        }
+
+        if (details.freeSize > 0)
+            details.fragmentation = 1.0f - static_cast<float>(details.maxFragmentedBlockSize) / static_cast<float>(details.freeSize);
     }
     return details;
 }
@@ -74,24 +82,27 @@ VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& title) const
 {
     std::size_t i = 0;
-    for (const auto& chunk : chunks_)
+    for (const auto& chunkList : chunks_)
     {
-        s << "chunk[" << (i++) << "]:";
+        for (const auto& chunk : chunkList)
+        {
+            s << "chunk[" << (i++) << "]:";
 
-        if (!title.empty())
-            s << " \"" << title << '\"';
+            if (!title.empty())
+                s << " \"" << title << '\"';
 
-        s << '\n';
-        s << "  size             = " << chunk->GetSize() << '\n';
-        s << "  memoryTypeIndex  = " << chunk->GetMemoryTypeIndex() << '\n';
+            s << '\n';
+            s << "  size             = " << chunk->GetSize() << '\n';
+            s << "  memoryTypeIndex  = " << chunk->GetMemoryTypeIndex() << '\n';
 
-        s << "  blocks           = ";
-        chunk->PrintBlocks(s);
-        s << '\n';
+            s << "  blocks           = ";
+            chunk->PrintBlocks(s);
+            s << '\n';
 
-        s << "  fragmentedBlocks = ";
-        chunk->PrintFragmentedBlocks(s);
-        s << '\n';
+            s << "  fragmentedBlocks = ";
+            chunk->PrintFragmentedBlocks(s);
+            s << '\n';
+        }
     }
 }
 
@@ -109,23 +120,21 @@ std::uint32_t VKDeviceMemoryManager::FindMemoryType(std::uint32_t memoryTypeBits
 
 VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32_t memoryTypeIndex)
 {
-    return TakeOwnership(chunks_, MakeUnique<VKDeviceMemory>(device_, size, memoryTypeIndex));
+    return TakeOwnership(chunks_[memoryTypeIndex], MakeUnique<VKDeviceMemory>(device_, size, memoryTypeIndex));
 }
 
-VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize)
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocInExistingChunk(VkDeviceSize size, VkDeviceSize alignment, std::uint32_t memoryTypeIndex)
 {
-    /* Search for a suitable chunk */
-    for (const auto& chunk : chunks_)
+    /* Search chunks of this memory type in reverse order, since the most recently allocated chunks are most likely to have free memory */
+    auto& chunkList = chunks_[memoryTypeIndex];
+    for (auto it = chunkList.rbegin(); it != chunkList.rend(); ++it)
     {
-        if (chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
-            return chunk.get();
+        if (auto region = (*it)->Allocate(size, alignment, reduceFragmentation_))
+            return region;
     }
-
-    /* Allocate new chunk */
-    return AllocChunk(allocationSize, memoryTypeIndex);
+    return nullptr;
 }
 
-
 } // /namespace LLGL
 
 
@@ -71,8 +71,8 @@ class VKDeviceMemoryManager
         // Allocates a new VkDeviceMemory chunk of the specified size and memory type.
         VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex);
 
-        // Finds a suitable device memory chunk or allocates a new one.
-        VKDeviceMemory* FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize);
+        // Tries to allocate a block within one of the existing chunks of the specified memory type, and returns null on failure.
+        VKDeviceMemoryRegion* AllocInExistingChunk(VkDeviceSize size, VkDeviceSize alignment, std::uint32_t memoryTypeIndex);
 
         const VKPtr<VkDevice>&                          device_;
         VkPhysicalDeviceMemoryProperties                memoryProperties_;
@@ -80,7 +80,8 @@ class VKDeviceMemoryManager
         VkDeviceSize                                    minAllocationSize_      = 1024*1024;
         bool                                            reduceFragmentation_    = false;
 
-        std::vector<std::unique_ptr<VKDeviceMemory>>    chunks_;
+        // Chunk lists for each memory type index, so allocations and releases only search chunks of the same memory type.
+        std::vector<std::unique_ptr<VKDeviceMemory>>    chunks_[VK_MAX_MEMORY_TYPES];
 
 };
 
@@ -14,14 +14,6 @@ namespace LLGL
 {
 
 
-VKDeviceMemoryRegion::VKDeviceMemoryRegion(VKDeviceMemory* deviceMemory, VkDeviceSize alignedSize, VkDeviceSize alignedOffset, std::uint32_t memoryTypeIndex) :
-    deviceMemory_    { deviceMemory    },
-    size_            { alignedSize     },
-    offset_          { alignedOffset   },
-    memoryTypeIndex_ { memoryTypeIndex }
-{
-}
-
 void VKDeviceMemoryRegion::BindBuffer(VkDevice device, VkBuffer buffer)
 {
     vkBindBufferMemory(device, buffer, deviceMemory_->GetVkDeviceMemory(), GetOffset());
@@ -33,39 +25,6 @@ void VKDeviceMemoryRegion::BindImage(VkDevice device, VkImage image)
 }
 
 
-/*
- * ======= Protected: =======
- */
-
-bool VKDeviceMemoryRegion::MergeWith(VKDeviceMemoryRegion& other)
-{
-    if (GetParentChunk() == other.GetParentChunk() && GetMemoryTypeIndex() == other.GetMemoryTypeIndex())
-    {
-        /* Check if this region is a direct lower part */
-        if (GetOffsetWithSize() == other.GetOffset())
-        {
-            size_ += other.GetSize();
-            return true;
-        }
-
-        /* Check if this region is a direct upper part */
-        if (other.GetOffsetWithSize() == GetOffset())
-        {
-            offset_ = other.GetOffset();
-            size_ += other.GetSize();
-            return true;
-        }
-    }
-    return false;
-}
-
-void VKDeviceMemoryRegion::MoveAt(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
-{
-    size_   = alignedSize;
-    offset_ = alignedOffset;
-}
-
-
 } // /namespace LLGL
 
 
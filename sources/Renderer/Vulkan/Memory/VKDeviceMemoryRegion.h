@@ -25,8 +25,6 @@ class VKDeviceMemoryRegion
 
     public:
 
-        VKDeviceMemoryRegion(VKDeviceMemory* deviceMemory, VkDeviceSize alignedSize, VkDeviceSize alignedOffset, std::uint32_t memoryTypeIndex);
-
         // Binds the specified buffer to this memory region.
         void BindBuffer(VkDevice device, VkBuffer buffer);
 
@@ -63,22 +61,34 @@ class VKDeviceMemoryRegion
             return memoryTypeIndex_;
         }
 
-    protected:
+        // Returns true if this region is currently not in use, i.e. it is a fragment within its device memory chunk.
+        inline bool IsFree() const
+        {
+            return free_;
+        }
 
-        friend class VKDeviceMemory;
+    private:
 
-        // Tries to merge the specified region into this region, and returns true on success.
-        bool MergeWith(VKDeviceMemoryRegion& other);
+        friend class VKDeviceMemory;
 
-        // Sets the new size and offset.
-        void MoveAt(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
+        // Regions are only constructed by the region pool of their parent device memory chunk.
+        VKDeviceMemoryRegion() = default;
 
     private:
 
-        VKDeviceMemory* deviceMemory_       = nullptr;
-        VkDeviceSize    size_               = 0;
-        VkDeviceSize    offset_             = 0;
-        std::uint32_t   memoryTypeIndex_    = 0;
+        VKDeviceMemory*         deviceMemory_       = nullptr;
+        VkDeviceSize            size_               = 0;
+        VkDeviceSize            offset_             = 0;
+        std::uint32_t           memoryTypeIndex_    = 0;
+        bool                    free_               = false;
+
+        /* Links to the physically adjacent regions within the device memory chunk */
+        VKDeviceMemoryRegion*   prevPhysical_       = nullptr;
+        VKDeviceMemoryRegion*   nextPhysical_       = nullptr;
+
+        /* Links within the free list of the same size class (also used by the region pool) */
+        VKDeviceMemoryRegion*   prevFree_           = nullptr;
+        VKDeviceMemoryRegion*   nextFree_           = nullptr;
 
 };
 
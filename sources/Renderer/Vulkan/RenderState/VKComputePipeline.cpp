@@ -8,6 +8,7 @@
 #include "VKComputePipeline.h"
 #include "../Shader/VKShaderProgram.h"
 #include "VKPipelineLayout.h"
+#include "VKPipelineCache.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include "../../CheckedCast.h"
@@ -19,7 +20,8 @@ namespace LLGL
 
 
 VKComputePipeline::VKComputePipeline(
-    const VKPtr<VkDevice>& device, const ComputePipelineDescriptor& desc, VkPipelineLayout defaultPipelineLayout) :
+    const VKPtr<VkDevice>& device, const ComputePipelineDescriptor& desc,
+    VkPipelineLayout defaultPipelineLayout, VkPipelineCache defaultPipelineCache) :
         device_         { device                    },
         pipelineLayout_ { defaultPipelineLayout     },
         pipeline_       { device, vkDestroyPipeline }
@@ -31,8 +33,15 @@ VKComputePipeline::VKComputePipeline(
         pipelineLayout_ = pipelineLayoutVK->GetVkPipelineLayout();
     }
 
+    /* Get pipeline cache object */
+    if (desc.pipelineCache)
+    {
+        auto pipelineCacheVK = LLGL_CAST(VKPipelineCache*, desc.pipelineCache);
+        defaultPipelineCache = pipelineCacheVK->GetVkPipelineCache();
+    }
+
     /* Create Vulkan compute pipeline object */
-    CreateComputePipeline(desc);
+    CreateComputePipeline(desc, defaultPipelineCache);
 }
 
 
@@ -40,7 +49,7 @@ VKComputePipeline::VKComputePipeline(
  * ======= Private: =======
  */
 
-void VKComputePipeline::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+void VKComputePipeline::CreateComputePipeline(const ComputePipelineDescriptor& desc, VkPipelineCache pipelineCache)
 {
     /* Get shader program object */
     auto shaderProgramVK = LLGL_CAST(VKShaderProgram*, desc.shaderProgram);
@@ -63,7 +72,7 @@ void VKComputePipeline::CreateComputePipeline(const ComputePipelineDescriptor& d
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
     }
-    auto result = vkCreateComputePipelines(device_, VK_NULL_HANDLE, 1, &createInfo, nullptr, pipeline_.ReleaseAndGetAddressOf());
+    auto result = vkCreateComputePipelines(device_, pipelineCache, 1, &createInfo, nullptr, pipeline_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan compute pipeline");
 }
 
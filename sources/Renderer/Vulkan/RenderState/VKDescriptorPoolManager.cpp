@@ -0,0 +1,269 @@
+/*
+ * VKDescriptorPoolManager.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKDescriptorPoolManager.h"
+#include "VKPipelineLayout.h"
+#include "../VKCore.h"
+#include <LLGL/Log.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKDescriptorPoolPage::VKDescriptorPoolPage(const VKPtr<VkDevice>& device) :
+    descriptorPool { device, vkDestroyDescriptorPool }
+{
+}
+
+VKDescriptorPoolManager::VKDescriptorPoolManager(
+    const VKPtr<VkDevice>&  device,
+    VkQueue                 queue,
+    std::uint32_t           initialPageSize,
+    std::uint32_t           maxPageSize)
+:
+    device_          { device                                 },
+    queue_           { queue                                  },
+    initialPageSize_ { std::max(1u, initialPageSize)          },
+    maxPageSize_     { std::max(initialPageSize_, maxPageSize) }
+{
+}
+
+VKDescriptorSetAllocation VKDescriptorPoolManager::AllocateDescriptorSet(VkDescriptorSetLayout setLayout, const std::vector<VKLayoutBinding>& bindings)
+{
+    /* Return descriptor sets of completed commands to their pages first */
+    RecycleDescriptorSets();
+
+    auto& layoutClass = GetOrCreateLayoutClass(bindings);
+
+    VKDescriptorSetAllocation allocation;
+
+    while (true)
+    {
+        auto page = FindOrCreatePage(layoutClass);
+
+        /* Allocate descriptor set from page */
+        VkDescriptorSetAllocateInfo allocInfo;
+        {
+            allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            allocInfo.pNext                 = nullptr;
+            allocInfo.descriptorPool        = page->descriptorPool;
+            allocInfo.descriptorSetCount    = 1;
+            allocInfo.pSetLayouts           = (&setLayout);
+        }
+        auto result = vkAllocateDescriptorSets(device_, &allocInfo, &(allocation.descriptorSet));
+
+        /* Mark page as full and continue with a new page, if an existing page ran out of memory */
+        if ((result == VK_ERROR_FRAGMENTED_POOL || result == VK_ERROR_OUT_OF_POOL_MEMORY_KHR) && page->numSets > 0)
+        {
+            page->maxSets = page->numSets;
+            continue;
+        }
+
+        VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets");
+
+        allocation.page = page;
+        ++page->numSets;
+
+        break;
+    }
+
+    return allocation;
+}
+
+void VKDescriptorPoolManager::FreeDescriptorSet(const VKDescriptorSetAllocation& allocation)
+{
+    if (allocation.descriptorSet != VK_NULL_HANDLE && allocation.page != nullptr)
+    {
+        /* Defer release, since previously submitted commands might still refer to this descriptor set */
+        try
+        {
+            queuedFrees_.push_back(allocation);
+        }
+        catch (const std::exception& e)
+        {
+            /* Only report failures, since this is called from the destructor of VKResourceHeap */
+            Log::StdErr() << "failed to queue Vulkan descriptor set for release: " << e.what() << std::endl;
+        }
+    }
+}
+
+void VKDescriptorPoolManager::RecycleDescriptorSets()
+{
+    SubmitPendingFrees();
+
+    bool anyReleased = false;
+
+    /* Release descriptor sets of all signaled fences (fences are signaled in submission order) */
+    while (!pendingFrees_.empty() && vkGetFenceStatus(device_, pendingFrees_.front().fence) == VK_SUCCESS)
+    {
+        auto& pending = pendingFrees_.front();
+
+        for (const auto& allocation : pending.allocations)
+        {
+            auto result = vkFreeDescriptorSets(device_, allocation.page->descriptorPool, 1, &(allocation.descriptorSet));
+            VKLogIfFailed(result, "failed to release Vulkan descriptor sets");
+            --allocation.page->numSets;
+        }
+
+        freeFences_.push_back(std::move(pending.fence));
+        pendingFrees_.pop_front();
+
+        anyReleased = true;
+    }
+
+    if (anyReleased)
+        ReleaseEmptyPages();
+}
+
+std::size_t VKDescriptorPoolManager::GetNumPages() const
+{
+    std::size_t n = 0;
+
+    for (const auto& layoutClass : layoutClasses_)
+        n += layoutClass.second.pages.size();
+
+    return n;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKDescriptorPoolManager::LayoutClass& VKDescriptorPoolManager::GetOrCreateLayoutClass(const std::vector<VKLayoutBinding>& bindings)
+{
+    /* Accumulate number of descriptors per type (one descriptor per binding) */
+    std::map<VkDescriptorType, std::uint32_t> descriptorCounts;
+    for (const auto& binding : bindings)
+        ++descriptorCounts[binding.descriptorType];
+
+    LayoutClassKey key;
+    key.reserve(descriptorCounts.size() * 2);
+
+    for (const auto& count : descriptorCounts)
+    {
+        key.push_back(static_cast<std::uint32_t>(count.first));
+        key.push_back(count.second);
+    }
+
+    /* Find layout class or create a new one */
+    auto it = layoutClasses_.find(key);
+    if (it != layoutClasses_.end())
+        return it->second;
+
+    auto& layoutClass = layoutClasses_[key];
+    {
+        for (const auto& count : descriptorCounts)
+            layoutClass.setPoolSizes.push_back({ count.first, count.second });
+        layoutClass.nextPageSize = initialPageSize_;
+    }
+    return layoutClass;
+}
+
+VKDescriptorPoolPage* VKDescriptorPoolManager::FindOrCreatePage(LayoutClass& layoutClass)
+{
+    /* Find page with free descriptor sets, starting with the most recent one */
+    for (auto it = layoutClass.pages.rbegin(); it != layoutClass.pages.rend(); ++it)
+    {
+        if ((*it)->numSets < (*it)->maxSets)
+            return it->get();
+    }
+
+    /* Create new page with pool sizes for the maximum number of sets */
+    std::unique_ptr<VKDescriptorPoolPage> page { new VKDescriptorPoolPage(device_) };
+    page->maxSets = layoutClass.nextPageSize;
+
+    auto poolSizes = layoutClass.setPoolSizes;
+    for (auto& poolSize : poolSizes)
+        poolSize.descriptorCount *= page->maxSets;
+
+    VkDescriptorPoolCreateInfo poolCreateInfo;
+    {
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        poolCreateInfo.maxSets          = page->maxSets;
+        poolCreateInfo.poolSizeCount    = static_cast<std::uint32_t>(poolSizes.size());
+        poolCreateInfo.pPoolSizes       = poolSizes.data();
+    }
+    auto result = vkCreateDescriptorPool(device_, &poolCreateInfo, nullptr, page->descriptorPool.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool");
+
+    /* Grow page size for the next page of this layout class */
+    layoutClass.nextPageSize = std::min(layoutClass.nextPageSize * 2, maxPageSize_);
+
+    layoutClass.pages.push_back(std::move(page));
+
+    return layoutClass.pages.back().get();
+}
+
+VKPtr<VkFence> VKDescriptorPoolManager::AcquireFence()
+{
+    /* Reuse signaled fence */
+    if (!freeFences_.empty())
+    {
+        VKPtr<VkFence> fence { std::move(freeFences_.front()) };
+        freeFences_.pop_front();
+        vkResetFences(device_, 1, &fence);
+        return fence;
+    }
+
+    /* Create new fence */
+    VKPtr<VkFence> fence { device_, vkDestroyFence };
+
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    auto result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence");
+
+    return fence;
+}
+
+void VKDescriptorPoolManager::SubmitPendingFrees()
+{
+    if (queuedFrees_.empty())
+        return;
+
+    auto fence = AcquireFence();
+
+    /* Submit fence without commands, so it is signaled once all previously submitted commands have completed */
+    auto result = vkQueueSubmit(queue_, 0, nullptr, fence);
+    VKThrowIfFailed(result, "failed to submit Vulkan fence for descriptor set release");
+
+    pendingFrees_.push_back({ std::move(fence), std::move(queuedFrees_) });
+    queuedFrees_.clear();
+}
+
+void VKDescriptorPoolManager::ReleaseEmptyPages()
+{
+    for (auto& layoutClass : layoutClasses_)
+    {
+        auto& pages = layoutClass.second.pages;
+
+        /* Destroy all empty pages, but keep one page per layout class to avoid re-creating pools for alternating allocations */
+        for (auto it = pages.begin(); it != pages.end() && pages.size() > 1;)
+        {
+            if ((*it)->numSets == 0)
+                it = pages.erase(it);
+            else
+                ++it;
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,124 @@
+/*
+ * VKDescriptorPoolManager.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_DESCRIPTOR_POOL_MANAGER_H
+#define LLGL_VK_DESCRIPTOR_POOL_MANAGER_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+struct VKLayoutBinding;
+
+// Descriptor pool that holds a fixed number of descriptor sets of the same layout class.
+struct VKDescriptorPoolPage
+{
+    VKDescriptorPoolPage(const VKPtr<VkDevice>& device);
+
+    VKPtr<VkDescriptorPool> descriptorPool;
+    std::uint32_t           maxSets         = 0;
+    std::uint32_t           numSets         = 0;
+};
+
+// Descriptor set that was allocated by the descriptor pool manager.
+struct VKDescriptorSetAllocation
+{
+    VkDescriptorSet         descriptorSet   = VK_NULL_HANDLE;
+    VKDescriptorPoolPage*   page            = nullptr;
+};
+
+/*
+Manages growable lists of descriptor pools (pages), one list for each layout class.
+A layout class is determined by the number of descriptors of each type within a set,
+so each set of a class consumes exactly the same amount of pool memory and freed sets can be recycled without fragmentation.
+Freed sets are only returned to their page once a fence, submitted after the free, has been signaled by the queue.
+*/
+class VKDescriptorPoolManager
+{
+
+    public:
+
+        VKDescriptorPoolManager(
+            const VKPtr<VkDevice>&  device,
+            VkQueue                 queue,
+            std::uint32_t           initialPageSize = 16,
+            std::uint32_t           maxPageSize     = 1024
+        );
+
+        VKDescriptorPoolManager(const VKDescriptorPoolManager&) = delete;
+        VKDescriptorPoolManager& operator = (const VKDescriptorPoolManager&) = delete;
+
+        // Allocates a descriptor set with the specified layout. The bindings determine the layout class.
+        VKDescriptorSetAllocation AllocateDescriptorSet(VkDescriptorSetLayout setLayout, const std::vector<VKLayoutBinding>& bindings);
+
+        // Queues the specified descriptor set to be returned to its page once all previously submitted commands have completed. Never throws.
+        void FreeDescriptorSet(const VKDescriptorSetAllocation& allocation);
+
+        // Submits a fence for all queued descriptor sets and returns those sets to their pages whose fence has been signaled.
+        void RecycleDescriptorSets();
+
+        // Returns the number of descriptor pools of all layout classes.
+        std::size_t GetNumPages() const;
+
+    private:
+
+        struct LayoutClass
+        {
+            std::vector<VkDescriptorPoolSize>                   setPoolSizes;
+            std::vector<std::unique_ptr<VKDescriptorPoolPage>>  pages;
+            std::uint32_t                                       nextPageSize    = 0;
+        };
+
+        // Descriptor sets that are freed once the fence has been signaled.
+        struct PendingFrees
+        {
+            VKPtr<VkFence>                          fence;
+            std::vector<VKDescriptorSetAllocation>  allocations;
+        };
+
+        // Sorted list of descriptor types and their counts per set.
+        using LayoutClassKey = std::vector<std::uint32_t>;
+
+        LayoutClass& GetOrCreateLayoutClass(const std::vector<VKLayoutBinding>& bindings);
+        VKDescriptorPoolPage* FindOrCreatePage(LayoutClass& layoutClass);
+
+        VKPtr<VkFence> AcquireFence();
+        void SubmitPendingFrees();
+        void ReleaseEmptyPages();
+
+        const VKPtr<VkDevice>&                  device_;
+        VkQueue                                 queue_              = VK_NULL_HANDLE;
+        std::uint32_t                           initialPageSize_    = 0;
+        std::uint32_t                           maxPageSize_        = 0;
+
+        std::map<LayoutClassKey, LayoutClass>   layoutClasses_;
+
+        std::vector<VKDescriptorSetAllocation>  queuedFrees_;       // Freed sets that are not yet covered by a fence
+        std::deque<PendingFrees>                pendingFrees_;      // Freed sets that wait for their fence, in submission order
+        std::deque<VKPtr<VkFence>>              freeFences_;        // Signaled fences for reuse
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
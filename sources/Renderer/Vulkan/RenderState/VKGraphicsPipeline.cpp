@@ -7,6 +7,7 @@
 
 #include "VKGraphicsPipeline.h"
 #include "VKPipelineLayout.h"
+#include "VKPipelineCache.h"
 #include "../Shader/VKShaderProgram.h"
 #include "../Texture/VKRenderTarget.h"
 #include "../VKTypes.h"
@@ -21,7 +22,7 @@ namespace LLGL
 
 
 VKGraphicsPipeline::VKGraphicsPipeline(
-    const VKPtr<VkDevice>& device, VkRenderPass renderPass, VkPipelineLayout defaultPipelineLayout,
+    const VKPtr<VkDevice>& device, VkRenderPass renderPass, VkPipelineLayout defaultPipelineLayout, VkPipelineCache defaultPipelineCache,
     const GraphicsPipelineDescriptor& desc, const VKGraphicsPipelineLimits& limits, const VkExtent2D& extent) :
         device_            { device                             },
         renderPass_        { renderPass                         },
@@ -44,8 +45,15 @@ VKGraphicsPipeline::VKGraphicsPipeline(
         renderPass_ = renderTargetVK->GetVkRenderPass();
     }
 
+    /* Get pipeline cache object */
+    if (desc.pipelineCache)
+    {
+        auto pipelineCacheVK = LLGL_CAST(VKPipelineCache*, desc.pipelineCache);
+        defaultPipelineCache = pipelineCacheVK->GetVkPipelineCache();
+    }
+
     /* Create Vulkan graphics pipeline object */
-    CreateGraphicsPipeline(desc, limits, extent);
+    CreateGraphicsPipeline(desc, limits, extent, defaultPipelineCache);
 }
 
 
@@ -291,7 +299,8 @@ static void CreateDynamicState(const GraphicsPipelineDescriptor& desc, VkPipelin
     createInfo.pDynamicStates       = (dynamicStatesVK.empty() ? nullptr : dynamicStatesVK.data());
 }
 
-void VKGraphicsPipeline::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc, const VKGraphicsPipelineLimits& limits, const VkExtent2D& extent)
+void VKGraphicsPipeline::CreateGraphicsPipeline(
+    const GraphicsPipelineDescriptor& desc, const VKGraphicsPipelineLimits& limits, const VkExtent2D& extent, VkPipelineCache pipelineCache)
 {
     /* Get shader program object */
     auto shaderProgramVK = LLGL_CAST(VKShaderProgram*, desc.shaderProgram);
@@ -364,7 +373,7 @@ void VKGraphicsPipeline::CreateGraphicsPipeline(const GraphicsPipelineDescriptor
         createInfo.basePipelineHandle           = VK_NULL_HANDLE;
         createInfo.basePipelineIndex            = 0;
     }
-    auto result = vkCreateGraphicsPipelines(device_, VK_NULL_HANDLE, 1, &createInfo, nullptr, pipeline_.ReleaseAndGetAddressOf());
+    auto result = vkCreateGraphicsPipelines(device_, pipelineCache, 1, &createInfo, nullptr, pipeline_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
 }
 
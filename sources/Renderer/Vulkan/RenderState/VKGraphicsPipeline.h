@@ -34,7 +34,7 @@ class VKGraphicsPipeline final : public GraphicsPipeline
     public:
 
         VKGraphicsPipeline(
-            const VKPtr<VkDevice>& device, VkRenderPass renderPass, VkPipelineLayout defaultPipelineLayout,
+            const VKPtr<VkDevice>& device, VkRenderPass renderPass, VkPipelineLayout defaultPipelineLayout, VkPipelineCache defaultPipelineCache,
             const GraphicsPipelineDescriptor& desc, const VKGraphicsPipelineLimits& limits, const VkExtent2D& extent
         );
 
@@ -64,7 +64,9 @@ class VKGraphicsPipeline final : public GraphicsPipeline
 
     private:
 
-        void CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc, const VKGraphicsPipelineLimits& limits, const VkExtent2D& extent);
+        void CreateGraphicsPipeline(
+            const GraphicsPipelineDescriptor& desc, const VKGraphicsPipelineLimits& limits, const VkExtent2D& extent, VkPipelineCache pipelineCache
+        );
 
         VkDevice            device_             = VK_NULL_HANDLE;
         VkRenderPass        renderPass_         = VK_NULL_HANDLE;
@@ -0,0 +1,130 @@
+/*
+ * VKPipelineCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKPipelineCache.h"
+#include "../VKCore.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Magic number of the serialized pipeline cache ("LLVK" in little endian).
+static const std::uint32_t g_pipelineCacheMagic     = 0x4b564c4c;
+
+// Version of the serialized pipeline cache header; increment this whenever the header layout changes.
+static const std::uint32_t g_pipelineCacheVersion   = 1;
+
+// Header that is prepended to the Vulkan pipeline cache data when it is serialized.
+struct VKPipelineCacheHeader
+{
+    std::uint32_t   magic;
+    std::uint32_t   version;
+    std::uint32_t   vendorID;
+    std::uint32_t   deviceID;
+    std::uint32_t   driverVersion;
+    std::uint8_t    uuid[VK_UUID_SIZE];
+    std::uint32_t   reserved;
+    std::uint64_t   dataSize;
+};
+
+// Returns true if the specified blob was created with the same physical device and driver.
+static bool IsPipelineCacheBlobCompatible(const void* blob, std::size_t blobSize, const VkPhysicalDeviceProperties& properties)
+{
+    if (blob == nullptr || blobSize < sizeof(VKPipelineCacheHeader))
+        return false;
+
+    VKPipelineCacheHeader header;
+    ::memcpy(&header, blob, sizeof(header));
+
+    return
+    (
+        header.magic            == g_pipelineCacheMagic                         &&
+        header.version          == g_pipelineCacheVersion                       &&
+        header.vendorID         == properties.vendorID                          &&
+        header.deviceID         == properties.deviceID                          &&
+        header.driverVersion    == properties.driverVersion                     &&
+        header.dataSize         == blobSize - sizeof(VKPipelineCacheHeader)     &&
+        ::memcmp(header.uuid, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0
+    );
+}
+
+VKPipelineCache::VKPipelineCache(
+    const VKPtr<VkDevice>&              device,
+    const VkPhysicalDeviceProperties&   properties,
+    const void*                         initialBlob,
+    std::size_t                         initialBlobSize) :
+        device_         { device                        },
+        pipelineCache_  { device, vkDestroyPipelineCache },
+        vendorID_       { properties.vendorID           },
+        deviceID_       { properties.deviceID           },
+        driverVersion_  { properties.driverVersion      }
+{
+    ::memcpy(uuid_, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    /* Create pipeline cache with initial data only if the blob was created with the same device and driver */
+    VkPipelineCacheCreateInfo createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.pNext            = nullptr;
+        createInfo.flags            = 0;
+        if (IsPipelineCacheBlobCompatible(initialBlob, initialBlobSize, properties))
+        {
+            createInfo.initialDataSize  = initialBlobSize - sizeof(VKPipelineCacheHeader);
+            createInfo.pInitialData     = reinterpret_cast<const char*>(initialBlob) + sizeof(VKPipelineCacheHeader);
+        }
+        else
+        {
+            createInfo.initialDataSize  = 0;
+            createInfo.pInitialData     = nullptr;
+        }
+    }
+    auto result = vkCreatePipelineCache(device, &createInfo, nullptr, pipelineCache_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan pipeline cache");
+}
+
+std::vector<char> VKPipelineCache::GetBlob() const
+{
+    /* Query size of pipeline cache data */
+    std::size_t dataSize = 0;
+    auto result = vkGetPipelineCacheData(device_, pipelineCache_, &dataSize, nullptr);
+    VKThrowIfFailed(result, "failed to query Vulkan pipeline cache data size");
+
+    /* Retrieve pipeline cache data behind the header */
+    std::vector<char> blob(sizeof(VKPipelineCacheHeader) + dataSize);
+
+    if (dataSize > 0)
+    {
+        result = vkGetPipelineCacheData(device_, pipelineCache_, &dataSize, blob.data() + sizeof(VKPipelineCacheHeader));
+        VKThrowIfFailed(result, "failed to retrieve Vulkan pipeline cache data");
+        blob.resize(sizeof(VKPipelineCacheHeader) + dataSize);
+    }
+
+    /* Write header to validate the blob when it is loaded again */
+    VKPipelineCacheHeader header;
+    {
+        header.magic            = g_pipelineCacheMagic;
+        header.version          = g_pipelineCacheVersion;
+        header.vendorID         = vendorID_;
+        header.deviceID         = deviceID_;
+        header.driverVersion    = driverVersion_;
+        header.reserved         = 0;
+        header.dataSize         = static_cast<std::uint64_t>(dataSize);
+        ::memcpy(header.uuid, uuid_, VK_UUID_SIZE);
+    }
+    ::memcpy(blob.data(), &header, sizeof(header));
+
+    return blob;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
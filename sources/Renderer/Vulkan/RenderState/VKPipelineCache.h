@@ -0,0 +1,61 @@
+/*
+ * VKPipelineCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_PIPELINE_CACHE_H
+#define LLGL_VK_PIPELINE_CACHE_H
+
+
+#include <LLGL/PipelineCache.h>
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+
+
+namespace LLGL
+{
+
+
+class VKPipelineCache final : public PipelineCache
+{
+
+    public:
+
+        VKPipelineCache(
+            const VKPtr<VkDevice>&              device,
+            const VkPhysicalDeviceProperties&   properties,
+            const void*                         initialBlob     = nullptr,
+            std::size_t                         initialBlobSize = 0
+        );
+
+        std::vector<char> GetBlob() const override;
+
+        // Returns the Vulkan pipeline cache object.
+        inline VkPipelineCache GetVkPipelineCache() const
+        {
+            return pipelineCache_.Get();
+        }
+
+    private:
+
+        VkDevice                    device_         = VK_NULL_HANDLE;
+        VKPtr<VkPipelineCache>      pipelineCache_;
+
+        std::uint32_t               vendorID_       = 0;
+        std::uint32_t               deviceID_       = 0;
+        std::uint32_t               driverVersion_  = 0;
+        std::uint8_t                uuid_[VK_UUID_SIZE];
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,6 +8,7 @@
 #include "VKPipelineLayout.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -35,13 +36,28 @@ static VkShaderStageFlags GetVkShaderStageFlags(long flags)
     return bitmask;
 }
 
+// Returns the descriptor type for the specified binding, including the dynamic buffer types
+static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
+{
+    if ((desc.flags & BindingFlags::DynamicOffset) != 0)
+    {
+        switch (desc.type)
+        {
+            case ResourceType::ConstantBuffer:  return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            case ResourceType::StorageBuffer:   return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+            default:                            throw std::invalid_argument("dynamic offsets are only supported for constant and storage buffer bindings");
+        }
+    }
+    return VKTypes::Map(desc.type);
+}
+
 //TODO:
 // looks like 'VkDescriptorSetLayoutBinding::descriptorCount' can only be greater than 1
 // for arrays in a shader (e.g. array of uniform buffers), but not for multiple binding points.
 static void Convert(VkDescriptorSetLayoutBinding& dst, const BindingDescriptor& src)
 {
     dst.binding             = src.slot;
-    dst.descriptorType      = VKTypes::Map(src.type);
+    dst.descriptorType      = GetVkDescriptorType(src);
     dst.descriptorCount     = src.arraySize;
     dst.stageFlags          = GetVkShaderStageFlags(src.stageFlags);
     dst.pImmutableSamplers  = nullptr;
@@ -101,7 +117,11 @@ VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const Pipeline
     /* Create list of binding points (for later pass to 'VkWriteDescriptorSet::dstBinding') */
     bindings_.reserve(numBindings);
     for (const auto& binding : desc.bindings)
-        bindings_.push_back({ binding.slot, VKTypes::Map(binding.type) });
+    {
+        bindings_.push_back({ binding.slot, GetVkDescriptorType(binding) });
+        if ((binding.flags & BindingFlags::DynamicOffset) != 0)
+            numDynamicOffsets_ += std::max(1u, binding.arraySize);
+    }
 }
 
 
@@ -49,6 +49,12 @@ class VKPipelineLayout final : public PipelineLayout
             return bindings_;
         }
 
+        // Returns the number of bindings with dynamic offsets.
+        inline std::uint32_t GetNumDynamicOffsets() const
+        {
+            return numDynamicOffsets_;
+        }
+
     private:
 
         VkDevice                        device_                 = VK_NULL_HANDLE;
@@ -56,6 +62,7 @@ class VKPipelineLayout final : public PipelineLayout
         VKPtr<VkDescriptorSetLayout>    descriptorSetLayout_;
 
         std::vector<VKLayoutBinding>    bindings_;
+        std::uint32_t                   numDynamicOffsets_      = 0;
 
 };
 
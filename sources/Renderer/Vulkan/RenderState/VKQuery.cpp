@@ -36,9 +36,10 @@ static VkQueryPipelineStatisticFlags GetPipelineStatisticsFlags(const QueryDescr
     return 0;
 }
 
-VKQuery::VKQuery(const VKPtr<VkDevice>& device, const QueryDescriptor& desc) :
-    Query      { desc.type                  },
-    queryPool_ { device, vkDestroyQueryPool }
+VKQuery::VKQuery(const VKPtr<VkDevice>& device, const QueryDescriptor& desc, float timestampPeriod) :
+    Query            { desc.type                  },
+    queryPool_       { device, vkDestroyQueryPool },
+    timestampPeriod_ { timestampPeriod            }
 {
     /* Create query pool object */
     VkQueryPoolCreateInfo createInfo;
@@ -23,7 +23,7 @@ class VKQuery final : public Query
 
     public:
 
-        VKQuery(const VKPtr<VkDevice>& device, const QueryDescriptor& desc);
+        VKQuery(const VKPtr<VkDevice>& device, const QueryDescriptor& desc, float timestampPeriod = 1.0f);
 
         // Returns the Vulkan VkQueryPool object.
         inline VkQueryPool GetVkQueryPool() const
@@ -31,9 +31,16 @@ class VKQuery final : public Query
             return queryPool_.Get();
         }
 
+        // Returns the number of nanoseconds per timestamp tick (see VkPhysicalDeviceLimits::timestampPeriod).
+        inline float GetTimestampPeriod() const
+        {
+            return timestampPeriod_;
+        }
+
     private:
 
-        VKPtr<VkQueryPool> queryPool_;
+        VKPtr<VkQueryPool>  queryPool_;
+        float               timestampPeriod_    = 1.0f;
 
 };
 
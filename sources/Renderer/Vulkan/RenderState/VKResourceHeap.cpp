@@ -22,40 +22,42 @@ namespace LLGL
 {
 
 
-VKResourceHeap::VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeapDescriptor& desc) :
-    device_         { device                          },
-    descriptorPool_ { device, vkDestroyDescriptorPool }
+VKResourceHeap::VKResourceHeap(const VKPtr<VkDevice>& device, VKDescriptorPoolManager& descriptorPoolMngr, const ResourceHeapDescriptor& desc) :
+    device_             { device             },
+    descriptorPoolMngr_ { descriptorPoolMngr }
 {
     /* Get pipeline layout object */
     auto pipelineLayoutVK = LLGL_CAST(VKPipelineLayout*, desc.pipelineLayout);
     if (!pipelineLayoutVK)
         throw std::invalid_argument("failed to create resource view heap due to missing pipeline layout");
 
-    pipelineLayout_ = pipelineLayoutVK->GetVkPipelineLayout();
+    pipelineLayout_     = pipelineLayoutVK->GetVkPipelineLayout();
+    numDynamicOffsets_  = pipelineLayoutVK->GetNumDynamicOffsets();
 
     /* Validate binding descriptors */
     const auto& bindings = pipelineLayoutVK->GetBindings();
     if (desc.resourceViews.size() != bindings.size())
         throw std::invalid_argument("failed to create resource vied heap due to mismatch between number of resources and bindings");
 
-    /* Create resource descriptor pool */
-    CreateDescriptorPool(desc, bindings);
+    /* Allocate resource descriptor set for pipeline layout from the shared descriptor pools */
+    descriptorSetAlloc_ = descriptorPoolMngr_.AllocateDescriptorSet(pipelineLayoutVK->GetVkDescriptorSetLayout(), bindings);
+    descriptorSets_.push_back(descriptorSetAlloc_.descriptorSet);
 
-    /* Create resource descriptor set for pipeline layout */
-    VkDescriptorSetLayout setLayouts[] = { pipelineLayoutVK->GetVkDescriptorSetLayout() };
-    CreateDescriptorSets(1, setLayouts);
-
-    /* Update write descriptors in descriptor set */
-    UpdateDescriptorSets(desc, bindings);
+    /* Update write descriptors in descriptor set, and return the descriptor set if any resource view is invalid */
+    try
+    {
+        UpdateDescriptorSets(desc, bindings);
+    }
+    catch (...)
+    {
+        descriptorPoolMngr_.FreeDescriptorSet(descriptorSetAlloc_);
+        throw;
+    }
 }
 
 VKResourceHeap::~VKResourceHeap()
 {
-    //INFO: is automatically deleted when pool is deleted
-    #if 0
-    auto result = vkFreeDescriptorSets(device_, descriptorPool_, 1, &descriptorSet_);
-    VKThrowIfFailed(result, "failed to release Vulkan descriptor sets");
-    #endif
+    descriptorPoolMngr_.FreeDescriptorSet(descriptorSetAlloc_);
 }
 
 
@@ -63,85 +65,6 @@ VKResourceHeap::~VKResourceHeap()
  * ======= Private: =======
  */
 
-static std::uint32_t AccumDescriptorPoolSizes(
-    VkDescriptorType type,
-    std::vector<VkDescriptorPoolSize>::iterator it,
-    std::vector<VkDescriptorPoolSize>::iterator itEnd)
-{
-    std::uint32_t descriptorCount = it->descriptorCount;
-
-    for (++it; it != itEnd; ++it)
-    {
-        if (it->type == type)
-        {
-            descriptorCount += it->descriptorCount;
-            it->descriptorCount = 0;
-        }
-    }
-
-    return descriptorCount;
-}
-
-static void CompressDescriptorPoolSizes(std::vector<VkDescriptorPoolSize>& poolSizes)
-{
-    /* Accumulate all descriptors of the same type */
-    for (auto it = poolSizes.begin(); it != poolSizes.end(); ++it)
-        it->descriptorCount = AccumDescriptorPoolSizes(it->type, it, poolSizes.end());
-
-    /* Remove all remaining pool sizes with zero descriptors */
-    RemoveAllFromListIf(
-        poolSizes,
-        [](const VkDescriptorPoolSize& dps)
-        {
-            return (dps.descriptorCount == 0);
-        }
-    );
-}
-
-void VKResourceHeap::CreateDescriptorPool(const ResourceHeapDescriptor& desc, const std::vector<VKLayoutBinding>& bindings)
-{
-    /* Initialize descriptor pool sizes */
-    std::vector<VkDescriptorPoolSize> poolSizes(desc.resourceViews.size());
-    for (std::size_t i = 0; i < desc.resourceViews.size(); ++i)
-    {
-        poolSizes[i].type               = bindings[i].descriptorType;
-        poolSizes[i].descriptorCount    = 1;
-    }
-
-    /* Compress pool sizes by merging equal types with accumulated number of descriptors */
-    CompressDescriptorPoolSizes(poolSizes);
-
-    /* Create descriptor pool */
-    VkDescriptorPoolCreateInfo poolCreateInfo;
-    {
-        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        poolCreateInfo.pNext            = nullptr;
-        poolCreateInfo.flags            = 0;
-        poolCreateInfo.maxSets          = 1;
-        poolCreateInfo.poolSizeCount    = static_cast<std::uint32_t>(poolSizes.size());
-        poolCreateInfo.pPoolSizes       = poolSizes.data();
-    }
-    auto result = vkCreateDescriptorPool(device_, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool");
-}
-
-void VKResourceHeap::CreateDescriptorSets(std::uint32_t numSetLayouts, const VkDescriptorSetLayout* setLayouts)
-{
-    descriptorSets_.resize(1, VK_NULL_HANDLE);
-
-    /* Allocate descriptor set */
-    VkDescriptorSetAllocateInfo allocInfo;
-    {
-        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        allocInfo.pNext                 = nullptr;
-        allocInfo.descriptorPool        = descriptorPool_;
-        allocInfo.descriptorSetCount    = numSetLayouts;
-        allocInfo.pSetLayouts           = setLayouts;
-    }
-    auto result = vkAllocateDescriptorSets(device_, &allocInfo, descriptorSets_.data());
-    VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets");
-}
-
 void VKResourceHeap::UpdateDescriptorSets(const ResourceHeapDescriptor& desc, const std::vector<VKLayoutBinding>& bindings)
 {
     /* Allocate local storage for buffer and image descriptors */
@@ -167,6 +90,8 @@ void VKResourceHeap::UpdateDescriptorSets(const ResourceHeapDescriptor& desc, co
 
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
                 FillWriteDescriptorForBuffer(rvDesc, bindings[i], container);
                 break;
 
@@ -247,12 +172,22 @@ void VKResourceHeap::FillWriteDescriptorForBuffer(const ResourceViewDescriptor&
 {
     auto bufferVK = LLGL_CAST(VKBuffer*, resourceViewDesc.resource);
 
+    /* Dynamic offsets are added to the descriptor range, so the entire buffer cannot be used as range */
+    const bool isDynamic =
+    (
+        binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+        binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC
+    );
+
+    if (isDynamic && resourceViewDesc.bufferRange == 0)
+        throw std::invalid_argument("failed to create resource heap due to missing buffer range for binding with dynamic offset");
+
     /* Initialize buffer information */
     auto bufferInfo = container.NextBufferInfo();
     {
         bufferInfo->buffer    = bufferVK->GetVkBuffer();
         bufferInfo->offset    = 0;
-        bufferInfo->range     = bufferVK->GetSize();
+        bufferInfo->range     = (resourceViewDesc.bufferRange > 0 ? resourceViewDesc.bufferRange : bufferVK->GetSize());
     }
 
     /* Initialize write descriptor */
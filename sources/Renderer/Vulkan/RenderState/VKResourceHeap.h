@@ -12,6 +12,7 @@
 #include <LLGL/ResourceHeap.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include "VKDescriptorPoolManager.h"
 #include <vector>
 
 
@@ -28,7 +29,7 @@ class VKResourceHeap final : public ResourceHeap
 
     public:
 
-        VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeapDescriptor& desc);
+        VKResourceHeap(const VKPtr<VkDevice>& device, VKDescriptorPoolManager& descriptorPoolMngr, const ResourceHeapDescriptor& desc);
         ~VKResourceHeap();
 
         inline VkPipelineLayout GetVkPipelineLayout() const
@@ -38,7 +39,7 @@ class VKResourceHeap final : public ResourceHeap
 
         inline VkDescriptorPool GetVkDescriptorPool() const
         {
-            return descriptorPool_.Get();
+            return descriptorSetAlloc_.page->descriptorPool.Get();
         }
 
         inline const std::vector<VkDescriptorSet>& GetVkDescriptorSets() const
@@ -46,20 +47,26 @@ class VKResourceHeap final : public ResourceHeap
             return descriptorSets_;
         }
 
+        // Returns the number of dynamic offsets that must be passed when this resource heap is bound.
+        inline std::uint32_t GetNumDynamicOffsets() const
+        {
+            return numDynamicOffsets_;
+        }
+
     private:
 
-        void CreateDescriptorPool(const ResourceHeapDescriptor& desc, const std::vector<VKLayoutBinding>& bindings);
-        void CreateDescriptorSets(std::uint32_t numSetLayouts, const VkDescriptorSetLayout* setLayouts);
         void UpdateDescriptorSets(const ResourceHeapDescriptor& desc, const std::vector<VKLayoutBinding>& bindings);
 
         void FillWriteDescriptorForSampler(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container);
         void FillWriteDescriptorForTexture(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container);
         void FillWriteDescriptorForBuffer(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container);
 
-        VkDevice                        device_         = VK_NULL_HANDLE;
-        VkPipelineLayout                pipelineLayout_ = VK_NULL_HANDLE;
-        VKPtr<VkDescriptorPool>         descriptorPool_;
+        VkDevice                        device_                 = VK_NULL_HANDLE;
+        VKDescriptorPoolManager&        descriptorPoolMngr_;
+        VkPipelineLayout                pipelineLayout_         = VK_NULL_HANDLE;
+        VKDescriptorSetAllocation       descriptorSetAlloc_;
         std::vector<VkDescriptorSet>    descriptorSets_;
+        std::uint32_t                   numDynamicOffsets_      = 0;
 
 };
 
@@ -23,6 +23,7 @@ VKRenderTarget::VKRenderTarget(const VKPtr<VkDevice>& device, VKDeviceMemoryMana
     RenderTarget        { desc.resolution              },
     framebuffer_        { device, vkDestroyFramebuffer },
     renderPass_         { device, vkDestroyRenderPass  },
+    loadRenderPass_     { device, vkDestroyRenderPass  },
     depthStencilBuffer_ { device                       }
 {
     CreateRenderPass(device, deviceMemoryMngr, desc);
@@ -92,17 +93,20 @@ void VKRenderTarget::CreateRenderPass(const VKPtr<VkDevice>& device, VKDeviceMem
         /* Initialize format and sample count flags */
         VkFormat                format          = VK_FORMAT_UNDEFINED;
         VkSampleCountFlagBits   samplesFlags    = VK_SAMPLE_COUNT_1_BIT; //TODO: multi-sampling
+        VkImageLayout           finalLayout     = VK_IMAGE_LAYOUT_UNDEFINED;
 
         if (auto texture = attachmentSrc.texture)
         {
-            /* Get format from texture */
+            /* Get format from texture and return it to its layout at the end of the render pass */
             auto textureVK = LLGL_CAST(VKTexture*, texture);
-            format = textureVK->GetVkFormat();
+            format      = textureVK->GetVkFormat();
+            finalLayout = textureVK->GetVkImageLayout();
         }
         else
         {
             /* Create depth-stencil buffer */
-            format = GetDepthAttachmentVkFormat(attachmentSrc.type);
+            format      = GetDepthAttachmentVkFormat(attachmentSrc.type);
+            finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 
             if (depthStencilBuffer_.GetVkFormat() == VK_FORMAT_UNDEFINED)
                 depthStencilBuffer_.CreateDepthStencil(deviceMemoryMngr, GetResolution(), format, samplesFlags);
@@ -115,11 +119,11 @@ void VKRenderTarget::CreateRenderPass(const VKPtr<VkDevice>& device, VKDeviceMem
         attachmentDst.format           = format;
         attachmentDst.samples          = samplesFlags;
         attachmentDst.loadOp           = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-        attachmentDst.storeOp          = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachmentDst.storeOp          = VK_ATTACHMENT_STORE_OP_STORE;
         attachmentDst.stencilLoadOp    = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         attachmentDst.stencilStoreOp    = (HasStencilComponent(attachmentSrc.type) ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE);
         attachmentDst.initialLayout    = VK_IMAGE_LAYOUT_UNDEFINED;
-        attachmentDst.finalLayout      = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        attachmentDst.finalLayout      = finalLayout;
     }
 
     /* Initialize attachment reference */
@@ -198,6 +202,17 @@ void VKRenderTarget::CreateRenderPass(const VKPtr<VkDevice>& device, VKDeviceMem
     }
     auto result = vkCreateRenderPass(device, &createInfo, nullptr, renderPass_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan render pass");
+
+    /* Create compatible render pass that preserves the attachments, to resume rendering after transfer commands */
+    for (auto& attachmentDesc : attachmentDescs)
+    {
+        attachmentDesc.loadOp           = VK_ATTACHMENT_LOAD_OP_LOAD;
+        attachmentDesc.stencilLoadOp    = VK_ATTACHMENT_LOAD_OP_LOAD;
+        attachmentDesc.stencilStoreOp   = VK_ATTACHMENT_STORE_OP_STORE;
+        attachmentDesc.initialLayout    = attachmentDesc.finalLayout;
+    }
+    result = vkCreateRenderPass(device, &createInfo, nullptr, loadRenderPass_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan load render pass");
 }
 
 void VKRenderTarget::CreateFramebuffer(const VKPtr<VkDevice>& device, const RenderTargetDescriptor& desc)
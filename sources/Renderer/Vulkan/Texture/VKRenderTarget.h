@@ -44,6 +44,12 @@ class VKRenderTarget final : public RenderTarget
             return renderPass_;
         }
 
+        // Returns the Vulkan render pass object that loads the previous attachment contents (compatible with 'GetVkRenderPass').
+        inline VkRenderPass GetVkLoadRenderPass() const
+        {
+            return loadRenderPass_;
+        }
+
         // Returns the render target resolution as VkExtent2D.
         inline VkExtent2D GetVkExtent() const
         {
@@ -57,6 +63,7 @@ class VKRenderTarget final : public RenderTarget
 
         VKPtr<VkFramebuffer>            framebuffer_;
         VKPtr<VkRenderPass>             renderPass_;
+        VKPtr<VkRenderPass>             loadRenderPass_;
 
         std::vector<VKPtr<VkImageView>> imageViews_;
 
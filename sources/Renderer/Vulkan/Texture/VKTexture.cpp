@@ -238,11 +238,8 @@ static VkSampleCountFlagBits GetVkImageSampleCountFlags(const TextureDescriptor&
 
 static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
 {
-    VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
-
-    /* Enable TRANSFER_SRC_BIT image usage when MIP-maps are enabled */
-    if (IsMipMappedTexture(desc))
-        usageFlags |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    /* Always enable TRANSFER_SRC_BIT image usage for MIP-map generation and texture copies */
+    VkImageUsageFlags usageFlags = (VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
 
     /* Enable either color or depth-stencil ATTACHMENT_BIT image usage when attachment usage is enabled */
     if ((desc.flags & TextureFlags::AttachmentUsage) != 0)
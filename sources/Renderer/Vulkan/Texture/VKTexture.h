@@ -90,6 +90,30 @@ class VKTexture final : public Texture
             return imageWrapper_.GetMemoryRegion();
         }
 
+        // Sets the image layout the texture is kept in between commands (see 'GetVkImageLayout').
+        inline void SetVkImageLayout(VkImageLayout layout)
+        {
+            layout_ = layout;
+        }
+
+        // Returns the image layout the texture is kept in between commands. Transfer commands transition from and back to this layout.
+        inline VkImageLayout GetVkImageLayout() const
+        {
+            return layout_;
+        }
+
+        // Sets the ID of the last upload batch that accesses this texture (see VKUploadBatcher). Also used for read-only access, hence const.
+        inline void SetUploadBatchID(std::uint64_t batchID) const
+        {
+            uploadBatchID_ = batchID;
+        }
+
+        // Returns the ID of the last upload batch that accesses this texture.
+        inline std::uint64_t GetUploadBatchID() const
+        {
+            return uploadBatchID_;
+        }
+
     private:
 
         void CreateImage(VkDevice device, const TextureDescriptor& desc);
@@ -101,6 +125,8 @@ class VKTexture final : public Texture
         VkExtent3D              extent_;
         std::uint32_t           numMipLevels_   = 0;
         std::uint32_t           numArrayLayers_ = 0;
+        VkImageLayout           layout_         = VK_IMAGE_LAYOUT_UNDEFINED;
+        mutable std::uint64_t   uploadBatchID_  = 0;
 
 };
 
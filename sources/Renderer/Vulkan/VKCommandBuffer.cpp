@@ -12,6 +12,7 @@
 #include "RenderState/VKComputePipeline.h"
 #include "RenderState/VKResourceHeap.h"
 #include "RenderState/VKQuery.h"
+#include "Texture/VKTexture.h"
 #include "Texture/VKSampler.h"
 #include "Texture/VKRenderTarget.h"
 #include "Buffer/VKBuffer.h"
@@ -19,6 +20,8 @@
 #include "Buffer/VKIndexBuffer.h"
 #include "../CheckedCast.h"
 #include <cstddef>
+#include <stdexcept>
+#include <string>
 
 
 namespace LLGL
@@ -27,10 +30,16 @@ namespace LLGL
 
 static const std::uint32_t g_maxNumViewportsPerBatch = 16;
 
-VKCommandBuffer::VKCommandBuffer(const VKPtr<VkDevice>& device, VkQueue graphicsQueue, std::size_t bufferCount, const QueueFamilyIndices& queueFamilyIndices) :
-    device_             { device                           },
-    commandPool_        { device, vkDestroyCommandPool     },
-    queuePresentFamily_ { queueFamilyIndices.presentFamily }
+VKCommandBuffer::VKCommandBuffer(
+    const VKPtr<VkDevice>&          device,
+    VkQueue                         graphicsQueue,
+    std::size_t                     bufferCount,
+    const QueueFamilyIndices&       queueFamilyIndices,
+    const VkPhysicalDeviceFeatures& features) :
+        device_                     { device                                   },
+        commandPool_                { device, vkDestroyCommandPool             },
+        queuePresentFamily_         { queueFamilyIndices.presentFamily         },
+        multiDrawIndirectEnabled_   { (features.multiDrawIndirect != VK_FALSE) }
 {
     CreateCommandPool(queueFamilyIndices.graphicsFamily);
     CreateCommandBuffers(bufferCount);
@@ -259,6 +268,161 @@ void VKCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Attac
     ClearFramebufferAttachments(numAttachmentsVK, attachmentsVK);
 }
 
+/* ----- Copy ----- */
+
+void VKCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+
+    PauseRenderPass();
+    {
+        InsertMemoryBarrierBeforeTransfer();
+        vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), dstOffset, dataSize, data);
+        InsertMemoryBarrierAfterTransfer();
+    }
+    ResumeRenderPass();
+}
+
+void VKCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+    auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+
+    VkBufferCopy region;
+    {
+        region.srcOffset    = srcOffset;
+        region.dstOffset    = dstOffset;
+        region.size         = size;
+    }
+
+    PauseRenderPass();
+    {
+        InsertMemoryBarrierBeforeTransfer();
+        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
+        InsertMemoryBarrierAfterTransfer();
+    }
+    ResumeRenderPass();
+}
+
+/*
+Converts the texture region into the Vulkan subresource, offset, and extent.
+Array layers are specified by the Y component for 1D-array textures and by the Z component for all other array textures.
+*/
+static void ConvertVkImageRegion(
+    const TextureType           type,
+    std::uint32_t               mipLevel,
+    const Offset3D&             offset,
+    const Extent3D&             extent,
+    VkImageSubresourceLayers&   outSubresource,
+    VkOffset3D&                 outOffset,
+    VkExtent3D&                 outExtent)
+{
+    outSubresource.aspectMask   = VK_IMAGE_ASPECT_COLOR_BIT;
+    outSubresource.mipLevel     = mipLevel;
+
+    switch (type)
+    {
+        case TextureType::Texture1DArray:
+            outSubresource.baseArrayLayer   = static_cast<std::uint32_t>(offset.y);
+            outSubresource.layerCount       = extent.height;
+            outOffset                       = { offset.x, 0, 0 };
+            outExtent                       = { extent.width, 1, 1 };
+            break;
+
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DMSArray:
+            outSubresource.baseArrayLayer   = static_cast<std::uint32_t>(offset.z);
+            outSubresource.layerCount       = extent.depth;
+            outOffset                       = { offset.x, offset.y, 0 };
+            outExtent                       = { extent.width, extent.height, 1 };
+            break;
+
+        default:
+            outSubresource.baseArrayLayer   = 0;
+            outSubresource.layerCount       = 1;
+            outOffset                       = { offset.x, offset.y, offset.z };
+            outExtent                       = { extent.width, extent.height, extent.depth };
+            break;
+    }
+}
+
+void VKCommandBuffer::CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset)
+{
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+
+    VkBufferImageCopy region;
+    {
+        region.bufferOffset         = srcOffset;
+        region.bufferRowLength      = 0;
+        region.bufferImageHeight    = 0;
+        ConvertVkImageRegion(
+            dstTextureVK.GetType(), dstRegion.mipLevel, dstRegion.offset, dstRegion.extent,
+            region.imageSubresource, region.imageOffset, region.imageExtent
+        );
+    }
+
+    const auto dstLayout = dstTextureVK.GetVkImageLayout();
+
+    PauseRenderPass();
+    {
+        InsertMemoryBarrierBeforeTransfer();
+        TransitionImageLayout(dstTextureVK, region.imageSubresource, dstLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        vkCmdCopyBufferToImage(
+            commandBuffer_,
+            srcBufferVK.GetVkBuffer(),
+            dstTextureVK.GetVkImage(),
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            1,
+            &region
+        );
+        TransitionImageLayout(dstTextureVK, region.imageSubresource, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, dstLayout);
+    }
+    ResumeRenderPass();
+}
+
+void VKCommandBuffer::CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset)
+{
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+
+    VkImageCopy region;
+    {
+        ConvertVkImageRegion(
+            srcTextureVK.GetType(), srcMipLevel, srcOffset, dstRegion.extent,
+            region.srcSubresource, region.srcOffset, region.extent
+        );
+        ConvertVkImageRegion(
+            dstTextureVK.GetType(), dstRegion.mipLevel, dstRegion.offset, dstRegion.extent,
+            region.dstSubresource, region.dstOffset, region.extent
+        );
+    }
+
+    const auto srcLayout = srcTextureVK.GetVkImageLayout();
+    const auto dstLayout = dstTextureVK.GetVkImageLayout();
+
+    PauseRenderPass();
+    {
+        InsertMemoryBarrierBeforeTransfer();
+        TransitionImageLayout(srcTextureVK, region.srcSubresource, srcLayout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+        TransitionImageLayout(dstTextureVK, region.dstSubresource, dstLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        vkCmdCopyImage(
+            commandBuffer_,
+            srcTextureVK.GetVkImage(),
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            dstTextureVK.GetVkImage(),
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            1,
+            &region
+        );
+        TransitionImageLayout(dstTextureVK, region.dstSubresource, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, dstLayout);
+        TransitionImageLayout(srcTextureVK, region.srcSubresource, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, srcLayout);
+    }
+    ResumeRenderPass();
+}
+
 /* ----- Input Assembly ------ */
 
 void VKCommandBuffer::SetVertexBuffer(Buffer& buffer)
@@ -314,8 +478,22 @@ void VKCommandBuffer::EndStreamOutput()
 /* ----- Resource Heaps ----- */
 
 //private
-void VKCommandBuffer::BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet)
+void VKCommandBuffer::BindResourceHeap(
+    VKResourceHeap&         resourceHeapVK,
+    VkPipelineBindPoint     bindingPoint,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
 {
+    /* Each binding with a dynamic offset requires an offset, also for the bind functions without offsets */
+    if (numDynamicOffsets != resourceHeapVK.GetNumDynamicOffsets())
+    {
+        throw std::invalid_argument(
+            "mismatch between number of dynamic offsets (" + std::to_string(numDynamicOffsets) +
+            ") and bindings with dynamic offsets in Vulkan resource heap (" + std::to_string(resourceHeapVK.GetNumDynamicOffsets()) + ")"
+        );
+    }
+
     vkCmdBindDescriptorSets(
         commandBuffer_,
         bindingPoint,
@@ -323,8 +501,8 @@ void VKCommandBuffer::BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelin
         firstSet,
         static_cast<std::uint32_t>(resourceHeapVK.GetVkDescriptorSets().size()),
         resourceHeapVK.GetVkDescriptorSets().data(),
-        0,
-        nullptr
+        numDynamicOffsets,
+        dynamicOffsets
     );
 }
 
@@ -340,6 +518,26 @@ void VKCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::ui
     BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_COMPUTE, firstSet);
 }
 
+void VKCommandBuffer::SetGraphicsResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
+    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_GRAPHICS, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
+void VKCommandBuffer::SetComputeResourceHeapWithOffsets(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
+    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_COMPUTE, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
 /* ----- Render Targets ----- */
 
 void VKCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
@@ -353,6 +551,7 @@ void VKCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
     /* Set new render pass */
     SetRenderPass(
         renderTargetVK.GetVkRenderPass(),
+        renderTargetVK.GetVkLoadRenderPass(),
         renderTargetVK.GetVkFramebuffer(),
         renderTargetVK.GetVkExtent()
     );
@@ -383,6 +582,7 @@ void VKCommandBuffer::SetRenderTarget(RenderContext& renderContext)
     /* Set new render pass */
     SetRenderPass(
         renderContextVK.GetSwapChainRenderPass(),
+        renderContextVK.GetSwapChainLoadPass(),
         renderContextVK.GetSwapChainFramebuffer(),
         renderContextVK.GetSwapChainExtent()
     );
@@ -431,6 +631,13 @@ void VKCommandBuffer::BeginQuery(Query& query)
 {
     auto& queryVK = LLGL_CAST(VKQuery&, query);
 
+    /* Timestamp queries must be reset before they are written again */
+    if (query.GetType() == QueryType::Timestamp)
+    {
+        vkCmdResetQueryPool(commandBuffer_, queryVK.GetVkQueryPool(), 0, 1);
+        return;
+    }
+
     /* Determine control flags (for either 'SamplesPassed' or 'AnySamplesPassed') */
     VkQueryControlFlags flags = 0;
 
@@ -443,7 +650,11 @@ void VKCommandBuffer::BeginQuery(Query& query)
 void VKCommandBuffer::EndQuery(Query& query)
 {
     auto& queryVK = LLGL_CAST(VKQuery&, query);
-    vkCmdEndQuery(commandBuffer_, queryVK.GetVkQueryPool(), 0);
+
+    if (query.GetType() == QueryType::Timestamp)
+        vkCmdWriteTimestamp(commandBuffer_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryVK.GetVkQueryPool(), 0);
+    else
+        vkCmdEndQuery(commandBuffer_, queryVK.GetVkQueryPool(), 0);
 }
 
 bool VKCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
@@ -463,6 +674,10 @@ bool VKCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
 
     VKThrowIfFailed(stateResult, "failed to retrieve results from Vulkan query pool");
 
+    /* Convert timestamp ticks to nanoseconds */
+    if (query.GetType() == QueryType::Timestamp)
+        result = static_cast<std::uint64_t>(static_cast<double>(result) * static_cast<double>(queryVK.GetTimestampPeriod()));
+
     return true;
 }
 
@@ -554,6 +769,52 @@ void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
+void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
+}
+
+void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    if (multiDrawIndirectEnabled_)
+        vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
+    else
+    {
+        for (; numCommands-- > 0; offset += stride)
+            vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
+    }
+}
+
+void VKCommandBuffer::DrawIndirectCount(Buffer& /*buffer*/, std::uint64_t /*offset*/, Buffer& /*countBuffer*/, std::uint64_t /*countOffset*/, std::uint32_t /*maxNumCommands*/, std::uint32_t /*stride*/)
+{
+    throw std::runtime_error("indirect draw commands with count buffer not supported by Vulkan renderer");
+}
+
+void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
+}
+
+void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    if (multiDrawIndirectEnabled_)
+        vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
+    else
+    {
+        for (; numCommands-- > 0; offset += stride)
+            vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
+    }
+}
+
+void VKCommandBuffer::DrawIndexedIndirectCount(Buffer& /*buffer*/, std::uint64_t /*offset*/, Buffer& /*countBuffer*/, std::uint64_t /*countOffset*/, std::uint32_t /*maxNumCommands*/, std::uint32_t /*stride*/)
+{
+    throw std::runtime_error("indirect draw commands with count buffer not supported by Vulkan renderer");
+}
+
 /* ----- Compute ----- */
 
 void VKCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
@@ -561,10 +822,17 @@ void VKCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSize
     vkCmdDispatch(commandBuffer_, groupSizeX, groupSizeY, groupSizeZ);
 }
 
+void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
+}
+
 /* --- Extended functions --- */
 
-void VKCommandBuffer::SetPresentIndex(std::uint32_t idx)
+void VKCommandBuffer::SetFrameIndex(std::uint32_t frameIndex)
 {
+    const auto idx = frameIndex % commandBufferList_.size();
     commandBuffer_          = commandBufferList_[idx];
     commandBufferActiveIt_  = commandBufferActiveList_.begin() + idx;
     recordingFence_         = recordingFenceList_[idx];
@@ -606,7 +874,7 @@ void VKCommandBuffer::EndCommandBuffer()
     *commandBufferActiveIt_ = false;
 }
 
-void VKCommandBuffer::SetRenderPass(VkRenderPass renderPass, VkFramebuffer framebuffer, const VkExtent2D& extent)
+void VKCommandBuffer::SetRenderPass(VkRenderPass renderPass, VkRenderPass loadRenderPass, VkFramebuffer framebuffer, const VkExtent2D& extent)
 {
     if (renderPass_)
         EndRenderPass();
@@ -618,6 +886,7 @@ void VKCommandBuffer::SetRenderPass(VkRenderPass renderPass, VkFramebuffer frame
 
         /* Store render pass and framebuffer attributes */
         renderPass_             = renderPass;
+        loadRenderPass_         = loadRenderPass;
         framebuffer_            = framebuffer;
         framebufferExtent_      = extent;
         scissorRectInvalidated_ = true;
@@ -633,6 +902,7 @@ void VKCommandBuffer::SetRenderPassNull()
 
         /* Reset render pass and framebuffer attributes */
         renderPass_     = VK_NULL_HANDLE;
+        loadRenderPass_ = VK_NULL_HANDLE;
         framebuffer_    = VK_NULL_HANDLE;
     }
 }
@@ -667,6 +937,107 @@ void VKCommandBuffer::EndRenderPass()
  * ======= Private: =======
  */
 
+void VKCommandBuffer::PauseRenderPass()
+{
+    /* Transfer commands must not be recorded inside a render pass */
+    if (renderPass_ != VK_NULL_HANDLE)
+        EndRenderPass();
+}
+
+void VKCommandBuffer::ResumeRenderPass()
+{
+    /* Continue with the compatible render pass that loads the attachments (VK_ATTACHMENT_LOAD_OP_LOAD) */
+    if (renderPass_ != VK_NULL_HANDLE)
+        BeginRenderPass(loadRenderPass_, framebuffer_, framebufferExtent_);
+}
+
+void VKCommandBuffer::InsertMemoryBarrier(
+    VkPipelineStageFlags srcStageMask, VkAccessFlags srcAccessMask, VkPipelineStageFlags dstStageMask, VkAccessFlags dstAccessMask)
+{
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = srcAccessMask;
+        barrier.dstAccessMask   = dstAccessMask;
+    }
+    vkCmdPipelineBarrier(
+        commandBuffer_,
+        srcStageMask,
+        dstStageMask,
+        0,
+        1, &barrier,
+        0, nullptr,
+        0, nullptr
+    );
+}
+
+void VKCommandBuffer::InsertMemoryBarrierBeforeTransfer()
+{
+    /* Make the result of all previous commands visible to the transfer command, and let pending reads finish before it writes */
+    InsertMemoryBarrier(
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT),
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT)
+    );
+}
+
+void VKCommandBuffer::InsertMemoryBarrierAfterTransfer()
+{
+    /* Make the result of the transfer command visible to all subsequent commands */
+    InsertMemoryBarrier(
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_ACCESS_TRANSFER_WRITE_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT)
+    );
+}
+
+static VkAccessFlags GetVkAccessMaskForImageLayout(const VkImageLayout layout)
+{
+    switch (layout)
+    {
+        case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:      return VK_ACCESS_TRANSFER_READ_BIT;
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:      return VK_ACCESS_TRANSFER_WRITE_BIT;
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:  return VK_ACCESS_SHADER_READ_BIT;
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:  return (VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+        case VK_IMAGE_LAYOUT_GENERAL:                   return (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+        default:                                        return 0;
+    }
+}
+
+void VKCommandBuffer::TransitionImageLayout(
+    VKTexture& textureVK, const VkImageSubresourceLayers& subresource, VkImageLayout oldLayout, VkImageLayout newLayout)
+{
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = GetVkAccessMaskForImageLayout(oldLayout);
+        barrier.dstAccessMask                   = GetVkAccessMaskForImageLayout(newLayout);
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = newLayout;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = textureVK.GetVkImage();
+        barrier.subresourceRange.aspectMask     = subresource.aspectMask;
+        barrier.subresourceRange.baseMipLevel   = subresource.mipLevel;
+        barrier.subresourceRange.levelCount     = 1;
+        barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
+        barrier.subresourceRange.layerCount     = subresource.layerCount;
+    }
+    vkCmdPipelineBarrier(
+        commandBuffer_,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0,
+        0, nullptr,
+        0, nullptr,
+        1, &barrier
+    );
+}
+
 void VKCommandBuffer::CreateCommandPool(std::uint32_t queueFamilyIndex)
 {
     /* Create command pool */
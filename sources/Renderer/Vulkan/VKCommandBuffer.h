@@ -22,6 +22,7 @@ namespace LLGL
 
 
 class VKResourceHeap;
+class VKTexture;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -30,7 +31,13 @@ class VKCommandBuffer final : public CommandBuffer
 
         /* ----- Common ----- */
 
-        VKCommandBuffer(const VKPtr<VkDevice>& device, VkQueue graphicsQueue, std::size_t bufferCount, const QueueFamilyIndices& queueFamilyIndices);
+        VKCommandBuffer(
+            const VKPtr<VkDevice>&          device,
+            VkQueue                         graphicsQueue,
+            std::size_t                     bufferCount,
+            const QueueFamilyIndices&       queueFamilyIndices,
+            const VkPhysicalDeviceFeatures& features
+        );
         ~VKCommandBuffer();
 
         /* ----- Configuration ----- */
@@ -54,6 +61,13 @@ class VKCommandBuffer final : public CommandBuffer
         void Clear(long flags) override;
         void ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments) override;
 
+        /* ----- Copy ----- */
+
+        void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
+        void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void CopyBufferToTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset) override;
+        void CopyTexture(Texture& dstTexture, const SubTextureDescriptor& dstRegion, Texture& srcTexture, std::uint32_t srcMipLevel, const Offset3D& srcOffset) override;
+
         /* ----- Input Assembly ------ */
 
         void SetVertexBuffer(Buffer& buffer) override;
@@ -74,6 +88,20 @@ class VKCommandBuffer final : public CommandBuffer
         void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
         void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
 
+        void SetGraphicsResourceHeapWithOffsets(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        ) override;
+
+        void SetComputeResourceHeapWithOffsets(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        ) override;
+
         /* ----- Render Targets ----- */
 
         void SetRenderTarget(RenderTarget& renderTarget) override;
@@ -109,20 +137,31 @@ class VKCommandBuffer final : public CommandBuffer
         void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset) override;
         void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance) override;
 
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, std::uint64_t offset) override;
 
         /* --- Extended functions --- */
 
-        void SetPresentIndex(std::uint32_t idx);
+        // Selects the native command buffer and fence of the specified frame slot (see VKRenderContext::GetCurrentFrameIndex).
+        void SetFrameIndex(std::uint32_t frameIndex);
 
         bool IsCommandBufferActive() const;
 
         void BeginCommandBuffer();
         void EndCommandBuffer();
 
-        void SetRenderPass(VkRenderPass renderPass, VkFramebuffer framebuffer, const VkExtent2D& extent);
+        // Begins the render pass; 'loadRenderPass' must be compatible with 'renderPass' and is used to resume it after transfer commands.
+        void SetRenderPass(VkRenderPass renderPass, VkRenderPass loadRenderPass, VkFramebuffer framebuffer, const VkExtent2D& extent);
         void SetRenderPassNull();
 
         // Returns the native VkCommandBuffer object.
@@ -137,6 +176,12 @@ class VKCommandBuffer final : public CommandBuffer
             return recordingFence_;
         }
 
+        // Returns the fence of the specified frame slot, which is signaled when the GPU has finished the commands of that frame.
+        inline VkFence GetFrameFence(std::uint32_t frameIndex) const
+        {
+            return recordingFenceList_[frameIndex % recordingFenceList_.size()].Get();
+        }
+
     private:
 
         void CreateCommandPool(std::uint32_t queueFamilyIndex);
@@ -154,11 +199,29 @@ class VKCommandBuffer final : public CommandBuffer
         void EndClearImage(VkImageMemoryBarrier& clearToPresentBarrier);
         #endif
 
-        void BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet);
+        void BindResourceHeap(
+            VKResourceHeap&         resourceHeapVK,
+            VkPipelineBindPoint     bindingPoint,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets   = 0,
+            const std::uint32_t*    dynamicOffsets      = nullptr
+        );
 
         void BeginRenderPass(VkRenderPass renderPass, VkFramebuffer framebuffer, const VkExtent2D& extent);
         void EndRenderPass();
 
+        // Interrupts the current render pass for transfer commands and resumes it afterwards with its load render pass.
+        void PauseRenderPass();
+        void ResumeRenderPass();
+
+        // Records memory barriers to synchronize transfer commands with the commands before and after them.
+        void InsertMemoryBarrier(VkPipelineStageFlags srcStageMask, VkAccessFlags srcAccessMask, VkPipelineStageFlags dstStageMask, VkAccessFlags dstAccessMask);
+        void InsertMemoryBarrierBeforeTransfer();
+        void InsertMemoryBarrierAfterTransfer();
+
+        // Records an image layout transition for the specified subresource of the texture.
+        void TransitionImageLayout(VKTexture& textureVK, const VkImageSubresourceLayers& subresource, VkImageLayout oldLayout, VkImageLayout newLayout);
+
         const VKPtr<VkDevice>&          device_;
         VKPtr<VkCommandPool>            commandPool_;
 
@@ -173,6 +236,7 @@ class VKCommandBuffer final : public CommandBuffer
         VkClearDepthStencilValue        clearDepthStencil_          = { 1.0f, 0 };
 
         VkRenderPass                    renderPass_                 = VK_NULL_HANDLE;
+        VkRenderPass                    loadRenderPass_             = VK_NULL_HANDLE;
         bool                            renderPassActive_           = false;
         VkFramebuffer                   framebuffer_                = VK_NULL_HANDLE;
         VkExtent2D                      framebufferExtent_          = { 0, 0 };
@@ -189,6 +253,8 @@ class VKCommandBuffer final : public CommandBuffer
         bool                            scissorEnabled_             = false;
         bool                            scissorRectInvalidated_     = false;
 
+        bool                            multiDrawIndirectEnabled_   = false;   // Emulate multi-draw-indirect with single draw commands if this is false
+
 };
 
 
@@ -14,9 +14,10 @@ namespace LLGL
 {
 
 
-VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue) :
+VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue, VKUploadBatcher& uploadBatcher) :
     device_        { device        },
-    graphicsQueue_ { graphicsQueue }
+    graphicsQueue_ { graphicsQueue },
+    uploadBatcher_ { uploadBatcher }
 {
 }
 
@@ -31,6 +32,9 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 
 void VKCommandQueue::Submit(Fence& fence)
 {
+    /* Submit pending staging commands first, so the fence also covers resource uploads */
+    uploadBatcher_.Flush();
+
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
     fenceVK.Reset(device_);
     vkQueueSubmit(graphicsQueue_, 0, nullptr, fenceVK.GetHardwareFence());
@@ -44,6 +48,7 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 
 void VKCommandQueue::WaitIdle()
 {
+    uploadBatcher_.Wait();
     vkQueueWaitIdle(graphicsQueue_);
 }
 
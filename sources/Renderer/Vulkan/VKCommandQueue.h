@@ -14,6 +14,7 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "RenderState/VKFence.h"
+#include "VKUploadBatcher.h"
 
 
 namespace LLGL
@@ -27,7 +28,7 @@ class VKCommandQueue final : public CommandQueue
 
         /* ----- Common ----- */
 
-        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue);
+        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue, VKUploadBatcher& uploadBatcher);
 
         /* ----- Command queues ----- */
 
@@ -42,8 +43,9 @@ class VKCommandQueue final : public CommandQueue
 
     private:
 
-        VkDevice    device_;
-        VkQueue     graphicsQueue_  = VK_NULL_HANDLE;
+        VkDevice            device_;
+        VkQueue             graphicsQueue_  = VK_NULL_HANDLE;
+        VKUploadBatcher&    uploadBatcher_;
 
 };
 
@@ -8,6 +8,7 @@
 #include "VKCore.h"
 #include "../../Core/Helper.h"
 #include "../../Core/HelperMacros.h"
+#include <LLGL/Log.h>
 
 
 namespace LLGL
@@ -51,32 +52,41 @@ static const char* VKErrorToStr(const VkResult errorCode)
     return nullptr;
 }
 
-void VKThrowIfFailed(const VkResult result, const char* info)
+static std::string VKErrorMessage(const VkResult result, const char* info)
 {
-    if (result != VK_SUCCESS)
+    std::string s;
+
+    if (info)
     {
-        std::string s;
+        s += info;
+        s += " (error code = ";
+    }
+    else
+        s += "Vulkan operation failed (error code = ";
 
-        if (info)
-        {
-            s += info;
-            s += " (error code = ";
-        }
-        else
-            s += "Vulkan operation failed (error code = ";
+    if (auto err = VKErrorToStr(result))
+        s += err;
+    else
+    {
+        s += "0x";
+        s += ToHex(static_cast<int>(result));
+    }
 
-        if (auto err = VKErrorToStr(result))
-            s += err;
-        else
-        {
-            s += "0x";
-            s += ToHex(static_cast<int>(result));
-        }
+    s += ")";
 
-        s += ")";
+    return s;
+}
 
-        throw std::runtime_error(s);
-    }
+void VKThrowIfFailed(const VkResult result, const char* info)
+{
+    if (result != VK_SUCCESS)
+        throw std::runtime_error(VKErrorMessage(result, info));
+}
+
+void VKLogIfFailed(const VkResult result, const char* info)
+{
+    if (result != VK_SUCCESS)
+        Log::StdErr() << VKErrorMessage(result, info) << std::endl;
 }
 
 // see https://www.khronos.org/registry/vulkan/specs/1.0/html/vkspec.html#fundamentals-versionnum
@@ -61,6 +61,9 @@ struct SurfaceSupportDetails
 // Throws an std::runtime_error exception if 'result' is not VK_SUCCESS.
 void VKThrowIfFailed(const VkResult result, const char* info);
 
+// Prints an error message to the standard error output if 'result' is not VK_SUCCESS. Use this instead of VKThrowIfFailed in destructors.
+void VKLogIfFailed(const VkResult result, const char* info);
+
 // Converts the specified Vulkan API version into a string (e.g. "1.0.100").
 std::string VKApiVersionToString(std::uint32_t version);
 
@@ -10,8 +10,10 @@
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "Memory/VKDeviceMemoryManager.h"
+#include "VKUploadBatcher.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
+#include <algorithm>
 #include <set>
 
 
@@ -26,11 +28,22 @@ static const std::vector<const char*> g_deviceExtensions
     VK_KHR_SWAPCHAIN_EXTENSION_NAME
 };
 
+// Maximal number of frames the CPU may record ahead of the GPU.
+static const std::uint32_t g_maxFramesInFlight = 3;
+
+// Returns the elapsed time of the specified timer in milliseconds.
+static double GetElapsedMilliseconds(Timer& timer)
+{
+    const auto ticks = timer.Stop();
+    return static_cast<double>(ticks) * 1000.0 / static_cast<double>(timer.GetFrequency());
+}
+
 VKRenderContext::VKRenderContext(
     const VKPtr<VkInstance>& instance,
     VkPhysicalDevice physicalDevice,
     const VKPtr<VkDevice>& device,
     VKDeviceMemoryManager& deviceMemoryMngr,
+    VKUploadBatcher& uploadBatcher,
     RenderContextDescriptor desc,
     const std::shared_ptr<Surface>& surface) :
         RenderContext        { desc.videoMode, desc.vsync    },
@@ -38,14 +51,24 @@ VKRenderContext::VKRenderContext(
         physicalDevice_      { physicalDevice                },
         device_              { device                        },
         deviceMemoryMngr_    { deviceMemoryMngr              },
+        uploadBatcher_       { uploadBatcher                 },
         surface_             { instance, vkDestroySurfaceKHR },
         swapChain_           { device, vkDestroySwapchainKHR },
         swapChainRenderPass_ { device, vkDestroyRenderPass   },
+        swapChainLoadPass_   { device, vkDestroyRenderPass   },
         depthStencilBuffer_  { device                        }
 {
     SetOrCreateSurface(surface, desc.videoMode, nullptr);
     desc.videoMode = GetVideoMode();
 
+    /* Initialize frame slots and frame pacing timers */
+    numFramesInFlight_              = std::max(1u, std::min(desc.framesInFlight, g_maxFramesInFlight));
+    framePacing_.framesInFlight     = numFramesInFlight_;
+
+    frameTimer_ = Timer::Create();
+    waitTimer_  = Timer::Create();
+    frameTimer_->Start();
+
     CreatePresentSemaphores();
     CreateGpuSurface();
 
@@ -70,12 +93,15 @@ void VKRenderContext::Present()
     commandBuffer_->SetRenderPassNull();
     commandBuffer_->EndCommandBuffer();
 
-    /* Initialize semaphorse */
-    VkSemaphore waitSemaphorse[] = { imageAvailableSemaphore_ };
+    /* Initialize semaphorse of the current frame slot and the acquired swap-chain image */
+    VkSemaphore waitSemaphorse[] = { imageAvailableSemaphores_[currentFrame_] };
     VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    VkSemaphore signalSemaphorse[] = { renderFinishedSemaphore_ };
+    VkSemaphore signalSemaphorse[] = { renderFinishedSemaphores_[presentImageIndex_] };
     VkCommandBuffer commandBuffers[] = { commandBuffer_->GetVkCommandBuffer() };
 
+    /* Submit pending staging commands before the commands that use these resources */
+    uploadBatcher_.Flush();
+
     /* Submit command buffer to graphics queue */
     VkSubmitInfo submitInfo;
     {
@@ -109,6 +135,9 @@ void VKRenderContext::Present()
     result = vkQueuePresentKHR(presentQueue_, &presentInfo);
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
+    /* Move on to the next frame slot, so the CPU can record the next frame while the GPU is still busy with the previous ones */
+    WaitForNextFrameSlot();
+
     /* Get image index for next presentation */
     AcquireNextPresentImage();
 }
@@ -123,12 +152,18 @@ Format VKRenderContext::QueryDepthStencilFormat() const
     return VKTypes::Unmap(depthStencilBuffer_.GetVkFormat());
 }
 
+bool VKRenderContext::QueryFramePacingStatistics(FramePacingStatistics& stats) const
+{
+    stats = framePacing_;
+    return true;
+}
+
 /* --- Extended functions --- */
 
 void VKRenderContext::SetPresentCommandBuffer(VKCommandBuffer* commandBuffer)
 {
     commandBuffer_ = commandBuffer;
-    commandBuffer_->SetPresentIndex(presentImageIndex_);
+    commandBuffer_->SetFrameIndex(currentFrame_);
 }
 
 bool VKRenderContext::HasDepthStencilBuffer() const
@@ -187,11 +222,19 @@ void VKRenderContext::CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore)
     VKThrowIfFailed(result, "failed to create Vulkan semaphore");
 }
 
+void VKRenderContext::CreateGpuSemaphores(std::vector<VKPtr<VkSemaphore>>& semaphores, std::size_t numSemaphores)
+{
+    semaphores.clear();
+    semaphores.resize(numSemaphores, VKPtr<VkSemaphore> { device_, vkDestroySemaphore });
+
+    for (auto& semaphore : semaphores)
+        CreateGpuSemaphore(semaphore);
+}
+
 void VKRenderContext::CreatePresentSemaphores()
 {
-    /* Create presentation semaphorse */
-    CreateGpuSemaphore(imageAvailableSemaphore_);
-    CreateGpuSemaphore(renderFinishedSemaphore_);
+    /* Create image acquisition semaphores for each frame slot (render finished semaphores are created with the swap-chain) */
+    CreateGpuSemaphores(imageAvailableSemaphores_, numFramesInFlight_);
 }
 
 void VKRenderContext::CreateGpuSurface()
@@ -261,7 +304,7 @@ void VKRenderContext::CreateSwapChainRenderPass()
         attachments[1].loadOp               = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         attachments[1].storeOp              = VK_ATTACHMENT_STORE_OP_STORE;
         attachments[1].stencilLoadOp        = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-        attachments[1].stencilStoreOp       = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[1].stencilStoreOp       = VK_ATTACHMENT_STORE_OP_STORE;
         attachments[1].initialLayout        = VK_IMAGE_LAYOUT_UNDEFINED;
         attachments[1].finalLayout          = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     }
@@ -317,6 +360,17 @@ void VKRenderContext::CreateSwapChainRenderPass()
     }
     auto result = vkCreateRenderPass(device_, &createInfo, nullptr, swapChainRenderPass_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan swap-chain render pass");
+
+    /* Create compatible render pass that preserves the attachments, to resume rendering after transfer commands */
+    for (std::uint32_t i = 0; i < createInfo.attachmentCount; ++i)
+    {
+        attachments[i].loadOp               = VK_ATTACHMENT_LOAD_OP_LOAD;
+        attachments[i].stencilLoadOp        = VK_ATTACHMENT_LOAD_OP_LOAD;
+        attachments[i].stencilStoreOp       = VK_ATTACHMENT_STORE_OP_STORE;
+        attachments[i].initialLayout        = attachments[i].finalLayout;
+    }
+    result = vkCreateRenderPass(device_, &createInfo, nullptr, swapChainLoadPass_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan swap-chain load render pass");
 }
 
 void VKRenderContext::CreateSwapChain(const VideoModeDescriptor& videoModeDesc, const VsyncDescriptor& vsyncDesc)
@@ -390,6 +444,7 @@ void VKRenderContext::CreateSwapChain(const VideoModeDescriptor& videoModeDesc,
     /* Create all swap-chain dependent resources */
     CreateSwapChainImageViews();
     CreateSwapChainFramebuffers();
+    CreateGpuSemaphores(renderFinishedSemaphores_, swapChainImages_.size());
 
     /* Acquire first image for presentation */
     AcquireNextPresentImage();
@@ -546,12 +601,41 @@ void VKRenderContext::AcquireNextPresentImage()
         device_,
         swapChain_,
         UINT64_MAX,
-        imageAvailableSemaphore_,
+        imageAvailableSemaphores_[currentFrame_],
         VK_NULL_HANDLE,
         &presentImageIndex_
     );
 }
 
+void VKRenderContext::WaitForNextFrameSlot()
+{
+    currentFrame_ = (currentFrame_ + 1) % numFramesInFlight_;
+
+    /* Wait until the GPU has finished the frame that was previously recorded in this frame slot */
+    waitTimer_->Start();
+    if (commandBuffer_)
+    {
+        VkFence fence = commandBuffer_->GetFrameFence(currentFrame_);
+        vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
+    }
+    const auto waitTime = GetElapsedMilliseconds(*waitTimer_);
+
+    /* Measure time since previous frame */
+    const auto frameTime = GetElapsedMilliseconds(*frameTimer_);
+    frameTimer_->Start();
+
+    /* Update frame pacing statistics */
+    totalWaitTime_  += waitTime;
+    totalFrameTime_ += frameTime;
+
+    framePacing_.numFrames++;
+    framePacing_.lastWaitTime       = waitTime;
+    framePacing_.maxWaitTime        = std::max(framePacing_.maxWaitTime, waitTime);
+    framePacing_.averageWaitTime    = totalWaitTime_ / static_cast<double>(framePacing_.numFrames);
+    framePacing_.lastFrameTime      = frameTime;
+    framePacing_.averageFrameTime   = totalFrameTime_ / static_cast<double>(framePacing_.numFrames);
+}
+
 
 } // /namespace LLGL
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/Window.h>
 #include <LLGL/RenderContext.h>
+#include <LLGL/Timer.h>
 #include "VKCore.h"
 #include "VKPtr.h"
 #include "Texture/VKDepthStencilBuffer.h"
@@ -25,6 +26,7 @@ namespace LLGL
 class VKCommandBuffer;
 class VKDeviceMemoryManager;
 class VKDeviceMemoryRegion;
+class VKUploadBatcher;
 
 class VKRenderContext final : public RenderContext
 {
@@ -38,6 +40,7 @@ class VKRenderContext final : public RenderContext
             VkPhysicalDevice physicalDevice,
             const VKPtr<VkDevice>& device,
             VKDeviceMemoryManager& deviceMemoryMngr,
+            VKUploadBatcher& uploadBatcher,
             RenderContextDescriptor desc,
             const std::shared_ptr<Surface>& surface
         );
@@ -49,6 +52,8 @@ class VKRenderContext final : public RenderContext
         Format QueryColorFormat() const override;
         Format QueryDepthStencilFormat() const override;
 
+        bool QueryFramePacingStatistics(FramePacingStatistics& stats) const override;
+
         /* --- Extended functions --- */
 
         void SetPresentCommandBuffer(VKCommandBuffer* commandBuffer);
@@ -58,6 +63,12 @@ class VKRenderContext final : public RenderContext
             return swapChainRenderPass_;
         }
 
+        // Returns the swap-chain render pass that loads the previous attachment contents (compatible with 'GetSwapChainRenderPass').
+        inline const VKPtr<VkRenderPass>& GetSwapChainLoadPass() const
+        {
+            return swapChainLoadPass_;
+        }
+
         // Returns the number of images the swap chain has.
         inline size_t GetSwapChainSize() const
         {
@@ -82,6 +93,18 @@ class VKRenderContext final : public RenderContext
             return swapChainExtent_;
         }
 
+        // Returns the number of frames the CPU may record ahead of the GPU.
+        inline std::uint32_t GetNumFramesInFlight() const
+        {
+            return numFramesInFlight_;
+        }
+
+        // Returns the index of the frame slot that is currently being recorded, in the range [0, GetNumFramesInFlight()).
+        inline std::uint32_t GetCurrentFrameIndex() const
+        {
+            return currentFrame_;
+        }
+
         // Returns true if this render context has a depth-stencil buffer.
         bool HasDepthStencilBuffer() const;
 
@@ -91,6 +114,7 @@ class VKRenderContext final : public RenderContext
         bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
 
         void CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore);
+        void CreateGpuSemaphores(std::vector<VKPtr<VkSemaphore>>& semaphores, std::size_t numSemaphores);
         void CreatePresentSemaphores();
         void CreateGpuSurface();
 
@@ -110,6 +134,9 @@ class VKRenderContext final : public RenderContext
 
         void AcquireNextPresentImage();
 
+        // Advances to the next frame slot and waits until the GPU has finished the frame that previously used this slot.
+        void WaitForNextFrameSlot();
+
         /* ----- Common objects ----- */
 
         VkInstance                          instance_                   = VK_NULL_HANDLE;
@@ -117,12 +144,14 @@ class VKRenderContext final : public RenderContext
         const VKPtr<VkDevice>&              device_;
 
         VKDeviceMemoryManager&              deviceMemoryMngr_;
+        VKUploadBatcher&                    uploadBatcher_;
 
         VKPtr<VkSurfaceKHR>                 surface_;
         SurfaceSupportDetails               surfaceSupportDetails_;
 
         VKPtr<VkSwapchainKHR>               swapChain_;
         VKPtr<VkRenderPass>                 swapChainRenderPass_;
+        VKPtr<VkRenderPass>                 swapChainLoadPass_;
         VkSurfaceFormatKHR                  swapChainFormat_;
         VkExtent2D                          swapChainExtent_            = { 0, 0 };
         std::vector<VkImage>                swapChainImages_;
@@ -135,11 +164,24 @@ class VKRenderContext final : public RenderContext
         VkQueue                             graphicsQueue_              = VK_NULL_HANDLE;
         VkQueue                             presentQueue_               = VK_NULL_HANDLE;
 
-        VKPtr<VkSemaphore>                  imageAvailableSemaphore_;
-        VKPtr<VkSemaphore>                  renderFinishedSemaphore_;
+        /* ----- Frame slots ----- */
+
+        std::uint32_t                       numFramesInFlight_          = 1;
+        std::uint32_t                       currentFrame_               = 0;
+
+        std::vector<VKPtr<VkSemaphore>>     imageAvailableSemaphores_;  // One semaphore per frame slot
+        std::vector<VKPtr<VkSemaphore>>     renderFinishedSemaphores_;  // One semaphore per swap-chain image, since presentation may still wait on it when the frame slot is reused
 
         VKCommandBuffer*                    commandBuffer_              = nullptr;
 
+        /* ----- Frame pacing ----- */
+
+        FramePacingStatistics               framePacing_;
+        double                              totalWaitTime_              = 0.0;
+        double                              totalFrameTime_             = 0.0;
+        std::unique_ptr<Timer>              frameTimer_;
+        std::unique_ptr<Timer>              waitTimer_;
+
 };
 
 
@@ -13,7 +13,9 @@
 #include "Buffer/VKIndexBuffer.h"
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
+#include "../../Core/Assertion.h"
 #include "../../Core/Vendor.h"
+#include "../../Core/ThreadPool.h"
 #include "../GLCommon/GLTypes.h"
 #include "VKCore.h"
 #include "VKTypes.h"
@@ -49,10 +51,14 @@ static void DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCall
 
 static VkBufferUsageFlags GetVkBufferUsageFlags(long bufferFlags)
 {
+    VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
     if ((bufferFlags & BufferFlags::MapReadAccess) != 0)
-        return VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    else
-        return VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    if ((bufferFlags & BufferFlags::IndirectArguments) != 0)
+        usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+
+    return usage;
 }
 
 static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long bufferFlags)
@@ -160,9 +166,11 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
 
     QueryDeviceProperties();
     CreateLogicalDevice();
-    CreateStagingCommandResources();
     CreateDefaultPipelineLayout();
 
+    /* Create internal pipeline cache for all pipelines that are created without a user-defined cache */
+    defaultPipelineCache_ = MakeUnique<VKPipelineCache>(device_, deviceProperties_);
+
     /* Create device memory manager */
     deviceMemoryMngr_ = MakeUnique<VKDeviceMemoryManager>(
         device_,
@@ -171,6 +179,20 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
     );
 
+    /* Create batcher for staging commands and command queue interface */
+    uploadBatcher_ = MakeUnique<VKUploadBatcher>(
+        device_,
+        graphicsQueue_,
+        queueFamilyIndices_.graphicsFamily,
+        *deviceMemoryMngr_,
+        memoryProperties_,
+        (rendererConfigVK != nullptr ? rendererConfigVK->stagingRingBufferSize : 4*1024*1024)
+    );
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, graphicsQueue_, *uploadBatcher_);
+
+    /* Create shared descriptor pools for all resource heaps */
+    descriptorPoolMngr_ = MakeUnique<VKDescriptorPoolManager>(device_, graphicsQueue_);
+
     #ifdef TEST_VULKAN_MEMORY_MNGR
     TestVulkanMemoryMngr(*deviceMemoryMngr_);
     #endif
@@ -178,8 +200,11 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
 
 VKRenderSystem::~VKRenderSystem()
 {
-    /* Release resource and wait until device becomes idle */
-    ReleaseStagingCommandResources();
+    /* Wait for asynchronous pipeline creation, since those tasks still refer to this render system */
+    WaitForPipelineTasks();
+
+    /* Submit pending staging commands and wait until device becomes idle */
+    uploadBatcher_->Wait();
     vkDeviceWaitIdle(device_);
 }
 
@@ -189,7 +214,7 @@ RenderContext* VKRenderSystem::CreateRenderContext(const RenderContextDescriptor
 {
     return TakeOwnership(
         renderContexts_,
-        MakeUnique<VKRenderContext>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, desc, surface)
+        MakeUnique<VKRenderContext>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, *uploadBatcher_, desc, surface)
     );
 }
 
@@ -212,7 +237,7 @@ CommandBuffer* VKRenderSystem::CreateCommandBuffer()
     auto mainContext = renderContexts_.begin()->get();
     return TakeOwnership(
         commandBuffers_,
-        MakeUnique<VKCommandBuffer>(device_, graphicsQueue_, mainContext->GetSwapChainSize(), queueFamilyIndices_)
+        MakeUnique<VKCommandBuffer>(device_, graphicsQueue_, mainContext->GetNumFramesInFlight(), queueFamilyIndices_, features_)
     );
 }
 
@@ -231,7 +256,7 @@ void VKRenderSystem::Release(CommandBuffer& commandBuffer)
 
 Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
-    static const long g_stagingBufferRelatedFlags = (BufferFlags::MapReadWriteAccess | BufferFlags::DynamicUsage);
+    static const long g_stagingBufferRelatedFlags = (BufferFlags::MapReadWriteAccess | BufferFlags::DynamicUsage | BufferFlags::StreamingUsage);
 
     AssertCreateBuffer(desc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
 
@@ -265,6 +290,7 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
 
     /* Copy staging buffer into hardware buffer */
     CopyBuffer(stagingBuffer.buffer, buffer->GetVkBuffer(), static_cast<VkDeviceSize>(desc.size));
+    buffer->SetUploadBatchID(uploadBatcher_->GetCurrentBatchID());
 
     if ((desc.flags & g_stagingBufferRelatedFlags) != 0)
     {
@@ -273,8 +299,8 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
     }
     else
     {
-        /* Release staging buffer */
-        deviceMemoryMngr_->Release(memoryRegionStaging);
+        /* Release staging buffer after the copy command has been executed */
+        uploadBatcher_->ReleaseAfterBatch(std::move(stagingBuffer), memoryRegionStaging);
     }
 
     return buffer;
@@ -289,8 +315,12 @@ BufferArray* VKRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void VKRenderSystem::Release(Buffer& buffer)
 {
-    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+
+    /* Wait only for the last upload batch that refers to this buffer */
+    uploadBatcher_->WaitForBatch(bufferVK.GetUploadBatchID());
+
+    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
     deviceMemoryMngr_->Release(bufferVK.GetMemoryRegion());
     deviceMemoryMngr_->Release(bufferVK.GetMemoryRegionStaging());
     RemoveFromUniqueSet(buffers_, &buffer);
@@ -308,13 +338,24 @@ void VKRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t d
     auto memorySize     = static_cast<VkDeviceSize>(dataSize);
     auto memoryOffset   = static_cast<VkDeviceSize>(offset);
 
+    VkBuffer        ringBuffer      = VK_NULL_HANDLE;
+    VkDeviceSize    ringOffset      = 0;
+
     if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
-        /* Copy data to staging buffer memory */
+        /* Wait until previous copy commands from the staging buffer have been executed, then copy data to staging buffer memory */
+        uploadBatcher_->WaitForBatch(bufferVK.GetUploadBatchID());
         bufferVK.UpdateStagingBuffer(device_, data, memorySize, memoryOffset);
 
         /* Copy staging buffer into hardware buffer */
         CopyBuffer(bufferVK.GetStagingVkBuffer(), bufferVK.GetVkBuffer(), memorySize, memoryOffset, memoryOffset);
+        bufferVK.SetUploadBatchID(uploadBatcher_->GetCurrentBatchID());
+    }
+    else if (uploadBatcher_->WriteStaging(data, memorySize, ringBuffer, ringOffset))
+    {
+        /* Copy sub-region of staging ring buffer into hardware buffer */
+        CopyBuffer(ringBuffer, bufferVK.GetVkBuffer(), memorySize, ringOffset, memoryOffset);
+        bufferVK.SetUploadBatchID(uploadBatcher_->GetCurrentBatchID());
     }
     else
     {
@@ -333,9 +374,10 @@ void VKRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t d
 
         /* Copy staging buffer into hardware buffer */
         CopyBuffer(stagingBuffer.buffer, bufferVK.GetVkBuffer(), memorySize, 0, memoryOffset);
+        bufferVK.SetUploadBatchID(uploadBatcher_->GetCurrentBatchID());
 
-        /* Release device memory region */
-        deviceMemoryMngr_->Release(memoryRegionStaging);
+        /* Release staging buffer after the copy command has been executed */
+        uploadBatcher_->ReleaseAfterBatch(std::move(stagingBuffer), memoryRegionStaging);
     }
 }
 
@@ -345,8 +387,14 @@ void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
     AssertBufferCPUAccess(bufferVK);
 
     /* Copy GPU local buffer into staging buffer for read accces */
-    if (access != CPUAccess::WriteOnly)
+    if (access == CPUAccess::ReadOnly || access == CPUAccess::ReadWrite)
+    {
         CopyBuffer(bufferVK.GetVkBuffer(), bufferVK.GetStagingVkBuffer(), bufferVK.GetSize());
+        bufferVK.SetUploadBatchID(uploadBatcher_->GetCurrentBatchID());
+    }
+
+    /* Wait until all copy commands from and into the staging buffer have been executed */
+    uploadBatcher_->WaitForBatch(bufferVK.GetUploadBatchID());
 
     /* Map staging buffer */
     return bufferVK.Map(device_, access);
@@ -362,7 +410,16 @@ void VKRenderSystem::UnmapBuffer(Buffer& buffer)
 
     /* Copy staging buffer into GPU local buffer for write access */
     if (bufferVK.GetMappingCPUAccess() != CPUAccess::ReadOnly)
+    {
         CopyBuffer(bufferVK.GetStagingVkBuffer(), bufferVK.GetVkBuffer(), bufferVK.GetSize());
+        bufferVK.SetUploadBatchID(uploadBatcher_->GetCurrentBatchID());
+    }
+}
+
+bool VKRenderSystem::QueryStagingStatistics(StagingStatistics& statistics) const
+{
+    statistics = uploadBatcher_->GetStagingStatistics();
+    return true;
 }
 
 /* ----- Textures ----- */
@@ -490,9 +547,11 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         );
     }
     TransitionImageLayout(image, formatVK, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels, arrayLayers);
+    textureVK->SetVkImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    textureVK->SetUploadBatchID(uploadBatcher_->GetCurrentBatchID());
 
-    /* Release staging buffer */
-    deviceMemoryMngr_->Release(memoryRegionStaging);
+    /* Release staging buffer after the copy commands have been executed */
+    uploadBatcher_->ReleaseAfterBatch(std::move(stagingBuffer), memoryRegionStaging);
 
     /* Create image view for texture */
     textureVK->CreateInternalImageView(device_);
@@ -502,8 +561,12 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void VKRenderSystem::Release(Texture& texture)
 {
-    /* Release device memory region, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    /* Wait only for the last upload batch that refers to this texture */
+    uploadBatcher_->WaitForBatch(textureVK.GetUploadBatchID());
+
+    /* Release device memory region, then release texture object */
     deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
     RemoveFromUniqueSet(textures_, &texture);
 }
@@ -515,7 +578,97 @@ void VKRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor&
 
 void VKRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
 {
-    //todo
+    /* Read texture via readback buffer and wait for the result */
+    QueryTextureReadResult(ReadTextureAsync(texture, mipLevel), imageDesc, true);
+}
+
+std::uint64_t VKRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    auto& textureVK = LLGL_CAST(const VKTexture&, texture);
+
+    /* Determine extent and size of the MIP-map level in the hardware format */
+    const auto& baseExtent  = textureVK.GetVkExtent();
+    const auto  numLayers   = textureVK.GetNumArrayLayers();
+
+    const VkExtent3D extent
+    {
+        std::max(1u, baseExtent.width  >> mipLevel),
+        std::max(1u, baseExtent.height >> mipLevel),
+        std::max(1u, baseExtent.depth  >> mipLevel)
+    };
+
+    const auto numTexels    = extent.width * extent.height * extent.depth * numLayers;
+    const auto dataSize     = static_cast<VkDeviceSize>(TextureBufferSize(VKTypes::Unmap(textureVK.GetVkFormat()), numTexels));
+
+    /* Create host visible readback buffer */
+    VkBufferCreateInfo readbackCreateInfo;
+    FillBufferCreateInfo(readbackCreateInfo, dataSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    auto readback = CreateStagingBuffer(readbackCreateInfo);
+
+    /* Copy image into readback buffer and restore the layout the texture is kept in, then submit the batch without waiting for its completion */
+    const auto imageLayout = textureVK.GetVkImageLayout();
+
+    TransitionImageLayout(
+        textureVK.GetVkImage(), textureVK.GetVkFormat(),
+        imageLayout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        textureVK.GetNumMipLevels(), numLayers
+    );
+
+    CopyImageToBuffer(textureVK.GetVkImage(), std::get<0>(readback).buffer, mipLevel, extent, numLayers);
+
+    TransitionImageLayout(
+        textureVK.GetVkImage(), textureVK.GetVkFormat(),
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, imageLayout,
+        textureVK.GetNumMipLevels(), numLayers
+    );
+
+    const auto batchID = uploadBatcher_->GetCurrentBatchID();
+    textureVK.SetUploadBatchID(batchID);
+    uploadBatcher_->Flush();
+
+    /* Keep readback buffer until the result is queried */
+    const auto ticket = ++lastTextureReadTicket_;
+    textureReads_.emplace(
+        ticket,
+        TextureRead { std::move(std::get<0>(readback)), std::get<1>(readback), dataSize, batchID }
+    );
+
+    return ticket;
+}
+
+bool VKRenderSystem::QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait)
+{
+    auto it = textureReads_.find(ticket);
+    if (it == textureReads_.end())
+        throw std::invalid_argument("invalid ticket for asynchronous texture read: " + std::to_string(ticket));
+
+    auto& textureRead = it->second;
+
+    LLGL_ASSERT_PTR(imageDesc.data);
+    AssertImageDataSize(imageDesc.dataSize, static_cast<std::size_t>(textureRead.size));
+
+    /* Wait for or poll the batch that contains the copy command */
+    if (wait)
+        uploadBatcher_->WaitForBatch(textureRead.batchID);
+    else if (!uploadBatcher_->IsBatchComplete(textureRead.batchID))
+        return false;
+
+    /* Copy image data from readback buffer */
+    auto readbackDeviceMemory = textureRead.memoryRegion->GetParentChunk();
+
+    if (auto memory = readbackDeviceMemory->Map(device_, textureRead.memoryRegion->GetOffset(), textureRead.size))
+    {
+        ::memcpy(imageDesc.data, memory, static_cast<std::size_t>(textureRead.size));
+        readbackDeviceMemory->Unmap(device_);
+    }
+
+    /* Release readback buffer and invalidate ticket */
+    textureRead.buffer.Release();
+    deviceMemoryMngr_->Release(textureRead.memoryRegion);
+    textureReads_.erase(it);
+
+    return true;
 }
 
 void VKRenderSystem::GenerateMips(Texture& texture)
@@ -565,7 +718,7 @@ void VKRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* VKRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
 {
-    return TakeOwnership(resourceHeaps_, MakeUnique<VKResourceHeap>(device_, desc));
+    return TakeOwnership(resourceHeaps_, MakeUnique<VKResourceHeap>(device_, *descriptorPoolMngr_, desc));
 }
 
 void VKRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -624,6 +777,18 @@ void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* VKRenderSystem::CreatePipelineCache(const void* initialBlob, std::size_t initialBlobSize)
+{
+    return TakeOwnership(pipelineCaches_, MakeUnique<VKPipelineCache>(device_, deviceProperties_, initialBlob, initialBlobSize));
+}
+
+void VKRenderSystem::Release(PipelineCache& pipelineCache)
+{
+    RemoveFromUniqueSet(pipelineCaches_, &pipelineCache);
+}
+
 /* ----- Pipeline States ----- */
 
 GraphicsPipeline* VKRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
@@ -634,27 +799,101 @@ GraphicsPipeline* VKRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineD
     auto renderContext = renderContexts_.begin()->get();
     auto renderPassVK = renderContext->GetSwapChainRenderPass().Get();
 
-    return TakeOwnership(
-        graphicsPipelines_,
-        MakeUnique<VKGraphicsPipeline>(
-            device_, renderPassVK, defaultPipelineLayout_,
-            desc, gfxPipelineLimits_, renderContext->GetSwapChainExtent()
-        )
+    auto pipeline = MakeUnique<VKGraphicsPipeline>(
+        device_, renderPassVK, defaultPipelineLayout_, defaultPipelineCache_->GetVkPipelineCache(),
+        desc, gfxPipelineLimits_, renderContext->GetSwapChainExtent()
     );
+
+    std::lock_guard<std::mutex> lock { pipelineMutex_ };
+    return TakeOwnership(graphicsPipelines_, std::move(pipeline));
 }
 
 ComputePipeline* VKRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
 {
-    return TakeOwnership(computePipelines_, MakeUnique<VKComputePipeline>(device_, desc, defaultPipelineLayout_));
+    auto pipeline = MakeUnique<VKComputePipeline>(
+        device_, desc, defaultPipelineLayout_, defaultPipelineCache_->GetVkPipelineCache()
+    );
+
+    std::lock_guard<std::mutex> lock { pipelineMutex_ };
+    return TakeOwnership(computePipelines_, std::move(pipeline));
+}
+
+std::future<GraphicsPipeline*> VKRenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    auto promise    = std::make_shared<std::promise<GraphicsPipeline*>>();
+    auto future     = promise->get_future();
+
+    if (renderContexts_.empty())
+    {
+        promise->set_exception(std::make_exception_ptr(std::runtime_error("cannot create graphics pipeline without a render context")));
+        return future;
+    }
+
+    /* Gather render context state on the calling thread, since render contexts are not synchronized */
+    auto renderContext  = renderContexts_.begin()->get();
+    auto renderPassVK   = renderContext->GetSwapChainRenderPass().Get();
+    auto extent         = renderContext->GetSwapChainExtent();
+
+    /* Compile pipeline on the job pool (VkPipelineCache objects are internally synchronized) */
+    SubmitPipelineTask(
+        [this, desc, renderPassVK, extent, promise]()
+        {
+            try
+            {
+                auto pipeline = MakeUnique<VKGraphicsPipeline>(
+                    device_, renderPassVK, defaultPipelineLayout_, defaultPipelineCache_->GetVkPipelineCache(),
+                    desc, gfxPipelineLimits_, extent
+                );
+
+                std::lock_guard<std::mutex> lock { pipelineMutex_ };
+                promise->set_value(TakeOwnership(graphicsPipelines_, std::move(pipeline)));
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+        }
+    );
+
+    return future;
+}
+
+std::future<ComputePipeline*> VKRenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    auto promise    = std::make_shared<std::promise<ComputePipeline*>>();
+    auto future     = promise->get_future();
+
+    SubmitPipelineTask(
+        [this, desc, promise]()
+        {
+            try
+            {
+                auto pipeline = MakeUnique<VKComputePipeline>(
+                    device_, desc, defaultPipelineLayout_, defaultPipelineCache_->GetVkPipelineCache()
+                );
+
+                std::lock_guard<std::mutex> lock { pipelineMutex_ };
+                promise->set_value(TakeOwnership(computePipelines_, std::move(pipeline)));
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+        }
+    );
+
+    return future;
 }
 
 void VKRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
+    std::lock_guard<std::mutex> lock { pipelineMutex_ };
     RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
 void VKRenderSystem::Release(ComputePipeline& computePipeline)
 {
+    std::lock_guard<std::mutex> lock { pipelineMutex_ };
     RemoveFromUniqueSet(computePipelines_, &computePipeline);
 }
 
@@ -662,7 +901,7 @@ void VKRenderSystem::Release(ComputePipeline& computePipeline)
 
 Query* VKRenderSystem::CreateQuery(const QueryDescriptor& desc)
 {
-    return TakeOwnership(queries_, MakeUnique<VKQuery>(device_, desc));
+    return TakeOwnership(queries_, MakeUnique<VKQuery>(device_, desc, deviceProperties_.limits.timestampPeriod));
 }
 
 void VKRenderSystem::Release(Query& query)
@@ -833,8 +1072,8 @@ void VKRenderSystem::QueryDeviceProperties()
     vkGetPhysicalDeviceFeatures(physicalDevice_, &features_);
 
     /* Query properties of selected physical device */
-    VkPhysicalDeviceProperties properties;
-    vkGetPhysicalDeviceProperties(physicalDevice_, &properties);
+    vkGetPhysicalDeviceProperties(physicalDevice_, &deviceProperties_);
+    const auto& properties = deviceProperties_;
 
     /* Map properties to output renderer info */
     RendererInfo info;
@@ -877,6 +1116,9 @@ void VKRenderSystem::QueryDeviceProperties()
         caps.features.hasConservativeRasterization      = false;
         caps.features.hasStreamOutputs                  = false;
         caps.features.hasLogicOp                        = true;
+        caps.features.hasIndirectDrawing                = true;
+        caps.features.hasIndirectCountDrawing           = false;
+        caps.features.hasTimestampQueries               = (limits.timestampComputeAndGraphics != VK_FALSE);
 
         /* Query limits */
         caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -900,6 +1142,8 @@ void VKRenderSystem::QueryDeviceProperties()
         caps.limits.maxViewportSize[1]                  = limits.maxViewportDimensions[1];
         caps.limits.maxBufferSize                       = std::numeric_limits<VkDeviceSize>::max();
         caps.limits.maxConstantBufferSize               = limits.maxUniformBufferRange;
+        caps.limits.minConstantBufferOffsetAlignment    = limits.minUniformBufferOffsetAlignment;
+        caps.limits.minStorageBufferOffsetAlignment     = limits.minStorageBufferOffsetAlignment;
     }
     SetRenderingCaps(caps);
 
@@ -953,52 +1197,41 @@ void VKRenderSystem::CreateLogicalDevice()
 
     /* Query device graphics queue */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
-
-    /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, graphicsQueue_);
 }
 
-void VKRenderSystem::CreateStagingCommandResources()
+void VKRenderSystem::CreateDefaultPipelineLayout()
 {
-    /* Create staging command pool */
-    VkCommandPoolCreateInfo createInfo;
+    VkPipelineLayoutCreateInfo layoutCreateInfo = {};
     {
-        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        createInfo.pNext            = nullptr;
-        createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        createInfo.queueFamilyIndex = queueFamilyIndices_.graphicsFamily;
+        layoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     }
-    auto result = vkCreateCommandPool(device_, &createInfo, nullptr, stagingCommandPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan command pool for staging buffers");
+    auto result = vkCreatePipelineLayout(device_, &layoutCreateInfo, nullptr, defaultPipelineLayout_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan default pipeline layout");
+}
 
-    /* Allocate staging command buffer */
-    VkCommandBufferAllocateInfo allocInfo;
+void VKRenderSystem::SubmitPipelineTask(const std::function<void()>& task)
+{
     {
-        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.pNext                 = nullptr;
-        allocInfo.commandPool           = stagingCommandPool_;
-        allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        allocInfo.commandBufferCount    = 1;
+        std::lock_guard<std::mutex> lock { pipelineMutex_ };
+        ++numPipelineTasks_;
     }
-    result = vkAllocateCommandBuffers(device_, &allocInfo, &stagingCommandBuffer_);
-    VKThrowIfFailed(result, "failed to create Vulkan command buffer for staging buffers");
-}
 
-void VKRenderSystem::ReleaseStagingCommandResources()
-{
-    /* Release staging command buffer */
-    vkFreeCommandBuffers(device_, stagingCommandPool_, 1, &stagingCommandBuffer_);
-    stagingCommandBuffer_ = VK_NULL_HANDLE;
+    DoAsyncWork(
+        [this, task]()
+        {
+            task();
+
+            std::lock_guard<std::mutex> lock { pipelineMutex_ };
+            if (--numPipelineTasks_ == 0)
+                pipelineTasksVar_.notify_all();
+        }
+    );
 }
 
-void VKRenderSystem::CreateDefaultPipelineLayout()
+void VKRenderSystem::WaitForPipelineTasks()
 {
-    VkPipelineLayoutCreateInfo layoutCreateInfo = {};
-    {
-        layoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    }
-    auto result = vkCreatePipelineLayout(device_, &layoutCreateInfo, nullptr, defaultPipelineLayout_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan default pipeline layout");
+    std::unique_lock<std::mutex> lock { pipelineMutex_ };
+    pipelineTasksVar_.wait(lock, [this]{ return (numPipelineTasks_ == 0); });
 }
 
 bool VKRenderSystem::IsLayerRequired(const std::string& name) const
@@ -1131,40 +1364,10 @@ std::tuple<VKBufferWithRequirements, VKDeviceMemoryRegion*> VKRenderSystem::Crea
     return std::make_tuple(std::move(stagingBuffer), memoryRegionStaging);
 }
 
-void VKRenderSystem::BeginStagingCommands()
-{
-    /* Begin command buffer record */
-    VkCommandBufferBeginInfo beginInfo;
-    {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        beginInfo.pInheritanceInfo  = nullptr;
-    }
-    auto result = vkBeginCommandBuffer(stagingCommandBuffer_, &beginInfo);
-    VKThrowIfFailed(result, "failed to begin recording Vulkan command buffer");
-}
-
-void VKRenderSystem::EndStagingCommands()
-{
-    /* End command buffer record */
-    vkEndCommandBuffer(stagingCommandBuffer_);
-
-    /* Submit command buffer to queue */
-    VkSubmitInfo submitInfo = {};
-    {
-        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.commandBufferCount   = 1;
-        submitInfo.pCommandBuffers      = (&stagingCommandBuffer_);
-    }
-    vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(graphicsQueue_);
-}
-
 void VKRenderSystem::TransitionImageLayout(
     VkImage image, VkFormat /*format*/, VkImageLayout oldLayout, VkImageLayout newLayout, std::uint32_t numMipLevels, std::uint32_t numArrayLayers)
 {
-    BeginStagingCommands();
+    auto commandBuffer = uploadBatcher_->GetCommandBuffer();
 
     /* Initialize image memory barrier descriptor */
     VkImageMemoryBarrier barrier;
@@ -1203,16 +1406,37 @@ void VKRenderSystem::TransitionImageLayout(
         srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
         dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     }
+    else if (newLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+    {
+        /* Image may have been written as attachment or storage image by previously submitted commands (in any layout) */
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    }
+    else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+    {
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    }
+    else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+    {
+        /* Transition back to the layout the image is kept in, which may be used by any subsequent command */
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    }
 
     /* Record image barrier command */
-    vkCmdPipelineBarrier(stagingCommandBuffer_, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
-
-    EndStagingCommands();
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
 }
 
 void VKRenderSystem::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset, VkDeviceSize dstOffset)
 {
-    BeginStagingCommands();
+    auto commandBuffer = uploadBatcher_->GetCommandBuffer();
 
     /* Record copy command */
     VkBufferCopy region;
@@ -1221,14 +1445,12 @@ void VKRenderSystem::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDevice
         region.dstOffset    = dstOffset;
         region.size         = size;
     }
-    vkCmdCopyBuffer(stagingCommandBuffer_, srcBuffer, dstBuffer, 1, &region);
-
-    EndStagingCommands();
+    vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &region);
 }
 
 void VKRenderSystem::CopyBufferToImage(VkBuffer srcBuffer, VkImage dstImage, const VkExtent3D& extent, std::uint32_t numLayers)
 {
-    BeginStagingCommands();
+    auto commandBuffer = uploadBatcher_->GetCommandBuffer();
 
     /* Record copy command */
     VkBufferImageCopy region;
@@ -1243,9 +1465,42 @@ void VKRenderSystem::CopyBufferToImage(VkBuffer srcBuffer, VkImage dstImage, con
         region.imageOffset                      = { 0, 0, 0 };
         region.imageExtent                      = extent;
     }
-    vkCmdCopyBufferToImage(stagingCommandBuffer_, srcBuffer, dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+}
 
-    EndStagingCommands();
+void VKRenderSystem::CopyImageToBuffer(VkImage srcImage, VkBuffer dstBuffer, std::uint32_t mipLevel, const VkExtent3D& extent, std::uint32_t numLayers)
+{
+    auto commandBuffer = uploadBatcher_->GetCommandBuffer();
+
+    /* Record copy command */
+    VkBufferImageCopy region;
+    {
+        region.bufferOffset                     = 0;
+        region.bufferRowLength                  = 0;
+        region.bufferImageHeight                = 0;
+        region.imageSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel        = mipLevel;
+        region.imageSubresource.baseArrayLayer  = 0;
+        region.imageSubresource.layerCount      = numLayers;
+        region.imageOffset                      = { 0, 0, 0 };
+        region.imageExtent                      = extent;
+    }
+    vkCmdCopyImageToBuffer(commandBuffer, srcImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dstBuffer, 1, &region);
+
+    /* Make transfer writes visible to the host once the fence of this batch has been signaled */
+    VkBufferMemoryBarrier barrier;
+    {
+        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask       = VK_ACCESS_HOST_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer              = dstBuffer;
+        barrier.offset              = 0;
+        barrier.size                = VK_WHOLE_SIZE;
+    }
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
 }
 
 void VKRenderSystem::AssertBufferCPUAccess(const VKBuffer& bufferVK)
@@ -1263,7 +1518,7 @@ void VKRenderSystem::GenerateMipsPrimary(VKTexture& textureVK, std::uint32_t bas
 
     TransitionImageLayout(image, VK_FORMAT_UNDEFINED, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, numMipLevels, numArrayLayers);
 
-    BeginStagingCommands();
+    auto commandBuffer = uploadBatcher_->GetCommandBuffer();
 
     /* Initialize image memory barrier */
     VkImageMemoryBarrier barrier;
@@ -1306,7 +1561,7 @@ void VKRenderSystem::GenerateMipsPrimary(VKTexture& textureVK, std::uint32_t bas
             barrier.subresourceRange.baseArrayLayer = arrayLayer;
 
             vkCmdPipelineBarrier(
-                stagingCommandBuffer_,
+                commandBuffer,
                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
                 0, nullptr,
                 0, nullptr,
@@ -1334,7 +1589,7 @@ void VKRenderSystem::GenerateMipsPrimary(VKTexture& textureVK, std::uint32_t bas
             blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
 
             vkCmdBlitImage(
-                stagingCommandBuffer_,
+                commandBuffer,
                 image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                 image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                 1, &blit,
@@ -1348,7 +1603,7 @@ void VKRenderSystem::GenerateMipsPrimary(VKTexture& textureVK, std::uint32_t bas
             barrier.newLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
             vkCmdPipelineBarrier(
-                stagingCommandBuffer_,
+                commandBuffer,
                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
                 0, nullptr,
                 0, nullptr,
@@ -1367,7 +1622,7 @@ void VKRenderSystem::GenerateMipsPrimary(VKTexture& textureVK, std::uint32_t bas
         barrier.subresourceRange.baseMipLevel   = numMipLevels - 1;
 
         vkCmdPipelineBarrier(
-            stagingCommandBuffer_,
+            commandBuffer,
             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
             0, nullptr,
             0, nullptr,
@@ -1375,7 +1630,7 @@ void VKRenderSystem::GenerateMipsPrimary(VKTexture& textureVK, std::uint32_t bas
         );
     }
 
-    EndStagingCommands();
+    textureVK.SetUploadBatchID(uploadBatcher_->GetCurrentBatchID());
 }
 
 
@@ -15,6 +15,7 @@
 #include "../ContainerTypes.h"
 #include "Memory/VKDeviceMemoryManager.h"
 
+#include "VKUploadBatcher.h"
 #include "VKCommandQueue.h"
 #include "VKCommandBuffer.h"
 #include "VKRenderContext.h"
@@ -32,15 +33,22 @@
 #include "RenderState/VKQuery.h"
 #include "RenderState/VKFence.h"
 #include "RenderState/VKPipelineLayout.h"
+#include "RenderState/VKPipelineCache.h"
 #include "RenderState/VKGraphicsPipeline.h"
 #include "RenderState/VKComputePipeline.h"
 #include "RenderState/VKResourceHeap.h"
+#include "RenderState/VKDescriptorPoolManager.h"
 
 #include <string>
 #include <memory>
 #include <vector>
 #include <set>
+#include <map>
 #include <tuple>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 
 
 namespace LLGL
@@ -87,6 +95,8 @@ class VKRenderSystem final : public RenderSystem
         void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        bool QueryStagingStatistics(StagingStatistics& statistics) const override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
@@ -96,6 +106,9 @@ class VKRenderSystem final : public RenderSystem
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        bool QueryTextureReadResult(std::uint64_t ticket, const DstImageDescriptor& imageDesc, bool wait = false) override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
 
@@ -131,11 +144,20 @@ class VKRenderSystem final : public RenderSystem
 
         void Release(PipelineLayout& pipelineLayout) override;
 
+        /* ----- Pipeline Caches ----- */
+
+        PipelineCache* CreatePipelineCache(const void* initialBlob = nullptr, std::size_t initialBlobSize = 0) override;
+
+        void Release(PipelineCache& pipelineCache) override;
+
         /* ----- Pipeline States ----- */
 
         GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
         ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
 
+        std::future<GraphicsPipeline*> CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc) override;
+        std::future<ComputePipeline*> CreateComputePipelineAsync(const ComputePipelineDescriptor& desc) override;
+
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
@@ -160,11 +182,14 @@ class VKRenderSystem final : public RenderSystem
         void QueryDeviceProperties();
         void CreateLogicalDevice();
 
-        void CreateStagingCommandResources();
-        void ReleaseStagingCommandResources();
-
         void CreateDefaultPipelineLayout();
 
+        // Executes the specified pipeline creation task on the shared job pool and keeps track of it until it has finished.
+        void SubmitPipelineTask(const std::function<void()>& task);
+
+        // Blocks until all pending pipeline creation tasks have finished.
+        void WaitForPipelineTasks();
+
         bool IsLayerRequired(const std::string& name) const;
         bool IsExtensionRequired(const std::string& name) const;
         bool IsPhysicalDeviceSuitable(VkPhysicalDevice device) const;
@@ -178,9 +203,6 @@ class VKRenderSystem final : public RenderSystem
             const VkBufferCreateInfo& stagingCreateInfo, const void* initialData = nullptr, std::size_t initialDataSize = 0
         );
 
-        void BeginStagingCommands();
-        void EndStagingCommands();
-
         void TransitionImageLayout(
             VkImage image, VkFormat format,
             VkImageLayout oldLayout, VkImageLayout newLayout,
@@ -189,6 +211,7 @@ class VKRenderSystem final : public RenderSystem
 
         void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset = 0, VkDeviceSize dstOffset = 0);
         void CopyBufferToImage(VkBuffer srcBuffer, VkImage dstImage, const VkExtent3D& extent, std::uint32_t numLayers);
+        void CopyImageToBuffer(VkImage srcImage, VkBuffer dstBuffer, std::uint32_t mipLevel, const VkExtent3D& extent, std::uint32_t numLayers);
 
         void AssertBufferCPUAccess(const VKBuffer& bufferVK);
 
@@ -208,20 +231,36 @@ class VKRenderSystem final : public RenderSystem
         QueueFamilyIndices                      queueFamilyIndices_;
         VkPhysicalDeviceMemoryProperties        memoryProperties_;
         VkPhysicalDeviceFeatures                features_;
+        VkPhysicalDeviceProperties              deviceProperties_;
 
         VkQueue                                 graphicsQueue_          = VK_NULL_HANDLE;
 
-        VKPtr<VkCommandPool>                    stagingCommandPool_;
-        VkCommandBuffer                         stagingCommandBuffer_   = VK_NULL_HANDLE;
-
         VKPtr<VkPipelineLayout>                 defaultPipelineLayout_;
+        std::unique_ptr<VKPipelineCache>        defaultPipelineCache_;
 
         bool                                    debugLayerEnabled_      = false;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        std::unique_ptr<VKUploadBatcher>        uploadBatcher_;
+        std::unique_ptr<VKDescriptorPoolManager> descriptorPoolMngr_;
 
         VKGraphicsPipelineLimits                gfxPipelineLimits_;
 
+        std::mutex                              pipelineMutex_;             // Guards the pipeline containers for asynchronous pipeline creation
+        std::condition_variable                 pipelineTasksVar_;
+        std::size_t                             numPipelineTasks_       = 0;
+
+        struct TextureRead
+        {
+            VKBufferWithRequirements    buffer;
+            VKDeviceMemoryRegion*       memoryRegion;
+            VkDeviceSize                size;
+            std::uint64_t               batchID;
+        };
+
+        std::map<std::uint64_t, TextureRead>    textureReads_;              // Pending asynchronous texture read operations
+        std::uint64_t                           lastTextureReadTicket_  = 0;
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<VKRenderContext>      renderContexts_;
@@ -235,6 +274,7 @@ class VKRenderSystem final : public RenderSystem
         HWObjectContainer<VKShader>             shaders_;
         HWObjectContainer<VKShaderProgram>      shaderPrograms_;
         HWObjectContainer<VKPipelineLayout>     pipelineLayouts_;
+        HWObjectContainer<VKPipelineCache>      pipelineCaches_;
         HWObjectContainer<VKGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<VKComputePipeline>    computePipelines_;
         HWObjectContainer<VKResourceHeap>       resourceHeaps_;
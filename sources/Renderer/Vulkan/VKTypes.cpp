@@ -327,6 +327,7 @@ VkQueryType Map(const QueryType queryType)
         case QueryType::StreamOutPrimitivesWritten:     break; // ???
         case QueryType::StreamOutOverflow:              break; // ???
         case QueryType::PipelineStatistics:             return VK_QUERY_TYPE_PIPELINE_STATISTICS;
+        case QueryType::Timestamp:                      return VK_QUERY_TYPE_TIMESTAMP;
     }
     MapFailed("QueryType", "VkQueryType");
 }
@@ -0,0 +1,325 @@
+/*
+ * VKUploadBatcher.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKUploadBatcher.h"
+#include "VKCore.h"
+#include "Memory/VKDeviceMemoryManager.h"
+#include "Memory/VKDeviceMemoryRegion.h"
+#include "../../Core/Helper.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKUploadBatcher::Batch::Batch(const VKPtr<VkDevice>& device) :
+    fence { device, vkDestroyFence }
+{
+}
+
+VKUploadBatcher::VKUploadBatcher(
+    const VKPtr<VkDevice>&                  device,
+    VkQueue                                 graphicsQueue,
+    std::uint32_t                           queueFamilyIndex,
+    VKDeviceMemoryManager&                  deviceMemoryMngr,
+    const VkPhysicalDeviceMemoryProperties& memoryProperties,
+    VkDeviceSize                            ringBufferSize,
+    std::uint32_t                           numCommandBuffers,
+    VkDeviceSize                            maxPendingSize) :
+        device_           { device                        },
+        graphicsQueue_    { graphicsQueue                 },
+        deviceMemoryMngr_ { deviceMemoryMngr              },
+        commandPool_      { device, vkDestroyCommandPool  },
+        maxPendingSize_   { maxPendingSize                }
+{
+    CreateCommandPool(queueFamilyIndex);
+    CreateBatches(numCommandBuffers);
+
+    if (ringBufferSize > 0)
+        ringBuffer_ = MakeUnique<VKStagingRingBuffer>(device, memoryProperties, ringBufferSize);
+}
+
+VKUploadBatcher::~VKUploadBatcher()
+{
+    /* Wait for all pending batches, so their staging buffers can be released safely */
+    Wait();
+
+    for (const auto& batch : batches_)
+        vkFreeCommandBuffers(device_, commandPool_, 1, &(batch->commandBuffer));
+}
+
+VkCommandBuffer VKUploadBatcher::GetCommandBuffer()
+{
+    auto& batch = *batches_[currentBatch_];
+
+    if (!batch.recording)
+    {
+        /* Wait until the previous submission of this command buffer has been executed */
+        if (batch.submitted)
+            RetireBatch(batch);
+
+        /* Begin command buffer record */
+        VkCommandBufferBeginInfo beginInfo;
+        {
+            beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.pNext             = nullptr;
+            beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            beginInfo.pInheritanceInfo  = nullptr;
+        }
+        auto result = vkBeginCommandBuffer(batch.commandBuffer, &beginInfo);
+        VKThrowIfFailed(result, "failed to begin recording Vulkan command buffer");
+
+        /* Make transfer commands of this batch wait for all previously submitted commands that may access the same resources */
+        VkMemoryBarrier barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            barrier.dstAccessMask   = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        }
+        vkCmdPipelineBarrier(
+            batch.commandBuffer,
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+            1, &barrier,
+            0, nullptr,
+            0, nullptr
+        );
+
+        batch.batchID   = currentBatchID_;
+        batch.recording = true;
+        ++numPendingBatches_;
+    }
+
+    return batch.commandBuffer;
+}
+
+void VKUploadBatcher::ReleaseAfterBatch(VKBufferWithRequirements&& buffer, VKDeviceMemoryRegion* memoryRegion)
+{
+    auto& batch = *batches_[currentBatch_];
+
+    if (batch.recording)
+    {
+        if (memoryRegion != nullptr)
+            pendingSize_ += memoryRegion->GetSize();
+
+        batch.releases.push_back({ std::move(buffer), memoryRegion });
+
+        /* Submit batch early to limit the amount of staging memory that is held back */
+        if (pendingSize_ >= maxPendingSize_)
+            Flush();
+    }
+    else
+    {
+        /* Release staging buffer immediately, because no command references it */
+        buffer.Release();
+        deviceMemoryMngr_.Release(memoryRegion);
+    }
+}
+
+bool VKUploadBatcher::WriteStaging(const void* data, VkDeviceSize dataSize, VkBuffer& stagingBuffer, VkDeviceSize& stagingOffset)
+{
+    if (!ringBuffer_ || dataSize > ringBuffer_->GetSize())
+    {
+        ++stagingStats_.temporaryStagingBuffers;
+        return false;
+    }
+
+    while (!ringBuffer_->Write(data, dataSize, currentBatchID_, stagingOffset))
+    {
+        /* Submit current batch and wait for the oldest batch to recycle its memory range */
+        auto oldestBatchID = ringBuffer_->GetOldestBatchID();
+        if (oldestBatchID == 0)
+        {
+            ++stagingStats_.temporaryStagingBuffers;
+            return false;
+        }
+
+        ++stagingStats_.ringBufferStalls;
+        Flush();
+        WaitForBatch(oldestBatchID);
+    }
+
+    stagingBuffer = ringBuffer_->GetVkBuffer();
+
+    stagingStats_.ringBufferBytes           += dataSize;
+    stagingStats_.ringBufferHighWaterMark    = std::max(stagingStats_.ringBufferHighWaterMark, static_cast<std::uint64_t>(ringBuffer_->GetUsage()));
+
+    return true;
+}
+
+void VKUploadBatcher::Flush()
+{
+    auto& batch = *batches_[currentBatch_];
+
+    if (!batch.recording)
+        return;
+
+    /* Make all transfer writes of this batch visible to commands that are submitted later on the same queue */
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    }
+    vkCmdPipelineBarrier(
+        batch.commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+        1, &barrier,
+        0, nullptr,
+        0, nullptr
+    );
+
+    /* End command buffer record */
+    auto result = vkEndCommandBuffer(batch.commandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer");
+
+    /* Submit command buffer to queue with the fence of this batch */
+    VkSubmitInfo submitInfo = {};
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = (&batch.commandBuffer);
+    }
+    vkResetFences(device_, 1, &(batch.fence));
+    result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, batch.fence);
+    VKThrowIfFailed(result, "failed to submit Vulkan staging command buffer");
+
+    batch.recording = false;
+    batch.submitted = true;
+
+    /* Move on to the next command buffer in the ring */
+    currentBatch_ = (currentBatch_ + 1) % batches_.size();
+    ++currentBatchID_;
+    pendingSize_ = 0;
+}
+
+void VKUploadBatcher::Wait()
+{
+    if (numPendingBatches_ > 0)
+    {
+        Flush();
+        for (const auto& batch : batches_)
+        {
+            if (batch->submitted)
+                RetireBatch(*batch);
+        }
+    }
+}
+
+void VKUploadBatcher::WaitForBatch(std::uint64_t batchID)
+{
+    if (batchID == currentBatchID_)
+        Flush();
+
+    for (const auto& batch : batches_)
+    {
+        if (batch->submitted && batch->batchID == batchID)
+        {
+            RetireBatch(*batch);
+            break;
+        }
+    }
+}
+
+bool VKUploadBatcher::IsBatchComplete(std::uint64_t batchID) const
+{
+    for (const auto& batch : batches_)
+    {
+        if (batch->batchID == batchID)
+        {
+            if (batch->recording)
+                return false;
+            if (batch->submitted)
+                return (vkGetFenceStatus(device_, batch->fence) == VK_SUCCESS);
+            break;
+        }
+    }
+
+    /* Batch has already been retired (or its command buffer has been reused) */
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKUploadBatcher::CreateCommandPool(std::uint32_t queueFamilyIndex)
+{
+    VkCommandPoolCreateInfo createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        createInfo.pNext            = nullptr;
+        createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        createInfo.queueFamilyIndex = queueFamilyIndex;
+    }
+    auto result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan command pool for staging buffers");
+}
+
+void VKUploadBatcher::CreateBatches(std::uint32_t numCommandBuffers)
+{
+    batches_.reserve(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        batches_.emplace_back(MakeUnique<Batch>(device_));
+        auto& batch = *batches_.back();
+
+        /* Allocate staging command buffer */
+        VkCommandBufferAllocateInfo allocInfo;
+        {
+            allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.pNext                 = nullptr;
+            allocInfo.commandPool           = commandPool_;
+            allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandBufferCount    = 1;
+        }
+        auto result = vkAllocateCommandBuffers(device_, &allocInfo, &(batch.commandBuffer));
+        VKThrowIfFailed(result, "failed to create Vulkan command buffer for staging buffers");
+
+        /* Create fence to keep track of the submission of this command buffer */
+        VkFenceCreateInfo fenceInfo;
+        {
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            fenceInfo.pNext = nullptr;
+            fenceInfo.flags = 0;
+        }
+        result = vkCreateFence(device_, &fenceInfo, nullptr, batch.fence.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence for staging buffers");
+    }
+}
+
+void VKUploadBatcher::RetireBatch(Batch& batch)
+{
+    /* Wait until GPU has executed the command buffer */
+    vkWaitForFences(device_, 1, &(batch.fence), VK_TRUE, UINT64_MAX);
+
+    /* Release all staging buffers of this batch */
+    for (auto& release : batch.releases)
+    {
+        release.buffer.Release();
+        deviceMemoryMngr_.Release(release.memoryRegion);
+    }
+    batch.releases.clear();
+
+    /* Recycle memory ranges of the staging ring buffer that were used by this batch */
+    if (ringBuffer_)
+        ringBuffer_->Recycle(batch.batchID);
+
+    batch.submitted = false;
+    --numPendingBatches_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
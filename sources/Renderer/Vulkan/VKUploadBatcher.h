@@ -0,0 +1,157 @@
+/*
+ * VKUploadBatcher.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_UPLOAD_BATCHER_H
+#define LLGL_VK_UPLOAD_BATCHER_H
+
+
+#include "Vulkan.h"
+#include "VKPtr.h"
+#include "Buffer/VKBuffer.h"
+#include "Buffer/VKStagingRingBuffer.h"
+#include <LLGL/RenderSystemFlags.h>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+class VKDeviceMemoryRegion;
+
+/*
+Records staging commands (buffer copies, image layout transitions etc.) into a ring of command buffers.
+Each command buffer is submitted with its own fence when the batch is flushed, so resource creation does not block the CPU.
+Staging buffers that are still referenced by a pending batch are released once the GPU has finished that batch.
+*/
+class VKUploadBatcher
+{
+
+    public:
+
+        VKUploadBatcher(
+            const VKPtr<VkDevice>&                  device,
+            VkQueue                                 graphicsQueue,
+            std::uint32_t                           queueFamilyIndex,
+            VKDeviceMemoryManager&                  deviceMemoryMngr,
+            const VkPhysicalDeviceMemoryProperties& memoryProperties,
+            VkDeviceSize                            ringBufferSize      = 0,
+            std::uint32_t                           numCommandBuffers   = 4,
+            VkDeviceSize                            maxPendingSize      = 64*1024*1024
+        );
+
+        ~VKUploadBatcher();
+
+        VKUploadBatcher(const VKUploadBatcher&) = delete;
+        VKUploadBatcher& operator = (const VKUploadBatcher&) = delete;
+
+        // Returns the command buffer of the current batch and begins recording if necessary.
+        VkCommandBuffer GetCommandBuffer();
+
+        // Releases the specified staging buffer once the current batch has been executed by the GPU.
+        void ReleaseAfterBatch(VKBufferWithRequirements&& buffer, VKDeviceMemoryRegion* memoryRegion);
+
+        /*
+        Copies the specified data into the staging ring buffer for the current batch.
+        Returns false if there is no ring buffer or the data is larger than the entire ring buffer,
+        in which case the caller is expected to fall back to a temporary staging buffer.
+        If the ring buffer is full, the current batch is submitted and the oldest batch is waited for.
+        */
+        bool WriteStaging(const void* data, VkDeviceSize dataSize, VkBuffer& stagingBuffer, VkDeviceSize& stagingOffset);
+
+        // Submits the current batch (if there is any) without waiting for its completion.
+        void Flush();
+
+        // Submits the current batch and waits until all pending batches have been executed by the GPU.
+        void Wait();
+
+        // Waits until the specified batch has been executed by the GPU (submits it first if it is still recording).
+        void WaitForBatch(std::uint64_t batchID);
+
+        // Returns true if the specified batch has been executed by the GPU (without waiting).
+        bool IsBatchComplete(std::uint64_t batchID) const;
+
+        // Returns the ID of the batch that is currently being recorded.
+        inline std::uint64_t GetCurrentBatchID() const
+        {
+            return currentBatchID_;
+        }
+
+        // Returns true if there are batches that have been recorded but not yet executed.
+        inline bool HasPendingBatches() const
+        {
+            return (numPendingBatches_ > 0);
+        }
+
+        // Returns the staging ring buffer, or null if it is disabled.
+        inline const VKStagingRingBuffer* GetRingBuffer() const
+        {
+            return ringBuffer_.get();
+        }
+
+        // Returns the accumulated statistics of the staging ring buffer (see WriteStaging).
+        inline const StagingStatistics& GetStagingStatistics() const
+        {
+            return stagingStats_;
+        }
+
+    private:
+
+        struct StagingRelease
+        {
+            VKBufferWithRequirements    buffer;
+            VKDeviceMemoryRegion*       memoryRegion;
+        };
+
+        struct Batch
+        {
+            Batch(const VKPtr<VkDevice>& device);
+
+            VkCommandBuffer             commandBuffer   = VK_NULL_HANDLE;
+            VKPtr<VkFence>              fence;
+            std::vector<StagingRelease> releases;
+            std::uint64_t               batchID         = 0;
+            bool                        recording       = false;
+            bool                        submitted       = false;
+        };
+
+        void CreateCommandPool(std::uint32_t queueFamilyIndex);
+        void CreateBatches(std::uint32_t numCommandBuffers);
+
+        // Waits for the specified batch to complete and releases its staging buffers.
+        void RetireBatch(Batch& batch);
+
+        const VKPtr<VkDevice>&               device_;
+        VkQueue                              graphicsQueue_      = VK_NULL_HANDLE;
+        VKDeviceMemoryManager&               deviceMemoryMngr_;
+
+        VKPtr<VkCommandPool>                 commandPool_;
+        std::vector<std::unique_ptr<Batch>>  batches_;
+        std::size_t                          currentBatch_       = 0;
+        std::uint64_t                        currentBatchID_     = 1;
+        std::size_t                          numPendingBatches_  = 0;
+
+        VkDeviceSize                         pendingSize_        = 0;
+        VkDeviceSize                         maxPendingSize_     = 0;
+
+        std::unique_ptr<VKStagingRingBuffer> ringBuffer_;
+        StagingStatistics                    stagingStats_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
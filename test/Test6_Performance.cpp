@@ -10,6 +10,7 @@
 #include <vector>
 #include <functional>
 #include <iostream>
+#include <chrono>
 
 
 static unsigned int g_seed;
@@ -48,10 +49,16 @@ LLGL::ColorRGBAub RandColorRGBA()
 
 struct TestConfig
 {
-    std::size_t     numTextures = 10;
-    std::uint32_t   textureSize = 512;
-    std::uint32_t   arrayLayers = 32;
-    std::uint32_t   numMipMaps  = 5;
+    std::size_t     numTextures             = 10;
+    std::uint32_t   textureSize             = 512;
+    std::uint32_t   arrayLayers             = 32;
+    std::uint32_t   numMipMaps              = 5;
+
+    std::uint64_t   streamBufferSize        = 256;  // Size of each streamed buffer update (e.g. per-draw constants)
+    std::uint32_t   streamFrames            = 1000;
+    std::uint32_t   streamUpdatesPerFrame   = 100;
+
+    std::size_t     numLifetimeObjects      = 100000;   // Number of buffers and textures that are created and released at once
 };
 
 class PerformanceTest
@@ -61,6 +68,7 @@ class PerformanceTest
 
         std::unique_ptr<LLGL::RenderSystem> renderer;
         LLGL::RenderContext*                context     = nullptr;
+        LLGL::CommandQueue*                 queue       = nullptr;
         LLGL::CommandBuffer*                commands    = nullptr;
 
         LLGL::Query*                        timerQuery  = nullptr;
@@ -130,6 +138,70 @@ class PerformanceTest
             }
         }
 
+        // Measures the CPU time of streaming buffer updates with the specified buffer flags, including the time until the GPU is idle.
+        void MeasureBufferStreaming(const std::string& title, long bufferFlags)
+        {
+            // Create buffer for all updates of one frame
+            LLGL::BufferDescriptor bufferDesc;
+            {
+                bufferDesc.type     = LLGL::BufferType::Constant;
+                bufferDesc.size     = config.streamBufferSize * config.streamUpdatesPerFrame;
+                bufferDesc.flags    = bufferFlags;
+            }
+            auto buffer = renderer->CreateBuffer(bufferDesc);
+
+            std::vector<char> data(static_cast<std::size_t>(config.streamBufferSize));
+
+            // Update each range of the buffer once per frame
+            auto startTime = std::chrono::high_resolution_clock::now();
+
+            for (std::uint32_t frame = 0; frame < config.streamFrames; ++frame)
+            {
+                for (std::uint32_t i = 0; i < config.streamUpdatesPerFrame; ++i)
+                {
+                    data[0] = static_cast<char>(frame + i);
+                    renderer->WriteBuffer(*buffer, data.data(), data.size(), static_cast<std::size_t>(i * config.streamBufferSize));
+                }
+            }
+
+            queue->WaitIdle();
+
+            auto endTime = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+
+            // Print result
+            std::cout << title << std::endl;
+            std::cout << "\tduration: " << duration << "us (" << (static_cast<double>(duration) / 1000.0) << "ms)" << "\n\n";
+
+            renderer->Release(*buffer);
+        }
+
+        // Measures the CPU time of creating and releasing many objects, which must scale linearly with the number of objects.
+        void MeasureObjectLifetime(const std::string& title, const std::function<void*()>& create, const std::function<void(void*)>& release)
+        {
+            std::vector<void*> objects(config.numLifetimeObjects);
+
+            auto startTime = std::chrono::high_resolution_clock::now();
+
+            for (auto& obj : objects)
+                obj = create();
+
+            auto midTime = std::chrono::high_resolution_clock::now();
+
+            for (auto obj : objects)
+                release(obj);
+
+            auto endTime = std::chrono::high_resolution_clock::now();
+
+            auto durationCreate     = std::chrono::duration_cast<std::chrono::microseconds>(midTime - startTime).count();
+            auto durationRelease    = std::chrono::duration_cast<std::chrono::microseconds>(endTime - midTime).count();
+
+            // Print result
+            std::cout << title << std::endl;
+            std::cout << "\tcreate:  " << durationCreate << "us (" << (static_cast<double>(durationCreate) / 1000.0) << "ms)" << std::endl;
+            std::cout << "\trelease: " << durationRelease << "us (" << (static_cast<double>(durationRelease) / 1000.0) << "ms)" << "\n\n";
+        }
+
         void TestMIPMapGeneration()
         {
             for (std::size_t i = 0; i < config.numTextures; ++i)
@@ -163,7 +235,8 @@ class PerformanceTest
             }
             context = renderer->CreateRenderContext(contextDesc);
 
-            // Create command buffer
+            // Get command queue and create command buffer
+            queue = renderer->GetCommandQueue();
             commands = renderer->CreateCommandBuffer();
 
             // Create timer query
@@ -190,6 +263,38 @@ class PerformanceTest
                 std::bind(&PerformanceTest::TestSubMIPMapGeneration, this)
             );
 
+            const auto streamInfo =
+            (
+                std::to_string(config.streamFrames) + " frames with " + std::to_string(config.streamUpdatesPerFrame) +
+                " buffer updates of " + std::to_string(config.streamBufferSize) + " bytes"
+            );
+
+            MeasureBufferStreaming("Buffer streaming with DynamicUsage flag over " + streamInfo, LLGL::BufferFlags::DynamicUsage);
+            MeasureBufferStreaming("Buffer streaming with StreamingUsage flag over " + streamInfo, LLGL::BufferFlags::StreamingUsage);
+
+            LLGL::BufferDescriptor bufferDesc;
+            {
+                bufferDesc.type = LLGL::BufferType::Constant;
+                bufferDesc.size = 16;
+            }
+            MeasureObjectLifetime(
+                "Create and release " + std::to_string(config.numLifetimeObjects) + " buffers",
+                [&]() -> void* { return renderer->CreateBuffer(bufferDesc); },
+                [&](void* obj) { renderer->Release(*reinterpret_cast<LLGL::Buffer*>(obj)); }
+            );
+
+            LLGL::TextureDescriptor textureDesc;
+            {
+                textureDesc.type    = LLGL::TextureType::Texture2D;
+                textureDesc.format  = LLGL::Format::RGBA8UNorm;
+                textureDesc.extent  = { 4, 4, 1 };
+            }
+            MeasureObjectLifetime(
+                "Create and release " + std::to_string(config.numLifetimeObjects) + " textures",
+                [&]() -> void* { return renderer->CreateTexture(textureDesc); },
+                [&](void* obj) { renderer->Release(*reinterpret_cast<LLGL::Texture*>(obj)); }
+            );
+
             //context->Present();
         }
 
@@ -199,6 +304,10 @@ int main(int argc, char* argv[])
 {
     std::string rendererModule = "OpenGL";
 
+    // Renderer module can be specified as first argument (e.g. "Null" to measure the CPU overhead only)
+    if (argc > 1)
+        rendererModule = argv[1];
+
     TestConfig testConfig;
     testConfig.numTextures  = 2;
     testConfig.textureSize  = 512;
@@ -7,6 +7,12 @@
 
 #include <LLGL/Image.h>
 #include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <cstring>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
@@ -108,6 +114,245 @@ void Test_Resize()
     SaveImagePNG(img1, "Output/img1-resize-smaller.png");
 }
 
+// Reference conversion of a single component, equivalent to the generic double round-trip of ConvertImageBuffer.
+static void ConvertReferenceComponent(LLGL::DataType srcDataType, const void* src, LLGL::DataType dstDataType, void* dst)
+{
+    if (srcDataType == dstDataType)
+    {
+        std::memcpy(dst, src, LLGL::DataTypeSize(srcDataType));
+        return;
+    }
+
+    /* Read normalized value */
+    double value = 0.0;
+    switch (srcDataType)
+    {
+        case LLGL::DataType::UInt8:     value = static_cast<double>(*reinterpret_cast<const std::uint8_t*>(src)) / 255.0;    break;
+        case LLGL::DataType::UInt16:    value = static_cast<double>(*reinterpret_cast<const std::uint16_t*>(src)) / 65535.0; break;
+        case LLGL::DataType::Float32:   value = static_cast<double>(*reinterpret_cast<const float*>(src));                   break;
+        default:                        break;
+    }
+
+    /* Write saturated value */
+    auto saturated = (value > 0.0 ? (value < 1.0 ? value : 1.0) : 0.0);
+    switch (dstDataType)
+    {
+        case LLGL::DataType::UInt8:     *reinterpret_cast<std::uint8_t*>(dst) = static_cast<std::uint8_t>(saturated * 255.0);      break;
+        case LLGL::DataType::UInt16:    *reinterpret_cast<std::uint16_t*>(dst) = static_cast<std::uint16_t>(saturated * 65535.0); break;
+        case LLGL::DataType::Float32:   *reinterpret_cast<float*>(dst) = static_cast<float>(value);                               break;
+        default:                        break;
+    }
+}
+
+// Returns the index of the specified color component (0 = red, 1 = green, 2 = blue, 3 = alpha) within a pixel, or -1 if the format has no such component.
+static int GetComponentIndex(LLGL::ImageFormat format, int component)
+{
+    static const int mapRGBA[] = { 0, 1, 2, 3 };
+    static const int mapBGRA[] = { 2, 1, 0, 3 };
+    switch (format)
+    {
+        case LLGL::ImageFormat::RGB:    return (component < 3 ? mapRGBA[component] : -1);
+        case LLGL::ImageFormat::BGR:    return (component < 3 ? mapBGRA[component] : -1);
+        case LLGL::ImageFormat::RGBA:   return mapRGBA[component];
+        case LLGL::ImageFormat::BGRA:   return mapBGRA[component];
+        default:                        return -1;
+    }
+}
+
+// Compares the results of ConvertImageBuffer (including all specialized and vectorized kernels) against a scalar reference implementation.
+void Test_ConvertBitExact()
+{
+    const LLGL::ImageFormat formats[] = { LLGL::ImageFormat::RGB, LLGL::ImageFormat::BGR, LLGL::ImageFormat::RGBA, LLGL::ImageFormat::BGRA };
+    const LLGL::DataType dataTypes[] = { LLGL::DataType::UInt8, LLGL::DataType::UInt16, LLGL::DataType::Float32 };
+    const std::size_t numPixelsList[] = { 1, 7, 61, 1000, 4099 };
+    const std::size_t threadCounts[] = { 0, 3 };
+
+    std::size_t numTests = 0, numFailures = 0;
+
+    for (auto srcFormat : formats)
+    for (auto srcDataType : dataTypes)
+    for (auto dstFormat : formats)
+    for (auto dstDataType : dataTypes)
+    for (auto numPixels : numPixelsList)
+    {
+        auto srcPixelSize = LLGL::ImageFormatSize(srcFormat) * LLGL::DataTypeSize(srcDataType);
+        auto dstPixelSize = LLGL::ImageFormatSize(dstFormat) * LLGL::DataTypeSize(dstDataType);
+
+        /* Generate source image with random content (floats also outside of [0, 1] and NaN) */
+        std::vector<std::uint8_t> srcData(numPixels * srcPixelSize);
+
+        if (srcDataType == LLGL::DataType::Float32)
+        {
+            auto srcFloats = reinterpret_cast<float*>(srcData.data());
+            for (std::size_t i = 0, n = srcData.size() / sizeof(float); i < n; ++i)
+                srcFloats[i] = (i % 97 == 0 ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>(rand() % 1201 - 100) / 1000.0f);
+        }
+        else
+        {
+            for (auto& byte : srcData)
+                byte = static_cast<std::uint8_t>(rand());
+        }
+
+        /* Generate reference image */
+        std::vector<std::uint8_t> refData(numPixels * dstPixelSize);
+
+        for (std::size_t i = 0; i < numPixels; ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                auto dstIdx = GetComponentIndex(dstFormat, c);
+                if (dstIdx < 0)
+                    continue;
+
+                auto dst    = &refData[i * dstPixelSize + dstIdx * LLGL::DataTypeSize(dstDataType)];
+                auto srcIdx = GetComponentIndex(srcFormat, c);
+
+                if (srcIdx >= 0)
+                    ConvertReferenceComponent(srcDataType, &srcData[i * srcPixelSize + srcIdx * LLGL::DataTypeSize(srcDataType)], dstDataType, dst);
+                else
+                {
+                    /* Insert default alpha component */
+                    const float one = 1.0f;
+                    ConvertReferenceComponent(LLGL::DataType::Float32, &one, dstDataType, dst);
+                }
+            }
+        }
+
+        /* Compare with converted image */
+        for (auto threadCount : threadCounts)
+        {
+            LLGL::SrcImageDescriptor srcDesc { srcFormat, srcDataType, srcData.data(), srcData.size() };
+
+            if (auto dstData = LLGL::ConvertImageBuffer(srcDesc, dstFormat, dstDataType, threadCount))
+            {
+                ++numTests;
+                if (std::memcmp(dstData.get(), refData.data(), refData.size()) != 0)
+                {
+                    ++numFailures;
+                    std::cerr
+                        << "conversion mismatch: format " << static_cast<int>(srcFormat) << " -> " << static_cast<int>(dstFormat)
+                        << ", data type " << static_cast<int>(srcDataType) << " -> " << static_cast<int>(dstDataType)
+                        << ", " << numPixels << " pixels, " << threadCount << " threads" << std::endl;
+                }
+            }
+        }
+    }
+
+    std::cout << "image conversion tests: " << (numTests - numFailures) << " of " << numTests << " passed" << std::endl;
+}
+
+// Converts the image through Float64 intermediate images, which are only handled by the generic conversion, so the result serves as scalar reference.
+static LLGL::ByteBuffer ConvertImageGeneric(const LLGL::SrcImageDescriptor& srcDesc, LLGL::ImageFormat dstFormat, LLGL::DataType dstDataType)
+{
+    const auto numPixels = srcDesc.dataSize / (LLGL::ImageFormatSize(srcDesc.format) * LLGL::DataTypeSize(srcDesc.dataType));
+
+    LLGL::ByteBuffer buffer;
+    LLGL::SrcImageDescriptor desc = srcDesc;
+
+    auto convert = [&](LLGL::ImageFormat format, LLGL::DataType dataType)
+    {
+        if (auto result = LLGL::ConvertImageBuffer(desc, format, dataType))
+        {
+            desc    = { format, dataType, result.get(), numPixels * LLGL::ImageFormatSize(format) * LLGL::DataTypeSize(dataType) };
+            buffer  = std::move(result);
+        }
+    };
+
+    convert(srcDesc.format, LLGL::DataType::Float64);
+    convert(dstFormat, LLGL::DataType::Float64);
+    convert(dstFormat, dstDataType);
+
+    return buffer;
+}
+
+// Measures the conversion of a 4K image with the specialized and vectorized kernels and compares the results against the generic conversion.
+void Test_ConvertPerformance()
+{
+    struct ConversionCase
+    {
+        LLGL::ImageFormat   srcFormat;
+        LLGL::DataType      srcDataType;
+        LLGL::ImageFormat   dstFormat;
+        LLGL::DataType      dstDataType;
+        const char*         name;
+    };
+
+    const ConversionCase cases[] =
+    {
+        { LLGL::ImageFormat::RGB,  LLGL::DataType::UInt8,   LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8,   "RGB/UInt8    -> RGBA/UInt8   " },
+        { LLGL::ImageFormat::BGRA, LLGL::DataType::UInt8,   LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8,   "BGRA/UInt8   -> RGBA/UInt8   " },
+        { LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8,   LLGL::ImageFormat::RGBA, LLGL::DataType::Float32, "RGBA/UInt8   -> RGBA/Float32 " },
+        { LLGL::ImageFormat::RGBA, LLGL::DataType::Float32, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8,   "RGBA/Float32 -> RGBA/UInt8   " },
+        { LLGL::ImageFormat::RGBA, LLGL::DataType::Float32, LLGL::ImageFormat::RGBA, LLGL::DataType::Float16, "RGBA/Float32 -> RGBA/Float16 " },
+        { LLGL::ImageFormat::RGB,  LLGL::DataType::UInt8,   LLGL::ImageFormat::RGBA, LLGL::DataType::Float16, "RGB/UInt8    -> RGBA/Float16 " },
+        { LLGL::ImageFormat::RG,   LLGL::DataType::Int16,   LLGL::ImageFormat::RGBA, LLGL::DataType::Float64, "RG/Int16     -> RGBA/Float64 " }, // generic path
+    };
+
+    const std::size_t width = 3840, height = 2160;
+    const std::size_t numPixels = width * height;
+    const std::size_t numSlicePixels = width * 64;
+    const int numIterations = 10;
+
+    for (const auto& c : cases)
+    {
+        auto srcPixelSize = LLGL::ImageFormatSize(c.srcFormat) * LLGL::DataTypeSize(c.srcDataType);
+        auto dstPixelSize = LLGL::ImageFormatSize(c.dstFormat) * LLGL::DataTypeSize(c.dstDataType);
+
+        /* Generate source image with random content */
+        std::vector<std::uint8_t> srcData(numPixels * srcPixelSize);
+
+        if (c.srcDataType == LLGL::DataType::Float32)
+        {
+            auto srcFloats = reinterpret_cast<float*>(srcData.data());
+            for (std::size_t i = 0, n = srcData.size() / sizeof(float); i < n; ++i)
+                srcFloats[i] = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+        }
+        else
+        {
+            for (auto& byte : srcData)
+                byte = static_cast<std::uint8_t>(rand());
+        }
+
+        LLGL::SrcImageDescriptor srcDesc { c.srcFormat, c.srcDataType, srcData.data(), srcData.size() };
+
+        /* Measure conversion time */
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        LLGL::ByteBuffer dstData;
+        for (int i = 0; i < numIterations; ++i)
+            dstData = LLGL::ConvertImageBuffer(srcDesc, c.dstFormat, c.dstDataType);
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration<double, std::milli>(endTime - startTime).count() / numIterations;
+
+        /* Compare with generic conversion byte for byte (in slices to limit the size of the intermediate images) */
+        std::size_t numMismatches = 0;
+
+        for (std::size_t offset = 0; offset < numPixels; offset += numSlicePixels)
+        {
+            auto sliceNumPixels = std::min(numSlicePixels, numPixels - offset);
+
+            LLGL::SrcImageDescriptor sliceDesc { c.srcFormat, c.srcDataType, srcData.data() + offset * srcPixelSize, sliceNumPixels * srcPixelSize };
+            auto refData = ConvertImageGeneric(sliceDesc, c.dstFormat, c.dstDataType);
+
+            auto dst = dstData.get() + offset * dstPixelSize;
+            auto ref = refData.get();
+
+            for (std::size_t i = 0, n = sliceNumPixels * dstPixelSize; i < n; ++i)
+            {
+                if (dst[i] != ref[i])
+                    ++numMismatches;
+            }
+        }
+
+        std::cout << c.name << ": " << duration << " ms (" << numPixels << " pixels), ";
+        if (numMismatches == 0)
+            std::cout << "bit-exact" << std::endl;
+        else
+            std::cout << numMismatches << " mismatching bytes" << std::endl;
+    }
+}
+
 int main(int argc, char* argv[])
 {
     try
@@ -115,6 +360,8 @@ int main(int argc, char* argv[])
         //Test_PixelOperations();
         //Test_Blit();
         Test_Resize();
+        //Test_ConvertBitExact();
+        //Test_ConvertPerformance();
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,78 @@
+/*
+ * main.cpp (llgl-replay)
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <limits>
+
+
+/*
+Replays a trace file, which has been captured with 'RenderSystemDescriptor::captureFilename',
+and prints the CPU time and number of commands of each frame.
+*/
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "usage: llgl-replay <module> <trace>" << std::endl;
+        std::cerr << "  e.g. llgl-replay OpenGL frames.llgltrace" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        auto renderer = LLGL::RenderSystem::Load(argv[1]);
+
+        std::cout << "replay \"" << argv[2] << "\" with renderer: " << renderer->GetName() << std::endl;
+
+        double totalTime = 0.0, minTime = std::numeric_limits<double>::max(), maxTime = 0.0;
+        std::uint64_t numFrames = 0;
+
+        {
+            LLGL::TraceReplayer replayer(*renderer, argv[2]);
+            LLGL::TraceFrameStatistics stats;
+
+            while (replayer.ReplayFrame(&stats))
+            {
+                auto time = stats.CPUTimeMs();
+
+                std::cout << "frame " << std::setw(6) << stats.frameIndex;
+                std::cout << ": " << std::fixed << std::setprecision(3) << std::setw(9) << time << " ms";
+                std::cout << ", " << std::setw(7) << stats.numCommands << " commands";
+                std::cout << ", " << std::setw(7) << stats.numRecords << " records" << std::endl;
+
+                totalTime += time;
+                minTime = std::min(minTime, time);
+                maxTime = std::max(maxTime, time);
+                ++numFrames;
+            }
+        }
+
+        if (numFrames > 0)
+        {
+            std::cout << "frames: " << numFrames;
+            std::cout << ", average: " << std::fixed << std::setprecision(3) << (totalTime / static_cast<double>(numFrames)) << " ms";
+            std::cout << ", min: " << minTime << " ms";
+            std::cout << ", max: " << maxTime << " ms" << std::endl;
+        }
+        else
+            std::cout << "trace contains no frames" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+
+
+// ================================================================================